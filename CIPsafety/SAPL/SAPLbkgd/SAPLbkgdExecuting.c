@@ -105,8 +105,9 @@ STATIC void BkgdTaskRxTcooFrameProcess(void);
 ***************************************************************************************************/
 void SAPL_BkgdTaskExecuting(void)
 {
-  /* This background task is called once within T-cyc:asm (4ms). This means the CSS API
-  ** is triggered as fast to achieve RPI of 4ms (see [SRS_2146], [SRS_2134], [SRS_2135]).
+  /* This background task is called once within T-cyc:asm (GLOBDEF_CYCLE_TIME_US). This means
+  ** the CSS API is triggered as fast to achieve RPI of T-cyc (see [SRS_2146], [SRS_2134],
+  ** [SRS_2135]).
   */
 
   /* set current system time of CSS and handle reset of the fault counters */
@@ -81,8 +81,8 @@
 ***************************************************************************************************/
 void SAPL_BkgdTaskIdle(void)
 {
-  /* This background task is called once within T-cyc:asm (4ms). This means the CSS API
-  ** is triggered as fast to achieve RPI of 4ms (see [SRS_2146], [SRS_2130]).
+  /* This background task is called once within T-cyc:asm (GLOBDEF_CYCLE_TIME_US). This means
+  ** the CSS API is triggered as fast to achieve RPI of T-cyc (see [SRS_2146], [SRS_2130]).
   ** Attention: No processing of IO Data Messages and Time Coordination Messages from
   ** SPDU is done here, means no cyclic CIP Safety communication possible (see [SRS_2047]).
   */
@@ -32,6 +32,7 @@
 #include "xdefs.h"
 
 /* Module header */
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 #include "timer-def.h"
@@ -41,6 +42,7 @@
 
 #include "SAPLbkgdMain.h"
 #include "SAPLbkgdInt.h"
+#include "SAPLbkgdStat.h"
 
 /***************************************************************************************************
 **    global variables
@@ -60,7 +62,7 @@
 ** It is expected that all IRQ functionality is finished within T-cyc;asm +/-10% and so the 
 ** background task is activated at least after that time.
 */
-#define k_BKGD_ACTIVITY_TIMEOUT_US    ((UINT32)4400U) /* 4.4ms */
+#define k_BKGD_ACTIVITY_TIMEOUT_US    ((UINT32)GLOBDEF_CYCLE_TIME_MAX_US) /* 4.4ms at 4ms */
 
 
 /* e_BkgdTaskActivateSema:
@@ -111,6 +113,8 @@ void SAPL_BkgdTaskTrigger(void)
   /* else: everything fine */
   else
   {
+    /* store time slice of the trigger for the statistic */
+    SAPL_BkgdStatTrigger();
     /* set semaphore */
     e_BkgdTaskActivateSema = eTRUE;
   }
@@ -147,7 +151,8 @@ void SAPL_BkgdTaskCheck(void)
   /* else: background task finished */
   else
   {
-    /* empty branch */
+    /* store time slice of the deadline for the statistic */
+    SAPL_BkgdStatCheck();
   }
 }
 
@@ -188,7 +193,7 @@ void SAPL_BkgdTaskExec(void)
   u32_startTimeout = timerHAL_GetSystemTime3();
   __enable_irq();
   
-  /* while loop: wait until a new cycle (4ms) is triggered by IRQ Scheduler via 
+  /* while loop: wait until a new cycle (T-cyc) is triggered by IRQ Scheduler via 
   ** SAPL_BkgdTaskTrigger() */
   /* read access to 'e_BkgdTaskActivateSema' is considered as 'atomic'. */
   while (e_BkgdTaskActivateSema != eTRUE)
@@ -220,6 +225,9 @@ void SAPL_BkgdTaskExec(void)
   /* read current AIC state used for Background Task, variable is accessed by IRQ Scheduler Task 
   ** but read access is considered as 'atomic' here */
   e_aicState = aicSm_eAicState;
+
+  /* start of the background cycle for the statistic */
+  SAPL_BkgdStatStart();
       
   /* background task depends on AIC state */
   switch (e_aicState)
@@ -288,6 +296,9 @@ void SAPL_BkgdTaskExec(void)
     }
   }
   
+  /* add the finished background cycle to the statistic */
+  SAPL_BkgdStatFinish(e_aicState);
+
   /* write access to 'e_BkgdTaskActivateSema' is considered as 'atomic'. */
   e_BkgdTaskActivateSema = eFALSE;
   
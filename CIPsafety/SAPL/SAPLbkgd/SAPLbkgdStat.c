@@ -0,0 +1,622 @@
+/***************************************************************************************************
+**    Copyright (C) 2015-2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: SAPLbkgdStat.c
+**     Summary: This module records the timing of the Background Task relative to the time slices
+**              of the IRQ Scheduler: start and finish time slice and duration of every background
+**              cycle as histograms per class of AIC states. The statistic shows the processing
+**              headroom of the CIP Safety stack and is read via the Diagnostic Object.
+**   $Revision: $
+**       $Date: $
+**      Author: KlAn
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: SAPL_BkgdStatTrigger
+**             SAPL_BkgdStatCheck
+**             SAPL_BkgdStatStart
+**             SAPL_BkgdStatFinish
+**             SAPL_BkgdStatReset
+**             SAPL_BkgdStatSummaryGet
+**             SAPL_BkgdStatHistGet
+**
+**             ClassGet
+**
+**    History: -
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Project header */
+#include "xtypes.h"
+#include "xdefs.h"
+
+/* Module header */
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+#include "timer-def.h"
+#include "timer-hal.h"
+#include "hist-sys.h"
+
+#include "aicSm.h"
+#include "sch_Scheduler-app.h"
+
+#include "SAPLbkgdStat.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Unique file id used to build additional info */
+#define k_FILEID      44u
+
+/* Number of buckets of the histograms */
+#define k_START_BUCKET_CNT      8u    /* start 0..7 time slices after the trigger */
+#define k_FINISH_BUCKET_CNT     32u   /* finish 0..31 time slices after the trigger */
+#define k_DUR_BUCKET_CNT        16u   /* duration */
+
+/* Duration covered by one bucket of the duration histogram (T-cyc / k_DUR_BUCKET_CNT) */
+#define k_DUR_BUCKET_US         (GLOBDEF_CYCLE_TIME_US / k_DUR_BUCKET_CNT)
+
+/* Time slices covered by a value of the "finished within" histogram */
+#define k_WITHIN_SLICES         (k_FINISH_BUCKET_CNT / SAPL_BKGD_STAT_HIST_MAX_LEN)
+
+/* Number of samples after which sum and number of samples of the mean duration are halved */
+#define k_MEAN_WINDOW           0x8000u
+
+/* Time slice not known yet */
+#define k_SLICE_UNKNOWN         0xFFu
+
+/** PRE-PROCESSOR CHECK **/
+/* The histograms must fit into the buffer of SAPL_BkgdStatHistGet(), the finish histogram is
+** read in two halves and covers the time slices of a scheduler cycle (max. SCHAPP_TIME_SLICE_MAX,
+** with fewer time slices the last buckets stay empty) */
+/*lint -e(948) */
+IXX_TASSERT((k_START_BUCKET_CNT <= SAPL_BKGD_STAT_HIST_MAX_LEN), bkgdStat_chk1)
+/*lint -e(948) */
+IXX_TASSERT((k_FINISH_BUCKET_CNT == (2u * SAPL_BKGD_STAT_HIST_MAX_LEN)), bkgdStat_chk2)
+/*lint -e(948) */
+IXX_TASSERT((k_DUR_BUCKET_CNT <= SAPL_BKGD_STAT_HIST_MAX_LEN), bkgdStat_chk3)
+/*lint -e(948) */
+IXX_TASSERT((k_FINISH_BUCKET_CNT < SCHAPP_TIME_SLICE_MAX), bkgdStat_chk4)
+/*lint -esym(751, IXX_DUMMY_bkgdStat_chk1, IXX_DUMMY_bkgdStat_chk2) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_bkgdStat_chk3, IXX_DUMMY_bkgdStat_chk4) not referenced - just for checks */
+
+/* t_CLASS_STAT:
+** Statistic of the background cycles of one class of AIC states. A histogram is halved if one of
+** its buckets reaches the maximum, so the distribution is kept for long measurements.
+*/
+typedef struct
+{
+  UINT32 u32_cnt;                                 /* number of background cycles */
+  UINT32 u32_durSum;                              /* sum of the durations */
+  UINT16 u16_durSumCnt;                           /* number of samples of u32_durSum */
+  UINT16 u16_durMax;                              /* longest duration */
+  UINT8  u8_finishMax;                            /* latest finish after the trigger */
+  UINT8  u8_headroomMin;                          /* least time slices left to the check */
+  UINT16 au16_start[k_START_BUCKET_CNT];          /* start, time slices after the trigger */
+  UINT16 au16_finish[k_FINISH_BUCKET_CNT];        /* finish, time slices after the trigger */
+  UINT16 au16_dur[k_DUR_BUCKET_CNT];              /* duration */
+} t_CLASS_STAT;
+
+/* as_ClassStat:
+** Statistic of all classes of AIC states
+*/
+STATIC t_CLASS_STAT as_ClassStat[SAPL_BKGD_STAT_CLASS_CNT];
+
+/* u8_TriggerSlice, u8_CheckSlice:
+** Time slices of SAPL_BkgdTaskTrigger() and SAPL_BkgdTaskCheck(), written by the IRQ Scheduler
+*/
+STATIC volatile UINT8 u8_TriggerSlice = k_SLICE_UNKNOWN;
+STATIC volatile UINT8 u8_CheckSlice = k_SLICE_UNKNOWN;
+
+/* u8_StartSlice, u32_StartTime:
+** Time slice and system time [us] of the start of the current background cycle
+*/
+STATIC UINT8 u8_StartSlice = k_SLICE_UNKNOWN;
+STATIC UINT32 u32_StartTime = 0u;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+
+STATIC UINT8 ClassGet(AICSM_STATE_ENUM e_aicState);
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatTrigger
+
+  Description:
+    This function stores the time slice in which the background task is triggered.
+
+  See also:
+    SAPL_BkgdTaskTrigger()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void SAPL_BkgdStatTrigger(void)
+{
+  u8_TriggerSlice = schAPP_TimeSliceGet();
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatCheck
+
+  Description:
+    This function stores the time slice in which the background task is checked (deadline).
+
+  See also:
+    SAPL_BkgdTaskCheck()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void SAPL_BkgdStatCheck(void)
+{
+  u8_CheckSlice = schAPP_TimeSliceGet();
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatStart
+
+  Description:
+    This function stores the start time and time slice of the background task. Called from main
+    the scheduler returns the time slice following the current one.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatStart(void)
+{
+  __disable_irq();
+  u32_StartTime = timerHAL_GetSystemTime3();
+  __enable_irq();
+
+  u8_StartSlice = (UINT8)((schAPP_TimeSliceGet() + (SCHAPP_TIME_SLICE_CNT - 1u))
+                          % SCHAPP_TIME_SLICE_CNT);
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatFinish
+
+  Description:
+    This function adds the start and finish time slice and the duration of the finished
+    background cycle to the statistic of the class of the AIC state. The time slices are counted
+    from the time slice of the trigger, the headroom is the number of complete time slices
+    between the finish and the deadline check.
+
+  See also:
+    -
+
+  Parameters:
+    e_aicState (IN) - AIC state the background cycle was executed for
+                      (valid range: any, unknown states are counted as SAPL_BKGD_STAT_CLASS_OTHER)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatFinish(AICSM_STATE_ENUM e_aicState)
+{
+  t_CLASS_STAT *ps_stat = &as_ClassStat[ClassGet(e_aicState)];
+  UINT32 u32_dur;
+  UINT8 u8_finishSlice;
+  UINT8 u8_trigger = u8_TriggerSlice;
+  UINT8 u8_check = u8_CheckSlice;
+  UINT8 u8_ofs;
+  UINT8 u8_headroom;
+
+  __disable_irq();
+  u32_dur = timerHAL_GetSystemTime3() - u32_StartTime;
+  __enable_irq();
+
+  u8_finishSlice = (UINT8)((schAPP_TimeSliceGet() + (SCHAPP_TIME_SLICE_CNT - 1u))
+                           % SCHAPP_TIME_SLICE_CNT);
+
+  /* if trigger and start known (first cycle after power-up or reset of the statistic is done) */
+  if ((u8_trigger < SCHAPP_TIME_SLICE_CNT) && (u8_StartSlice < SCHAPP_TIME_SLICE_CNT))
+  {
+    if (ps_stat->u32_cnt < (UINT32)UINT32_MAX)
+    {
+      ps_stat->u32_cnt++;
+    }
+    else
+    {
+      /* empty branch, counter saturated */
+    }
+
+    /* start */
+    u8_ofs = (UINT8)(((u8_StartSlice + SCHAPP_TIME_SLICE_CNT) - u8_trigger)
+                     % SCHAPP_TIME_SLICE_CNT);
+    histSYS_Add(ps_stat->au16_start, (UINT8)k_START_BUCKET_CNT, (UINT32)u8_ofs);
+
+    /* finish */
+    u8_ofs = (UINT8)(((u8_finishSlice + SCHAPP_TIME_SLICE_CNT) - u8_trigger)
+                     % SCHAPP_TIME_SLICE_CNT);
+    histSYS_Add(ps_stat->au16_finish, (UINT8)k_FINISH_BUCKET_CNT, (UINT32)u8_ofs);
+    if (u8_ofs > ps_stat->u8_finishMax)
+    {
+      ps_stat->u8_finishMax = u8_ofs;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* headroom, only known after the first deadline check */
+    if (u8_check < SCHAPP_TIME_SLICE_CNT)
+    {
+      u8_headroom = (UINT8)(((u8_check + (2u * SCHAPP_TIME_SLICE_CNT)) - u8_finishSlice - 1u)
+                            % SCHAPP_TIME_SLICE_CNT);
+      if (u8_headroom < ps_stat->u8_headroomMin)
+      {
+        ps_stat->u8_headroomMin = u8_headroom;
+      }
+      else
+      {
+        /* empty branch */
+      }
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* duration */
+    if (u32_dur > (UINT32)UINT16_MAX)
+    {
+      u32_dur = (UINT32)UINT16_MAX;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    /* the bucket is limited by histSYS_Add() */
+    histSYS_Add(ps_stat->au16_dur, (UINT8)k_DUR_BUCKET_CNT, u32_dur / k_DUR_BUCKET_US);
+    if ((UINT16)u32_dur > ps_stat->u16_durMax)
+    {
+      ps_stat->u16_durMax = (UINT16)u32_dur;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* mean value over a sliding window */
+    if (ps_stat->u16_durSumCnt >= k_MEAN_WINDOW)
+    {
+      ps_stat->u32_durSum >>= 1u;
+      ps_stat->u16_durSumCnt >>= 1u;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    ps_stat->u32_durSum += u32_dur;
+    ps_stat->u16_durSumCnt++;
+  }
+  /* else: incomplete background cycle, not counted */
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatReset
+
+  Description:
+    This function clears the statistic of all classes. The background cycle running during the
+    reset is not counted.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatReset(void)
+{
+  t_CLASS_STAT *ps_stat;
+  UINT8 u8_class;
+  UINT8 u8_idx;
+
+  for (u8_class = 0u; u8_class < SAPL_BKGD_STAT_CLASS_CNT; u8_class++)
+  {
+    ps_stat = &as_ClassStat[u8_class];
+    ps_stat->u32_cnt = 0u;
+    ps_stat->u32_durSum = 0u;
+    ps_stat->u16_durSumCnt = 0u;
+    ps_stat->u16_durMax = 0u;
+    ps_stat->u8_finishMax = 0u;
+    ps_stat->u8_headroomMin = k_SLICE_UNKNOWN;
+    for (u8_idx = 0u; u8_idx < k_START_BUCKET_CNT; u8_idx++)
+    {
+      ps_stat->au16_start[u8_idx] = 0u;
+    }
+    for (u8_idx = 0u; u8_idx < k_FINISH_BUCKET_CNT; u8_idx++)
+    {
+      ps_stat->au16_finish[u8_idx] = 0u;
+    }
+    for (u8_idx = 0u; u8_idx < k_DUR_BUCKET_CNT; u8_idx++)
+    {
+      ps_stat->au16_dur[u8_idx] = 0u;
+    }
+  }
+
+  u8_StartSlice = k_SLICE_UNKNOWN;
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatSummaryGet
+
+  Description:
+    This function returns the summary of the statistic of a class of AIC states.
+
+  See also:
+    -
+
+  Parameters:
+    u8_class (IN)    - SAPL_BKGD_STAT_CLASS_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_CLASS_CNT-1, not checked, checked by caller)
+    ps_summary (OUT) - summary of the statistic
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatSummaryGet(UINT8 u8_class, t_SAPL_BKGD_STAT_SUMMARY *ps_summary)
+{
+  CONST t_CLASS_STAT *ps_stat = &as_ClassStat[u8_class];
+
+  ps_summary->u32_cnt = ps_stat->u32_cnt;
+  ps_summary->u16_durMax = ps_stat->u16_durMax;
+  /* no sample yet: report 0 */
+  if (ps_stat->u16_durSumCnt == 0u)
+  {
+    ps_summary->u16_durMean = 0u;
+  }
+  else
+  {
+    ps_summary->u16_durMean = (UINT16)(ps_stat->u32_durSum / ps_stat->u16_durSumCnt);
+  }
+  ps_summary->u8_finishMax = ps_stat->u8_finishMax;
+  ps_summary->u8_headroomMin = ps_stat->u8_headroomMin;
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatHistGet
+
+  Description:
+    This function copies a histogram of a class of AIC states. The "finished within" histogram
+    is calculated from the finish histogram: value n is the share of the background cycles
+    finished within 2 * (n + 1) time slices after the trigger in 1/1000.
+
+  See also:
+    -
+
+  Parameters:
+    u8_class (IN)    - SAPL_BKGD_STAT_CLASS_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_CLASS_CNT-1, not checked, checked by caller)
+    u8_hist (IN)     - SAPL_BKGD_STAT_HIST_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_HIST_CNT-1, not checked, checked by caller)
+    pau16_hist (OUT) - buffer for the histogram, at least SAPL_BKGD_STAT_HIST_MAX_LEN values
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    Number of values of the histogram
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+UINT8 SAPL_BkgdStatHistGet(UINT8 u8_class, UINT8 u8_hist, UINT16 *pau16_hist)
+{
+  CONST t_CLASS_STAT *ps_stat = &as_ClassStat[u8_class];
+  CONST UINT16 *pau16_src = ps_stat->au16_dur;
+  UINT8 u8_cnt = (UINT8)k_DUR_BUCKET_CNT;
+  UINT32 u32_total = 0u;
+  UINT32 u32_sum = 0u;
+  UINT8 u8_idx;
+
+  /*lint -esym(960, 17.4)*/
+  /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+   * other than array indexing used
+   * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
+  switch (u8_hist)
+  {
+    case SAPL_BKGD_STAT_HIST_START:
+    {
+      pau16_src = ps_stat->au16_start;
+      u8_cnt = (UINT8)k_START_BUCKET_CNT;
+      break;
+    }
+    case SAPL_BKGD_STAT_HIST_FINISH_LO:
+    {
+      pau16_src = &ps_stat->au16_finish[0u];
+      u8_cnt = (UINT8)SAPL_BKGD_STAT_HIST_MAX_LEN;
+      break;
+    }
+    case SAPL_BKGD_STAT_HIST_FINISH_HI:
+    {
+      pau16_src = &ps_stat->au16_finish[SAPL_BKGD_STAT_HIST_MAX_LEN];
+      u8_cnt = (UINT8)SAPL_BKGD_STAT_HIST_MAX_LEN;
+      break;
+    }
+    case SAPL_BKGD_STAT_HIST_WITHIN:
+    {
+      /* calculated below */
+      pau16_src = NULL_PNT;
+      u8_cnt = (UINT8)SAPL_BKGD_STAT_HIST_MAX_LEN;
+      break;
+    }
+    default:
+    {
+      /* SAPL_BKGD_STAT_HIST_DURATION, initial values */
+      break;
+    }
+  }
+
+  if (pau16_src != NULL_PNT)
+  {
+    for (u8_idx = 0u; u8_idx < u8_cnt; u8_idx++)
+    {
+      pau16_hist[u8_idx] = pau16_src[u8_idx];
+    }
+  }
+  /* else: share of the background cycles finished within the time slices */
+  else
+  {
+    for (u8_idx = 0u; u8_idx < k_FINISH_BUCKET_CNT; u8_idx++)
+    {
+      u32_total += ps_stat->au16_finish[u8_idx];
+    }
+    for (u8_idx = 0u; u8_idx < k_FINISH_BUCKET_CNT; u8_idx++)
+    {
+      u32_sum += ps_stat->au16_finish[u8_idx];
+      if (((u8_idx + 1u) % k_WITHIN_SLICES) == 0u)
+      {
+        pau16_hist[u8_idx / k_WITHIN_SLICES] =
+          (u32_total == 0u) ? 0u : (UINT16)((u32_sum * 1000u) / u32_total);
+      }
+      else
+      {
+        /* empty branch */
+      }
+    }
+  }
+  /*lint +esym(960, 17.4)*/
+
+  return u8_cnt;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    ClassGet
+
+  Description:
+    This function returns the class of an AIC state.
+
+  See also:
+    -
+
+  Parameters:
+    e_aicState (IN) - AIC state
+                      (valid range: any, unknown states are SAPL_BKGD_STAT_CLASS_OTHER)
+
+  Return value:
+    SAPL_BKGD_STAT_CLASS_xxx
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+STATIC UINT8 ClassGet(AICSM_STATE_ENUM e_aicState)
+{
+  UINT8 u8_class;
+
+  switch (e_aicState)
+  {
+    case AICSM_AIC_STARTUP:          /* fall through */
+    case AICSM_AIC_WAIT_FOR_INIT:    /* fall through */
+    case AICSM_AIC_START_CSS:
+    {
+      u8_class = SAPL_BKGD_STAT_CLASS_STARTUP;
+      break;
+    }
+    case AICSM_AIC_WAIT_FOR_CONFIG:  /* fall through */
+    case AICSM_AIC_PROCESS_CONFIG:   /* fall through */
+    case AICSM_AIC_INVALID_CONFIG:
+    {
+      u8_class = SAPL_BKGD_STAT_CLASS_CONFIG;
+      break;
+    }
+    case AICSM_AIC_IDLE:
+    {
+      u8_class = SAPL_BKGD_STAT_CLASS_IDLE;
+      break;
+    }
+    case AICSM_AIC_EXEC_PROD_ONLY:   /* fall through */
+    case AICSM_AIC_EXEC_CONS_ONLY:   /* fall through */
+    case AICSM_AIC_EXEC_PROD_CONS:
+    {
+      u8_class = SAPL_BKGD_STAT_CLASS_EXEC;
+      break;
+    }
+    default:
+    {
+      /* AICSM_AIC_WAIT_TUNID, AICSM_AIC_WAIT_RESET, AICSM_AIC_ABORT (an invalid state is
+      ** handled by SAPL_BkgdTaskExec()) */
+      u8_class = SAPL_BKGD_STAT_CLASS_OTHER;
+      break;
+    }
+  }
+
+  return u8_class;
+}
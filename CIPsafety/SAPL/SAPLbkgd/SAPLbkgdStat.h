@@ -0,0 +1,246 @@
+/***************************************************************************************************
+**    Copyright (C) 2015-2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: SAPLbkgdStat.h
+**     Summary: Header of module SAPLbkgdStat.c
+**   $Revision: $
+**       $Date: $
+**      Author: KlAn
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: SAPL_BkgdStatTrigger
+**             SAPL_BkgdStatCheck
+**             SAPL_BkgdStatStart
+**             SAPL_BkgdStatFinish
+**             SAPL_BkgdStatReset
+**             SAPL_BkgdStatSummaryGet
+**             SAPL_BkgdStatHistGet
+**
+**    History: -
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef SAPL_BKGD_STAT_H
+#define SAPL_BKGD_STAT_H
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Classes of AIC states, the statistic is kept separately for every class */
+#define SAPL_BKGD_STAT_CLASS_STARTUP    0u  /* AICSM_AIC_STARTUP, _WAIT_FOR_INIT, _START_CSS */
+#define SAPL_BKGD_STAT_CLASS_CONFIG     1u  /* AICSM_AIC_WAIT_FOR_CONFIG, _PROCESS_CONFIG,
+                                            ** _INVALID_CONFIG */
+#define SAPL_BKGD_STAT_CLASS_IDLE       2u  /* AICSM_AIC_IDLE */
+#define SAPL_BKGD_STAT_CLASS_EXEC       3u  /* AICSM_AIC_EXEC_PROD_ONLY, _CONS_ONLY, _PROD_CONS */
+#define SAPL_BKGD_STAT_CLASS_OTHER      4u  /* AICSM_AIC_WAIT_TUNID, _WAIT_RESET, _ABORT */
+#define SAPL_BKGD_STAT_CLASS_CNT        5u
+
+/* Histograms of a class, see SAPL_BkgdStatHistGet() */
+#define SAPL_BKGD_STAT_HIST_START       0u  /* start, time slices after the trigger */
+#define SAPL_BKGD_STAT_HIST_FINISH_LO   1u  /* finish, time slices 0..15 after the trigger */
+#define SAPL_BKGD_STAT_HIST_FINISH_HI   2u  /* finish, time slices 16..31 after the trigger */
+#define SAPL_BKGD_STAT_HIST_DURATION    3u  /* duration, buckets of T-cyc/16 */
+#define SAPL_BKGD_STAT_HIST_WITHIN      4u  /* finished within 2, 4, .. 32 time slices [1/1000] */
+#define SAPL_BKGD_STAT_HIST_CNT         5u
+
+/* Max. number of values of a histogram */
+#define SAPL_BKGD_STAT_HIST_MAX_LEN     16u
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/* t_SAPL_BKGD_STAT_SUMMARY:
+** Summary of the background task statistic of one class of AIC states
+*/
+typedef struct
+{
+  UINT32 u32_cnt;          /* number of background cycles */
+  UINT16 u16_durMax;       /* longest duration [us] */
+  UINT16 u16_durMean;      /* mean duration [us] */
+  UINT8  u8_finishMax;     /* latest finish, time slices after the trigger */
+  UINT8  u8_headroomMin;   /* least complete time slices between finish and deadline check
+                           ** (0xFF: no sample yet) */
+} t_SAPL_BKGD_STAT_SUMMARY;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatTrigger
+
+  Description:
+    This function stores the time slice in which the background task is triggered.
+
+  See also:
+    SAPL_BkgdTaskTrigger()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void SAPL_BkgdStatTrigger(void);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatCheck
+
+  Description:
+    This function stores the time slice in which the background task is checked (deadline).
+
+  See also:
+    SAPL_BkgdTaskCheck()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void SAPL_BkgdStatCheck(void);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatStart
+
+  Description:
+    This function stores the start time and time slice of the background task.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatStart(void);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatFinish
+
+  Description:
+    This function adds the start and finish time slice and the duration of the finished
+    background cycle to the statistic of the class of the AIC state.
+
+  See also:
+    -
+
+  Parameters:
+    e_aicState (IN) - AIC state the background cycle was executed for
+                      (valid range: any, unknown states are counted as SAPL_BKGD_STAT_CLASS_OTHER)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatFinish(AICSM_STATE_ENUM e_aicState);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatReset
+
+  Description:
+    This function clears the statistic of all classes.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatReset(void);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatSummaryGet
+
+  Description:
+    This function returns the summary of the statistic of a class of AIC states.
+
+  See also:
+    -
+
+  Parameters:
+    u8_class (IN)    - SAPL_BKGD_STAT_CLASS_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_CLASS_CNT-1, not checked, checked by caller)
+    ps_summary (OUT) - summary of the statistic
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+void SAPL_BkgdStatSummaryGet(UINT8 u8_class, t_SAPL_BKGD_STAT_SUMMARY *ps_summary);
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdStatHistGet
+
+  Description:
+    This function copies a histogram of a class of AIC states.
+
+  See also:
+    -
+
+  Parameters:
+    u8_class (IN)    - SAPL_BKGD_STAT_CLASS_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_CLASS_CNT-1, not checked, checked by caller)
+    u8_hist (IN)     - SAPL_BKGD_STAT_HIST_xxx
+                       (valid range: 0..SAPL_BKGD_STAT_HIST_CNT-1, not checked, checked by caller)
+    pau16_hist (OUT) - buffer for the histogram, at least SAPL_BKGD_STAT_HIST_MAX_LEN values
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    Number of values of the histogram
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+UINT8 SAPL_BkgdStatHistGet(UINT8 u8_class, UINT8 u8_hist, UINT16 *pau16_hist);
+
+#endif /* SAPL_BKGD_STAT_H */
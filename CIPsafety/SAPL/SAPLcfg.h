@@ -44,8 +44,9 @@
                                                   sizeof(UINT16) + \
                                                   sizeof(fiParam_sIParam))
 
-/* Min. Supported RPI for O_to_T RPI and T_to_O RPI (see [SRS_2147])*/ 
-#define SAPL_cfg_MIN_RPI_SUPPORTED    (CSS_t_UDINT)4000u /* in [us] */
+/* Min. Supported RPI for O_to_T RPI and T_to_O RPI (see [SRS_2147]), the safety data is
+** processed once per cycle of the IRQ scheduler */ 
+#define SAPL_cfg_MIN_RPI_SUPPORTED    (CSS_t_UDINT)GLOBDEF_CYCLE_TIME_US /* in [us] */
 
 
 /***************************************************************************************************
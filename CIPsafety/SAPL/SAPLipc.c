@@ -262,12 +262,17 @@ void SAPLipc_CheckNvCrc(void)
 ***************************************************************************************************/
 void SAPLipc_SendVar(void)
 {
+  t_IPC_VAR* ps_varTx;
+
+  /* reserve the IPC telegram in the Tx DMA buffer */
+  /* Cast from pointer to pointer is intended here because the data is written directly into the 
+  ** DMA buffer, t_IPC_VAR is packed (no alignment). */
+  ps_varTx = (t_IPC_VAR*)ipcxSYS_TxReserve(IPCXSYS_IPC_ID_CSS_CTRL_INFO, 
+                                           (UINT8)sizeof(t_IPC_VAR)); /*lint !e927 */
+  *ps_varTx = s_VarLocal;
+
   /* send data via IPC */
-  /* Cast from pointer to pointer is intended here because the underlying function directly writes
-  ** into the DMA buffer. */
-  ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_CSS_CTRL_INFO, 
-                     (UINT8)sizeof(s_VarLocal), 
-                     (UINT8*)&s_VarLocal); /*lint !e928*/
+  ipcxSYS_TxCommit();
 }
 
 /***************************************************************************************************
@@ -298,13 +303,16 @@ void SAPLipc_SendVar(void)
 ***************************************************************************************************/
 void SAPLipc_RecvAndCheckVar(void)
 {
-  
-  /* receive data via IPC */
-  /* Cast from pointer to pointer is intended here because the underlying function directly reads
-  ** from the DMA buffer. */
-  ipcxSYS_GetBufferinclWait(IPCXSYS_IPC_ID_CSS_CTRL_INFO, 
-                            (UINT8)sizeof(s_VarRemote), 
-                            (UINT8*)&s_VarRemote); /*lint !e928 */
+  CONST t_IPC_VAR* ps_varRx;
+
+  /* receive data via IPC, the IPC telegram is read once (consumed) */
+  /* Cast from pointer to pointer is intended here because the data is read directly from the 
+  ** DMA buffer, t_IPC_VAR is packed (no alignment). */
+  ps_varRx = (CONST t_IPC_VAR*)ipcxSYS_RxViewinclWait(IPCXSYS_IPC_ID_CSS_CTRL_INFO, 
+                                                      (UINT8)sizeof(t_IPC_VAR)); /*lint !e927 */
+
+  /* keep the data for SAPLipc_CheckNvCrc(), the DMA buffer is reused by the next IPC telegram */
+  s_VarRemote = *ps_varRx;
   
   /* FIT to manipulate the program flow counter*/
   /* RSM_IGNORE_QUALITY_BEGIN Notice #50 - Variable assignment to lit. number   */
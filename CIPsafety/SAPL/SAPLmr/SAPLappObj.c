@@ -32,6 +32,7 @@
 #include "xdefs.h"
 
 /* Module header */
+#include "globPreChk.h"
 #include "globDef_GlobalDefinitions.h"
 
 #include "tm_TemperatureMonitor-srv.h"
@@ -39,6 +40,22 @@
 #include "aicMsgDef.h"
 #include "aicMsgCfg.h"
 
+#include "sch_Scheduler-app.h"
+#include "aicSm.h"
+#include "SAPLbkgdStat.h"
+#include "globFail_Errorcodes.h"
+#include "ipcs_IpcSync-sys.h"
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+#ifdef SCH_PROFILER_ACTIVE
+  #include "schProf_Profiler-app.h"
+#endif
+
+#ifdef RFID_ACTIVE
+  #include "RFID.h"
+  #include "RFIDjournal.h"
+#endif
+
 /* CSOS common headers */
 #include "CSOScfg.h"
 #include "CSOSapi.h"
@@ -77,6 +94,61 @@
 #define k_DIAG_INST_ATTR_AVAILABLE_FLASH_BLKS        (UINT16)0x000A 
 /* Max. timeslice touched by background task */
 #define k_DIAG_INST_ATTR_MAX_TIMESLICE               (UINT16)0x0014 
+/* Task budget overruns of the scheduler */
+#define k_DIAG_INST_ATTR_SCH_OVERRUN                 (UINT16)0x0015
+/* Time waited for the other controller per scheduler cycle (IPC telegrams and sync) */
+#define k_DIAG_INST_ATTR_IPC_WAIT                    (UINT16)0x0016
+/* Histogram of the time waited in the IPC sync */
+#define k_DIAG_INST_ATTR_IPC_SYNC_HIST               (UINT16)0x0017
+/* IPC link statistic, one attribute per IPC ID */
+#define k_DIAG_INST_ATTR_IPC_LINK_FIRST              (UINT16)0x00A0
+#define k_DIAG_INST_ATTR_IPC_LINK_LAST               (UINT16)0x00AE
+/* Background task statistic, k_DIAG_BKGD_ATTR_PER_CLASS attributes per class of AIC states:
+** summary followed by the SAPL_BKGD_STAT_HIST_CNT histograms */
+#define k_DIAG_INST_ATTR_BKGD_FIRST                  (UINT16)0x0070
+#define k_DIAG_INST_ATTR_BKGD_LAST                   (UINT16)0x0095
+#define k_DIAG_BKGD_ATTR_PER_CLASS                   8u
+#ifdef SCH_PROFILER_ACTIVE
+/* Scheduler profiler, one attribute per time slice */
+#define k_DIAG_INST_ATTR_SCH_PROF_SLICE_FIRST        (UINT16)0x0040
+#define k_DIAG_INST_ATTR_SCH_PROF_SLICE_LAST         (UINT16)0x0067
+/* Scheduler profiler, longest task execution times, k_DIAG_SCH_PROF_TASKS_PER_ATTR tasks per
+** attribute, k_DIAG_SCH_PROF_ATTR_PER_MODE attributes per task table (startup, run mode) */
+#define k_DIAG_INST_ATTR_SCH_PROF_TASK_FIRST         (UINT16)0x0068
+#define k_DIAG_INST_ATTR_SCH_PROF_TASK_LAST          (UINT16)0x006D
+#define k_DIAG_SCH_PROF_TASKS_PER_ATTR               16u
+#define k_DIAG_SCH_PROF_ATTR_PER_MODE                3u
+#endif /* SCH_PROFILER_ACTIVE */
+#ifdef RFID_ACTIVE
+/* RFID latency histograms (one attribute per t_RFID_HIST) */
+#define k_DIAG_INST_ATTR_RFID_HIST_UID               (UINT16)0x0020
+#define k_DIAG_INST_ATTR_RFID_HIST_REC_EVEN          (UINT16)0x0021
+#define k_DIAG_INST_ATTR_RFID_HIST_REC_ODD           (UINT16)0x0022
+#define k_DIAG_INST_ATTR_RFID_HIST_FULL_VERIFY       (UINT16)0x0023
+#define k_DIAG_INST_ATTR_RFID_HIST_TAG_REMOVAL       (UINT16)0x0024
+/* RFID failure counters, k_DIAG_RFID_FAIL_PER_ATTR counters per attribute */
+#define k_DIAG_INST_ATTR_RFID_FAIL_CNT_0             (UINT16)0x0028
+#define k_DIAG_INST_ATTR_RFID_FAIL_CNT_1             (UINT16)0x0029
+/* Active baud rate of the RFID reader */
+#define k_DIAG_INST_ATTR_RFID_BAUDRATE               (UINT16)0x0030
+/* Current UID poll interval [us] and duty cycle [per mille] of the RFID tag read */
+#define k_DIAG_INST_ATTR_RFID_POLL_INTERVAL          (UINT16)0x0031
+#define k_DIAG_INST_ATTR_RFID_POLL_DUTY              (UINT16)0x0032
+
+/* Number of failure counters transmitted with one attribute */
+#define k_DIAG_RFID_FAIL_PER_ATTR                    16u
+
+/* Object specific service: read the RFID tag event journal */
+#define k_DIAG_SRV_RFID_JOURNAL_READ                 0x4Bu
+/* Size of a journal entry in the response */
+#define k_DIAG_RFID_JOURNAL_ENTRY_SIZE               ((3u * CSOS_k_SIZEOF_UDINT) + \
+                                                      CSOS_k_SIZEOF_UINT + \
+                                                      (2u * CSOS_k_SIZEOF_USINT))
+/* Number of journal entries per response (after the sequence number) */
+#define k_DIAG_RFID_JOURNAL_PER_RSP                  ((CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE - \
+                                                       CSOS_k_SIZEOF_UINT) / \
+                                                      k_DIAG_RFID_JOURNAL_ENTRY_SIZE)
+#endif /* RFID_ACTIVE */
 
 /* Defines the instance used for accessing the temperature diagnosis data */
 #define k_DIAG_INST_ID                               (UINT16)1U     /* Instance used for Diag. */
@@ -85,6 +157,95 @@
 /* Max. time slice reached by background task */
 STATIC UINT8 u8_MaxTimesliceReached = 0u;
 
+#ifdef RFID_ACTIVE
+/** PRE-PROCESSOR CHECK **/
+/* One attribute per histogram and all failure counters in the failure counter attributes */
+/*lint -e(948) */
+IXX_TASSERT( ((k_DIAG_INST_ATTR_RFID_HIST_TAG_REMOVAL - k_DIAG_INST_ATTR_RFID_HIST_UID) + 1u)
+             == (UINT16)RFID_HIST_CNT, appObj_chk1 )
+/*lint -e(948) */
+IXX_TASSERT( (((k_DIAG_INST_ATTR_RFID_FAIL_CNT_1 - k_DIAG_INST_ATTR_RFID_FAIL_CNT_0) + 1u)
+             * k_DIAG_RFID_FAIL_PER_ATTR) >= RFID_FAIL_CNT, appObj_chk2 )
+/* Ensure the response buffer holds a histogram and the counters of one attribute */
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (RFID_HIST_BUCKET_CNT * CSOS_k_SIZEOF_UINT),
+             appObj_chk3 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (k_DIAG_RFID_FAIL_PER_ATTR * CSOS_k_SIZEOF_UINT),
+             appObj_chk4 )
+/* Ensure the response buffer holds at least one journal entry */
+/*lint -e(948) */
+IXX_TASSERT( k_DIAG_RFID_JOURNAL_PER_RSP >= 1u, appObj_chk5 )
+
+/* Mute lint warning type not referenced. These types are just defined for
+** being able to check the size of the elementary types. */
+/*lint -esym(751, IXX_DUMMY_appObj_chk1, IXX_DUMMY_appObj_chk2 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk3, IXX_DUMMY_appObj_chk4 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk5 ) not referenced - just for checks */
+#endif /* RFID_ACTIVE */
+
+#ifdef SCH_PROFILER_ACTIVE
+/** PRE-PROCESSOR CHECK **/
+/* One attribute per time slice, all tasks in the task attributes, response buffer holds the
+** statistic of a time slice and the execution times of one task attribute */
+/*lint -e(948) */
+IXX_TASSERT( ((k_DIAG_INST_ATTR_SCH_PROF_SLICE_LAST - k_DIAG_INST_ATTR_SCH_PROF_SLICE_FIRST) + 1u)
+             == SCHPROF_SLICE_CNT, appObj_chk6 )
+/*lint -e(948) */
+IXX_TASSERT( ((k_DIAG_INST_ATTR_SCH_PROF_TASK_LAST - k_DIAG_INST_ATTR_SCH_PROF_TASK_FIRST) + 1u)
+             == (k_DIAG_SCH_PROF_ATTR_PER_MODE * SCHPROF_MODE_CNT), appObj_chk7 )
+/*lint -e(948) */
+IXX_TASSERT( (k_DIAG_SCH_PROF_ATTR_PER_MODE * k_DIAG_SCH_PROF_TASKS_PER_ATTR) >= SCHPROF_TASK_CNT,
+             appObj_chk8 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= ((3u + SCHPROF_HIST_BUCKET_CNT) * CSOS_k_SIZEOF_UINT),
+             appObj_chk9 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (k_DIAG_SCH_PROF_TASKS_PER_ATTR * CSOS_k_SIZEOF_UINT),
+             appObj_chk10 )
+/*lint -esym(751, IXX_DUMMY_appObj_chk6, IXX_DUMMY_appObj_chk7 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk8, IXX_DUMMY_appObj_chk9 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk10 ) not referenced - just for checks */
+#endif /* SCH_PROFILER_ACTIVE */
+
+/** PRE-PROCESSOR CHECK **/
+/* Summary and histograms of all classes in the background task attributes, response buffer
+** holds the longest histogram */
+/*lint -e(948) */
+IXX_TASSERT( ((k_DIAG_INST_ATTR_BKGD_LAST - k_DIAG_INST_ATTR_BKGD_FIRST) + 1u)
+             == (((SAPL_BKGD_STAT_CLASS_CNT - 1u) * k_DIAG_BKGD_ATTR_PER_CLASS)
+                 + (1u + SAPL_BKGD_STAT_HIST_CNT)), appObj_chk11 )
+/*lint -e(948) */
+IXX_TASSERT( k_DIAG_BKGD_ATTR_PER_CLASS >= (1u + SAPL_BKGD_STAT_HIST_CNT), appObj_chk12 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (SAPL_BKGD_STAT_HIST_MAX_LEN * CSOS_k_SIZEOF_UINT),
+             appObj_chk13 )
+/*lint -esym(751, IXX_DUMMY_appObj_chk11, IXX_DUMMY_appObj_chk12 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk13 ) not referenced - just for checks */
+
+/** PRE-PROCESSOR CHECK **/
+/* Response buffer holds the IPC wait time statistic */
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= ((2u * CSOS_k_SIZEOF_UDINT)
+                                                 + (7u * CSOS_k_SIZEOF_UINT)), appObj_chk14 )
+/*lint -esym(751, IXX_DUMMY_appObj_chk14 ) not referenced - just for checks */
+
+/** PRE-PROCESSOR CHECK **/
+/* One IPC link attribute per IPC ID, response buffer holds the link statistic and the sync 
+** wait histogram */
+/*lint -e(948) */
+IXX_TASSERT( ((k_DIAG_INST_ATTR_IPC_LINK_LAST - k_DIAG_INST_ATTR_IPC_LINK_FIRST) + 1u)
+             == IPCXSYS_IPC_ID_CNT, appObj_chk15 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (CSOS_k_SIZEOF_UDINT
+                                                 + ((4u + IPCXSYS_WAIT_HIST_CNT)
+                                                    * CSOS_k_SIZEOF_UINT)), appObj_chk16 )
+/*lint -e(948) */
+IXX_TASSERT( CSOS_cfg_EXPL_RSP_DATA_BUF_SIZE >= (IPCSSYS_WAIT_HIST_CNT * CSOS_k_SIZEOF_UINT),
+             appObj_chk17 )
+/*lint -esym(751, IXX_DUMMY_appObj_chk15, IXX_DUMMY_appObj_chk16 ) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_appObj_chk17 ) not referenced - just for checks */
+
 /***************************************************************************************************
 **    static function-prototypes
 ***************************************************************************************************/
@@ -105,6 +266,13 @@ STATIC UINT8 u8_MaxTimesliceReached = 0u;
     
     Currently the following services are implemented:
      - Get_Attribute_Single
+     - Reset (clears the background task statistic, the IPC wait time and link statistic, the
+       RFID latency histograms, failure counters and tag event journal, RFID_ACTIVE only, and
+       the scheduler profiler statistic, SCH_PROFILER_ACTIVE only)
+     - Read_RFID_Journal (0x4B): request UINT sequence number of the first entry, response
+       UINT sequence number of the first returned entry followed by up to 2 entries of
+       UDINT time [128us], UDINT S2L ID, UDINT UID low, UINT duration [128us], USINT event,
+       USINT detail (RFID_ACTIVE only)
      
      Currently the following class/instance attributes are implemented:
      - Temperature (Instance Attribute)
@@ -112,6 +280,32 @@ STATIC UINT8 u8_MaxTimesliceReached = 0u;
      - Temperature Status other channel (Instance Attribute)
      - Available NV data flash blocks (Instance Attribute)
      - Highest Time Slice touched by background task (Instance Attribute)
+     - Scheduler overruns: UINT task budget overruns, UINT time slice overruns, USINT time
+       slice and USINT task table index of the last task budget overrun (Instance Attribute)
+     - IPC wait time per scheduler cycle: UDINT cycles, UDINT cycles with waiting for IPC
+       telegrams, UINT last and max. wait for IPC telegrams, UINT last and max. wait in the IPC
+       sync, UINT mean and max. total wait, UINT shortest time between reception and use of an
+       IPC telegram, all times in [us] (Instance Attribute)
+     - IPC sync wait histogram: IPCSSYS_WAIT_HIST_CNT x UINT, bucket 0 without waiting, then
+       buckets of IPCSSYS_WAIT_HIST_US [us] (Instance Attribute)
+     - IPC link statistic per IPC ID, one attribute per ID starting at 0xA0: UDINT received
+       telegrams, UINT CRC failures of the first copy, UINT recoveries by the second copy, UINT
+       max. and mean wait [us], IPCXSYS_WAIT_HIST_CNT x UINT wait histogram, bucket 0 without
+       waiting, then buckets of IPCXSYS_WAIT_HIST_US [us] (Instance Attributes)
+     - Background task statistic per class of AIC states (SAPL_BKGD_STAT_CLASS_xxx), 8
+       attributes per class starting at 0x70: UDINT cycles, UINT max. and mean duration [us],
+       USINT latest finish and USINT least headroom [time slices], followed by the histograms
+       SAPL_BKGD_STAT_HIST_xxx of up to 16 x UINT (Instance Attributes)
+     - Scheduler profiler per time slice: UINT min, UINT max, UINT mean [CPU cycles],
+       SCHPROF_HIST_BUCKET_CNT x UINT histogram (Instance Attributes, SCH_PROFILER_ACTIVE only)
+     - Scheduler profiler longest task execution times, 16 x UINT [CPU cycles] per attribute
+       (Instance Attributes, SCH_PROFILER_ACTIVE only)
+     - RFID latency histograms, RFID_HIST_BUCKET_CNT x UINT (Instance Attributes, RFID_ACTIVE
+       only)
+     - RFID failure counters per t_RFID_FAILURE, up to 16 x UINT (Instance Attributes,
+       RFID_ACTIVE only)
+     - RFID reader baud rate (Instance Attribute, RFID_ACTIVE only)
+     - RFID UID poll interval and duty cycle (Instance Attributes, RFID_ACTIVE only)
 
   See also:
     -
@@ -252,6 +446,349 @@ void SAPL_AppObjDiagMsgHandler(const CSS_t_EXPL_REQ *ps_explReq,
             ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
           }
 
+          /* if attribute 'Scheduler overruns' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_SCH_OVERRUN)
+          {
+            t_SCHAPP_OVERRUN s_overrun;
+
+            /* get a consistent copy of the statistic */
+            __disable_irq();
+            schAPP_OverrunGet(&s_overrun);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            /* Deactivate lint since pointer arithmetic is not really done here */
+            /*lint -esym(960, 17.4) */
+            CSS_H2N_CPY16(&pau8_rspData[0u], &s_overrun.u16_taskCnt);
+            CSS_H2N_CPY16(&pau8_rspData[2u], &s_overrun.u16_sliceCnt);
+            CSS_H2N_CPY8(&pau8_rspData[4u], &s_overrun.u8_lastSlice);
+            CSS_H2N_CPY8(&pau8_rspData[5u], &s_overrun.u8_lastTask);
+            /*lint +esym(960, 17.4) */
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (2u * CSOS_k_SIZEOF_UINT) + (2u * CSOS_k_SIZEOF_USINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'IPC wait time' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_IPC_WAIT)
+          {
+            IPCXSYS_WAIT_STAT_STRUCT s_wait;
+
+            /* get a consistent copy of the statistic */
+            __disable_irq();
+            ipcxSYS_WaitStatGet(&s_wait);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            /* Deactivate lint since pointer arithmetic is not really done here */
+            /*lint -esym(960, 17.4) */
+            CSS_H2N_CPY32(&pau8_rspData[0u], &s_wait.u32_cycleCnt);
+            CSS_H2N_CPY32(&pau8_rspData[4u], &s_wait.u32_rxWaitCycleCnt);
+            CSS_H2N_CPY16(&pau8_rspData[8u], &s_wait.u16_rxLast);
+            CSS_H2N_CPY16(&pau8_rspData[10u], &s_wait.u16_rxMax);
+            CSS_H2N_CPY16(&pau8_rspData[12u], &s_wait.u16_syncLast);
+            CSS_H2N_CPY16(&pau8_rspData[14u], &s_wait.u16_syncMax);
+            CSS_H2N_CPY16(&pau8_rspData[16u], &s_wait.u16_totalMean);
+            CSS_H2N_CPY16(&pau8_rspData[18u], &s_wait.u16_totalMax);
+            CSS_H2N_CPY16(&pau8_rspData[20u], &s_wait.u16_rxMarginMin);
+            /*lint +esym(960, 17.4) */
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (2u * CSOS_k_SIZEOF_UDINT) + (7u * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'IPC sync wait histogram' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_IPC_SYNC_HIST)
+          {
+            UINT16 au16_hist[IPCSSYS_WAIT_HIST_CNT];
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the histogram */
+            __disable_irq();
+            ipcsSYS_GetWaitHist(au16_hist);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            for (u8_idx = 0u; u8_idx < IPCSSYS_WAIT_HIST_CNT; u8_idx++)
+            {
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              CSS_H2N_CPY16(&pau8_rspData[u8_idx * CSOS_k_SIZEOF_UINT], &au16_hist[u8_idx]);
+              /*lint +esym(960, 17.4) */
+            }
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(IPCSSYS_WAIT_HIST_CNT * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'IPC link statistic' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_IPC_LINK_FIRST)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_IPC_LINK_LAST))
+          {
+            IPCXSYS_LINK_STAT_STRUCT s_link;
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the statistic */
+            __disable_irq();
+            ipcxSYS_LinkStatGet((UINT8)(ps_explReq->u16_attribute
+                                        - k_DIAG_INST_ATTR_IPC_LINK_FIRST), &s_link);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            /* Deactivate lint since pointer arithmetic is not really done here */
+            /*lint -esym(960, 17.4) */
+            CSS_H2N_CPY32(&pau8_rspData[0u], &s_link.u32_rxCnt);
+            CSS_H2N_CPY16(&pau8_rspData[4u], &s_link.u16_crcFailCnt);
+            CSS_H2N_CPY16(&pau8_rspData[6u], &s_link.u16_recoverCnt);
+            CSS_H2N_CPY16(&pau8_rspData[8u], &s_link.u16_waitMax);
+            CSS_H2N_CPY16(&pau8_rspData[10u], &s_link.u16_waitMean);
+            for (u8_idx = 0u; u8_idx < IPCXSYS_WAIT_HIST_CNT; u8_idx++)
+            {
+              CSS_H2N_CPY16(&pau8_rspData[12u + (u8_idx * CSOS_k_SIZEOF_UINT)],
+                            &s_link.au16_waitHist[u8_idx]);
+            }
+            /*lint +esym(960, 17.4) */
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(CSOS_k_SIZEOF_UDINT
+                                                   + ((4u + IPCXSYS_WAIT_HIST_CNT)
+                                                      * CSOS_k_SIZEOF_UINT));
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'Background task statistic' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_BKGD_FIRST)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_BKGD_LAST)
+                   && (((ps_explReq->u16_attribute - k_DIAG_INST_ATTR_BKGD_FIRST)
+                        % k_DIAG_BKGD_ATTR_PER_CLASS) <= SAPL_BKGD_STAT_HIST_CNT))
+          {
+            UINT8 u8_attr = (UINT8)(ps_explReq->u16_attribute - k_DIAG_INST_ATTR_BKGD_FIRST);
+            UINT8 u8_class = (UINT8)(u8_attr / k_DIAG_BKGD_ATTR_PER_CLASS);
+            UINT8 u8_ofs = (UINT8)(u8_attr % k_DIAG_BKGD_ATTR_PER_CLASS);
+
+            /* statistic is written by the background task itself, no lock necessary */
+            /* if summary */
+            if (u8_ofs == 0u)
+            {
+              t_SAPL_BKGD_STAT_SUMMARY s_summary;
+
+              SAPL_BkgdStatSummaryGet(u8_class, &s_summary);
+
+              /* set response data ("little-endian") */
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              CSS_H2N_CPY32(&pau8_rspData[0u], &s_summary.u32_cnt);
+              CSS_H2N_CPY16(&pau8_rspData[4u], &s_summary.u16_durMax);
+              CSS_H2N_CPY16(&pau8_rspData[6u], &s_summary.u16_durMean);
+              CSS_H2N_CPY8(&pau8_rspData[8u], &s_summary.u8_finishMax);
+              CSS_H2N_CPY8(&pau8_rspData[9u], &s_summary.u8_headroomMin);
+              /*lint +esym(960, 17.4) */
+
+              /* set response header */
+              ps_explResp->u16_rspDataLen = CSOS_k_SIZEOF_UDINT + (2u * CSOS_k_SIZEOF_UINT)
+                                            + (2u * CSOS_k_SIZEOF_USINT);
+            }
+            /* else: histogram */
+            else
+            {
+              UINT16 au16_hist[SAPL_BKGD_STAT_HIST_MAX_LEN];
+              UINT8 u8_cnt;
+              UINT8 u8_idx;
+
+              u8_cnt = SAPL_BkgdStatHistGet(u8_class, (UINT8)(u8_ofs - 1u), au16_hist);
+
+              /* set response data ("little-endian") */
+              for (u8_idx = 0u; u8_idx < u8_cnt; u8_idx++)
+              {
+                /* Deactivate lint since pointer arithmetic is not really done here */
+                /*lint -esym(960, 17.4) */
+                CSS_H2N_CPY16(&pau8_rspData[u8_idx * CSOS_k_SIZEOF_UINT], &au16_hist[u8_idx]);
+                /*lint +esym(960, 17.4) */
+              }
+
+              /* set response header */
+              ps_explResp->u16_rspDataLen = (UINT16)(u8_cnt * CSOS_k_SIZEOF_UINT);
+            }
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+#ifdef SCH_PROFILER_ACTIVE
+          /* if attribute 'Scheduler profiler time slice' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_SCH_PROF_SLICE_FIRST)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_SCH_PROF_SLICE_LAST))
+          {
+            t_SCHPROF_SLICE s_slice;
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the statistic */
+            __disable_irq();
+            schProf_SliceGet((UINT8)(ps_explReq->u16_attribute
+                                     - k_DIAG_INST_ATTR_SCH_PROF_SLICE_FIRST), &s_slice);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            /* Deactivate lint since pointer arithmetic is not really done here */
+            /*lint -esym(960, 17.4) */
+            CSS_H2N_CPY16(&pau8_rspData[0u], &s_slice.u16_min);
+            CSS_H2N_CPY16(&pau8_rspData[2u], &s_slice.u16_max);
+            CSS_H2N_CPY16(&pau8_rspData[4u], &s_slice.u16_mean);
+            for (u8_idx = 0u; u8_idx < SCHPROF_HIST_BUCKET_CNT; u8_idx++)
+            {
+              CSS_H2N_CPY16(&pau8_rspData[(3u + u8_idx) * CSOS_k_SIZEOF_UINT],
+                            &s_slice.au16_hist[u8_idx]);
+            }
+            /*lint +esym(960, 17.4) */
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)((3u + SCHPROF_HIST_BUCKET_CNT)
+                                                   * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'Scheduler profiler task execution times' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_SCH_PROF_TASK_FIRST)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_SCH_PROF_TASK_LAST))
+          {
+            UINT16 au16_max[k_DIAG_SCH_PROF_TASKS_PER_ATTR];
+            UINT8 u8_attr = (UINT8)(ps_explReq->u16_attribute - k_DIAG_INST_ATTR_SCH_PROF_TASK_FIRST);
+            UINT8 u8_cnt;
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the execution times */
+            __disable_irq();
+            u8_cnt = schProf_TaskMaxGet((UINT8)(u8_attr / k_DIAG_SCH_PROF_ATTR_PER_MODE),
+                                        (UINT8)((u8_attr % k_DIAG_SCH_PROF_ATTR_PER_MODE)
+                                                * k_DIAG_SCH_PROF_TASKS_PER_ATTR),
+                                        au16_max, (UINT8)k_DIAG_SCH_PROF_TASKS_PER_ATTR);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            for (u8_idx = 0u; u8_idx < u8_cnt; u8_idx++)
+            {
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              CSS_H2N_CPY16(&pau8_rspData[u8_idx * CSOS_k_SIZEOF_UINT], &au16_max[u8_idx]);
+              /*lint +esym(960, 17.4) */
+            }
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(u8_cnt * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+#endif /* SCH_PROFILER_ACTIVE */
+
+#ifdef RFID_ACTIVE
+          /* if attribute 'RFID latency histogram' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_RFID_HIST_UID)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_RFID_HIST_TAG_REMOVAL))
+          {
+            UINT16 au16_bucket[RFID_HIST_BUCKET_CNT];
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the histogram */
+            __disable_irq();
+            RFID_DiagHistGet((t_RFID_HIST)(ps_explReq->u16_attribute
+                                           - k_DIAG_INST_ATTR_RFID_HIST_UID), au16_bucket);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            for (u8_idx = 0u; u8_idx < RFID_HIST_BUCKET_CNT; u8_idx++)
+            {
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              CSS_H2N_CPY16(&pau8_rspData[u8_idx * CSOS_k_SIZEOF_UINT], &au16_bucket[u8_idx]);
+              /*lint +esym(960, 17.4) */
+            }
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(RFID_HIST_BUCKET_CNT * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'RFID failure counters' */
+          else if (   (ps_explReq->u16_attribute >= k_DIAG_INST_ATTR_RFID_FAIL_CNT_0)
+                   && (ps_explReq->u16_attribute <= k_DIAG_INST_ATTR_RFID_FAIL_CNT_1))
+          {
+            UINT16 au16_cnt[k_DIAG_RFID_FAIL_PER_ATTR];
+            UINT8 u8_first = (UINT8)((ps_explReq->u16_attribute - k_DIAG_INST_ATTR_RFID_FAIL_CNT_0)
+                                     * k_DIAG_RFID_FAIL_PER_ATTR);
+            UINT8 u8_cnt;
+            UINT8 u8_idx;
+
+            /* get a consistent copy of the counters */
+            __disable_irq();
+            u8_cnt = RFID_DiagFailCntGet(u8_first, au16_cnt, (UINT8)k_DIAG_RFID_FAIL_PER_ATTR);
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            for (u8_idx = 0u; u8_idx < u8_cnt; u8_idx++)
+            {
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              CSS_H2N_CPY16(&pau8_rspData[u8_idx * CSOS_k_SIZEOF_UINT], &au16_cnt[u8_idx]);
+              /*lint +esym(960, 17.4) */
+            }
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(u8_cnt * CSOS_k_SIZEOF_UINT);
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'RFID reader baud rate' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_RFID_BAUDRATE)
+          {
+            UINT32 u32_baudRate;
+
+            __disable_irq();
+            u32_baudRate = RFID_BaudRateGet();
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            CSS_H2N_CPY32(pau8_rspData, &u32_baudRate);
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = CSOS_k_SIZEOF_UDINT;
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'RFID poll interval' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_RFID_POLL_INTERVAL)
+          {
+            UINT32 u32_pollInterval;
+
+            __disable_irq();
+            u32_pollInterval = RFID_PollIntervalGet();
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            CSS_H2N_CPY32(pau8_rspData, &u32_pollInterval);
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = CSOS_k_SIZEOF_UDINT;
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+
+          /* if attribute 'RFID poll duty cycle' */
+          else if (ps_explReq->u16_attribute == k_DIAG_INST_ATTR_RFID_POLL_DUTY)
+          {
+            UINT16 u16_pollDuty;
+
+            __disable_irq();
+            u16_pollDuty = RFID_PollDutyGet();
+            __enable_irq();
+
+            /* set response data ("little-endian") */
+            CSS_H2N_CPY16(pau8_rspData, &u16_pollDuty);
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = CSOS_k_SIZEOF_UINT;
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+#endif /* RFID_ACTIVE */
+
           /* else attribute unknown/unsupported */
           else
           {
@@ -260,6 +797,82 @@ void SAPL_AppObjDiagMsgHandler(const CSS_t_EXPL_REQ *ps_explReq,
           } 
           break;
         }
+
+        /* 'Reset' Service: clear the background task statistic, the IPC wait time and link
+        ** statistic, the RFID latency histograms, failure counters and journal and the scheduler
+        ** profiler statistic */
+        case CSOS_k_CCSC_RESET:
+        {
+          SAPL_BkgdStatReset();
+
+          __disable_irq();
+          ipcxSYS_WaitStatReset();
+          ipcxSYS_LinkStatReset();
+          ipcsSYS_ResetWaitHist();
+#ifdef RFID_ACTIVE
+          RFID_DiagReset();
+#endif
+#ifdef SCH_PROFILER_ACTIVE
+          schProf_Reset();
+#endif
+          __enable_irq();
+
+          /* no response data */
+          ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          break;
+        }
+
+#ifdef RFID_ACTIVE
+        /* 'Read_RFID_Journal' Service: read the tag event journal in bulk */
+        case k_DIAG_SRV_RFID_JOURNAL_READ:
+        {
+          t_RFID_JOURNAL_ENTRY as_entry[k_DIAG_RFID_JOURNAL_PER_RSP];
+          UINT16 u16_seq;
+          UINT8 u8_cnt;
+          UINT8 u8_idx;
+          UINT8 *pau8_entry;
+
+          /* if request data does not contain the sequence number */
+          if (ps_explReq->u16_reqDataLen < CSOS_k_SIZEOF_UINT)
+          {
+            ps_explResp->u8_genStat = CSOS_k_CGSC_NOT_ENOUGH_DATA;
+          }
+          else if (ps_explReq->u16_reqDataLen > CSOS_k_SIZEOF_UINT)
+          {
+            ps_explResp->u8_genStat = CSOS_k_CGSC_TOO_MUCH_DATA;
+          }
+          else
+          {
+            CSS_N2H_CPY16(&u16_seq, ps_explReq->pb_reqData);
+
+            /* the journal is read without locking the interrupts */
+            u8_cnt = RFID_JournalRead(&u16_seq, as_entry, (UINT8)k_DIAG_RFID_JOURNAL_PER_RSP);
+
+            /* set response data ("little-endian") */
+            CSS_H2N_CPY16(pau8_rspData, &u16_seq);
+            for (u8_idx = 0u; u8_idx < u8_cnt; u8_idx++)
+            {
+              /* Deactivate lint since pointer arithmetic is not really done here */
+              /*lint -esym(960, 17.4) */
+              pau8_entry = &pau8_rspData[CSOS_k_SIZEOF_UINT
+                                         + (u8_idx * k_DIAG_RFID_JOURNAL_ENTRY_SIZE)];
+              CSS_H2N_CPY32(&pau8_entry[0u], &as_entry[u8_idx].u32_time128us);
+              CSS_H2N_CPY32(&pau8_entry[4u], &as_entry[u8_idx].u32_s2lId);
+              CSS_H2N_CPY32(&pau8_entry[8u], &as_entry[u8_idx].u32_uidLow);
+              CSS_H2N_CPY16(&pau8_entry[12u], &as_entry[u8_idx].u16_duration);
+              CSS_H2N_CPY8(&pau8_entry[14u], &as_entry[u8_idx].u8_event);
+              CSS_H2N_CPY8(&pau8_entry[15u], &as_entry[u8_idx].u8_detail);
+              /*lint +esym(960, 17.4) */
+            }
+
+            /* set response header */
+            ps_explResp->u16_rspDataLen = (UINT16)(CSOS_k_SIZEOF_UINT
+                                                   + (u8_cnt * k_DIAG_RFID_JOURNAL_ENTRY_SIZE));
+            ps_explResp->u8_genStat = CSOS_k_CGSC_SUCCESS;
+          }
+          break;
+        }
+#endif /* RFID_ACTIVE */
         
         /* Unknown/unsupported service */
         default:
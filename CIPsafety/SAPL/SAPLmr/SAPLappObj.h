@@ -60,6 +60,13 @@
     
     Currently the following services are implemented:
      - Get_Attribute_Single
+     - Reset (clears the background task statistic, the IPC wait time and link statistic, the
+       RFID latency histograms, failure counters and tag event journal, RFID_ACTIVE only, and
+       the scheduler profiler statistic, SCH_PROFILER_ACTIVE only)
+     - Read_RFID_Journal (0x4B): request UINT sequence number of the first entry, response
+       UINT sequence number of the first returned entry followed by up to 2 entries of
+       UDINT time [128us], UDINT S2L ID, UDINT UID low, UINT duration [128us], USINT event,
+       USINT detail (RFID_ACTIVE only)
      
      Currently the following class/instance attributes are implemented:
      - Temperature (Instance Attribute)
@@ -67,6 +74,32 @@
      - Temperature Status other channel (Instance Attribute)
      - Available NV data flash blocks (Instance Attribute)
      - Highest Time Slice touched by background task (Instance Attribute)
+     - Scheduler overruns: UINT task budget overruns, UINT time slice overruns, USINT time
+       slice and USINT task table index of the last task budget overrun (Instance Attribute)
+     - IPC wait time per scheduler cycle: UDINT cycles, UDINT cycles with waiting for IPC
+       telegrams, UINT last and max. wait for IPC telegrams, UINT last and max. wait in the IPC
+       sync, UINT mean and max. total wait, UINT shortest time between reception and use of an
+       IPC telegram, all times in [us] (Instance Attribute)
+     - IPC sync wait histogram: IPCSSYS_WAIT_HIST_CNT x UINT, bucket 0 without waiting, then
+       buckets of IPCSSYS_WAIT_HIST_US [us] (Instance Attribute)
+     - IPC link statistic per IPC ID, one attribute per ID starting at 0xA0: UDINT received
+       telegrams, UINT CRC failures of the first copy, UINT recoveries by the second copy, UINT
+       max. and mean wait [us], IPCXSYS_WAIT_HIST_CNT x UINT wait histogram, bucket 0 without
+       waiting, then buckets of IPCXSYS_WAIT_HIST_US [us] (Instance Attributes)
+     - Background task statistic per class of AIC states (SAPL_BKGD_STAT_CLASS_xxx), 8
+       attributes per class starting at 0x70: UDINT cycles, UINT max. and mean duration [us],
+       USINT latest finish and USINT least headroom [time slices], followed by the histograms
+       SAPL_BKGD_STAT_HIST_xxx of up to 16 x UINT (Instance Attributes)
+     - Scheduler profiler per time slice: UINT min, UINT max, UINT mean [CPU cycles],
+       SCHPROF_HIST_BUCKET_CNT x UINT histogram (Instance Attributes, SCH_PROFILER_ACTIVE only)
+     - Scheduler profiler longest task execution times, 16 x UINT [CPU cycles] per attribute
+       (Instance Attributes, SCH_PROFILER_ACTIVE only)
+     - RFID latency histograms, RFID_HIST_BUCKET_CNT x UINT (Instance Attributes, RFID_ACTIVE
+       only)
+     - RFID failure counters per t_RFID_FAILURE, up to 16 x UINT (Instance Attributes,
+       RFID_ACTIVE only)
+     - RFID reader baud rate (Instance Attribute, RFID_ACTIVE only)
+     - RFID UID poll interval and duty cycle (Instance Attributes, RFID_ACTIVE only)
 
   See also:
     -
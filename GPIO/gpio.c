@@ -46,6 +46,7 @@
 #include "xdefs.h"
 
 /* Module header */
+#include "globFail_Errorcodes.h"
 #include "ipcx_ExchangeData-sys_def.h"
 #include "ipcx_ExchangeData-sys.h"
 
@@ -357,6 +358,14 @@ void gpio_SendIOvaluesViaIPC(void)
   if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_1)
   {
     uIpcIoData.sIoStruct.u32RfidInfo = RFID_InfoGet();
+    uIpcIoData.sIoStruct.u8RfidDigestCnt = RFID_DigestCntGet();
+    uIpcIoData.sIoStruct.u8RfidDigestAck = 0u;
+  }
+  else
+  {
+    uIpcIoData.sIoStruct.u32RfidInfo = 0uL;
+    uIpcIoData.sIoStruct.u8RfidDigestCnt = 0u;
+    uIpcIoData.sIoStruct.u8RfidDigestAck = RFID_DigestAckGet();
   }
 
   ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
@@ -408,6 +417,11 @@ void gpio_GetIOvaluesFromIPC(void)
   if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_2)
   {
     RFID_InfoSet(uIpcIoDataRx.sIoStruct.u32RfidInfo);
+    RFID_DigestCntSet(uIpcIoDataRx.sIoStruct.u8RfidDigestCnt);
+  }
+  else
+  {
+    RFID_DigestAckSet(uIpcIoDataRx.sIoStruct.u8RfidDigestAck);
   }
 #else
    uIpcIoDataRx.u32IpcPacket = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_IO );
@@ -470,6 +484,14 @@ void gpio_SendAicSyncViaIPC(void)
  if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_1)
   {
     uIpcIoData.sIoStruct.u32RfidInfo = RFID_InfoGet();
+    uIpcIoData.sIoStruct.u8RfidDigestCnt = RFID_DigestCntGet();
+    uIpcIoData.sIoStruct.u8RfidDigestAck = 0u;
+  }
+  else
+  {
+    uIpcIoData.sIoStruct.u32RfidInfo = 0uL;
+    uIpcIoData.sIoStruct.u8RfidDigestCnt = 0u;
+    uIpcIoData.sIoStruct.u8RfidDigestAck = RFID_DigestAckGet();
   }
 
   ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
@@ -523,6 +545,11 @@ void gpio_GetAicSyncFromIPC(void)
   if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_2)
   {
     RFID_InfoSet(uIpcIoDataRx.sIoStruct.u32RfidInfo);
+    RFID_DigestCntSet(uIpcIoDataRx.sIoStruct.u8RfidDigestCnt);
+  }
+  else
+  {
+    RFID_DigestAckSet(uIpcIoDataRx.sIoStruct.u8RfidDigestAck);
   }
 #else
    uIpcIoDataRx.u32IpcPacket = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_IO );
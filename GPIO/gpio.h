@@ -66,6 +66,8 @@ typedef struct IPC_IO_DATA_TAG
    UINT8 u8AicSyncCnt;    /* sync value for AIC */
 #ifdef RFID_ACTIVE
    UINT32 u32RfidInfo;     /* RFID information */
+   UINT8 u8RfidDigestCnt;  /* counter of the RFID digest, see RFID_DigestSend() */
+   UINT8 u8RfidDigestAck;  /* verdict on the RFID digest, see RFID_DigestAckGet() */
 #endif /* RFID_ACTIVE */
 } INPT_IPC_IO_DATA_STRUCT;
 
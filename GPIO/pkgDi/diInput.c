@@ -52,11 +52,16 @@
 
 #include "cfg_Config-sys.h"
 
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 
 #include "rds.h"
 
+/* time slices of the scheduler, used for the filter period */
+#include "sch_Scheduler-app.h"
+
 /* Header-file of module */
 #include "gpio-hal.h"
 #include "gpio_cfg.h"
@@ -173,6 +178,14 @@ STATIC CONST DIINPUT_BUFF_LOC_STRUCT sBuffLocationEnDo[GPIOCFG_NUM_ENDO] =
   {DIPORTMAP_BUFFER_INDEX_PORT_EN_DO, PINMASK_EN_DO}
 };
 
+/** PRE-PROCESSOR CHECK **/
+/* The additional filter time must be a whole number (>= 1) of filter periods */
+/*lint -e(948) */
+IXX_TASSERT((DIINPUT_ADD_FILTER_TIME_US >= DIINPUT_FILTER_PERIOD_US), diInput_chk1)
+/*lint -e(948) */
+IXX_TASSERT(((DIINPUT_ADD_FILTER_TIME_US % DIINPUT_FILTER_PERIOD_US) == 0u), diInput_chk2)
+/*lint -esym(751, IXX_DUMMY_diInput_chk1, IXX_DUMMY_diInput_chk2) not referenced - just for checks */
+
 
 /*******************************************************************************
 **
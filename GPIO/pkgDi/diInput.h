@@ -46,9 +46,22 @@
 ********************************************************************************
 */
 
-#define DIINPUT_ADD_DI_C_FILTERCYCLES   ((UINT8)(2u))
-
-#define DIINPUT_ADD_DI_S_FILTERCYCLES   ((UINT8)(2u))
+/* Time slices between two calls of the filter (period of gpio_FilterDiRelValues, see
+** sch_Scheduler-app_tasks.cfg) and the resulting filter period. The length of a time slice
+** depends on the cycle time (SCHAPP_TIME_SLICE_CNT, 2ms/4ms: 100us, 8ms: 200us). */
+#define DIINPUT_FILTER_PERIOD_SLICES    4u
+#define DIINPUT_FILTER_PERIOD_US        ((GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_CNT) \
+                                         * DIINPUT_FILTER_PERIOD_SLICES)
+
+/* Additional filter time of the second filter step, the same for every cycle time */
+#define DIINPUT_ADD_FILTER_TIME_US      800u
+
+/* Additional filter cycles of the second filter step (2ms/4ms: 2 x 400us, 8ms: 1 x 800us) */
+#define DIINPUT_ADD_DI_C_FILTERCYCLES   ((UINT8)(DIINPUT_ADD_FILTER_TIME_US / \
+                                                 DIINPUT_FILTER_PERIOD_US))
+
+#define DIINPUT_ADD_DI_S_FILTERCYCLES   ((UINT8)(DIINPUT_ADD_FILTER_TIME_US / \
+                                                 DIINPUT_FILTER_PERIOD_US))
 
 /*------------------------------------------------------------------------------
 **  init value used for local static high level filter
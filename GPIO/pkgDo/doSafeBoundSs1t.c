@@ -38,6 +38,7 @@
 #include "xtypes.h"
 #include "xdefs.h"
 
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 
@@ -77,8 +78,12 @@ typedef enum
 /* state variables for each DO channel */
 STATIC t_DO_SS1T_DELAY_STATE_ENUM ae_Ss1tState[GPIOCFG_NUM_DO_TOT];
 
-/* delay timers for each DO channel */
-STATIC RDS_UINT16 au16_RdsTimeout4msCtrs[GPIOCFG_NUM_DO_TOT];
+/* unit of the configured SS1-t delay timer value (FIPARAM_DO_SS1T_DELAY_4MS) in ms */
+#define k_SS1T_DELAY_UNIT_MS    4u
+
+/* delay timers for each DO channel in ms, reduced by the cycle time (GLOBDEF_CYCLE_TIME_MS) in
+** every scheduler cycle */
+STATIC RDS_UINT32 au32_RdsTimeoutMsCtrs[GPIOCFG_NUM_DO_TOT];
 
 /* DI SafeBound value for DO */
 STATIC RDS_BOOL ab_RdsSafeBoundValueForDo[GPIOCFG_NUM_DO_TOT];
@@ -137,7 +142,7 @@ void doSafeBoundSS1t_Init(void)
     /* set default state for SS1-t state machine */
     ae_Ss1tState[u8_index] = eWF_DO_REQ_HIGH;
     /* initialize SS1-t delay timer to 'stopped' */
-    RDS_SET(au16_RdsTimeout4msCtrs[u8_index], 0u);
+    RDS_SET(au32_RdsTimeoutMsCtrs[u8_index], 0u);
   }
 }
 
@@ -323,15 +328,15 @@ void doSafeBoundSS1t_UpdateTimers(void)
 
   for (u8_doChannel = 0u; u8_doChannel < GPIOCFG_NUM_DO_TOT; u8_doChannel++)
   {
-    /* if timer is running */
-    if (RDS_GET(au16_RdsTimeout4msCtrs[u8_doChannel]) > 0u)
+    /* if timer is running longer than one cycle */
+    if (RDS_GET(au32_RdsTimeoutMsCtrs[u8_doChannel]) > GLOBDEF_CYCLE_TIME_MS)
     {
-      /* timer is reduced with 4ms */
-      RDS_DEC(au16_RdsTimeout4msCtrs[u8_doChannel])
+      /* timer is reduced with the cycle time */
+      RDS_SUB(au32_RdsTimeoutMsCtrs[u8_doChannel], GLOBDEF_CYCLE_TIME_MS)
     }
-    else  /* else: timer is inactive */
+    else  /* else: timer elapses in this cycle or is inactive */
     {
-      /* empty branch */
+      RDS_SET(au32_RdsTimeoutMsCtrs[u8_doChannel], 0u);
     }
   }
 }
@@ -478,8 +483,10 @@ STATIC void WaitForDoRequestLowState(UINT8 u8_doChannel,
       ae_Ss1tState[u8_doChannelOther] = eWF_DO_DELAY_ELAPSED;
 
       /* STO delay is started */
-      RDS_SET(au16_RdsTimeout4msCtrs[u8_doChannel], u16CfgDelay4ms);
-      RDS_SET(au16_RdsTimeout4msCtrs[u8_doChannelOther], u16CfgDelay4ms);
+      RDS_SET(au32_RdsTimeoutMsCtrs[u8_doChannel],
+              (UINT32)u16CfgDelay4ms * k_SS1T_DELAY_UNIT_MS);
+      RDS_SET(au32_RdsTimeoutMsCtrs[u8_doChannelOther],
+              (UINT32)u16CfgDelay4ms * k_SS1T_DELAY_UNIT_MS);
     }
     else /* the DI "AND gate" value for the DO (SafeBound) is not HIGH/TRUE */
     {
@@ -583,8 +590,8 @@ STATIC void WaitForDoDelayElapsedState(UINT8 u8_doChannel,
     }
 
     /* delay timer is stopped */
-    RDS_SET(au16_RdsTimeout4msCtrs[u8_doChannel], 0u);
-    RDS_SET(au16_RdsTimeout4msCtrs[u8_doChannelOther], 0u);
+    RDS_SET(au32_RdsTimeoutMsCtrs[u8_doChannel], 0u);
+    RDS_SET(au32_RdsTimeoutMsCtrs[u8_doChannelOther], 0u);
   }
   /* else: if LOW state is requested */
   else if (eGPIO_LOW == e_reqState)
@@ -612,8 +619,8 @@ STATIC void WaitForDoDelayElapsedState(UINT8 u8_doChannel,
       /* Note 960: Violates MISRA 2004 Required Rule 12.4, side effects on right hand of logical
         *  operator: '&&' --> Side effect of RDS_GET is checking of, the redundant copy. It's not
         *  an issue if the right hand side is not evaluated. */
-      if (    (RDS_GET(au16_RdsTimeout4msCtrs[u8_doChannel]) == 0u)
-            && (RDS_GET(au16_RdsTimeout4msCtrs[u8_doChannelOther]) == 0u)
+      if (    (RDS_GET(au32_RdsTimeoutMsCtrs[u8_doChannel]) == 0u)
+            && (RDS_GET(au32_RdsTimeoutMsCtrs[u8_doChannelOther]) == 0u)
          )  /*lint !e960*/
       {
         doState_DoReqSPDU[u8_doChannel] = eGPIO_LOW;
@@ -32,6 +32,7 @@
 /* system includes */
 #include "xtypes.h"
 #include "xdefs.h"
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 
@@ -351,14 +352,12 @@ STATIC BOOL AutoErrResetProcessDi(UINT8 u8_index)
 
     case k_DI_RST_STATE_RECOVERY:
     {
-      /* since function is called every ~4ms, decrement RDS variable by 4.
-      ** RDS variable could be negative then if FIPARAM_DI_LATCH_ERROR_TIME is not a
-      ** multiple of 4. OK, because FIPARAM_DI_LATCH_ERROR_TIME has a range of 16 bit.
+      /* since function is called once per cycle, decrement RDS variable by the cycle time
+      ** (GLOBDEF_CYCLE_TIME_MS). RDS variable could be negative then if
+      ** FIPARAM_DI_LATCH_ERROR_TIME is not a multiple of the cycle time. OK, because
+      ** FIPARAM_DI_LATCH_ERROR_TIME has a range of 16 bit.
       */
-      RDS_DEC(ai32_DiErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DiErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DiErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DiErrorLatchTimeout[u8_index]);
+      RDS_SUB(ai32_DiErrorLatchTimeout[u8_index], (INT32)GLOBDEF_CYCLE_TIME_MS);
 
       /* dual channel configuration of DI */
       if (FIPARAM_DI_DUAL_CH(DICFG_GET_DUAL_CH_NUM(u8_index)))
@@ -32,6 +32,7 @@
 /* system includes */
 #include "xtypes.h"
 #include "xdefs.h"
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 
@@ -381,14 +382,12 @@ STATIC BOOL AutoErrResetProcessDo(UINT8 u8_index, UINT8 u8_doVal)
 
     case k_DO_RST_STATE_RECOVERY:
     {
-      /* since function is called every ~4ms, decrement RDS variable by 4.
-      ** RDS variable could be negative then if FIPARAM_DO_LATCH_ERROR_TIME is not a 
-      ** multiple of 4. OK, because FIPARAM_DO_LATCH_ERROR_TIME has a range of 16 bit.
+      /* since function is called once per cycle, decrement RDS variable by the cycle time
+      ** (GLOBDEF_CYCLE_TIME_MS). RDS variable could be negative then if
+      ** FIPARAM_DO_LATCH_ERROR_TIME is not a multiple of the cycle time. OK, because
+      ** FIPARAM_DO_LATCH_ERROR_TIME has a range of 16 bit.
       */
-      RDS_DEC(ai32_DoErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DoErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DoErrorLatchTimeout[u8_index]);
-      RDS_DEC(ai32_DoErrorLatchTimeout[u8_index]);
+      RDS_SUB(ai32_DoErrorLatchTimeout[u8_index], (INT32)GLOBDEF_CYCLE_TIME_MS);
       
       /* is DO in dual channel mode? */
       if (FIPARAM_DO_DUAL_CH(DOCFG_GET_DUAL_CH_NUM(u8_index)))
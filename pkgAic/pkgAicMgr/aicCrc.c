@@ -38,6 +38,9 @@
 #include "xtypes.h"
 #include "xdefs.h"
 
+#include "globFail_Errorcodes.h"
+#include "globFail_SafetyHandler.h"
+
 #include "aicCrc.h"
 
 /*******************************************************************************
@@ -56,6 +59,26 @@
 ********************************************************************************
 */
 
+/* Unique file id used to build additional info */
+#define k_FILEID                 46u
+
+/*------------------------------------------------------------------------------
+** Known answer of the startup test (see aicCrc_StartupTest()): CRC16 with
+** polynomial 0xA001 (reflected) and preset 0xFFFF of the ASCII string
+** "123456789" (check value of the CRC-16/MODBUS).
+**------------------------------------------------------------------------------
+*/
+#define AICCRC_KAT_LEN            ((UINT32)9u)
+#define AICCRC_KAT_CRC            ((UINT16)0x4B37u)
+/* split of the test string for aicCrc_Crc16Update(): 3 bytes (remainder
+** only), then 6 bytes (one 4 byte loop and a remainder of 2 bytes) */
+#define AICCRC_KAT_SPLIT          ((UINT32)3u)
+
+STATIC CONST UINT8 aicCrc_au8KatData[AICCRC_KAT_LEN] =
+{
+   0x31u, 0x32u, 0x33u, 0x34u, 0x35u, 0x36u, 0x37u, 0x38u, 0x39u
+};
+
 
 
 /*******************************************************************************
@@ -65,6 +88,157 @@
 ********************************************************************************
 */
 
+#if (AICCRC_SLICE_BY_4 == TRUE)
+
+/*------------------------------------------------------------------------------
+** Tables for the slicing-by-4 CRC16 calculation, polynomial 0xA001 (reflected),
+** see [SRS_419], [SIS_018]. Table [0] is the byte-wise table (high and low byte
+** of aicCrc_au8Crc16Hi/Lo merged), table [k] is the CRC of a byte followed by k
+** zero bytes, so four bytes are processed with four independent table lookups.
+**------------------------------------------------------------------------------
+*/
+STATIC CONST UINT16 aicCrc_au16Crc16Slice[4u][256u] =
+{
+   {
+      0x0000u, 0xC0C1u, 0xC181u, 0x0140u, 0xC301u, 0x03C0u, 0x0280u, 0xC241u,
+      0xC601u, 0x06C0u, 0x0780u, 0xC741u, 0x0500u, 0xC5C1u, 0xC481u, 0x0440u,
+      0xCC01u, 0x0CC0u, 0x0D80u, 0xCD41u, 0x0F00u, 0xCFC1u, 0xCE81u, 0x0E40u,
+      0x0A00u, 0xCAC1u, 0xCB81u, 0x0B40u, 0xC901u, 0x09C0u, 0x0880u, 0xC841u,
+      0xD801u, 0x18C0u, 0x1980u, 0xD941u, 0x1B00u, 0xDBC1u, 0xDA81u, 0x1A40u,
+      0x1E00u, 0xDEC1u, 0xDF81u, 0x1F40u, 0xDD01u, 0x1DC0u, 0x1C80u, 0xDC41u,
+      0x1400u, 0xD4C1u, 0xD581u, 0x1540u, 0xD701u, 0x17C0u, 0x1680u, 0xD641u,
+      0xD201u, 0x12C0u, 0x1380u, 0xD341u, 0x1100u, 0xD1C1u, 0xD081u, 0x1040u,
+      0xF001u, 0x30C0u, 0x3180u, 0xF141u, 0x3300u, 0xF3C1u, 0xF281u, 0x3240u,
+      0x3600u, 0xF6C1u, 0xF781u, 0x3740u, 0xF501u, 0x35C0u, 0x3480u, 0xF441u,
+      0x3C00u, 0xFCC1u, 0xFD81u, 0x3D40u, 0xFF01u, 0x3FC0u, 0x3E80u, 0xFE41u,
+      0xFA01u, 0x3AC0u, 0x3B80u, 0xFB41u, 0x3900u, 0xF9C1u, 0xF881u, 0x3840u,
+      0x2800u, 0xE8C1u, 0xE981u, 0x2940u, 0xEB01u, 0x2BC0u, 0x2A80u, 0xEA41u,
+      0xEE01u, 0x2EC0u, 0x2F80u, 0xEF41u, 0x2D00u, 0xEDC1u, 0xEC81u, 0x2C40u,
+      0xE401u, 0x24C0u, 0x2580u, 0xE541u, 0x2700u, 0xE7C1u, 0xE681u, 0x2640u,
+      0x2200u, 0xE2C1u, 0xE381u, 0x2340u, 0xE101u, 0x21C0u, 0x2080u, 0xE041u,
+      0xA001u, 0x60C0u, 0x6180u, 0xA141u, 0x6300u, 0xA3C1u, 0xA281u, 0x6240u,
+      0x6600u, 0xA6C1u, 0xA781u, 0x6740u, 0xA501u, 0x65C0u, 0x6480u, 0xA441u,
+      0x6C00u, 0xACC1u, 0xAD81u, 0x6D40u, 0xAF01u, 0x6FC0u, 0x6E80u, 0xAE41u,
+      0xAA01u, 0x6AC0u, 0x6B80u, 0xAB41u, 0x6900u, 0xA9C1u, 0xA881u, 0x6840u,
+      0x7800u, 0xB8C1u, 0xB981u, 0x7940u, 0xBB01u, 0x7BC0u, 0x7A80u, 0xBA41u,
+      0xBE01u, 0x7EC0u, 0x7F80u, 0xBF41u, 0x7D00u, 0xBDC1u, 0xBC81u, 0x7C40u,
+      0xB401u, 0x74C0u, 0x7580u, 0xB541u, 0x7700u, 0xB7C1u, 0xB681u, 0x7640u,
+      0x7200u, 0xB2C1u, 0xB381u, 0x7340u, 0xB101u, 0x71C0u, 0x7080u, 0xB041u,
+      0x5000u, 0x90C1u, 0x9181u, 0x5140u, 0x9301u, 0x53C0u, 0x5280u, 0x9241u,
+      0x9601u, 0x56C0u, 0x5780u, 0x9741u, 0x5500u, 0x95C1u, 0x9481u, 0x5440u,
+      0x9C01u, 0x5CC0u, 0x5D80u, 0x9D41u, 0x5F00u, 0x9FC1u, 0x9E81u, 0x5E40u,
+      0x5A00u, 0x9AC1u, 0x9B81u, 0x5B40u, 0x9901u, 0x59C0u, 0x5880u, 0x9841u,
+      0x8801u, 0x48C0u, 0x4980u, 0x8941u, 0x4B00u, 0x8BC1u, 0x8A81u, 0x4A40u,
+      0x4E00u, 0x8EC1u, 0x8F81u, 0x4F40u, 0x8D01u, 0x4DC0u, 0x4C80u, 0x8C41u,
+      0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u,
+      0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u
+   },
+   {
+      0x0000u, 0x9001u, 0x6001u, 0xF000u, 0xC002u, 0x5003u, 0xA003u, 0x3002u,
+      0xC007u, 0x5006u, 0xA006u, 0x3007u, 0x0005u, 0x9004u, 0x6004u, 0xF005u,
+      0xC00Du, 0x500Cu, 0xA00Cu, 0x300Du, 0x000Fu, 0x900Eu, 0x600Eu, 0xF00Fu,
+      0x000Au, 0x900Bu, 0x600Bu, 0xF00Au, 0xC008u, 0x5009u, 0xA009u, 0x3008u,
+      0xC019u, 0x5018u, 0xA018u, 0x3019u, 0x001Bu, 0x901Au, 0x601Au, 0xF01Bu,
+      0x001Eu, 0x901Fu, 0x601Fu, 0xF01Eu, 0xC01Cu, 0x501Du, 0xA01Du, 0x301Cu,
+      0x0014u, 0x9015u, 0x6015u, 0xF014u, 0xC016u, 0x5017u, 0xA017u, 0x3016u,
+      0xC013u, 0x5012u, 0xA012u, 0x3013u, 0x0011u, 0x9010u, 0x6010u, 0xF011u,
+      0xC031u, 0x5030u, 0xA030u, 0x3031u, 0x0033u, 0x9032u, 0x6032u, 0xF033u,
+      0x0036u, 0x9037u, 0x6037u, 0xF036u, 0xC034u, 0x5035u, 0xA035u, 0x3034u,
+      0x003Cu, 0x903Du, 0x603Du, 0xF03Cu, 0xC03Eu, 0x503Fu, 0xA03Fu, 0x303Eu,
+      0xC03Bu, 0x503Au, 0xA03Au, 0x303Bu, 0x0039u, 0x9038u, 0x6038u, 0xF039u,
+      0x0028u, 0x9029u, 0x6029u, 0xF028u, 0xC02Au, 0x502Bu, 0xA02Bu, 0x302Au,
+      0xC02Fu, 0x502Eu, 0xA02Eu, 0x302Fu, 0x002Du, 0x902Cu, 0x602Cu, 0xF02Du,
+      0xC025u, 0x5024u, 0xA024u, 0x3025u, 0x0027u, 0x9026u, 0x6026u, 0xF027u,
+      0x0022u, 0x9023u, 0x6023u, 0xF022u, 0xC020u, 0x5021u, 0xA021u, 0x3020u,
+      0xC061u, 0x5060u, 0xA060u, 0x3061u, 0x0063u, 0x9062u, 0x6062u, 0xF063u,
+      0x0066u, 0x9067u, 0x6067u, 0xF066u, 0xC064u, 0x5065u, 0xA065u, 0x3064u,
+      0x006Cu, 0x906Du, 0x606Du, 0xF06Cu, 0xC06Eu, 0x506Fu, 0xA06Fu, 0x306Eu,
+      0xC06Bu, 0x506Au, 0xA06Au, 0x306Bu, 0x0069u, 0x9068u, 0x6068u, 0xF069u,
+      0x0078u, 0x9079u, 0x6079u, 0xF078u, 0xC07Au, 0x507Bu, 0xA07Bu, 0x307Au,
+      0xC07Fu, 0x507Eu, 0xA07Eu, 0x307Fu, 0x007Du, 0x907Cu, 0x607Cu, 0xF07Du,
+      0xC075u, 0x5074u, 0xA074u, 0x3075u, 0x0077u, 0x9076u, 0x6076u, 0xF077u,
+      0x0072u, 0x9073u, 0x6073u, 0xF072u, 0xC070u, 0x5071u, 0xA071u, 0x3070u,
+      0x0050u, 0x9051u, 0x6051u, 0xF050u, 0xC052u, 0x5053u, 0xA053u, 0x3052u,
+      0xC057u, 0x5056u, 0xA056u, 0x3057u, 0x0055u, 0x9054u, 0x6054u, 0xF055u,
+      0xC05Du, 0x505Cu, 0xA05Cu, 0x305Du, 0x005Fu, 0x905Eu, 0x605Eu, 0xF05Fu,
+      0x005Au, 0x905Bu, 0x605Bu, 0xF05Au, 0xC058u, 0x5059u, 0xA059u, 0x3058u,
+      0xC049u, 0x5048u, 0xA048u, 0x3049u, 0x004Bu, 0x904Au, 0x604Au, 0xF04Bu,
+      0x004Eu, 0x904Fu, 0x604Fu, 0xF04Eu, 0xC04Cu, 0x504Du, 0xA04Du, 0x304Cu,
+      0x0044u, 0x9045u, 0x6045u, 0xF044u, 0xC046u, 0x5047u, 0xA047u, 0x3046u,
+      0xC043u, 0x5042u, 0xA042u, 0x3043u, 0x0041u, 0x9040u, 0x6040u, 0xF041u
+   },
+   {
+      0x0000u, 0xC051u, 0xC0A1u, 0x00F0u, 0xC141u, 0x0110u, 0x01E0u, 0xC1B1u,
+      0xC281u, 0x02D0u, 0x0220u, 0xC271u, 0x03C0u, 0xC391u, 0xC361u, 0x0330u,
+      0xC501u, 0x0550u, 0x05A0u, 0xC5F1u, 0x0440u, 0xC411u, 0xC4E1u, 0x04B0u,
+      0x0780u, 0xC7D1u, 0xC721u, 0x0770u, 0xC6C1u, 0x0690u, 0x0660u, 0xC631u,
+      0xCA01u, 0x0A50u, 0x0AA0u, 0xCAF1u, 0x0B40u, 0xCB11u, 0xCBE1u, 0x0BB0u,
+      0x0880u, 0xC8D1u, 0xC821u, 0x0870u, 0xC9C1u, 0x0990u, 0x0960u, 0xC931u,
+      0x0F00u, 0xCF51u, 0xCFA1u, 0x0FF0u, 0xCE41u, 0x0E10u, 0x0EE0u, 0xCEB1u,
+      0xCD81u, 0x0DD0u, 0x0D20u, 0xCD71u, 0x0CC0u, 0xCC91u, 0xCC61u, 0x0C30u,
+      0xD401u, 0x1450u, 0x14A0u, 0xD4F1u, 0x1540u, 0xD511u, 0xD5E1u, 0x15B0u,
+      0x1680u, 0xD6D1u, 0xD621u, 0x1670u, 0xD7C1u, 0x1790u, 0x1760u, 0xD731u,
+      0x1100u, 0xD151u, 0xD1A1u, 0x11F0u, 0xD041u, 0x1010u, 0x10E0u, 0xD0B1u,
+      0xD381u, 0x13D0u, 0x1320u, 0xD371u, 0x12C0u, 0xD291u, 0xD261u, 0x1230u,
+      0x1E00u, 0xDE51u, 0xDEA1u, 0x1EF0u, 0xDF41u, 0x1F10u, 0x1FE0u, 0xDFB1u,
+      0xDC81u, 0x1CD0u, 0x1C20u, 0xDC71u, 0x1DC0u, 0xDD91u, 0xDD61u, 0x1D30u,
+      0xDB01u, 0x1B50u, 0x1BA0u, 0xDBF1u, 0x1A40u, 0xDA11u, 0xDAE1u, 0x1AB0u,
+      0x1980u, 0xD9D1u, 0xD921u, 0x1970u, 0xD8C1u, 0x1890u, 0x1860u, 0xD831u,
+      0xE801u, 0x2850u, 0x28A0u, 0xE8F1u, 0x2940u, 0xE911u, 0xE9E1u, 0x29B0u,
+      0x2A80u, 0xEAD1u, 0xEA21u, 0x2A70u, 0xEBC1u, 0x2B90u, 0x2B60u, 0xEB31u,
+      0x2D00u, 0xED51u, 0xEDA1u, 0x2DF0u, 0xEC41u, 0x2C10u, 0x2CE0u, 0xECB1u,
+      0xEF81u, 0x2FD0u, 0x2F20u, 0xEF71u, 0x2EC0u, 0xEE91u, 0xEE61u, 0x2E30u,
+      0x2200u, 0xE251u, 0xE2A1u, 0x22F0u, 0xE341u, 0x2310u, 0x23E0u, 0xE3B1u,
+      0xE081u, 0x20D0u, 0x2020u, 0xE071u, 0x21C0u, 0xE191u, 0xE161u, 0x2130u,
+      0xE701u, 0x2750u, 0x27A0u, 0xE7F1u, 0x2640u, 0xE611u, 0xE6E1u, 0x26B0u,
+      0x2580u, 0xE5D1u, 0xE521u, 0x2570u, 0xE4C1u, 0x2490u, 0x2460u, 0xE431u,
+      0x3C00u, 0xFC51u, 0xFCA1u, 0x3CF0u, 0xFD41u, 0x3D10u, 0x3DE0u, 0xFDB1u,
+      0xFE81u, 0x3ED0u, 0x3E20u, 0xFE71u, 0x3FC0u, 0xFF91u, 0xFF61u, 0x3F30u,
+      0xF901u, 0x3950u, 0x39A0u, 0xF9F1u, 0x3840u, 0xF811u, 0xF8E1u, 0x38B0u,
+      0x3B80u, 0xFBD1u, 0xFB21u, 0x3B70u, 0xFAC1u, 0x3A90u, 0x3A60u, 0xFA31u,
+      0xF601u, 0x3650u, 0x36A0u, 0xF6F1u, 0x3740u, 0xF711u, 0xF7E1u, 0x37B0u,
+      0x3480u, 0xF4D1u, 0xF421u, 0x3470u, 0xF5C1u, 0x3590u, 0x3560u, 0xF531u,
+      0x3300u, 0xF351u, 0xF3A1u, 0x33F0u, 0xF241u, 0x3210u, 0x32E0u, 0xF2B1u,
+      0xF181u, 0x31D0u, 0x3120u, 0xF171u, 0x30C0u, 0xF091u, 0xF061u, 0x3030u
+   },
+   {
+      0x0000u, 0xFC01u, 0xB801u, 0x4400u, 0x3001u, 0xCC00u, 0x8800u, 0x7401u,
+      0x6002u, 0x9C03u, 0xD803u, 0x2402u, 0x5003u, 0xAC02u, 0xE802u, 0x1403u,
+      0xC004u, 0x3C05u, 0x7805u, 0x8404u, 0xF005u, 0x0C04u, 0x4804u, 0xB405u,
+      0xA006u, 0x5C07u, 0x1807u, 0xE406u, 0x9007u, 0x6C06u, 0x2806u, 0xD407u,
+      0xC00Bu, 0x3C0Au, 0x780Au, 0x840Bu, 0xF00Au, 0x0C0Bu, 0x480Bu, 0xB40Au,
+      0xA009u, 0x5C08u, 0x1808u, 0xE409u, 0x9008u, 0x6C09u, 0x2809u, 0xD408u,
+      0x000Fu, 0xFC0Eu, 0xB80Eu, 0x440Fu, 0x300Eu, 0xCC0Fu, 0x880Fu, 0x740Eu,
+      0x600Du, 0x9C0Cu, 0xD80Cu, 0x240Du, 0x500Cu, 0xAC0Du, 0xE80Du, 0x140Cu,
+      0xC015u, 0x3C14u, 0x7814u, 0x8415u, 0xF014u, 0x0C15u, 0x4815u, 0xB414u,
+      0xA017u, 0x5C16u, 0x1816u, 0xE417u, 0x9016u, 0x6C17u, 0x2817u, 0xD416u,
+      0x0011u, 0xFC10u, 0xB810u, 0x4411u, 0x3010u, 0xCC11u, 0x8811u, 0x7410u,
+      0x6013u, 0x9C12u, 0xD812u, 0x2413u, 0x5012u, 0xAC13u, 0xE813u, 0x1412u,
+      0x001Eu, 0xFC1Fu, 0xB81Fu, 0x441Eu, 0x301Fu, 0xCC1Eu, 0x881Eu, 0x741Fu,
+      0x601Cu, 0x9C1Du, 0xD81Du, 0x241Cu, 0x501Du, 0xAC1Cu, 0xE81Cu, 0x141Du,
+      0xC01Au, 0x3C1Bu, 0x781Bu, 0x841Au, 0xF01Bu, 0x0C1Au, 0x481Au, 0xB41Bu,
+      0xA018u, 0x5C19u, 0x1819u, 0xE418u, 0x9019u, 0x6C18u, 0x2818u, 0xD419u,
+      0xC029u, 0x3C28u, 0x7828u, 0x8429u, 0xF028u, 0x0C29u, 0x4829u, 0xB428u,
+      0xA02Bu, 0x5C2Au, 0x182Au, 0xE42Bu, 0x902Au, 0x6C2Bu, 0x282Bu, 0xD42Au,
+      0x002Du, 0xFC2Cu, 0xB82Cu, 0x442Du, 0x302Cu, 0xCC2Du, 0x882Du, 0x742Cu,
+      0x602Fu, 0x9C2Eu, 0xD82Eu, 0x242Fu, 0x502Eu, 0xAC2Fu, 0xE82Fu, 0x142Eu,
+      0x0022u, 0xFC23u, 0xB823u, 0x4422u, 0x3023u, 0xCC22u, 0x8822u, 0x7423u,
+      0x6020u, 0x9C21u, 0xD821u, 0x2420u, 0x5021u, 0xAC20u, 0xE820u, 0x1421u,
+      0xC026u, 0x3C27u, 0x7827u, 0x8426u, 0xF027u, 0x0C26u, 0x4826u, 0xB427u,
+      0xA024u, 0x5C25u, 0x1825u, 0xE424u, 0x9025u, 0x6C24u, 0x2824u, 0xD425u,
+      0x003Cu, 0xFC3Du, 0xB83Du, 0x443Cu, 0x303Du, 0xCC3Cu, 0x883Cu, 0x743Du,
+      0x603Eu, 0x9C3Fu, 0xD83Fu, 0x243Eu, 0x503Fu, 0xAC3Eu, 0xE83Eu, 0x143Fu,
+      0xC038u, 0x3C39u, 0x7839u, 0x8438u, 0xF039u, 0x0C38u, 0x4838u, 0xB439u,
+      0xA03Au, 0x5C3Bu, 0x183Bu, 0xE43Au, 0x903Bu, 0x6C3Au, 0x283Au, 0xD43Bu,
+      0xC037u, 0x3C36u, 0x7836u, 0x8437u, 0xF036u, 0x0C37u, 0x4837u, 0xB436u,
+      0xA035u, 0x5C34u, 0x1834u, 0xE435u, 0x9034u, 0x6C35u, 0x2835u, 0xD434u,
+      0x0033u, 0xFC32u, 0xB832u, 0x4433u, 0x3032u, 0xCC33u, 0x8833u, 0x7432u,
+      0x6031u, 0x9C30u, 0xD830u, 0x2431u, 0x5030u, 0xAC31u, 0xE831u, 0x1430u
+   }
+};
+
+#else
+
 /*------------------------------------------------------------------------------
 ** Tables for generating CRC16 checksum, it is splitted in high and low byte,
 ** polynomial 0xA001, see [SRS_419], [SIS_018]
@@ -126,6 +300,8 @@ STATIC CONST UINT8 aicCrc_au8Crc16Lo[256u] =
    0x81u, 0x80u, 0x40u
 };
 
+#endif
+
 
 /*------------------------------------------------------------------------------
 **
@@ -154,22 +330,92 @@ STATIC CONST UINT8 aicCrc_au8Crc16Lo[256u] =
 */
 UINT16 aicCrc_Crc16 (CONST UINT8* pu8BufferStart, CONST UINT32 u32Length)
 {
+   /* preset value 0xffff, [SRS_419], [SIS_018] */
+   return aicCrc_Crc16Update(AICCRC_CRC16_PRESET, pu8BufferStart, u32Length);
+} /* End of aicCrc_crc16() */
+
+
+/*------------------------------------------------------------------------------
+**
+** aicCrc_Crc16Update()
+**
+** Description:
+**    Continues a crc16 calculation with the next bytes of the buffer. The CRC
+**    of a buffer is the same if it is calculated at once or in several parts:
+**    the first part starts with AICCRC_CRC16_PRESET, the following parts with
+**    the return value of the previous part. Used to calculate the CRC of the
+**    AIC telegram during its reception (see aicUart.c). Reentrant.
+**
+**------------------------------------------------------------------------------
+** Inputs:
+**    u16Crc:              CRC of the previous parts (AICCRC_CRC16_PRESET for
+**                         the first part)
+**    *pu8Buffer:          Pointer to the next bytes
+**    u32Length:           Number of the next bytes
+**
+** Return:
+**    UINT16               CRC including the next bytes
+**
+** Usage:
+**    u16Crc = aicCrc_Crc16Update(u16Crc, &au8Buf[u32Done], u32New);
+**
+** Module Test:
+**    - NO -
+**    Reason: low complexity, functionality checked within every message
+**            transfer, and to test possible CRC results makes not much sense
+**------------------------------------------------------------------------------
+*/
+UINT16 aicCrc_Crc16Update (CONST UINT16 u16Crc, CONST UINT8* pu8Buffer,
+                           CONST UINT32 u32Length)
+{
+   UINT32  i = 0u;
+   UINT32  u32Len = u32Length;
+#if (AICCRC_SLICE_BY_4 == TRUE)
+   UINT16  u16Reg = u16Crc;
+
+   /*
+   ** Do the crc calculation, 4 bytes per loop: the first two bytes are merged
+   ** into the CRC register, the table lookups of the 4 bytes are independent
+   */
+   while( u32Len >= (UINT32)4u )
+   {
+      /* Pointer arithmetic is OK. */
+      u16Reg ^= (UINT16)((UINT16)pu8Buffer[i]                     /*lint !e960*/
+              | (UINT16)((UINT16)pu8Buffer[i + 1u] << 8u));        /*lint !e960*/
+      u16Reg = (UINT16)( aicCrc_au16Crc16Slice[3u][u16Reg & 0xFFu]
+                       ^ aicCrc_au16Crc16Slice[2u][u16Reg >> 8u]
+                       ^ aicCrc_au16Crc16Slice[1u][pu8Buffer[i + 2u]]/*lint !e960*/
+                       ^ aicCrc_au16Crc16Slice[0u][pu8Buffer[i + 3u]]);/*lint !e960*/
+      u32Len -= (UINT32)4u;
+      i += (UINT32)4u;
+   }
+
+   /* remaining 0..3 bytes byte-wise */
+   while( u32Len > (UINT32)0u )
+   {
+      /* Pointer arithmetic is OK. */
+      u16Reg = (UINT16)((u16Reg >> 8u)
+             ^ aicCrc_au16Crc16Slice[0u][(u16Reg ^ pu8Buffer[i]) & 0xFFu]);/*lint !e960*/
+      u32Len--;
+      i++;
+   }
+
+   return u16Reg;
+#else
    UINT8   u8Index;
    UINT8   u8CRCHi;
    UINT8   u8CRCLo;
-   UINT32  i = 0u;
-   UINT32  u32Len = u32Length;
 
-   /* set high and low byte of crc preset value to 0xff, [SRS_419], [SIS_018] */
-   u8CRCHi = (UINT8)0xFFu;
-   u8CRCLo = (UINT8)0xFFu;
+   /* split CRC in high and low byte of the tables */
+   u8CRCHi = (UINT8)(u16Crc & 0xFFu);
+   u8CRCLo = (UINT8)(u16Crc >> 8u);
 
    /*
    ** Do the crc calculation
    */
    while( u32Len > (UINT32)0u )
    {
-      u8Index = u8CRCHi ^ *(pu8BufferStart + i);/*lint !e960*/
+      u8Index = u8CRCHi ^ *(pu8Buffer + i);/*lint !e960*/
       /* Pointer arithmetic is OK. */
       u8CRCHi = u8CRCLo ^ aicCrc_au8Crc16Hi[ u8Index ];
       u8CRCLo = aicCrc_au8Crc16Lo[ u8Index ];
@@ -178,7 +424,73 @@ UINT16 aicCrc_Crc16 (CONST UINT8* pu8BufferStart, CONST UINT32 u32Length)
    }
 
    return ( (UINT16)((UINT16)u8CRCLo << 8u) | (UINT16)u8CRCHi );
-} /* End of aicCrc_crc16() */
+#endif
+} /* End of aicCrc_Crc16Update() */
+
+
+/*------------------------------------------------------------------------------
+**
+** aicCrc_StartupTest()
+**
+** Description:
+**    Known answer test of aicCrc_Crc16() and aicCrc_Crc16Update() with the
+**    tables of the selected kernel (see AICCRC_SLICE_BY_4). The CRC of the
+**    test string is calculated at once and in two parts, both shall be the
+**    known answer, else the Safety Handler is called. So a wrong table or
+**    kernel is detected before the first AIC telegram is checked.
+**
+**------------------------------------------------------------------------------
+** Inputs:
+**    - None -
+**
+** Return:
+**    - None -
+**
+** Usage:
+**    aicCrc_StartupTest();
+**
+** Remarks:
+**    Context: main (during initialization)
+**
+** Module Test:
+**    - NO -
+**    Reason: low complexity
+**------------------------------------------------------------------------------
+*/
+void aicCrc_StartupTest (void)
+{
+   UINT16 u16Crc;
+
+   /* CRC at once */
+   u16Crc = aicCrc_Crc16(aicCrc_au8KatData, AICCRC_KAT_LEN);
+
+   /* if wrong CRC */
+   if (u16Crc != AICCRC_KAT_CRC)
+   {
+      GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(1u));
+   }
+   else
+   {
+      /* empty branch */
+   }
+
+   /* CRC in two parts */
+   u16Crc = aicCrc_Crc16Update(AICCRC_CRC16_PRESET, aicCrc_au8KatData,
+                               AICCRC_KAT_SPLIT);
+   /* Pointer arithmetic is OK. */
+   u16Crc = aicCrc_Crc16Update(u16Crc, aicCrc_au8KatData + AICCRC_KAT_SPLIT,/*lint !e960*/
+                               AICCRC_KAT_LEN - AICCRC_KAT_SPLIT);
+
+   /* if wrong CRC */
+   if (u16Crc != AICCRC_KAT_CRC)
+   {
+      GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(2u));
+   }
+   else
+   {
+      /* empty branch */
+   }
+} /* End of aicCrc_StartupTest() */
 
 
 
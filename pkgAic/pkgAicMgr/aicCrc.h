@@ -46,6 +46,11 @@
 ********************************************************************************
 */
 
+/* CRC16 kernel: TRUE - slicing-by-4 (4 bytes per loop, 2 KByte tables),
+** FALSE - byte-wise (512 Byte tables). Can be set by the compiler options. */
+#ifndef AICCRC_SLICE_BY_4
+  #define AICCRC_SLICE_BY_4       TRUE
+#endif
 
 /*******************************************************************************
 **
@@ -54,6 +59,8 @@
 ********************************************************************************
 */
 
+/* preset value of the CRC16, [SRS_419], [SIS_018] */
+#define AICCRC_CRC16_PRESET       ((UINT16)0xFFFFu)
 
 /*******************************************************************************
 **
@@ -79,6 +86,9 @@
 */
 
 extern UINT16 aicCrc_Crc16(CONST UINT8* pu8BufferStart, CONST UINT32 u32Length);
+extern UINT16 aicCrc_Crc16Update(CONST UINT16 u16Crc, CONST UINT8* pu8Buffer,
+                                 CONST UINT32 u32Length);
+extern void aicCrc_StartupTest(void);
 
 #endif  /* inclusion lock */
 
@@ -48,7 +48,6 @@
 #include "includeDiDo.h"
 
 #include "aicMsgDef.h"
-#include "aicCrc.h"
 #include "aicUart.h"
 #include "globFit_FitTestHandler.h"
 
@@ -339,7 +338,8 @@ void aicMgrRx_GetOutputData (void)
     SplitAndCheckBuffer
 
   Description:
-    - checks if the telegram received is correct (CRC check)
+    - checks if the telegram received is correct (CRC check, the CRC is calculated
+      during the reception, see aicUart_RxCrcFinish())
     - If the CRC is correct, the RX-Telegram is splitted into the different
       parts (see [SRS_2021]) and stored on the data stack (global variables/structs):
        - Ctrl/Status-Byte of AM/ABCC
@@ -368,13 +368,16 @@ STATIC BOOL SplitAndCheckBuffer (void)
   UINT16  u16CalcCRC;
   BOOL    bRetVal = FALSE;
 
-  /* FIT to manipulate the AIC telegram to get a crc error */
-  GLOBFIT_FITTEST(GLOBFIT_CMD_AIC_CRC, aicUart_sAicRxDmaBuffer.sAmMsg.au8AicMsgData[0u] ^= 0x01u);
+  /* FIT to manipulate the AIC telegram to get a crc error, the CRC calculated
+   * during the reception does not contain the manipulation and is discarded */
+  GLOBFIT_FITTEST(GLOBFIT_CMD_AIC_CRC,
+                  { aicUart_sAicRxDmaBuffer.sAmMsg.au8AicMsgData[0u] ^= 0x01u;
+                    aicUart_RxCrcRestart(); });
 
-  /* check the received messages CRC, see [SRS_418], [SRS_420], [SIS_019] */
-  /* Deactivated PC-Lint Message 928 because cast from pointer to pointer is OK. */
-  u16CalcCRC = aicCrc_Crc16( (UINT8*)(&aicUart_sAicRxDmaBuffer),/*lint !e928*/
-                          (UINT32)(AICMSGDEF_AM_TGM_SIZE - AICMSGDEF_ASM_CRC_SIZE));
+  /* check the received messages CRC, see [SRS_418], [SRS_420], [SIS_019].
+   * The CRC is calculated during the reception by the Rx DMA interrupt, only
+   * the bytes not yet processed by it are calculated here. */
+  u16CalcCRC = aicUart_RxCrcFinish();
 
   if (u16CalcCRC == aicUart_sAicRxDmaBuffer.u16Crc)
   {
@@ -168,6 +168,9 @@ void aicMgrTx_SysInit (void)
   /* init non-safe message part */
   aicMsgProc_Init();
 
+  /* known answer test of the CRC16, before the first AIC telegram is checked */
+  aicCrc_StartupTest();
+
   /* initialization of UART/DMA HW */
   aicUart_UartDmaInit();
 
@@ -21,6 +21,8 @@
 **
 ** module containing:
 ** - UART/DMA interface functions for AIC
+** - CRC calculation of the received telegram during the reception (Rx DMA
+**   half transfer and transfer complete interrupt)
 **
 ********************************************************************************
 ********************************************************************************
@@ -51,6 +53,7 @@
 
 /* AIC module includes  */
 #include "aicMsgDef.h"
+#include "aicCrc.h"
 #include "aicUart.h"
 
 
@@ -81,6 +84,27 @@ AICMSGDEF_AM_TELEGRAM_STRUCT aicUart_sAicRxDmaBuffer
 ********************************************************************************
 */
 
+/* number of bytes of the Rx telegram protected by the CRC (CRC at the end) */
+#define AICUART_RX_CRC_LEN       ( (UINT16)(AICMSGDEF_AM_TGM_SIZE - AICMSGDEF_ASM_CRC_SIZE) )
+
+/* Priority of the Rx DMA interrupt, lower than the priority of the IRQ
+** Scheduler (2): the CRC is advanced between the time slices and never
+** extends a time slice. The bytes not yet processed when the telegram is
+** checked are calculated by aicUart_RxCrcFinish(). */
+#define AICUART_RX_IRQ_PRIORITY  ( (UINT32)3u )
+
+/*------------------------------------------------------------------------------
+** CRC of the Rx telegram calculated during the reception: CRC of the first
+** aicUart_u16RxCrcCnt bytes of aicUart_sAicRxDmaBuffer. It is advanced by the
+** half transfer and transfer complete interrupt of the Rx DMA, so only the
+** rest is calculated when the telegram is checked (aicUart_RxCrcFinish()).
+**------------------------------------------------------------------------------
+*/
+STATIC UINT16 aicUart_u16RxCrc    = AICCRC_CRC16_PRESET;
+STATIC UINT16 aicUart_u16RxCrcCnt = 0u;
+
+STATIC void aicUart_RxCrcAdvance (void);
+
 
 /*******************************************************************************
 **
@@ -162,6 +186,10 @@ void aicUart_UartDmaInit (void)
    /* init the DMA for Rx (see [SRS_180]) */
    aicUart_DmaInitRx();
 
+   /* the interrupts of the Rx DMA calculate the CRC during the reception */
+   NVIC_SetPriority(DMA2_Channel3_IRQn, AICUART_RX_IRQ_PRIORITY);
+   NVIC_EnableIRQ(DMA2_Channel3_IRQn);
+
    /* Lint message 923 deactivated because pointer address is casted to a
     * numeric value to set the DMA to the specific RAM address. */
 }
@@ -254,7 +282,8 @@ void aicUart_TriggerSendingStartup (void)
 ** aicUart_DmaInitRx()
 **
 ** Description:
-**    initialization of reception via DMA
+**    initialization of reception via DMA, the CRC calculation of the
+**    received telegram is restarted
 **
 **------------------------------------------------------------------------------
 ** Input:
@@ -280,6 +309,12 @@ void aicUart_DmaInitRx (void)
    /* write DMA-size in CNTR-Register */
    AIC_RX_UART_DMA2_CHANNEL3->CNDTR = AICMSGDEF_AM_TGM_SIZE;
 
+   /* restart the CRC calculation, the Rx DMA interrupt sees no received bytes
+    * because the CNDTR is already reloaded */
+   aicUart_u16RxCrc    = AICCRC_CRC16_PRESET;
+   aicUart_u16RxCrcCnt = 0u;
+   DMA2->IFCR = DMA_IFCR_CGIF3;
+
    /* enable DMA and UART */
    AIC_RX_UART_DMA2_CHANNEL3->CCR |= DMA_CCR3_EN; /* Rx */
 
@@ -333,6 +368,123 @@ BOOL aicUart_NewTgmReceived (void)
 }
 
 
+/*------------------------------------------------------------------------------
+**
+** aicUart_RxCrcFinish()
+**
+** Description:
+**    returns the CRC of the received telegram (without the CRC at the end).
+**    Most of the CRC is calculated during the reception by the Rx DMA
+**    interrupt, only the bytes not yet processed are calculated here.
+**    Shall only be called if aicUart_NewTgmReceived() returned TRUE.
+**
+**------------------------------------------------------------------------------
+** Input:
+**    - None -
+**
+** Return:
+**    UINT16: CRC of the received telegram
+**
+** Usage:
+**    u16CalcCRC = aicUart_RxCrcFinish();
+**
+** Module Test:
+**    - NO -
+**    Reason: easy to understand, low complexity
+**------------------------------------------------------------------------------
+*/
+UINT16 aicUart_RxCrcFinish (void)
+{
+   UINT16 u16Crc;
+
+   /* the Rx DMA interrupt shall not advance the CRC at the same time */
+   __disable_irq();
+   aicUart_RxCrcAdvance();
+   u16Crc = aicUart_u16RxCrc;
+   __enable_irq();
+
+   /* all bytes of the telegram shall be included */
+   GLOBFAIL_SAFETY_ASSERT( ( aicUart_u16RxCrcCnt == AICUART_RX_CRC_LEN ),
+                             GLOB_FAILCODE_VARIABLE_ERR);
+
+   return u16Crc;
+}
+
+
+/*------------------------------------------------------------------------------
+**
+** aicUart_RxCrcRestart()
+**
+** Description:
+**    discards the CRC calculated during the reception, the next call of
+**    aicUart_RxCrcFinish() calculates the CRC of the complete telegram. Used
+**    if the received telegram was changed (FIT test).
+**
+**------------------------------------------------------------------------------
+** Input:
+**    - None -
+**
+** Return:
+**    - None -
+**
+** Usage:
+**    aicUart_RxCrcRestart();
+**
+** Module Test:
+**    - NO -
+**    Reason: easy to understand, low complexity
+**------------------------------------------------------------------------------
+*/
+void aicUart_RxCrcRestart (void)
+{
+   __disable_irq();
+   aicUart_u16RxCrc    = AICCRC_CRC16_PRESET;
+   aicUart_u16RxCrcCnt = 0u;
+   __enable_irq();
+}
+
+
+/*------------------------------------------------------------------------------
+**
+** DMA2_Channel3_IRQHandler()
+**
+** Description:
+**    Interrupt service routine of the AIC Rx DMA. The half transfer and
+**    transfer complete interrupt advance the CRC of the received telegram,
+**    so the CRC check in aicMgrRx_CheckForNewTgm() only has to finish it.
+**
+**------------------------------------------------------------------------------
+** Input:
+**    - None -
+**
+** Return:
+**    - None -
+**
+** Usage:
+**    DMA2 Channel 3 IRQ
+**
+** Module Test:
+**    - NO -
+**    Reason: easy to understand, low complexity
+**------------------------------------------------------------------------------
+*/
+void DMA2_Channel3_IRQHandler (void)
+{
+   /* if half transfer or transfer complete */
+   if ((DMA2->ISR & (DMA_ISR_HTIF3 | DMA_ISR_TCIF3)) != 0u)
+   {
+      aicUart_RxCrcAdvance();
+   }
+   else
+   {
+      /* empty branch */
+   }
+
+   /* clear all flags of channel 3 */
+   DMA2->IFCR = DMA_IFCR_CGIF3;
+}
+
+
 /*******************************************************************************
 **
 ** Private Services
@@ -340,6 +492,59 @@ BOOL aicUart_NewTgmReceived (void)
 ********************************************************************************
 */
 
+/*------------------------------------------------------------------------------
+**
+** aicUart_RxCrcAdvance()
+**
+** Description:
+**    advances the CRC of the Rx telegram over the bytes received by the DMA
+**    since the last call (CNDTR counts down the bytes still to receive). The
+**    CRC at the end of the telegram is not included.
+**
+**------------------------------------------------------------------------------
+** Input:
+**    - None -
+**
+** Return:
+**    - None -
+**
+** Usage:
+**    aicUart_RxCrcAdvance();
+**
+** Module Test:
+**    - NO -
+**    Reason: easy to understand, low complexity
+**------------------------------------------------------------------------------
+*/
+STATIC void aicUart_RxCrcAdvance (void)
+{
+   UINT16 u16Rcvd;
+   CONST UINT8 *pu8 = (CONST UINT8*) &aicUart_sAicRxDmaBuffer;/*lint !e928*/
+
+   u16Rcvd = (UINT16)(AICMSGDEF_AM_TGM_SIZE - AIC_RX_UART_DMA2_CHANNEL3->CNDTR);
+   if (u16Rcvd > AICUART_RX_CRC_LEN)
+   {
+      u16Rcvd = AICUART_RX_CRC_LEN;
+   }
+   else
+   {
+      /* empty branch */
+   }
+
+   if (u16Rcvd > aicUart_u16RxCrcCnt)
+   {
+      /* Pointer arithmetic is OK. */
+      aicUart_u16RxCrc = aicCrc_Crc16Update(aicUart_u16RxCrc,
+                                            pu8 + aicUart_u16RxCrcCnt,/*lint !e960*/
+                                            (UINT32)(u16Rcvd - aicUart_u16RxCrcCnt));
+      aicUart_u16RxCrcCnt = u16Rcvd;
+   }
+   else
+   {
+      /* empty branch */
+   }
+}
+
 
 
 /*******************************************************************************
@@ -84,6 +84,8 @@ extern void aicUart_DmaInitRx(void);
 extern void aicUart_TriggerSending(void);
 extern void aicUart_TriggerSendingStartup(void);
 extern BOOL aicUart_NewTgmReceived(void);
+extern UINT16 aicUart_RxCrcFinish(void);
+extern void aicUart_RxCrcRestart(void);
 
 
 #endif  /* inclusion lock */
@@ -149,10 +149,14 @@
 **------------------------------------------------------------------------------
 */
 #ifdef RFID_ACTIVE
-#define AICMSGDEF_CIP_IN_DATA_ASM264_SIZE      ((UINT8)14u + (4u * 2u))
+#define AICMSGDEF_CIP_IN_RFID_SIZE             ((UINT8)4u)
 #else
-#define AICMSGDEF_CIP_IN_DATA_ASM264_SIZE      ((UINT8)14u)
+#define AICMSGDEF_CIP_IN_RFID_SIZE             ((UINT8)0u)
 #endif
+/* The additional user data (e.g. RFID data) is transferred twice (actual and complemented data),
+** the sub frame exchange in spduIn.c adapts automatically to this size.
+*/
+#define AICMSGDEF_CIP_IN_DATA_ASM264_SIZE      ((UINT8)(14u + (AICMSGDEF_CIP_IN_RFID_SIZE * 2u)))
 /*------------------------------------------------------------------------------
 **  size of Data field inside T100 SPDU 
 **  The following layout is given:
@@ -97,7 +97,7 @@ TRUE_FALSE_ENUM aicSm_eFirstMsgReceived = eFALSE;
 ** (4.) Application running in Background task (e.g. Configuration done)
 ** (5.) Ctrl/Status processing running in IRQ scheduler (e.g. Abort request from ABCC)
 **
-** The message queue size was calculated to process in each cycle (4ms) up to 4 events:
+** The message queue size was calculated to process in each cycle (T-cyc) up to 4 events:
 ** - Two events of (1.) (one for each Safety Connection)
 ** - One event of (2.) respectively (3.) (only one message is received and processed in each cycle)
 ** - One event of (5.) (only one state request possible)
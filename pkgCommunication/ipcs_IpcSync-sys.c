@@ -60,6 +60,7 @@
 #include "timer-def.h"
 #include "timer-hal.h"
 #include "gpio-hal.h"
+#include "hist-sys.h"
 
 #include "globFit_FitTestHandler.h"
 
@@ -83,6 +84,14 @@
  ********************************************************************************
  */
 
+/* Time waited for the other controller in ipcsSYS_Sync() in microseconds, free running sum 
+ * (see ipcsSYS_GetWaitTime()). */
+STATIC UINT32 ipcsSYS_u32WaitTime = 0u;
+
+/* Histogram of the time waited for the other controller in ipcsSYS_Sync()
+ * (see IPCSSYS_WAIT_HIST_CNT), all counters are halved if one saturates. */
+STATIC UINT16 ipcsSYS_au16WaitHist[IPCSSYS_WAIT_HIST_CNT];
+
 /*******************************************************************************
  **
  ** Public Services
@@ -244,7 +253,7 @@ void ipcsSYS_SyncStartup (void)
 void ipcsSYS_Sync( void )
 {
    UINT32 u32SysTime;
-   UINT32 u32Timeout;
+   UINT32 u32Timeout = 0u;
 
    LOCAL_STATIC (, GPIO_PINSTATE_ENUM,
                    ePinExpectedState,
@@ -300,6 +309,11 @@ void ipcsSYS_Sync( void )
       GPIO_PINSTATE_SAFETY_ASSERT(ePinState);
    }
 
+   /* add the time waited for the other controller (0 if it was already at the sync point) */
+   ipcsSYS_u32WaitTime += u32Timeout;
+   histSYS_Add(ipcsSYS_au16WaitHist, (UINT8)IPCSSYS_WAIT_HIST_CNT,
+               histSYS_WaitBucket(u32Timeout, IPCSSYS_WAIT_HIST_US));
+
    /* Check the expected pin state and set it to the opposite pin state.
     * A check against an invalid value of the expected pin state is not
     * necessary because an indirect check is in the while loop above. The only
@@ -318,6 +332,110 @@ void ipcsSYS_Sync( void )
 
 } /* end of ipcsSYS_Sync() */
 
+/*------------------------------------------------------------------------------
+ **
+ ** ipcsSYS_GetWaitTime()
+ **
+ ** Description:
+ ** This function returns the time waited for the other controller in
+ ** ipcsSYS_Sync() in microseconds. The value is a free running sum, the
+ ** caller builds the difference to an earlier value.
+ **
+ **------------------------------------------------------------------------------
+ ** Input:
+ **  void
+ **
+ ** Return:
+ **  UINT32   Sum of the wait time in microseconds
+ **
+ ** Usage:
+ **  -
+ **
+ ** Module Test: - NO -
+ **              Reason: low complexity
+ **------------------------------------------------------------------------------
+ */
+UINT32 ipcsSYS_GetWaitTime( void )
+{
+   return ipcsSYS_u32WaitTime;
+} /* end of ipcsSYS_GetWaitTime() */
+
+/*------------------------------------------------------------------------------
+ **
+ ** ipcsSYS_GetWaitHist()
+ **
+ ** Description:
+ ** This function copies the histogram of the time waited for the other
+ ** controller in ipcsSYS_Sync() (see IPCSSYS_WAIT_HIST_CNT).
+ **
+ **------------------------------------------------------------------------------
+ ** Input:
+ **  pau16Hist   Buffer for IPCSSYS_WAIT_HIST_CNT counters
+ **              (valid range: <>NULL, not checked)
+ **
+ ** Return:
+ **  void
+ **
+ ** Usage:
+ **  -
+ **
+ ** Remarks:
+ **   Context: Background Task (IRQs disabled by caller)
+ **
+ ** Module Test: - NO -
+ **              Reason: low complexity
+ **------------------------------------------------------------------------------
+ */
+void ipcsSYS_GetWaitHist( UINT16* pau16Hist )
+{
+   UINT8 u8Idx;
+
+   for (u8Idx = 0u; u8Idx < IPCSSYS_WAIT_HIST_CNT; u8Idx++)
+   {
+      /*lint -esym(960, 17.4)*/
+      /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+       * other than array indexing used
+       * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+      pau16Hist[u8Idx] = ipcsSYS_au16WaitHist[u8Idx];
+      /*lint +esym(960, 17.4)*/
+   }
+} /* end of ipcsSYS_GetWaitHist() */
+
+/*------------------------------------------------------------------------------
+ **
+ ** ipcsSYS_ResetWaitHist()
+ **
+ ** Description:
+ ** This function clears the histogram of the time waited for the other
+ ** controller in ipcsSYS_Sync().
+ **
+ **------------------------------------------------------------------------------
+ ** Input:
+ **  void
+ **
+ ** Return:
+ **  void
+ **
+ ** Usage:
+ **  -
+ **
+ ** Remarks:
+ **   Context: Background Task (IRQs disabled by caller)
+ **
+ ** Module Test: - NO -
+ **              Reason: low complexity
+ **------------------------------------------------------------------------------
+ */
+void ipcsSYS_ResetWaitHist( void )
+{
+   UINT8 u8Idx;
+
+   for (u8Idx = 0u; u8Idx < IPCSSYS_WAIT_HIST_CNT; u8Idx++)
+   {
+      ipcsSYS_au16WaitHist[u8Idx] = 0u;
+   }
+} /* end of ipcsSYS_ResetWaitHist() */
+
 
 
 /*******************************************************************************
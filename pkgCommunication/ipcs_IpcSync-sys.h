@@ -60,6 +60,11 @@
 ********************************************************************************
 */
 
+/*! Number of buckets of the histogram of the wait time in ipcsSYS_Sync().
+ *  Bucket 0 counts the synchronizations without waiting, the other buckets
+ *  are IPCSSYS_WAIT_HIST_US wide, the last one also counts longer waits. */
+#define IPCSSYS_WAIT_HIST_CNT     8u
+#define IPCSSYS_WAIT_HIST_US      10u
 
 
 /*------------------------------------------------------------------------------
@@ -115,6 +120,9 @@
 extern void ipcsSYS_Init (void);
 extern void ipcsSYS_Sync (void);
 extern void ipcsSYS_SyncStartup( void );
+extern UINT32 ipcsSYS_GetWaitTime( void );
+extern void ipcsSYS_GetWaitHist( UINT16* pau16Hist );
+extern void ipcsSYS_ResetWaitHist( void );
 
 /***** End of: Function-Prototypes ********************************************/
 
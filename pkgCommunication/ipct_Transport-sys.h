@@ -0,0 +1,132 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: ipct_Transport-sys.h
+**     Summary: Transport interface of the IPC exchange data module (ipcx_ExchangeData-sys.c).
+**              The transport moves the IPC telegrams between the DMA buffers of the two
+**              controllers. It is selected at link time:
+**               - ipct_TransportUsart-sys.c: USART1 with DMA1 channel 4 (Tx) and 5 (Rx), target
+**               - ipct_TransportHost-sys.c:  socket between two host processes with delay, drop
+**                                            and bit flip injection, IPCT_HOST_ACTIVE only
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: ipctSYS_Init
+**             ipctSYS_RxStart
+**             ipctSYS_TxStart
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef IPCT_TRANSPORT_SYS_H
+#define IPCT_TRANSPORT_SYS_H
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_Init
+
+  Description:
+    This function initializes the transport and starts the reception of u16_rxLen bytes into the
+    receive buffer. The buffers are owned by the caller and used by the transport up to the next
+    reset.
+
+  See also:
+    -
+
+  Parameters:
+    pau8_txBuffer (IN) - Transmit buffer, the data of ipctSYS_TxStart() is taken from here
+                         (valid range: <>NULL, not checked)
+    pau8_rxBuffer (IN) - Receive buffer, the received data is written here
+                         (valid range: <>NULL, not checked)
+    u16_rxLen (IN)     - Number of bytes of the first reception
+                         (valid range: 1..size of pau8_rxBuffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_Init( UINT8* pau8_txBuffer, UINT8* pau8_rxBuffer, CONST UINT16 u16_rxLen );
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_RxStart
+
+  Description:
+    This function restarts the reception of u16_len bytes into the receive buffer. Data received
+    before is discarded. When all bytes are received, the transport calls ipcxSYS_RxComplete().
+
+  See also:
+    ipcxSYS_RxComplete()
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to receive
+                         (valid range: 1..size of the receive buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_RxStart( CONST UINT16 u16_len );
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_TxStart
+
+  Description:
+    This function starts the transmission of the first u16_len bytes of the transmit buffer. The
+    transmit buffer shall not be changed up to the end of the transmission.
+
+  See also:
+    -
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to send
+                         (valid range: 1..size of the transmit buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_TxStart( CONST UINT16 u16_len );
+
+#endif /* IPCT_TRANSPORT_SYS_H */
+
@@ -0,0 +1,706 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: ipct_TransportHost-sys.c
+**     Summary: Host transport of the IPC (IPCT_HOST_ACTIVE only). Two host processes built from
+**              the firmware exchange the IPC telegrams over a SOCK_SEQPACKET socket, one
+**              datagram per ipctSYS_TxStart(). The reception emulates the Rx DMA: it is started
+**              with a number of bytes by ipctSYS_RxStart(), received bytes are written into the
+**              receive buffer and ipcxSYS_RxComplete() is called when all bytes are received,
+**              bytes received while no reception is started are lost.
+**              A receive thread injects the configured faults into the received data: delay
+**              (fixed, jitter and transfer time of the baud rate), dropped telegrams and bit
+**              flips. In the polled mode there is no thread, a simulation which advances the
+**              system time itself receives the datagrams with ipctHOST_Poll() and the delays
+**              are in system time (deterministic).
+**              The IPC sync (ipcs_IpcSync-sys.c), the system timer and the IRQ functions of the
+**              Safety Handler are not part of the transport, they are provided by the host
+**              environment (see tools/host/hostHal.c and the smoke test tools/host/ipcSmoke.c).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: ipctHOST_Setup
+**             ipctHOST_StatGet
+**             ipctHOST_Poll
+**             ipctSYS_Init
+**             ipctSYS_RxStart
+**             ipctSYS_TxStart
+**
+**             EnvGet
+**             Inject
+**             Random
+**             RxThread
+**             RxWrite
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/* host transport, replaces ipct_TransportUsart-sys.c in host builds */
+#ifdef IPCT_HOST_ACTIVE
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globDef_GlobalDefinitions.h"
+
+/* Module header */
+#include "globFail_Errorcodes.h"
+#include "globFail_SafetyHandler.h"
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+#include "ipct_Transport-sys.h"
+
+/* Header-file of module */
+#include "ipct_TransportHost-sys.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Unique file id used to build additional info */
+#define k_FILEID                 45u
+
+/* Size of the receive buffer of the thread, a datagram contains an IPC telegram twice. */
+#define k_RX_DGRAM_SIZE          ( IPCXSYS_SIZEOF_MAX_TGM * 2u )
+
+/* Bits per byte on the UART (8N1) for the transfer time. */
+#define k_BITS_PER_BYTE          10u
+
+/* Divisor of the fault probabilities. */
+#define k_PPM                    1000000u
+
+/* Number of datagrams delayed by the polled mode, further datagrams wait in the socket. */
+#define k_POLL_QUEUE_LEN         4u
+
+/* Socket and configuration of the transport, set by ipctHOST_Setup() or the environment. */
+STATIC INT32 i32_Fd = -1;
+STATIC IPCTHOST_CFG_STRUCT s_Cfg;
+
+/* Transmit and receive buffer of ipcx_ExchangeData-sys.c. */
+STATIC UINT8* pau8_TxBuffer = NULL_PNT;
+STATIC UINT8* pau8_RxBuffer = NULL_PNT;
+
+/* Started reception: number of bytes to receive and number of bytes received, 0/0 if the
+** reception is complete. Protected by s_RxMutex, also the statistic.
+*/
+STATIC UINT16 u16_RxLen = 0u;
+STATIC UINT16 u16_RxCnt = 0u;
+STATIC pthread_mutex_t s_RxMutex = PTHREAD_MUTEX_INITIALIZER;
+STATIC pthread_t s_RxThread;
+
+/* State of the random generator of the fault injection (xorshift32, receive thread only). */
+STATIC UINT32 u32_RandState = 1u;
+
+STATIC IPCTHOST_STAT_STRUCT s_Stat;
+
+/* Datagrams of the polled mode waiting for their delay (ring, u8_PollCnt entries from
+** u8_PollIdx), system time in usec when they are written into the receive buffer. */
+typedef struct
+{
+   UINT32 u32_due;
+   UINT16 u16_len;
+   UINT8  au8_data[k_RX_DGRAM_SIZE];
+} t_POLL_DGRAM;
+
+STATIC t_POLL_DGRAM as_PollQueue[k_POLL_QUEUE_LEN];
+STATIC UINT8 u8_PollIdx = 0u;
+STATIC UINT8 u8_PollCnt = 0u;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC UINT32 EnvGet( CONST char* pc_name, CONST UINT32 u32_default );
+STATIC BOOL Inject( UINT8* pau8_data, CONST UINT16 u16_len, UINT32* pu32_delayUs );
+STATIC UINT32 Random( void );
+STATIC void* RxThread( void* pv_arg );
+STATIC void RxWrite( CONST UINT8* pau8_data, CONST UINT16 u16_len );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_Setup
+
+  Description:
+    This function sets the socket and the configuration of the host transport. The socket is
+    one end of a SOCK_SEQPACKET socketpair (or a connected SOCK_SEQPACKET socket), the other
+    end is used by the host process of the other controller. It shall be called before
+    ipcxSYS_Init(), otherwise the environment variables IPCTHOST_ENV_xxx are read.
+
+  See also:
+    -
+
+  Parameters:
+    i32_fd (IN)        - File descriptor of the socket
+                         (valid range: >= 0, checked in ipctSYS_Init())
+    ps_cfg (IN)        - Configuration, it is copied
+                         (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (before ipcxSYS_Init())
+
+***************************************************************************************************/
+void ipctHOST_Setup( CONST INT32 i32_fd, CONST IPCTHOST_CFG_STRUCT* ps_cfg )
+{
+   i32_Fd = i32_fd;
+   s_Cfg = *ps_cfg;
+}
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_StatGet
+
+  Description:
+    This function returns the statistic of the host transport.
+
+  See also:
+    -
+
+  Parameters:
+    ps_stat (OUT)      - statistic
+                         (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: any
+
+***************************************************************************************************/
+void ipctHOST_StatGet( IPCTHOST_STAT_STRUCT* ps_stat )
+{
+   (void)pthread_mutex_lock(&s_RxMutex);
+   *ps_stat = s_Stat;
+   (void)pthread_mutex_unlock(&s_RxMutex);
+}
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_Poll
+
+  Description:
+    see ipct_TransportHost-sys.h
+
+***************************************************************************************************/
+void ipctHOST_Poll( CONST UINT32 u32_now )
+{
+   t_POLL_DGRAM* ps_dgram;
+   t_POLL_DGRAM* ps_last;
+   ssize_t       s32_len = 1;
+   UINT32        u32_delayUs;
+
+   /* receive the datagrams sent since the last call */
+   while ((u8_PollCnt < k_POLL_QUEUE_LEN) && (s32_len > 0))
+   {
+     ps_dgram = &as_PollQueue[(u8_PollIdx + u8_PollCnt) % k_POLL_QUEUE_LEN];
+     s32_len = recv(i32_Fd, ps_dgram->au8_data, sizeof(ps_dgram->au8_data), MSG_DONTWAIT);
+
+     /* if a datagram is received and not dropped */
+     if ((s32_len > 0) && Inject(ps_dgram->au8_data, (UINT16)s32_len, &u32_delayUs))
+     {
+       ps_dgram->u16_len = (UINT16)s32_len;
+       ps_dgram->u32_due = u32_now + u32_delayUs;
+
+       /* the UART keeps the order of the telegrams */
+       ps_last = &as_PollQueue[(u8_PollIdx + u8_PollCnt + k_POLL_QUEUE_LEN - 1u) %
+                               k_POLL_QUEUE_LEN];
+       if ((u8_PollCnt != 0u) && ((INT32)(ps_dgram->u32_due - ps_last->u32_due) < 0))
+       {
+         ps_dgram->u32_due = ps_last->u32_due;
+       }
+       else
+       {
+         /* empty branch */
+       }
+       u8_PollCnt++;
+     }
+     else
+     {
+       /* empty branch */
+     }
+   }
+
+   /* write the datagrams whose delay has expired */
+   while ((u8_PollCnt != 0u) && ((INT32)(u32_now - as_PollQueue[u8_PollIdx].u32_due) >= 0))
+   {
+     RxWrite(as_PollQueue[u8_PollIdx].au8_data, as_PollQueue[u8_PollIdx].u16_len);
+     u8_PollIdx = (UINT8)((u8_PollIdx + 1u) % k_POLL_QUEUE_LEN);
+     u8_PollCnt--;
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_Init
+
+  Description:
+    This function takes the socket and configuration from the environment if ipctHOST_Setup()
+    was not called, starts the reception and the receive thread (not in the polled mode).
+
+  See also:
+    -
+
+  Parameters:
+    pau8_txBuffer (IN) - Transmit buffer, the data of ipctSYS_TxStart() is taken from here
+                         (valid range: <>NULL, not checked)
+    pau8_rxBuffer (IN) - Receive buffer, the received data is written here
+                         (valid range: <>NULL, not checked)
+    u16_rxLen (IN)     - Number of bytes of the first reception
+                         (valid range: 1..size of pau8_rxBuffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_Init( UINT8* pau8_txBuffer, UINT8* pau8_rxBuffer, CONST UINT16 u16_rxLen )
+{
+   /* if not set up by the host environment */
+   if (i32_Fd < 0)
+   {
+     i32_Fd = (INT32)EnvGet(IPCTHOST_ENV_FD, (UINT32)-1);
+     s_Cfg.u32_delayUs  = EnvGet(IPCTHOST_ENV_DELAY_US, 0u);
+     s_Cfg.u32_jitterUs = EnvGet(IPCTHOST_ENV_JITTER_US, 0u);
+     s_Cfg.u32_baudRate = EnvGet(IPCTHOST_ENV_BAUD, 0u);
+     s_Cfg.u32_dropPpm  = EnvGet(IPCTHOST_ENV_DROP_PPM, 0u);
+     s_Cfg.u32_flipPpm  = EnvGet(IPCTHOST_ENV_FLIP_PPM, 0u);
+     s_Cfg.u32_seed     = EnvGet(IPCTHOST_ENV_SEED, 1u);
+     s_Cfg.u32_polled   = 0u;
+   }
+   else
+   {
+     /* empty branch */
+   }
+   u32_RandState = (s_Cfg.u32_seed == 0u) ? 1u : s_Cfg.u32_seed;
+
+   pau8_TxBuffer = pau8_txBuffer;
+   pau8_RxBuffer = pau8_rxBuffer;
+   ipctSYS_RxStart(u16_rxLen);
+
+   /* if no socket */
+   if (i32_Fd < 0)
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(1u));
+   }
+   /* else if polled, see ipctHOST_Poll() */
+   else if (s_Cfg.u32_polled != 0u)
+   {
+     /* empty branch */
+   }
+   /* else if the receive thread can not be started */
+   else if (pthread_create(&s_RxThread, NULL, &RxThread, NULL) != 0)
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(2u));
+   }
+   else
+   {
+     /* empty branch */
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_RxStart
+
+  Description:
+    This function restarts the reception of u16_len bytes into the receive buffer, bytes
+    received before are discarded.
+
+  See also:
+    ipcxSYS_RxComplete()
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to receive
+                         (valid range: 1..size of the receive buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_RxStart( CONST UINT16 u16_len )
+{
+   (void)pthread_mutex_lock(&s_RxMutex);
+   u16_RxLen = u16_len;
+   u16_RxCnt = 0u;
+   (void)pthread_mutex_unlock(&s_RxMutex);
+}
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_TxStart
+
+  Description:
+    This function sends the first u16_len bytes of the transmit buffer as one datagram. The
+    faults are injected by the receiver.
+
+  See also:
+    -
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to send
+                         (valid range: 1..size of the transmit buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_TxStart( CONST UINT16 u16_len )
+{
+   /* if the socket is broken, the other process is gone */
+   if (send(i32_Fd, pau8_TxBuffer, (size_t)u16_len, MSG_NOSIGNAL) != (ssize_t)u16_len)
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_RETURN_ERR, GLOBFAIL_ADDINFO_FILE(3u));
+   }
+   else
+   {
+     (void)pthread_mutex_lock(&s_RxMutex);
+     s_Stat.u32_txCnt++;
+     (void)pthread_mutex_unlock(&s_RxMutex);
+   }
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    EnvGet
+
+  Description:
+    This function reads a decimal value from the environment.
+
+  See also:
+    -
+
+  Parameters:
+    pc_name (IN)       - name of the environment variable
+                         (valid range: <>NULL, not checked)
+    u32_default (IN)   - value if the variable is not set
+                         (valid range: any, not checked)
+
+  Return value:
+    UINT32             - value of the variable (negative values are converted)
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+STATIC UINT32 EnvGet( CONST char* pc_name, CONST UINT32 u32_default )
+{
+   CONST char* pc_value = getenv(pc_name);
+
+   return (pc_value == NULL) ? u32_default : (UINT32)strtol(pc_value, NULL, 10);
+}
+
+/***************************************************************************************************
+  Function:
+    Inject
+
+  Description:
+    This function counts a received datagram and injects the configured faults: the datagram is
+    dropped or bits of its bytes are flipped, the delay is the fixed delay, the jitter and the
+    transfer time of the baud rate.
+
+  See also:
+    -
+
+  Parameters:
+    pau8_data (IN/OUT) - received datagram
+                         (valid range: <>NULL, not checked)
+    u16_len (IN)       - length of the datagram
+                         (valid range: 1..k_RX_DGRAM_SIZE, not checked)
+    pu32_delayUs (OUT) - delay of the datagram in usec
+                         (valid range: <>NULL, not checked)
+
+  Return value:
+    TRUE               - datagram shall be written into the receive buffer after the delay
+    FALSE              - datagram is dropped
+
+  Remarks:
+    Context: receive thread
+    Context: host simulation (polled mode)
+
+***************************************************************************************************/
+STATIC BOOL Inject( UINT8* pau8_data, CONST UINT16 u16_len, UINT32* pu32_delayUs )
+{
+   BOOL   b_keep = TRUE;
+   UINT16 i;
+
+   (void)pthread_mutex_lock(&s_RxMutex);
+   s_Stat.u32_rxCnt++;
+   (void)pthread_mutex_unlock(&s_RxMutex);
+
+   /* drop the telegram */
+   if ((Random() % k_PPM) < s_Cfg.u32_dropPpm)
+   {
+     (void)pthread_mutex_lock(&s_RxMutex);
+     s_Stat.u32_dropCnt++;
+     (void)pthread_mutex_unlock(&s_RxMutex);
+     b_keep = FALSE;
+   }
+   else
+   {
+     /* flip a bit of the bytes */
+     for (i = 0u; i < u16_len; i++)
+     {
+       if ((Random() % k_PPM) < s_Cfg.u32_flipPpm)
+       {
+         pau8_data[i] ^= (UINT8)(1u << (Random() % 8u));
+         (void)pthread_mutex_lock(&s_RxMutex);
+         s_Stat.u32_flipCnt++;
+         (void)pthread_mutex_unlock(&s_RxMutex);
+       }
+       else
+       {
+         /* empty branch */
+       }
+     }
+   }
+
+   /* delay: fixed, jitter and transfer time */
+   *pu32_delayUs = s_Cfg.u32_delayUs;
+   if (s_Cfg.u32_jitterUs != 0u)
+   {
+     *pu32_delayUs += Random() % (s_Cfg.u32_jitterUs + 1u);
+   }
+   else
+   {
+     /* empty branch */
+   }
+   if (s_Cfg.u32_baudRate != 0u)
+   {
+     /* no overflow, a datagram is shorter than 400 bytes */
+     *pu32_delayUs += ((UINT32)u16_len * k_BITS_PER_BYTE * 1000000u) / s_Cfg.u32_baudRate;
+   }
+   else
+   {
+     /* empty branch */
+   }
+
+   return b_keep;
+}
+
+/***************************************************************************************************
+  Function:
+    Random
+
+  Description:
+    This function returns the next value of the random generator (xorshift32), the sequence
+    is reproducible by the seed.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    UINT32             - random value
+
+  Remarks:
+    Context: receive thread
+    Context: host simulation (polled mode)
+
+***************************************************************************************************/
+STATIC UINT32 Random( void )
+{
+   u32_RandState ^= u32_RandState << 13u;
+   u32_RandState ^= u32_RandState >> 17u;
+   u32_RandState ^= u32_RandState << 5u;
+
+   return u32_RandState;
+}
+
+/***************************************************************************************************
+  Function:
+    RxThread
+
+  Description:
+    Receive thread: it receives the datagrams of the other process, injects the configured faults
+    (see Inject()), waits for the delay and writes the data into the receive buffer (see
+    RxWrite()). The thread ends if the other process closes the socket, the IPC then runs into
+    the timeout.
+
+  See also:
+    -
+
+  Parameters:
+    pv_arg (IN)        - not used
+
+  Return value:
+    void*              - NULL
+
+  Remarks:
+    Context: receive thread
+
+***************************************************************************************************/
+STATIC void* RxThread( void* pv_arg )
+{
+   UINT8           au8_data[k_RX_DGRAM_SIZE];
+   ssize_t         s32_len;
+   struct timespec s_due;
+   UINT32          u32_delayUs;
+
+   (void)pv_arg;
+
+   for (;;)
+   {
+     s32_len = recv(i32_Fd, au8_data, sizeof(au8_data), 0);
+
+     /* if the socket is closed or broken */
+     if ((s32_len <= 0) && (errno != EINTR))
+     {
+       break;
+     }
+     /* else if interrupted */
+     else if (s32_len <= 0)
+     {
+       continue;
+     }
+     else
+     {
+       /* empty branch */
+     }
+     (void)clock_gettime(CLOCK_MONOTONIC, &s_due);
+
+     /* if dropped */
+     if (!Inject(au8_data, (UINT16)s32_len, &u32_delayUs))
+     {
+       continue;
+     }
+     else
+     {
+       /* empty branch */
+     }
+
+     s_due.tv_nsec += (long)(u32_delayUs % 1000000u) * 1000L;
+     s_due.tv_sec  += (time_t)(u32_delayUs / 1000000u) + (s_due.tv_nsec / 1000000000L);
+     s_due.tv_nsec %= 1000000000L;
+     while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &s_due, NULL) == EINTR)
+     {
+       /* sleep again after a signal */
+     }
+
+     RxWrite(au8_data, (UINT16)s32_len);
+   }
+
+   return NULL;
+}
+
+/***************************************************************************************************
+  Function:
+    RxWrite
+
+  Description:
+    This function writes received bytes into the receive buffer like the Rx DMA: up to the
+    number of bytes of the started reception, further bytes are lost. If all bytes are received,
+    the reception is complete and ipcxSYS_RxComplete() is called.
+
+  See also:
+    ipctSYS_RxStart()
+
+  Parameters:
+    pau8_data (IN)     - received bytes
+                         (valid range: <>NULL, not checked)
+    u16_len (IN)       - number of received bytes
+                         (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: receive thread
+    Context: host simulation (polled mode)
+
+***************************************************************************************************/
+STATIC void RxWrite( CONST UINT8* pau8_data, CONST UINT16 u16_len )
+{
+   UINT16 u16_cnt = u16_len;
+
+   (void)pthread_mutex_lock(&s_RxMutex);
+
+   /* limit to the remaining bytes of the started reception */
+   if (u16_cnt > (UINT16)(u16_RxLen - u16_RxCnt))
+   {
+     s_Stat.u32_lostCnt += (UINT32)u16_cnt - (UINT32)(u16_RxLen - u16_RxCnt);
+     u16_cnt = (UINT16)(u16_RxLen - u16_RxCnt);
+   }
+   else
+   {
+     /* empty branch */
+   }
+
+   /* if a reception is started */
+   if (u16_cnt != 0u)
+   {
+     (void)memcpy(&pau8_RxBuffer[u16_RxCnt], pau8_data, u16_cnt);
+     u16_RxCnt = (UINT16)(u16_RxCnt + u16_cnt);
+
+     /* if complete: stop the reception and signal it, the data is written before the flag */
+     if (u16_RxCnt == u16_RxLen)
+     {
+       u16_RxLen = 0u;
+       u16_RxCnt = 0u;
+       s_Stat.u32_completeCnt++;
+       __sync_synchronize();
+       ipcxSYS_RxComplete();
+     }
+     else
+     {
+       /* empty branch */
+     }
+   }
+   else
+   {
+     /* empty branch */
+   }
+
+   (void)pthread_mutex_unlock(&s_RxMutex);
+}
+
+#endif /* IPCT_HOST_ACTIVE */
+
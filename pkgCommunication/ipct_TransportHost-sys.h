@@ -0,0 +1,164 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: ipct_TransportHost-sys.h
+**     Summary: Header of module ipct_TransportHost-sys.c, configuration and statistic of the host
+**              transport of the IPC (IPCT_HOST_ACTIVE only).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: ipctHOST_Setup
+**             ipctHOST_StatGet
+**             ipctHOST_Poll
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef IPCT_TRANSPORTHOST_SYS_H
+#define IPCT_TRANSPORTHOST_SYS_H
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Names of the environment variables read by ipctSYS_Init() if ipctHOST_Setup() was not called,
+** see IPCTHOST_CFG_STRUCT for the values (decimal). */
+#define IPCTHOST_ENV_FD          "IPCT_HOST_FD"
+#define IPCTHOST_ENV_DELAY_US    "IPCT_HOST_DELAY_US"
+#define IPCTHOST_ENV_JITTER_US   "IPCT_HOST_JITTER_US"
+#define IPCTHOST_ENV_BAUD        "IPCT_HOST_BAUD"
+#define IPCTHOST_ENV_DROP_PPM    "IPCT_HOST_DROP_PPM"
+#define IPCTHOST_ENV_FLIP_PPM    "IPCT_HOST_FLIP_PPM"
+#define IPCTHOST_ENV_SEED        "IPCT_HOST_SEED"
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/* IPCTHOST_CFG_STRUCT:
+** Configuration of the host transport, the faults are injected into the received data
+*/
+typedef struct
+{
+   UINT32 u32_delayUs;          /* delay of every received telegram [us] */
+   UINT32 u32_jitterUs;         /* additional random delay 0..u32_jitterUs [us] */
+   UINT32 u32_baudRate;         /* emulated baud rate, the transfer time of 10 bit per byte is
+                                ** added to the delay (0: no transfer time) */
+   UINT32 u32_dropPpm;          /* probability that a telegram is dropped [1/1000000] */
+   UINT32 u32_flipPpm;          /* probability that a bit of a byte is flipped [1/1000000] */
+   UINT32 u32_seed;             /* seed of the random generator (0: 1 is used) */
+   UINT32 u32_polled;           /* 0: receive thread, delays in host time, else: the datagrams
+                                ** are received by ipctHOST_Poll(), delays in system time */
+} IPCTHOST_CFG_STRUCT;
+
+/* IPCTHOST_STAT_STRUCT:
+** Statistic of the host transport
+*/
+typedef struct
+{
+   UINT32 u32_txCnt;            /* number of sent telegrams */
+   UINT32 u32_rxCnt;            /* number of received telegrams (before fault injection) */
+   UINT32 u32_dropCnt;          /* number of dropped telegrams */
+   UINT32 u32_flipCnt;          /* number of flipped bits */
+   UINT32 u32_lostCnt;          /* number of bytes lost because the reception was not started */
+   UINT32 u32_completeCnt;      /* number of completed receptions */
+} IPCTHOST_STAT_STRUCT;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_Setup
+
+  Description:
+    This function sets the socket and the configuration of the host transport. The socket is
+    one end of a SOCK_SEQPACKET socketpair (or a connected SOCK_SEQPACKET socket), the other
+    end is used by the host process of the other controller. It shall be called before
+    ipcxSYS_Init(), otherwise the environment variables IPCTHOST_ENV_xxx are read.
+
+  See also:
+    -
+
+  Parameters:
+    i32_fd (IN)        - File descriptor of the socket
+                         (valid range: >= 0, checked in ipctSYS_Init())
+    ps_cfg (IN)        - Configuration, it is copied
+                         (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (before ipcxSYS_Init())
+
+***************************************************************************************************/
+void ipctHOST_Setup( CONST INT32 i32_fd, CONST IPCTHOST_CFG_STRUCT* ps_cfg );
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_StatGet
+
+  Description:
+    This function returns the statistic of the host transport.
+
+  See also:
+    -
+
+  Parameters:
+    ps_stat (OUT)      - statistic
+                         (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: any
+
+***************************************************************************************************/
+void ipctHOST_StatGet( IPCTHOST_STAT_STRUCT* ps_stat );
+
+/***************************************************************************************************
+  Function:
+    ipctHOST_Poll
+
+  Description:
+    This function receives the datagrams of the polled transport (IPCTHOST_CFG_STRUCT
+    u32_polled). The datagrams received since the last call get the configured faults, the
+    delay starts at u32_now. The datagrams whose delay has expired are written into the receive
+    buffer in the order of their transmission. A simulation which advances the system time
+    itself calls it every usec, so the delays and the order of the events are deterministic.
+
+  See also:
+    -
+
+  Parameters:
+    u32_now (IN)       - current system time in usec
+                         (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: host simulation (time hook, see hostHAL_TimeStepSet() of tools/host/hostHal.c)
+
+***************************************************************************************************/
+void ipctHOST_Poll( CONST UINT32 u32_now );
+
+#endif /* IPCT_TRANSPORTHOST_SYS_H */
+
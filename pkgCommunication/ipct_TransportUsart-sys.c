@@ -0,0 +1,248 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: ipct_TransportUsart-sys.c
+**     Summary: Transport of the IPC telegrams over USART1 (offers functionalities required by
+**              [SRS_155], [SRS_118]). The telegrams are sent by DMA1 channel 4 and received by
+**              DMA1 channel 5, the transfer complete interrupt of the Rx DMA signals the
+**              reception to ipcx_ExchangeData-sys.c.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: ipctSYS_Init
+**             ipctSYS_RxStart
+**             ipctSYS_TxStart
+**             DMA1_Channel5_IRQHandler
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/* target transport, replaced by ipct_TransportHost-sys.c in host builds */
+#ifndef IPCT_HOST_ACTIVE
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+/* Module header */
+#include "globFail_Errorcodes.h"
+#include "gpio-hal.h"
+#include "serial-hal.h"
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+
+/* Header-file of module */
+#include "ipct_Transport-sys.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Priority of the Rx DMA interrupt. It is higher than the priority of the IRQ Scheduler (2), so
+** the completion time is taken when the transfer completes and not after the time slice. */
+#define k_RX_IRQ_PRIORITY        ( ( UINT32 ) 1u )
+
+/* Pin definitions for USART useage. */
+#define k_GPIOA_USART            ( GPIOA )
+#define k_GPIOA_USART_PIN9_TX    ( GPIO_9 )
+#define k_GPIOA_USART_PIN10_RX   ( GPIO_10 )
+
+/* Addresses of the transmit and receive buffer (DMA buffer section), the DMA channels are
+** reinitialized with them before every transfer.
+*/
+STATIC UINT32 u32_TxBufferAddr = 0u;
+STATIC UINT32 u32_RxBufferAddr = 0u;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_Init
+
+  Description:
+    This function initializes the port pins PA9 and PA10 and USART1 for the IPC, initializes the
+    DMA channels with the buffer addresses, starts the reception and enables the transfer
+    complete interrupt of the Rx DMA.
+
+  See also:
+    -
+
+  Parameters:
+    pau8_txBuffer (IN) - Transmit buffer, the data of ipctSYS_TxStart() is taken from here
+                         (valid range: <>NULL, not checked)
+    pau8_rxBuffer (IN) - Receive buffer, the received data is written here
+                         (valid range: <>NULL, not checked)
+    u16_rxLen (IN)     - Number of bytes of the first reception
+                         (valid range: 1..size of pau8_rxBuffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_Init( UINT8* pau8_txBuffer, UINT8* pau8_rxBuffer, CONST UINT16 u16_rxLen )
+{
+   /*lint -e923*/
+   /* Cast from pointer to int is OK, the DMA needs the address of the buffers as integer value. */
+   u32_TxBufferAddr = (UINT32)pau8_txBuffer;
+   u32_RxBufferAddr = (UINT32)pau8_rxBuffer;
+   /*lint +e923*/
+
+   /* configure the GPIO Pin PA9 for USART Tx */
+   gpioHAL_ConfigureOutput( k_GPIOA_USART,
+      k_GPIOA_USART_PIN9_TX,
+      OUT_CONFIG_AF_PP,
+      OUT_MODE_50MHZ );
+
+   /* configure the GPIO Pin PA10 for USART Rx */
+   gpioHAL_ConfigureInput( k_GPIOA_USART,
+      k_GPIOA_USART_PIN10_RX,
+      IN_CONFIG_FLOATING );
+
+   /* initialize the IPC communication via USART interface
+    * (see [SRS_155], [SRS_118]) */
+   serialHAL_Init ( USART1,
+                    SERIALHAL_4000000_BAUD,
+                    SERIALHAL_USART_SET_8NOP1 );
+
+   /* initialize the UART interface for sending data via DMA (see [SRS_155]) */
+   serialHAL_InitTxUsart1DmaCh(u32_TxBufferAddr);
+
+   /* initialize the UART interface for reception of data via DMA (see [SRS_155]) */
+   serialHAL_InitRxUsart1DmaCh(u32_RxBufferAddr, (UINT32)u16_rxLen);
+
+   /* the transfer complete interrupt of the Rx DMA signals the reception */
+   NVIC_SetPriority(DMA1_Channel5_IRQn, k_RX_IRQ_PRIORITY);
+   NVIC_EnableIRQ(DMA1_Channel5_IRQn);
+}
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_RxStart
+
+  Description:
+    This function reinitializes the UART Rx DMA for the reception of u16_len bytes.
+
+  See also:
+    ipcxSYS_RxComplete()
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to receive
+                         (valid range: 1..size of the receive buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_RxStart( CONST UINT16 u16_len )
+{
+   serialHAL_InitRxUsart1DmaCh(u32_RxBufferAddr, (UINT32)u16_len);
+}
+
+/***************************************************************************************************
+  Function:
+    ipctSYS_TxStart
+
+  Description:
+    This function reinitializes the UART Tx DMA and triggers the sending of u16_len bytes. The
+    reinitialization ensures that CPAR (DMA channel peripheral address register) and CMAR (DMA
+    channel memory address register) always contain the correct values since these registers
+    are not included in the SFR test.
+
+  See also:
+    -
+
+  Parameters:
+    u16_len (IN)       - Number of bytes to send
+                         (valid range: 1..size of the transmit buffer, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipctSYS_TxStart( CONST UINT16 u16_len )
+{
+   serialHAL_InitTxUsart1DmaCh(u32_TxBufferAddr);
+   /* trigger sending of TxDMA Buffer */
+   serialHAL_SendUsart1Dma((UINT32)u16_len);
+}
+
+/***************************************************************************************************
+  Function:
+    DMA1_Channel5_IRQHandler
+
+  Description:
+    Interrupt service routine of the Rx DMA of the IPC. The transfer complete interrupt signals
+    the complete reception of the IPC telegram to ipcx_ExchangeData-sys.c.
+
+  See also:
+    ipcxSYS_RxComplete()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: DMA1 Channel 5 IRQ
+
+***************************************************************************************************/
+void DMA1_Channel5_IRQHandler( void )
+{
+   /* if transfer complete */
+   if ((DMA1->ISR & DMA_ISR_TCIF5) != 0u)
+   {
+     ipcxSYS_RxComplete();
+   }
+   else
+   {
+     /* empty branch */
+   }
+
+   /* clear all flags of channel 5 */
+   DMA1->IFCR = DMA_IFCR_CGIF5;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+#endif /* IPCT_HOST_ACTIVE */
+
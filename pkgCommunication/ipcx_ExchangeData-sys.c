@@ -6,7 +6,7 @@
 **     Summary: This module contains the IPC exchange data functionality (offers functionalities 
 **              required by [SRS_28]). This module contains all functions to send and receive data
 **              over the IPC to and from the other controller. The IPC is a communication over the 
-**              UART interface.
+**              UART interface, it is accessed by the transport interface ipct_Transport-sys.h.
 **   $Revision: 4224 $
 **       $Date: 2024-01-23 10:39:25 +0100 (Di, 23 Jan 2024) $
 **      Author: K. Angele
@@ -18,13 +18,31 @@
 **  Functions: ipcxSYS_Init
 **             ipcxSYS_SendUINT32
 **             ipcxSYS_SendBuffer
+**             ipcxSYS_TxReserve
+**             ipcxSYS_TxCommit
 **             ipcxSYS_GetBufferinclWait
+**             ipcxSYS_RxViewinclWait
 **             ipcxSYS_GetUINT32inclWait
 **             ipcxSYS_ExChangeUINT32Data
+**             ipcxSYS_FrameAddBuffer
+**             ipcxSYS_FrameAddUINT32
+**             ipcxSYS_FrameSend
+**             ipcxSYS_FrameRecvinclWait
+**             ipcxSYS_FrameGetBuffer
+**             ipcxSYS_FrameGetUINT32
+**             ipcxSYS_WaitStatCycle
+**             ipcxSYS_WaitStatGet
+**             ipcxSYS_WaitStatReset
+**             ipcxSYS_LinkStatGet
+**             ipcxSYS_LinkStatReset
+**             ipcxSYS_RxComplete
 **
 **             Send
 **             CheckCrcAnd_uC_ID_Rx
 **             GetBuffer
+**             FrameFind
+**             LinkStatWait
+**             Saturate16
 **
 **    History:
 **
@@ -42,17 +60,19 @@
 #include "xtypes.h"
 #include "xdefs.h"
 
+#include "globDef_GlobalDefinitions.h"
+
 /* Module header */
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 #include "timer-def.h"
-#include "gpio-hal.h"
-#include "serial-hal.h"
 #include "crc-hal.h"
 #include "timer-hal.h"
+#include "hist-sys.h"
 #include "cfg_Config-sys.h"
 #include "ipcs_IpcSync-sys.h"
 #include "globFit_FitTestHandler.h"
+#include "ipct_Transport-sys.h"
 
 /* Header-file of module */
 #include "ipcx_ExchangeData-sys_def.h"
@@ -71,7 +91,7 @@
 #define k_FILEID                 34u
 
 /*
-** These constants defines the number of the Rx buffers.
+** These constants defines the number of the copies of the IPC telegram in the Rx DMA buffer.
 */
 /* Constant which defines Rx buffer number 1. */
 #define k_RXBUFF_IDX_0           ( ( UINT8 ) 0u )
@@ -79,28 +99,58 @@
 /* Constant which defines Rx buffer number 2. */
 #define k_RXBUFF_IDX_1           ( ( UINT8 ) 1u )
 
-/* Constant which defines the index size for the Rx buffers. */
-#define k_RXBUFF_IDX_SIZE        ( ( UINT8 )2u )
+/* Macro is used to calculate the offset of a copy of the IPC telegram in the DMA buffers, the 
+** IPC telegram is sent twice. */
+#define k_RXBUFF_OFS(idx, len)   ( (UINT32)(idx) * IPCXSYS_SIZEOF_TGM_VAR(len) )
+
+/* This constant defines that no IPC telegram is reserved in the Tx DMA buffer. */
+#define k_TX_NOT_RESERVED        ( ( UINT8 ) 0xFFu )
+
+/* Values of the completion flag of the Rx DMA. */
+#define k_RX_COMPLETE            ( ( UINT8 ) 0xA5u )
+#define k_RX_PENDING             ( ( UINT8 ) 0x5Au )
+
+/* Number of cycles after which sum and number of cycles of the mean wait time are halved, the 
+** mean value follows changes of the wait time and the sum can not overflow. */
+#define k_WAIT_MEAN_WINDOW       ( ( UINT16 ) 0x8000u )
 
-/* This constant defines if data is received. */
-#define k_DMA_RX_RECEIVED        ( (UINT32) 0 )
+/* Payload length of the IPC telegram reserved by ipcxSYS_TxReserve() in the Tx DMA buffer, 
+** k_TX_NOT_RESERVED if there is none. 
+*/
+STATIC UINT8 u8_TxReservedLen = k_TX_NOT_RESERVED;
 
-/* Pin definitions for USART useage. */
-#define k_GPIOA_USART            ( GPIOA )
-#define k_GPIOA_USART_PIN9_TX    ( GPIO_9 )
-#define k_GPIOA_USART_PIN10_RX   ( GPIO_10 )
+/* Completion flag of the Rx DMA, set by ipcxSYS_RxComplete() (transport) and reset by 
+** ipcxSYS_TxCommit() and when the IPC telegram is read (GetBuffer()), and the time the IPC 
+** telegram was completely received in usec. 
+*/
+STATIC volatile UINT8  u8_RxState = k_RX_PENDING;
+STATIC volatile UINT32 u32_RxCompleteTime = 0u;
 
-/* Transmit buffer of the IPC. */
-STATIC UINT8 au8_TxBuffer[IPCXSYS_SIZEOF_MAX_TGM];
+/* Time waited for IPC telegrams in usec, free running sum. */
+STATIC UINT32 u32_RxWaitTime = 0u;
 
-/* Receive buffer of the IPC.
-** The receive buffer are double because the IPC telegram is send twice.
+/* Wait time statistic per scheduler cycle (see ipcxSYS_WaitStatCycle()): the sums of the wait 
+** time for IPC telegrams and of ipcsSYS_Sync() at the end of the last cycle, the sum and number 
+** of cycles of the mean value and the statistic. 
 */
-STATIC UINT8 au8_RxBuffer[k_RXBUFF_IDX_SIZE][IPCXSYS_SIZEOF_MAX_TGM];
+STATIC UINT32 u32_RxWaitTimeLast = 0u;
+STATIC UINT32 u32_SyncWaitTimeLast = 0u;
+STATIC UINT32 u32_WaitMeanSum = 0u;
+STATIC UINT16 u16_WaitMeanCnt = 0u;
+STATIC IPCXSYS_WAIT_STAT_STRUCT s_WaitStat;
+
+/* Link statistic per IPC ID (see ipcxSYS_LinkStatGet()) and the sum and number of waits of the 
+** mean wait time. 
+*/
+STATIC IPCXSYS_LINK_STAT_STRUCT as_LinkStat[IPCXSYS_IPC_ID_CNT];
+STATIC UINT32 au32_LinkWaitSum[IPCXSYS_IPC_ID_CNT];
+STATIC UINT16 au16_LinkWaitCnt[IPCXSYS_IPC_ID_CNT];
 
 /* Transmit and Receive buffer which are used from the DMA. These buffers are
 ** attached to the DMA buffer section in the RAM. This is a specified section
 ** in the RAM just for DMA buffers. It is defined in the scatter file.
+** The IPC telegram is built and checked in place, it is contained twice in the buffers
+** (see [SRS_119]).
 **
 ** Subject: RAM Test
 ** The DMA buffer section is not under the control of the RAM Test!
@@ -112,14 +162,34 @@ STATIC UINT8 au8_RxDmaBuffer[IPCXSYS_SIZEOF_MAX_TGM * 2u]
                              __attribute__((section("DMA_BUFFER_SECTION")));/*lint !e950*/
 /* The word "attribute" and the words in the brackets are compiler specific syntax. */
 
+/* IPC frame transmit buffer, records added by ipcxSYS_FrameAddBuffer() up to the next 
+** ipcxSYS_FrameSend(), and its length. 
+*/
+STATIC UINT8 au8_FrameTxBuffer[IPCXSYS_SIZEOF_MAX_FRAME];
+STATIC UINT8 u8_FrameTxLen = 0u;
+
+/* Length of the IPC frame sent last. Both controllers send the same records, so it is also the 
+** length of the IPC frame to be received. 
+*/
+STATIC UINT8 u8_FrameRxExpLen = 0u;
+
+/* IPC frame receive buffer, records received by ipcxSYS_FrameRecvinclWait(), and its length.
+** The length is 0 from ipcxSYS_FrameSend() up to the reception of the frame. 
+*/
+STATIC UINT8 au8_FrameRxBuffer[IPCXSYS_SIZEOF_MAX_FRAME];
+STATIC UINT8 u8_FrameRxLen = 0u;
+
 /***************************************************************************************************
 **    static function-prototypes
 ***************************************************************************************************/
 STATIC void Send( CONST UINT8 u8_dataLen );
-STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen );
+STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen );
 STATIC GLOB_RETCODE_ENUM GetBuffer( CONST UINT8 u8_ipcId, 
                                     CONST UINT8 u8_dataLen, 
-                                    UINT8 pau8_buffer[] );
+                                    CONST UINT8** ppau8_payload );
+STATIC UINT8 FrameFind( CONST UINT8 u8_ipcId );
+STATIC void LinkStatWait( CONST UINT8 u8_ipcId, CONST UINT32 u32_waitTime );
+STATIC UINT16 Saturate16( CONST UINT32 u32_value );
 
 /***************************************************************************************************
 **    global functions
@@ -132,12 +202,9 @@ STATIC GLOB_RETCODE_ENUM GetBuffer( CONST UINT8 u8_ipcId,
 
   Description:
     This function initializes the IPC interface.
-    The communication goes over the USART. This function initializes the specific port pins 
-    PA9 and PA10 of the USART.
-    
-    Furthermore:
-     - it initializes the DMA buffer addresses
-     - initialize the UART interface for DMA.
+    The communication goes over the transport (see ipct_Transport-sys.h), on the target the 
+    USART1 with DMA. The transport is initialized with the DMA buffers and the reception is 
+    started.
 
   See also:
     -
@@ -154,32 +221,12 @@ STATIC GLOB_RETCODE_ENUM GetBuffer( CONST UINT8 u8_ipcId,
 ***************************************************************************************************/
 void ipcxSYS_Init( void )
 {
-   /* configure the GPIO Pin PA9 for USART Tx */
-   gpioHAL_ConfigureOutput( k_GPIOA_USART,
-      k_GPIOA_USART_PIN9_TX,
-      OUT_CONFIG_AF_PP,
-      OUT_MODE_50MHZ );
-
-   /* configure the GPIO Pin PA10 for USART Rx */
-   gpioHAL_ConfigureInput( k_GPIOA_USART,
-      k_GPIOA_USART_PIN10_RX,
-      IN_CONFIG_FLOATING );
-
-   /* initialize the IPC communication via USART interface
-    * (see [SRS_155], [SRS_118]) */
-   serialHAL_Init ( USART1,
-                    SERIALHAL_4000000_BAUD,
-                    SERIALHAL_USART_SET_8NOP1 );
-
-   /*lint -e923*/
-   /* Cast from pointer to int is OK, the function needs the address of the
-    * pointer as integer value for the DMA. */
-   /* initialize the UART interface for sending data via DMA (see [SRS_155]) */
-   serialHAL_InitTxUsart1DmaCh((UINT32) au8_TxDmaBuffer);
-
-   /* initialize the UART interface for reception of data via DMA (see [SRS_155]) */
-   serialHAL_InitRxUsart1DmaCh((UINT32) au8_RxDmaBuffer, (IPCXSYS_SIZEOF_MAX_TGM * 2u));
-   /*lint +e923*/
+   ipcxSYS_WaitStatReset();
+   ipcxSYS_LinkStatReset();
+
+   /* initialize the transport with the DMA buffers and start the reception, the transport calls
+   ** ipcxSYS_RxComplete() when the telegram is received (see [SRS_155], [SRS_118]) */
+   ipctSYS_Init(au8_TxDmaBuffer, au8_RxDmaBuffer, (UINT16)(IPCXSYS_SIZEOF_MAX_TGM * 2u));
    
 } /* end of ipcxSYS_Init() */
 
@@ -252,9 +299,60 @@ void ipcxSYS_SendUINT32( CONST UINT8  u8_ipcId, CONST UINT32 u32_data )
 ***************************************************************************************************/
 void ipcxSYS_SendBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, CONST UINT8* pau8_buffer)
 {
-   UINT8                   i;
+   UINT8  i;
+   UINT8* pau8_payload;
+
+   /* reserve the IPC telegram in the Tx DMA buffer, the length is checked there */
+   pau8_payload = ipcxSYS_TxReserve(u8_ipcId, u8_dataLen);
+
+   /* write payload directly into the Tx DMA buffer (see [SRS_2169]) */
+   for ( i = 0u; (i < u8_dataLen) && (i < IPCXSYS_SIZEOF_MAX_PAYLOAD); i++)
+   {
+      /*lint -esym(960, 17.4)*/
+      /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+       * other than array indexing used
+       * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+      pau8_payload[i] = pau8_buffer[i];
+      /*lint +esym(960, 17.4)*/
+   }
+
+   /* send data to the other controller */
+   ipcxSYS_TxCommit();
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_TxReserve
+
+  Description:
+    This function reserves an IPC telegram in the Tx DMA buffer and writes its ID. The caller
+    writes the payload directly into the returned buffer and sends the telegram with 
+    ipcxSYS_TxCommit(), no other IPC telegram shall be sent in between.
+
+  See also:
+    ipcxSYS_TxCommit()
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram. Since the highest bit of the transferred ID byte
+                        is used to distinguish between controller1 and controller2, this bit 
+                        shall not be used for an IPC ID (message ID). This must be ensured by the 
+                        calling function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)          
+    u8_dataLen (IN)   - Length of payload to send
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, checked)
+
+  Return value:
+    UINT8*            - Payload of the IPC telegram in the Tx DMA buffer (u8_dataLen bytes)
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+UINT8* ipcxSYS_TxReserve( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen )
+{
    CFG_CONTROLLER_ID_ENUM  e_controllerId;
-  
+
    /* if invalid data length */
    if (u8_dataLen > IPCXSYS_SIZEOF_MAX_PAYLOAD)
    {
@@ -263,26 +361,6 @@ void ipcxSYS_SendBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, CONST UI
    /* else: valid length */
    else
    {
-     /* FIT to manipulate data exchange */
-     /* RSM_IGNORE_BEGIN */
-     /* Code only used for FIT test so RSM warnings not relevant */
-     GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_TIMEOUT_RX, goto _FitRx);
-     /* RSM_IGNORE_END */
-     
-     /* reinitialize UART Rx DMA */
-     /* Cast from pointer to int is OK, the function needs the address of the
-      * pointer as integer value for the DMA. */
-     serialHAL_InitRxUsart1DmaCh( (UINT32)au8_RxDmaBuffer,                /*lint !e923*/
-                                  (2U * IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)) );
-
-     /* It must be avoided, that one controller already sends data, but the other controller has 
-     ** not yet restarted its UART Rx DMA. So an additional GPIO synchronization is done here. */
-     ipcsSYS_Sync();
-
-#ifdef GLOBFIT_FITTEST_ACTIVE
-_FitRx: /* CCT_NO_PRE_WARNING, only used for FIT test */
-#endif 
-
      /* get the controller ID (see [SRS_345]) */
      e_controllerId = cfgSYS_GetControllerID();
   
@@ -295,33 +373,89 @@ _FitRx: /* CCT_NO_PRE_WARNING, only used for FIT test */
      /* else: valid controller ID */
      else
      {
-       /* write IPC id and controller id (see [SRS_276]) to the TX buffer (see [SRS_345],
+       /* write IPC id and controller id (see [SRS_276]) to the TX DMA buffer (see [SRS_345],
         * [SRS_2169]) */
-       au8_TxBuffer[IPCXSYS_IDX_ID] = ( u8_ipcId & IPCXSYS_IPC_ID_MASK) \
+       au8_TxDmaBuffer[IPCXSYS_IDX_ID] = ( u8_ipcId & IPCXSYS_IPC_ID_MASK) \
        | ((( UINT8 ) e_controllerId ) & IPCXSYS_CONTROLLER_ID_MASK );
     
        /*FIT to manipulate the telegram ID*/
        GLOBFIT_FITTEST( GLOBFIT_CMD_IPC_ID,
-                        au8_TxBuffer[IPCXSYS_IDX_ID]++);
-        
-       /* write payload into the TX buffer (see [SRS_2169]) */
-       for ( i = 0u; i < u8_dataLen; i++)
-       {
-          /*lint -esym(960, 17.4)*/
-          /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-           * other than array indexing used
-           * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
-          /* Info 835: A zero has been given as left argument to operator '+'
-           * --> Done because of Array-Indexing */
-          /* get the payload data from buffer step by step and write it to the
-           * TX buffer */
-          au8_TxBuffer[i + IPCXSYS_IDX_PAYLOAD] = pau8_buffer[i]; /*lint !e835 */
-          /*lint +esym(960, 17.4)*/
-       }
-    
-       /* send data to the other controller */
-       Send(u8_dataLen);
+                        au8_TxDmaBuffer[IPCXSYS_IDX_ID]++);
+
+       u8_TxReservedLen = u8_dataLen;
+     }
+   }
+
+   return &au8_TxDmaBuffer[IPCXSYS_IDX_PAYLOAD];
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_TxCommit
+
+  Description:
+    This function sends the IPC telegram reserved by ipcxSYS_TxReserve() to the other controller.
+    The Rx DMA is prepared for the IPC telegram of the other controller (same length), its 
+    completion flag is reset and both controllers are synchronized before the transfer. The 
+    telegrams received before are no longer available afterwards.
+
+  See also:
+    ipcxSYS_TxReserve()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipcxSYS_TxCommit( void )
+{
+   UINT8 i;
+   UINT8 u8_dataLen = u8_TxReservedLen;
+
+   /* if no IPC telegram reserved */
+   if (u8_dataLen == k_TX_NOT_RESERVED)
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(15u));
+   }
+   /* else: reserved telegram */
+   else
+   {
+     u8_TxReservedLen = k_TX_NOT_RESERVED;
+
+     /* the IPC telegram received before is no longer available */
+     u8_RxState = k_RX_PENDING;
+
+     /* FIT to manipulate data exchange */
+     /* RSM_IGNORE_BEGIN */
+     /* Code only used for FIT test so RSM warnings not relevant */
+     GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_TIMEOUT_RX, goto _FitRx);
+     /* RSM_IGNORE_END */
+
+     /* clear the Rx DMA buffer, so a telegram is never checked twice */
+     for (i = 0u; i < (2U * IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)); i++)
+     {
+        au8_RxDmaBuffer[i] = ( UINT8 ) 0u;
      }
+     
+     /* restart the reception (UART Rx DMA) */
+     ipctSYS_RxStart((UINT16)(2U * IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)));
+
+     /* It must be avoided, that one controller already sends data, but the other controller has 
+     ** not yet restarted its UART Rx DMA. So an additional GPIO synchronization is done here. */
+     ipcsSYS_Sync();
+
+#ifdef GLOBFIT_FITTEST_ACTIVE
+_FitRx: /* CCT_NO_PRE_WARNING, only used for FIT test */
+#endif 
+
+     /* send data to the other controller */
+     Send(u8_dataLen);
    }
 }
 
@@ -356,10 +490,62 @@ _FitRx: /* CCT_NO_PRE_WARNING, only used for FIT test */
 
 ***************************************************************************************************/
 void ipcxSYS_GetBufferinclWait ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, UINT8* pau8_buffer)
+{
+   UINT8        i;
+   CONST UINT8* pau8_payload;
+
+   /* get the checked IPC telegram, the length is checked there */
+   pau8_payload = ipcxSYS_RxViewinclWait(u8_ipcId, u8_dataLen);
+
+   for ( i = 0u; (i < u8_dataLen) && (i < IPCXSYS_SIZEOF_MAX_PAYLOAD); i++ )
+   {
+      /*lint -esym(960, 17.4)*/
+      /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+       * other than array indexing used
+       * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+      /* write the payload of the valid copy to the receive buffer */
+      pau8_buffer[i] = pau8_payload[i];
+      /*lint +esym(960, 17.4)*/
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_RxViewinclWait
+
+  Description:
+    This function gets an IPC telegram which should already have arrived (see 
+    ipcxSYS_GetBufferinclWait()) and returns its payload in the Rx DMA buffer without copying it.
+    The IPC telegram is read once, a further read waits for the next IPC telegram. The time 
+    waited for the IPC telegram is added to the wait time statistic.
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram. Since the first bit of ID byte is used
+                        to distinguish between controller1 and controller2, this bit shall not 
+                        be used for IPC ID (message ID). This must be ensured by the calling
+                        function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u8_dataLen (IN)   - Length of payload to received
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, checked)
+
+  Return value:
+    CONST UINT8*      - Payload of the valid copy of the IPC telegram (u8_dataLen bytes), valid 
+                        up to the next IPC telegram sent
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+CONST UINT8* ipcxSYS_RxViewinclWait( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen )
 {
    UINT32             u32_startTimeout;
-   UINT32             u32_timeout;
+   UINT32             u32_timeout = 0u;
    GLOB_RETCODE_ENUM  e_ipcRetVal;
+   CONST UINT8*       pau8_payload = &au8_RxDmaBuffer[IPCXSYS_IDX_PAYLOAD];
 
    /* if invalid data length */
    if (u8_dataLen > IPCXSYS_SIZEOF_MAX_PAYLOAD)
@@ -369,7 +555,7 @@ void ipcxSYS_GetBufferinclWait ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, U
    /* else: valid length */
    else
    {
-     e_ipcRetVal = GetBuffer(u8_ipcId, u8_dataLen, pau8_buffer);
+     e_ipcRetVal = GetBuffer(u8_ipcId, u8_dataLen, &pau8_payload);
   
      /* get the actual system time for IPC-Timeout calculation */
      u32_startTimeout = timerHAL_GetSystemTime3();
@@ -393,10 +579,16 @@ void ipcxSYS_GetBufferinclWait ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, U
         else
         {  
           /* get data from the IPC */
-          e_ipcRetVal = GetBuffer(u8_ipcId, u8_dataLen, pau8_buffer);
+          e_ipcRetVal = GetBuffer(u8_ipcId, u8_dataLen, &pau8_payload);
         }
      }
+
+     /* add the time waited for the IPC telegram (0 if it was already received) */
+     u32_RxWaitTime += u32_timeout;
+     LinkStatWait(u8_ipcId, u32_timeout);
    }
+
+   return pau8_payload;
 }
 
 /***************************************************************************************************
@@ -474,8 +666,10 @@ UINT32 ipcxSYS_ExChangeUINT32Data (CONST UINT32 u32_ipcSendVal, CONST UINT8 u8_i
 {
    UINT32            u32_retVal = 0u;
    UINT32            u32_startTimeout;
-   UINT32            u32_timeout;
+   UINT32            u32_timeout = 0u;
    GLOB_RETCODE_ENUM e_ipcRetVal = GLOB_RET_BUSY;
+   CONST UINT8*      pau8_payload;
+   UINT8             i;
   
    /* exchange test-results */
    /* Cast from pointer to pointer is intended here because the underlying function directly writes
@@ -505,16 +699,15 @@ UINT32 ipcxSYS_ExChangeUINT32Data (CONST UINT32 u32_ipcSendVal, CONST UINT8 u8_i
       else
       {
         /* get data from the IPC */
-        /* Cast from pointer to pointer is intended here because the underlying function reads from 
-        ** the DMA buffer. 
-        */
-        e_ipcRetVal = GetBuffer(u8_ipcId, 
-                                (UINT8)sizeof(UINT32), 
-                                (UINT8*)&u32_retVal); /*lint !e928 */
+        e_ipcRetVal = GetBuffer(u8_ipcId, (UINT8)sizeof(UINT32), &pau8_payload);
       }
 
    } /* wait till the IPC data received */
    while (e_ipcRetVal == GLOB_RET_BUSY);
+
+   /* add the time waited for the IPC telegram (transfer time included) */
+   u32_RxWaitTime += u32_timeout;
+   LinkStatWait(u8_ipcId, u32_timeout);
    
    /* if unexpected IPC result */
    if (e_ipcRetVal != GLOB_RET_OK)
@@ -524,155 +717,730 @@ UINT32 ipcxSYS_ExChangeUINT32Data (CONST UINT32 u32_ipcSendVal, CONST UINT8 u8_i
    /* everything fine */
    else
    {
-     /* empty branch */
+     /* copy byte-wise, the payload in the DMA buffer is not aligned */
+     for ( i = 0u; i < (UINT8)sizeof(UINT32); i++ )
+     {
+        /*lint -esym(960, 17.4)*/
+        /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+         * other than array indexing used
+         * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+        ((UINT8*)&u32_retVal)[i] = pau8_payload[i]; /*lint !e928 */
+        /*lint +esym(960, 17.4)*/
+     }
    }
 
    return u32_retVal;
 }
 
-/***************************************************************************************************
-**    static functions
-***************************************************************************************************/
-
 /***************************************************************************************************
   Function:
-    Send
+    ipcxSYS_FrameAddBuffer
 
   Description:
-    This function sends the data over the IPC to the other controller.
-    In the first steps this function calculates the crc of the data and writes it to the DMA 
-    buffer for transmitting. Then a DMA transfer is initiated.
+    This function adds a record (ID, length and payload) to the IPC frame which is sent by the 
+    next call of ipcxSYS_FrameSend(). Several IPC messages are so exchanged in one IPC telegram 
+    (one CRC, sent twice) and in one pair of time slices.
+    Both controllers shall add the same records in the same order.
 
   See also:
-    -
+    ipcxSYS_FrameSend(), ipcxSYS_FrameGetBuffer()
 
   Parameters:
+    u8_ipcId (IN)     - ID of the IPC message. Since the highest bit of the transferred ID byte
+                        is used to distinguish between controller1 and controller2, this bit 
+                        shall not be used for an IPC ID (message ID). This must be ensured by the 
+                        calling function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)          
     u8_dataLen (IN)   - Length of payload to send
-                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, 
-                        already checked in ipcxSYS_SendBuffer)
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_FRAME minus the records already 
+                        added, checked)
+    pau8_buffer (IN)  - Payload to transmit over IPC
+                        (valid range: <>NULL, not checked because only called by reference)
 
   Return value:
     -
 
   Remarks:
     Context: IRQ Scheduler
-    Context: main (during initialization)
 
 ***************************************************************************************************/
-STATIC void Send( CONST UINT8 u8_dataLen )
+void ipcxSYS_FrameAddBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, 
+                             CONST UINT8* pau8_buffer )
 {
    UINT8 i;
-   UINT8 u8_crc    = IPCXSYS_CRC_INITIAL_VALUE;
 
-   /* copy ID and Payload to DMA buffer using for-loop  */
-   for (i = 0u; i < IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen); i++)
+   /* if record does not fit into the IPC frame */
+   if ( IPCXSYS_SIZEOF_REC_VAR(u8_dataLen) > (UINT32)(IPCXSYS_SIZEOF_MAX_FRAME - u8_FrameTxLen) )
    {
-      /* calculate the checksum over the data to send (see [SRS_327]) */
-      u8_crc = crcHAL_CalcCRC8(u8_crc, au8_TxBuffer[i]);
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_INVALID_PARAM_EX, GLOBFAIL_ADDINFO_FILE(11u));
+   }
+   /* else: record fits */
+   else
+   {
+     /* write record header */
+     au8_FrameTxBuffer[u8_FrameTxLen + IPCXSYS_IDX_REC_ID] = u8_ipcId & IPCXSYS_IPC_ID_MASK;
+     au8_FrameTxBuffer[u8_FrameTxLen + IPCXSYS_IDX_REC_LEN] = u8_dataLen;
 
-      /* copy every byte into the DMA send buffer [SRS_2169] */
-      au8_TxDmaBuffer[i] = au8_TxBuffer[i];
-      /* send IPC message twice, see [SRS_119] */
-      au8_TxDmaBuffer[i + IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)] = au8_TxBuffer[i];
+     /* write payload of the record */
+     for ( i = 0u; i < u8_dataLen; i++ )
+     {
+        /*lint -esym(960, 17.4)*/
+        /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+         * other than array indexing used
+         * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+        au8_FrameTxBuffer[u8_FrameTxLen + IPCXSYS_IDX_REC_PAYLOAD + i] = pau8_buffer[i];
+        /*lint +esym(960, 17.4)*/
+     }
+
+     u8_FrameTxLen = (UINT8)(u8_FrameTxLen + IPCXSYS_SIZEOF_REC_VAR(u8_dataLen));
    }
+}
 
-   /* write the CRC to the DMA send buffer [SRS_2169] */
-   au8_TxDmaBuffer[IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen)] = u8_crc;
-   /* send IPC message twice, see [SRS_119] */
-   au8_TxDmaBuffer[IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen)+IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)] = u8_crc;
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameAddUINT32
 
-   /* FIT to manipulate data exchange */
-   /* RSM_IGNORE_BEGIN */
-   /* Code only used for FIT test so RSM warnings not relevant */
-   GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_TIMEOUT_TX, goto _FitTx);
-   /* RSM_IGNORE_END */
+  Description:
+    This function adds an UINT32 data record to the IPC frame.
 
-   /* reinitialize UART Tx DMA,this ensures that CPAR (DMA channel peripheral address register) and
-   ** CMAR  (DMA channel memory address register) always contains the correct values since these 
-   ** register are not included in the SFR test */
-   /* Cast from pointer to int is OK, the function needs the address of the
-    * pointer as integer value for the DMA. */
-   serialHAL_InitTxUsart1DmaCh((UINT32) au8_TxDmaBuffer); /*lint !e923 */
-   /* trigger sending of TxDMA Buffer */
-   serialHAL_SendUsart1Dma(2U * IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen));
+  See also:
+    ipcxSYS_FrameAddBuffer()
 
-#ifdef GLOBFIT_FITTEST_ACTIVE
-_FitTx: /* CCT_NO_PRE_WARNING, only used for FIT test */
-   __NOP();
-#endif
+  Parameters:
+    u8_ipcId (IN)  - ID of the IPC message.
+                     (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u32_data (IN)  - value to send
+                     (valid range: any, not checked)    
+
+  Return value:
+    -
 
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameAddUINT32( CONST UINT8  u8_ipcId, CONST UINT32 u32_data )
+{
+  /* forward to 'generic' add routine */ 
+  ipcxSYS_FrameAddBuffer(u8_ipcId, (UINT8)sizeof(UINT32), (CONST UINT8*)&u32_data); /*lint !e928 */
 }
 
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameSend
+
+  Description:
+    This function sends the records added since the last call as one IPC telegram (ID 
+    IPCXSYS_IPC_ID_FRAME) to the other controller. The records received before are no longer
+    available afterwards.
+
+  See also:
+    ipcxSYS_FrameRecvinclWait()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameSend( void )
+{
+   /* the received records belong to the previous frame */
+   u8_FrameRxLen = 0u;
+   u8_FrameRxExpLen = u8_FrameTxLen;
+
+   /* send the frame as one IPC telegram */
+   ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_FRAME, u8_FrameTxLen, au8_FrameTxBuffer);
+
+   /* start the next frame */
+   u8_FrameTxLen = 0u;
+}
 
 /***************************************************************************************************
   Function:
-    CheckCrcAnd_uC_ID_Rx
+    ipcxSYS_FrameRecvinclWait
 
   Description:
-    This function calculates the checksum over the received IPC telegram and checks it against 
-    the received. If there is an error in the first telegram the second one is checked.
-    If everything is OK the specified buffer number is returned, else the Safety Handler will 
-    be called.
-    After checksum checking the received controller ID of the tgm is checked. If the received ID 
-    equals the own ID, a failure is detected and the Safety Handler will be called.
+    This function receives the IPC frame of the other controller which should already have 
+    arrived (see ipcxSYS_GetBufferinclWait()). The frame has the length of the frame sent last 
+    and its records must fill it exactly, else the Safety Handler is called.
+    The records are available via ipcxSYS_FrameGetBuffer() up to the next ipcxSYS_FrameSend().
 
   See also:
     -
 
   Parameters:
-    u8_dataLen (IN)   - Length of payload to send
-                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, 
-                        already checked in ipcxSYS_SendBuffer)
+    -
 
   Return value:
-    UINT8              - Used buffer index
+    -
 
   Remarks:
     Context: IRQ Scheduler
-    Context: main (during initialization)
 
 ***************************************************************************************************/
-STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen )
+void ipcxSYS_FrameRecvinclWait( void )
 {
-   UINT8                  i;
-   UINT8                  u8_crc    = IPCXSYS_CRC_INITIAL_VALUE;
-   UINT8                  u8_rxBuffIdx = k_RXBUFF_IDX_0;
-   CFG_CONTROLLER_ID_ENUM e_controllerId;
+   UINT32 u32_idx = 0u;
 
-   /* FIT to manipulate the received checksum in both buffers
-    * (1st step: flips the LSB of the buffer1-crc) */
-   /* RSM_IGNORE_BEGIN */
-   /* Code only used for FIT test so RSM warnings not relevant */
-   GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_CMD_IPC_CRC,
-                   (au8_RxBuffer[k_RXBUFF_IDX_0][3] ^= 1u));
-   /* RSM_IGNORE_END */
+   /* receive the frame telegram, CRC and IDs are checked here */
+   ipcxSYS_GetBufferinclWait(IPCXSYS_IPC_ID_FRAME, u8_FrameRxExpLen, au8_FrameRxBuffer);
 
-   /* calculate the CRC of first buffer */
-   for ( i = 0u; i < IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen); i++ )
+   /* walk through the records, the last one must end at the end of the frame */
+   while ( (u32_idx + IPCXSYS_SIZEOF_REC_HEADER) <= u8_FrameRxExpLen )
    {
-      /* calculated the CRC of the received data (see [SRS_327]) */
-      u8_crc = crcHAL_CalcCRC8 ( u8_crc, au8_RxBuffer[k_RXBUFF_IDX_0][i]);
+      u32_idx += IPCXSYS_SIZEOF_REC_VAR(au8_FrameRxBuffer[u32_idx + IPCXSYS_IDX_REC_LEN]);
    }
 
-   /* check the calculated CRC with the received CRC of the RX buffer */
-   if ( au8_RxBuffer[ k_RXBUFF_IDX_0 ][ IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen) ] != u8_crc )
+   /* if the records do not fill the frame */
+   if ( u32_idx != u8_FrameRxExpLen )
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_RETURN_ERR, GLOBFAIL_ADDINFO_FILE(12u));
+   }
+   /* else: valid frame */
+   else
+   {
+     u8_FrameRxLen = u8_FrameRxExpLen;
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameGetBuffer
+
+  Description:
+    This function returns the payload of a record of the received IPC frame. If the frame 
+    contains no record with the ID or the record has another length, the Safety Handler is 
+    called.
+
+  See also:
+    ipcxSYS_FrameRecvinclWait()
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC message.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u8_dataLen (IN)   - Length of payload to receive
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_FRAME, checked)
+
+  Return value:
+    CONST UINT8*      - Payload of the record, valid up to the next ipcxSYS_FrameSend()
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+CONST UINT8* ipcxSYS_FrameGetBuffer( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen )
+{
+   UINT8        u8_idx;
+   CONST UINT8* pu8_retVal = &au8_FrameRxBuffer[0u];
+
+   u8_idx = FrameFind(u8_ipcId);
+
+   /* if no record with this ID received (see [SRS_649]) */
+   if ( u8_idx >= u8_FrameRxLen )
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_IPC_ID, GLOBFAIL_ADDINFO_FILE(13u));
+   }
+   /* else if record has an unexpected length */
+   else if ( au8_FrameRxBuffer[u8_idx + IPCXSYS_IDX_REC_LEN] != u8_dataLen )
+   {
+     GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_RETURN_ERR, GLOBFAIL_ADDINFO_FILE(14u));
+   }
+   /* else: record found */
+   else
+   {
+     pu8_retVal = &au8_FrameRxBuffer[u8_idx + IPCXSYS_IDX_REC_PAYLOAD];
+   }
+
+   return pu8_retVal;
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameGetUINT32
+
+  Description:
+    This function returns the UINT32 data of a record of the received IPC frame.
+
+  See also:
+    ipcxSYS_FrameGetBuffer()
+
+  Parameters:
+    u8_ipcId (IN)  - ID of the IPC message.
+                     (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+
+  Return value:
+    UINT32         - Received IPC value
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+UINT32 ipcxSYS_FrameGetUINT32( CONST UINT8 u8_ipcId )
+{
+   UINT8        i;
+   UINT32       u32_retVal;
+   CONST UINT8* pau8_payload;
+
+   pau8_payload = ipcxSYS_FrameGetBuffer(u8_ipcId, (UINT8)sizeof(UINT32));
+
+   /* copy byte-wise, the payload is not aligned */
+   for ( i = 0u; i < (UINT8)sizeof(UINT32); i++ )
+   {
+      /*lint -esym(960, 17.4)*/
+      /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+       * other than array indexing used
+       * --> Deactivate Misra Rule 17.4, Array-Indexing is done */
+      ((UINT8*)&u32_retVal)[i] = pau8_payload[i]; /*lint !e928 */
+      /*lint +esym(960, 17.4)*/
+   }
+
+   return u32_retVal;
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatCycle
+
+  Description:
+    This function adds the time waited for IPC telegrams and in ipcsSYS_Sync() during the last
+    scheduler cycle to the wait time statistic. It is called once per scheduler cycle.
+
+  See also:
+    ipcsSYS_GetWaitTime()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatCycle( void )
+{
+   UINT32 u32_rxWaitTime   = u32_RxWaitTime;
+   UINT32 u32_syncWaitTime = ipcsSYS_GetWaitTime();
+   UINT16 u16_rx;
+   UINT16 u16_sync;
+   UINT16 u16_total;
+
+   /* wait time of the last cycle (free running sums) */
+   u16_rx   = Saturate16(u32_rxWaitTime - u32_RxWaitTimeLast);
+   u16_sync = Saturate16(u32_syncWaitTime - u32_SyncWaitTimeLast);
+   u16_total = Saturate16((UINT32)u16_rx + (UINT32)u16_sync);
+   u32_RxWaitTimeLast   = u32_rxWaitTime;
+   u32_SyncWaitTimeLast = u32_syncWaitTime;
+
+   s_WaitStat.u16_rxLast   = u16_rx;
+   s_WaitStat.u16_syncLast = u16_sync;
+   if (u16_rx > s_WaitStat.u16_rxMax)
+   {
+     s_WaitStat.u16_rxMax = u16_rx;
+   }
+   else
+   {
+     /* empty branch */
+   }
+   if (u16_sync > s_WaitStat.u16_syncMax)
+   {
+     s_WaitStat.u16_syncMax = u16_sync;
+   }
+   else
+   {
+     /* empty branch */
+   }
+   if (u16_total > s_WaitStat.u16_totalMax)
+   {
+     s_WaitStat.u16_totalMax = u16_total;
+   }
+   else
+   {
+     /* empty branch */
+   }
+
+   /* counters (saturated) */
+   if (s_WaitStat.u32_cycleCnt < (UINT32)UINT32_MAX)
+   {
+     s_WaitStat.u32_cycleCnt++;
+   }
+   else
+   {
+     /* empty branch, counter saturated */
+   }
+   if ((u16_rx != 0u) && (s_WaitStat.u32_rxWaitCycleCnt < (UINT32)UINT32_MAX))
+   {
+     s_WaitStat.u32_rxWaitCycleCnt++;
+   }
+   else
+   {
+     /* empty branch, no wait or counter saturated */
+   }
+
+   /* mean value over a sliding window */
+   if (u16_WaitMeanCnt >= k_WAIT_MEAN_WINDOW)
+   {
+     u32_WaitMeanSum >>= 1u;
+     u16_WaitMeanCnt >>= 1u;
+   }
+   else
+   {
+     /* empty branch */
+   }
+   u32_WaitMeanSum += u16_total;
+   u16_WaitMeanCnt++;
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatGet
+
+  Description:
+    This function returns the wait time statistic.
+
+  See also:
+    -
+
+  Parameters:
+    ps_stat (OUT)     - wait time statistic
+                        (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatGet( IPCXSYS_WAIT_STAT_STRUCT* ps_stat )
+{
+   *ps_stat = s_WaitStat;
+
+   /* no sample yet: report 0 as mean value */
+   if (u16_WaitMeanCnt == 0u)
+   {
+     ps_stat->u16_totalMean = 0u;
+   }
+   else
+   {
+     ps_stat->u16_totalMean = (UINT16)(u32_WaitMeanSum / u16_WaitMeanCnt);
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatReset
+
+  Description:
+    This function clears the wait time statistic.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatReset( void )
+{
+   /* the next cycle starts with the current sums */
+   u32_RxWaitTimeLast   = u32_RxWaitTime;
+   u32_SyncWaitTimeLast = ipcsSYS_GetWaitTime();
+   u32_WaitMeanSum = 0u;
+   u16_WaitMeanCnt = 0u;
+
+   s_WaitStat.u32_cycleCnt       = 0u;
+   s_WaitStat.u32_rxWaitCycleCnt = 0u;
+   s_WaitStat.u16_rxLast         = 0u;
+   s_WaitStat.u16_rxMax          = 0u;
+   s_WaitStat.u16_syncLast       = 0u;
+   s_WaitStat.u16_syncMax        = 0u;
+   s_WaitStat.u16_totalMean      = 0u;
+   s_WaitStat.u16_totalMax       = 0u;
+   s_WaitStat.u16_rxMarginMin    = (UINT16)UINT16_MAX;
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_LinkStatGet
+
+  Description:
+    This function returns the link statistic of an IPC ID: received IPC telegrams, CRC failures 
+    of the first copy, IPC telegrams recovered from the second copy and the time waited for the 
+    IPC telegrams by ipcxSYS_RxViewinclWait() and ipcxSYS_ExChangeUINT32Data().
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram
+                        (valid range: 0..IPCXSYS_IPC_ID_CNT-1, not checked, checked by caller)
+    ps_stat (OUT)     - link statistic
+                        (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_LinkStatGet( CONST UINT8 u8_ipcId, IPCXSYS_LINK_STAT_STRUCT* ps_stat )
+{
+   *ps_stat = as_LinkStat[u8_ipcId];
+
+   /* no wait yet: report 0 as mean value */
+   if (au16_LinkWaitCnt[u8_ipcId] == 0u)
+   {
+     ps_stat->u16_waitMean = 0u;
+   }
+   else
+   {
+     ps_stat->u16_waitMean = (UINT16)(au32_LinkWaitSum[u8_ipcId] / au16_LinkWaitCnt[u8_ipcId]);
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_LinkStatReset
+
+  Description:
+    This function clears the link statistic of all IPC IDs.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_LinkStatReset( void )
+{
+   UINT8 u8_id;
+   UINT8 u8_idx;
+
+   for (u8_id = 0u; u8_id < IPCXSYS_IPC_ID_CNT; u8_id++)
+   {
+     as_LinkStat[u8_id].u32_rxCnt      = 0u;
+     as_LinkStat[u8_id].u16_crcFailCnt = 0u;
+     as_LinkStat[u8_id].u16_recoverCnt = 0u;
+     as_LinkStat[u8_id].u16_waitMax    = 0u;
+     as_LinkStat[u8_id].u16_waitMean   = 0u;
+     for (u8_idx = 0u; u8_idx < IPCXSYS_WAIT_HIST_CNT; u8_idx++)
+     {
+       as_LinkStat[u8_id].au16_waitHist[u8_idx] = 0u;
+     }
+     au32_LinkWaitSum[u8_id] = 0u;
+     au16_LinkWaitCnt[u8_id] = 0u;
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_RxComplete
+
+  Description:
+    This function is called by the transport when the IPC telegram is completely received in the
+    Rx DMA buffer. It sets the completion flag and stores the time of the reception.
+
+  See also:
+    ipcxSYS_RxViewinclWait(), ipctSYS_RxStart()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: DMA1 Channel 5 IRQ (ipct_TransportUsart-sys.c)
+    Context: receive thread of the host transport (ipct_TransportHost-sys.c)
+
+***************************************************************************************************/
+void ipcxSYS_RxComplete( void )
+{
+   u32_RxCompleteTime = timerHAL_GetSystemTime3();
+   u8_RxState = k_RX_COMPLETE;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    Send
+
+  Description:
+    This function sends the data over the IPC to the other controller.
+    In the first steps this function calculates the crc of the data, which is already in the 
+    DMA buffer, and writes the crc and the second copy of the IPC telegram in the same pass. 
+    Then the transfer is started by the transport.
+
+  See also:
+    -
+
+  Parameters:
+    u8_dataLen (IN)   - Length of payload to send
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, 
+                        already checked in ipcxSYS_TxReserve)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+STATIC void Send( CONST UINT8 u8_dataLen )
+{
+   UINT8 i;
+   UINT8 u8_crc    = IPCXSYS_CRC_INITIAL_VALUE;
+
+   /* ID and Payload are already in the DMA buffer [SRS_2169] */
+   for (i = 0u; i < IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen); i++)
+   {
+      /* calculate the checksum over the data to send (see [SRS_327]) */
+      u8_crc = crcHAL_CalcCRC8(u8_crc, au8_TxDmaBuffer[i]);
+
+      /* send IPC message twice, see [SRS_119] */
+      au8_TxDmaBuffer[i + IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)] = au8_TxDmaBuffer[i];
+   }
+
+   /* write the CRC to the DMA send buffer [SRS_2169] */
+   au8_TxDmaBuffer[IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen)] = u8_crc;
+   /* send IPC message twice, see [SRS_119] */
+   au8_TxDmaBuffer[IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen)+IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)] = u8_crc;
+
+   /* FIT to manipulate data exchange */
+   /* RSM_IGNORE_BEGIN */
+   /* Code only used for FIT test so RSM warnings not relevant */
+   GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_TIMEOUT_TX, goto _FitTx);
+   /* RSM_IGNORE_END */
+
+   /* trigger sending of TxDMA Buffer, the transport reinitializes the UART Tx DMA */
+   ipctSYS_TxStart((UINT16)(2U * IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)));
+
+#ifdef GLOBFIT_FITTEST_ACTIVE
+_FitTx: /* CCT_NO_PRE_WARNING, only used for FIT test */
+   __NOP();
+#endif
+
+}
+
+
+/***************************************************************************************************
+  Function:
+    CheckCrcAnd_uC_ID_Rx
+
+  Description:
+    This function calculates the checksum over the received IPC telegram in the Rx DMA buffer and 
+    checks it against the received. If there is an error in the first telegram the second one is 
+    checked.
+    If everything is OK the specified buffer number is returned, else the Safety Handler will 
+    be called.
+    After checksum checking the received controller ID of the tgm is checked. If the received ID 
+    equals the own ID, a failure is detected and the Safety Handler will be called.
+    A CRC failure of the first copy and the recovery by the second copy are counted in the link 
+    statistic of the requested IPC ID (the ID in the faulty copy is not reliable).
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - requested ID of the IPC telegram, only used for the link statistic
+                        (valid range: any, IDs >= IPCXSYS_IPC_ID_CNT are not counted)
+    u8_dataLen (IN)   - Length of payload to send
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, 
+                        already checked in ipcxSYS_SendBuffer)
+
+  Return value:
+    UINT8              - Used buffer index
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen )
+{
+   UINT8                  i;
+   UINT8                  u8_crc    = IPCXSYS_CRC_INITIAL_VALUE;
+   UINT8                  u8_rxBuffIdx = k_RXBUFF_IDX_0;
+   CFG_CONTROLLER_ID_ENUM e_controllerId;
+
+   /* FIT to manipulate the received checksum in both buffers
+    * (1st step: flips the LSB of the buffer1-crc) */
+   /* RSM_IGNORE_BEGIN */
+   /* Code only used for FIT test so RSM warnings not relevant */
+   GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_CMD_IPC_CRC,
+                   (au8_RxDmaBuffer[k_RXBUFF_OFS(k_RXBUFF_IDX_0, u8_dataLen) + 3u] ^= 1u));
+   /* RSM_IGNORE_END */
+
+   /* calculate the CRC of first buffer */
+   for ( i = 0u; i < IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen); i++ )
+   {
+      /* calculated the CRC of the received data (see [SRS_327]) */
+      u8_crc = crcHAL_CalcCRC8 ( u8_crc, 
+                                 au8_RxDmaBuffer[k_RXBUFF_OFS(k_RXBUFF_IDX_0, u8_dataLen) + i]);
+   }
+
+   /* check the calculated CRC with the received CRC of the RX buffer */
+   if (   au8_RxDmaBuffer[ k_RXBUFF_OFS(k_RXBUFF_IDX_0, u8_dataLen) 
+                      + IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen) ] 
+       != u8_crc )
    {
       /* the CRC of the RX buffer is wrong, try the next buffer (see [SRS_119]) */
       u8_crc = IPCXSYS_CRC_INITIAL_VALUE;
 
+      /* count the CRC failure of the first copy (saturated) */
+      if (   (u8_ipcId < IPCXSYS_IPC_ID_CNT) 
+          && (as_LinkStat[u8_ipcId].u16_crcFailCnt < (UINT16)UINT16_MAX) )
+      {
+        as_LinkStat[u8_ipcId].u16_crcFailCnt++;
+      }
+      else
+      {
+        /* empty branch, ID not counted or counter saturated */
+      }
+
       /* FIT to manipulate the received checksum in both buffers
        * (2nd step: flips the LSB of the buffer2-crc) */
       GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_CRC,
-                    (au8_RxBuffer[k_RXBUFF_IDX_1][4] ^= 0x80u));
+                    (au8_RxDmaBuffer[k_RXBUFF_OFS(k_RXBUFF_IDX_1, u8_dataLen) + 4u] ^= 0x80u));
 
       /* calculate CRC result of second buffer (see [SRS_119], [SRS_327]) */
       for (i = 0u; i < IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen); i++)
       {
-         u8_crc = crcHAL_CalcCRC8 ( u8_crc, au8_RxBuffer[k_RXBUFF_IDX_1][i]);
+         u8_crc = crcHAL_CalcCRC8 ( u8_crc, 
+                                    au8_RxDmaBuffer[k_RXBUFF_OFS(k_RXBUFF_IDX_1, u8_dataLen) + i]);
       }
 
       /* check the CRC of the second buffer */
-      if ( au8_RxBuffer[ k_RXBUFF_IDX_1 ][ IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen) ] != u8_crc )
+      if (   au8_RxDmaBuffer[ k_RXBUFF_OFS(k_RXBUFF_IDX_1, u8_dataLen) 
+                         + IPCXSYS_SIZEOF_DATA_VAR(u8_dataLen) ] 
+          != u8_crc )
       {
          /* both telegrams are wrong, go to the FS state (see [SRS_119]) */
          GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_CRC, GLOBFAIL_ADDINFO_FILE(7u));
@@ -683,6 +1451,17 @@ STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen )
       {
          /* the CRC of the second buffer is OK return the number of the second buffer */
          u8_rxBuffIdx = k_RXBUFF_IDX_1;
+
+         /* count the recovery by the second copy (saturated) */
+         if (   (u8_ipcId < IPCXSYS_IPC_ID_CNT) 
+             && (as_LinkStat[u8_ipcId].u16_recoverCnt < (UINT16)UINT16_MAX) )
+         {
+           as_LinkStat[u8_ipcId].u16_recoverCnt++;
+         }
+         else
+         {
+           /* empty branch, ID not counted or counter saturated */
+         }
       }
    }
    else
@@ -712,11 +1491,13 @@ STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen )
      /* FIT to manipulate the the controller ID. */
      GLOBFIT_FITTEST(GLOBFIT_CMD_IPC_CONTROLLER,
                      e_controllerId =
-                     (CFG_CONTROLLER_ID_ENUM)au8_RxBuffer[u8_rxBuffIdx][IPCXSYS_IDX_ID]);
+                     (CFG_CONTROLLER_ID_ENUM)
+                     au8_RxDmaBuffer[k_RXBUFF_OFS(u8_rxBuffIdx, u8_dataLen) + IPCXSYS_IDX_ID]);
   
      /* check the received ID, see [SRS_276] */
      if (    ( ( ( UINT8 ) e_controllerId ) & IPCXSYS_CONTROLLER_ID_MASK)
-        == ( au8_RxBuffer[ u8_rxBuffIdx ][ IPCXSYS_IDX_ID ] & IPCXSYS_CONTROLLER_ID_MASK ) )
+        == (   au8_RxDmaBuffer[ k_RXBUFF_OFS(u8_rxBuffIdx, u8_dataLen) + IPCXSYS_IDX_ID ] 
+             & IPCXSYS_CONTROLLER_ID_MASK ) )
      {
         GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_IPCX_CONTROLLER_ID, GLOBFAIL_ADDINFO_FILE(9u));
         /* set return value, only used for unit test */
@@ -739,26 +1520,27 @@ STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen )
     GetBuffer
 
   Description:
-    This function returns the data after an IPC transfer. In the first step the received data is 
-    copied out of the DMA buffer. Then a CRC and Tgm-ID check is executed. After this the received 
-    data is copied into the output buffer.
-    In case of a failure, the Safety Handler will be called. If the IPC transfer is still busy, 
-    the return value is GLOB_RET_BUSY.
+    This function returns the data after an IPC transfer. A CRC and Tgm-ID check of the two 
+    copies of the IPC telegram is executed in the Rx DMA buffer. After this the payload of the 
+    valid copy is returned, it is not copied. The completion flag is reset, so the IPC telegram 
+    is read only once.
+    In case of a failure, the Safety Handler will be called. If the completion flag of the Rx DMA
+    is not yet set, the return value is GLOB_RET_BUSY.
 
   See also:
     -
 
   Parameters:
-    u8_ipcId (IN)     - ID of the IPC telegram. Since the highest bit of the transferred ID byte
-                        is used to distinguish between controller1 and controller2, this bit 
-                        shall not be used for an IPC ID (message ID). This must be ensured by the 
-                        calling function.
-                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
-    u8_dataLen (IN)   - Length of payload to receive
-                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, must be done 
-                        by calling function)
-    pau8_buffer (OUT) - Buffer for reception.
-                        (valid range: <>NULL, not checked because only called by reference)
+    u8_ipcId (IN)       - ID of the IPC telegram. Since the highest bit of the transferred ID byte
+                          is used to distinguish between controller1 and controller2, this bit 
+                          shall not be used for an IPC ID (message ID). This must be ensured by 
+                          the calling function.
+                          (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u8_dataLen (IN)     - Length of payload to receive
+                          (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, not checked, must be done 
+                          by calling function)
+    ppau8_payload (OUT) - Payload of the valid copy in the Rx DMA buffer, only set if GLOB_RET_OK
+                          (valid range: <>NULL, not checked because only called by reference)
 
   Return value:
     GLOB_RET_ERR      - Error (e.g. wrong CRC)
@@ -772,40 +1554,28 @@ STATIC UINT8 CheckCrcAnd_uC_ID_Rx ( CONST UINT8 u8_dataLen )
 ***************************************************************************************************/
 STATIC GLOB_RETCODE_ENUM GetBuffer( CONST UINT8 u8_ipcId, 
                                     CONST UINT8 u8_dataLen,
-                                    UINT8 pau8_buffer[] )
+                                    CONST UINT8** ppau8_payload )
 {
-   UINT8             i;
    UINT8             u8_rxBuffIdx  = 0u;
    GLOB_RETCODE_ENUM e_retVal   = GLOB_RET_ERR;
+   UINT16            u16_margin;
 
-   /*  get the CRC from TX DMA buffer first */
-   if ( k_DMA_RX_RECEIVED != (DMA1_Channel5->CNDTR) )
+   /* if the Rx DMA has not yet signaled the completion of the transfer */
+   if ( k_RX_COMPLETE != u8_RxState )
    {
-      /* still waiting for all Bytes to be received  */
+      /* still waiting for all Bytes to be received or IPC telegram already read */
       e_retVal = GLOB_RET_BUSY;
    }
    else
    {
-      /* write/split the data from the DMA Rx buffer to the two Rx buffers */
-      for (i = 0u; i < (IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)); i++)
-      {
-         /* copy the RX data from DMA Buffer to Rx buffer */
-         au8_RxBuffer[k_RXBUFF_IDX_0][i] = au8_RxDmaBuffer[i];
-
-         au8_RxBuffer[k_RXBUFF_IDX_1][i] = au8_RxDmaBuffer[i + IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)];
-
-         /* clear the Rx DMA buffer */
-         au8_RxDmaBuffer[i] = ( UINT8 ) 0u;
-         au8_RxDmaBuffer[i + IPCXSYS_SIZEOF_TGM_VAR(u8_dataLen)] = ( UINT8 ) 0u;
-
-      }
-
       /* check CRC and uC ID here to check if received telegram correctly received in one of the 
-       * two buffers function will return a buffer index or enter safe state */
-      u8_rxBuffIdx = CheckCrcAnd_uC_ID_Rx(u8_dataLen);
+       * two copies function will return a buffer index or enter safe state */
+      u8_rxBuffIdx = CheckCrcAnd_uC_ID_Rx(u8_ipcId, u8_dataLen);
 
       /* check if received ID matches requested ID (see [SRS_649])*/
-      if ( ( au8_RxBuffer[u8_rxBuffIdx][IPCXSYS_IDX_ID] & IPCXSYS_IPC_ID_MASK) != u8_ipcId )
+      if (   ( au8_RxDmaBuffer[k_RXBUFF_OFS(u8_rxBuffIdx, u8_dataLen) + IPCXSYS_IDX_ID] 
+             & IPCXSYS_IPC_ID_MASK) 
+          != u8_ipcId )
       {
          GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_IPCX_IPC_ID, GLOBFAIL_ADDINFO_FILE(10u));
          /* set return value, only used for unit test */
@@ -813,22 +1583,170 @@ STATIC GLOB_RETCODE_ENUM GetBuffer( CONST UINT8 u8_ipcId,
       }
       else
       {
-        /*lint -e835*/
-        /* Deactivated lint message because the constant IPCXSYS_IDX_PAYLOAD
-         * is made up of the IPC ID index which is 0 plus the size of the
-         * IPC ID. */
-        
-        for (i = 0u; i < u8_dataLen; i++)
+        /* payload of the valid copy */
+        *ppau8_payload = &au8_RxDmaBuffer[  k_RXBUFF_OFS(u8_rxBuffIdx, u8_dataLen) 
+                                          + IPCXSYS_IDX_PAYLOAD];
+        e_retVal = GLOB_RET_OK;
+
+        /* the IPC telegram is consumed, it is never read twice */
+        u8_RxState = k_RX_PENDING;
+
+        /* count the received IPC telegram (saturated), u8_ipcId is the checked ID */
+        if (   (u8_ipcId < IPCXSYS_IPC_ID_CNT) 
+            && (as_LinkStat[u8_ipcId].u32_rxCnt < (UINT32)UINT32_MAX) )
         {
-          /* write the data of the valid rx-buffer to the receive buffer */
-          pau8_buffer[i] = au8_RxBuffer[ u8_rxBuffIdx ][ IPCXSYS_IDX_PAYLOAD + i];
+          as_LinkStat[u8_ipcId].u32_rxCnt++;
+        }
+        else
+        {
+          /* empty branch, ID not counted or counter saturated */
         }
-        e_retVal = GLOB_RET_OK;
 
-         /*lint +e835*//* activate lint message 835. */
+        /* shortest time between the completion and the reception of an IPC telegram */
+        u16_margin = Saturate16(timerHAL_GetSystemTime3() - u32_RxCompleteTime);
+        if (u16_margin < s_WaitStat.u16_rxMarginMin)
+        {
+          s_WaitStat.u16_rxMarginMin = u16_margin;
+        }
+        else
+        {
+          /* empty branch */
+        }
       }
    }
 
    return e_retVal;
 } 
 
+
+/***************************************************************************************************
+  Function:
+    FrameFind
+
+  Description:
+    This function searches the record with the given ID in the received IPC frame.
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC message.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+
+  Return value:
+    UINT8             - Index of the record in the IPC frame receive buffer, u8_FrameRxLen if 
+                        there is no record with the ID
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+STATIC UINT8 FrameFind( CONST UINT8 u8_ipcId )
+{
+   UINT8 u8_idx = 0u;
+
+   /* walk through the records, they fill the frame exactly (see ipcxSYS_FrameRecvinclWait()) */
+   while (    ( u8_idx < u8_FrameRxLen )
+           && ( au8_FrameRxBuffer[u8_idx + IPCXSYS_IDX_REC_ID] != u8_ipcId ) )
+   {
+      u8_idx = (UINT8)( u8_idx
+                        + IPCXSYS_SIZEOF_REC_VAR(au8_FrameRxBuffer[u8_idx + IPCXSYS_IDX_REC_LEN]) );
+   }
+
+   return u8_idx;
+}
+
+/***************************************************************************************************
+  Function:
+    LinkStatWait
+
+  Description:
+    This function adds the time waited for an IPC telegram to the link statistic of its IPC ID: 
+    longest wait, mean wait and wait histogram. If a bucket of the histogram is saturated, all 
+    buckets are halved, so the distribution is kept. The sum and number of waits of the mean value
+    are halved after k_WAIT_MEAN_WINDOW waits.
+
+  See also:
+    IPCXSYS_WAIT_HIST_CNT
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram
+                        (valid range: any, IDs >= IPCXSYS_IPC_ID_CNT are not counted)
+    u32_waitTime (IN) - time waited for the IPC telegram in usec
+                        (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+STATIC void LinkStatWait( CONST UINT8 u8_ipcId, CONST UINT32 u32_waitTime )
+{
+   IPCXSYS_LINK_STAT_STRUCT* ps_stat;
+   UINT16                    u16_wait = Saturate16(u32_waitTime);
+
+   /* if ID is counted */
+   if (u8_ipcId < IPCXSYS_IPC_ID_CNT)
+   {
+     ps_stat = &as_LinkStat[u8_ipcId];
+
+     if (u16_wait > ps_stat->u16_waitMax)
+     {
+       ps_stat->u16_waitMax = u16_wait;
+     }
+     else
+     {
+       /* empty branch */
+     }
+
+     /* mean value over a sliding window */
+     if (au16_LinkWaitCnt[u8_ipcId] >= k_WAIT_MEAN_WINDOW)
+     {
+       au32_LinkWaitSum[u8_ipcId] >>= 1u;
+       au16_LinkWaitCnt[u8_ipcId] >>= 1u;
+     }
+     else
+     {
+       /* empty branch */
+     }
+     au32_LinkWaitSum[u8_ipcId] += u16_wait;
+     au16_LinkWaitCnt[u8_ipcId]++;
+
+     histSYS_Add(ps_stat->au16_waitHist, (UINT8)IPCXSYS_WAIT_HIST_CNT,
+                 histSYS_WaitBucket((UINT32)u16_wait, IPCXSYS_WAIT_HIST_US));
+   }
+   /* else: ID not counted */
+   else
+   {
+     /* empty branch */
+   }
+}
+
+/***************************************************************************************************
+  Function:
+    Saturate16
+
+  Description:
+    This function limits a time to the range of UINT16.
+
+  See also:
+    -
+
+  Parameters:
+    u32_value (IN)    - time in usec
+                        (valid range: any, not checked)
+
+  Return value:
+    UINT16            - time in usec, UINT16_MAX if longer
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+STATIC UINT16 Saturate16( CONST UINT32 u32_value )
+{
+   return (u32_value > (UINT32)UINT16_MAX) ? (UINT16)UINT16_MAX : (UINT16)u32_value;
+}
@@ -18,9 +18,24 @@
 **  Functions: ipcxSYS_Init
 **             ipcxSYS_SendUINT32
 **             ipcxSYS_SendBuffer
+**             ipcxSYS_TxReserve
+**             ipcxSYS_TxCommit
 **             ipcxSYS_GetBufferinclWait
+**             ipcxSYS_RxViewinclWait
 **             ipcxSYS_GetUINT32inclWait
 **             ipcxSYS_ExChangeUINT32Data
+**             ipcxSYS_FrameAddBuffer
+**             ipcxSYS_FrameAddUINT32
+**             ipcxSYS_FrameSend
+**             ipcxSYS_FrameRecvinclWait
+**             ipcxSYS_FrameGetBuffer
+**             ipcxSYS_FrameGetUINT32
+**             ipcxSYS_WaitStatCycle
+**             ipcxSYS_WaitStatGet
+**             ipcxSYS_WaitStatReset
+**             ipcxSYS_LinkStatGet
+**             ipcxSYS_LinkStatReset
+**             ipcxSYS_RxComplete
 **
 **    History:
 **
@@ -35,11 +50,48 @@
 **    constants and macros
 ***************************************************************************************************/
 
+/* Wait time histogram of the link statistic (see IPCXSYS_LINK_STAT_STRUCT): bucket 0 counts the 
+** IPC telegrams received without waiting, the other buckets are IPCXSYS_WAIT_HIST_US wide, the 
+** last one also counts longer waits. */
+#define IPCXSYS_WAIT_HIST_CNT        8u
+#define IPCXSYS_WAIT_HIST_US         8u
 
 /***************************************************************************************************
 **    data types
 ***************************************************************************************************/
 
+/* IPCXSYS_WAIT_STAT_STRUCT:
+** Statistic of the time waited for the other controller per scheduler cycle (see
+** ipcxSYS_WaitStatCycle()), all times in usec
+*/
+typedef struct
+{
+   UINT32 u32_cycleCnt;         /* number of scheduler cycles */
+   UINT32 u32_rxWaitCycleCnt;   /* number of scheduler cycles with waiting for IPC telegrams */
+   UINT16 u16_rxLast;           /* wait for IPC telegrams in the last cycle */
+   UINT16 u16_rxMax;            /* longest wait for IPC telegrams in a cycle */
+   UINT16 u16_syncLast;         /* wait in ipcsSYS_Sync() in the last cycle */
+   UINT16 u16_syncMax;          /* longest wait in ipcsSYS_Sync() in a cycle */
+   UINT16 u16_totalMean;        /* mean wait (IPC telegrams and sync) per cycle */
+   UINT16 u16_totalMax;         /* longest wait (IPC telegrams and sync) in a cycle */
+   UINT16 u16_rxMarginMin;      /* shortest time between the completion and the reception of an 
+                                ** IPC telegram (UINT16_MAX: no sample yet) */
+} IPCXSYS_WAIT_STAT_STRUCT;
+
+/* IPCXSYS_LINK_STAT_STRUCT:
+** Statistic of the IPC telegrams of one IPC ID (see ipcxSYS_LinkStatGet()), all times in usec
+*/
+typedef struct
+{
+   UINT32 u32_rxCnt;            /* number of received IPC telegrams */
+   UINT16 u16_crcFailCnt;       /* number of IPC telegrams with a CRC failure of the first copy */
+   UINT16 u16_recoverCnt;       /* number of IPC telegrams taken from the second copy */
+   UINT16 u16_waitMax;          /* longest wait for an IPC telegram */
+   UINT16 u16_waitMean;         /* mean wait for an IPC telegram */
+   UINT16 au16_waitHist[IPCXSYS_WAIT_HIST_CNT];  /* wait histogram, all buckets are halved if 
+                                                 ** one saturates */
+} IPCXSYS_LINK_STAT_STRUCT;
+
 /***************************************************************************************************
 **    global variables
 ***************************************************************************************************/
@@ -56,12 +108,9 @@
 
   Description:
     This function initializes the IPC interface.
-    The communication goes over the USART. This function initializes the specific port pins 
-    PA9 and PA10 of the USART.
-    
-    Furthermore:
-     - it initializes the DMA buffer addresses
-     - initialize the UART interface for DMA.
+    The communication goes over the transport (see ipct_Transport-sys.h), on the target the 
+    USART1 with DMA. The transport is initialized with the DMA buffers and the reception is 
+    started.
 
   See also:
     -
@@ -139,6 +188,63 @@ void ipcxSYS_SendUINT32( CONST UINT8  u8_ipcId, CONST UINT32 u32_data );
 ***************************************************************************************************/
 void ipcxSYS_SendBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, CONST UINT8* pau8_buffer);
 
+/***************************************************************************************************
+  Function:
+    ipcxSYS_TxReserve
+
+  Description:
+    This function reserves an IPC telegram in the Tx DMA buffer and writes its ID. The caller
+    writes the payload directly into the returned buffer and sends the telegram with 
+    ipcxSYS_TxCommit(), no other IPC telegram shall be sent in between.
+
+  See also:
+    ipcxSYS_TxCommit()
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram. Since the highest bit of the transferred ID byte
+                        is used to distinguish between controller1 and controller2, this bit 
+                        shall not be used for an IPC ID (message ID). This must be ensured by the 
+                        calling function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)          
+    u8_dataLen (IN)   - Length of payload to send
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, checked)
+
+  Return value:
+    UINT8*            - Payload of the IPC telegram in the Tx DMA buffer (u8_dataLen bytes)
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+UINT8* ipcxSYS_TxReserve( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_TxCommit
+
+  Description:
+    This function sends the IPC telegram reserved by ipcxSYS_TxReserve() to the other controller.
+    The Rx DMA is prepared for the IPC telegram of the other controller (same length) and both 
+    controllers are synchronized before the transfer. The telegrams received before are no
+    longer available afterwards.
+
+  See also:
+    ipcxSYS_TxReserve()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void ipcxSYS_TxCommit( void );
+
 /***************************************************************************************************
   Function:
     ipcxSYS_GetBufferinclWait
@@ -171,6 +277,38 @@ void ipcxSYS_SendBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, CONST UI
 ***************************************************************************************************/
 void ipcxSYS_GetBufferinclWait ( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, UINT8* pau8_buffer);
 
+/***************************************************************************************************
+  Function:
+    ipcxSYS_RxViewinclWait
+
+  Description:
+    This function gets an IPC telegram which should already have arrived (see 
+    ipcxSYS_GetBufferinclWait()) and returns its payload in the Rx DMA buffer without copying it.
+    The IPC telegram is read once, a further read waits for the next IPC telegram.
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram. Since the first bit of ID byte is used
+                        to distinguish between controller1 and controller2, this bit shall not 
+                        be used for IPC ID (message ID). This must be ensured by the calling
+                        function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u8_dataLen (IN)   - Length of payload to received
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_PAYLOAD, checked)
+
+  Return value:
+    CONST UINT8*      - Payload of the valid copy of the IPC telegram (u8_dataLen bytes), valid 
+                        up to the next IPC telegram sent
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main (during initialization)
+
+***************************************************************************************************/
+CONST UINT8* ipcxSYS_RxViewinclWait( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen );
+
 /***************************************************************************************************
   Function:
     ipcxSYS_GetUINT32inclWait
@@ -232,5 +370,307 @@ UINT32 ipcxSYS_GetUINT32inclWait ( CONST UINT8 u8_ipcId );
 ***************************************************************************************************/
 UINT32 ipcxSYS_ExChangeUINT32Data (CONST UINT32 u32_ipcSendVal, CONST UINT8 u8_ipcId);
 
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameAddBuffer
+
+  Description:
+    This function adds a record (ID, length and payload) to the IPC frame which is sent by the 
+    next call of ipcxSYS_FrameSend(). Several IPC messages are so exchanged in one IPC telegram 
+    (one CRC, sent twice) and in one pair of time slices.
+    Both controllers shall add the same records in the same order.
+
+  See also:
+    ipcxSYS_FrameSend(), ipcxSYS_FrameGetBuffer()
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC message. Since the highest bit of the transferred ID byte
+                        is used to distinguish between controller1 and controller2, this bit 
+                        shall not be used for an IPC ID (message ID). This must be ensured by the 
+                        calling function.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)          
+    u8_dataLen (IN)   - Length of payload to send
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_FRAME minus the records already 
+                        added, checked)
+    pau8_buffer (IN)  - Payload to transmit over IPC
+                        (valid range: <>NULL, not checked because only called by reference)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameAddBuffer( CONST UINT8  u8_ipcId, CONST UINT8 u8_dataLen, 
+                             CONST UINT8* pau8_buffer );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameAddUINT32
+
+  Description:
+    This function adds an UINT32 data record to the IPC frame.
+
+  See also:
+    ipcxSYS_FrameAddBuffer()
+
+  Parameters:
+    u8_ipcId (IN)  - ID of the IPC message.
+                     (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u32_data (IN)  - value to send
+                     (valid range: any, not checked)    
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameAddUINT32( CONST UINT8  u8_ipcId, CONST UINT32 u32_data );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameSend
+
+  Description:
+    This function sends the records added since the last call as one IPC telegram (ID 
+    IPCXSYS_IPC_ID_FRAME) to the other controller. The records received before are no longer
+    available afterwards.
+
+  See also:
+    ipcxSYS_FrameRecvinclWait()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameSend( void );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameRecvinclWait
+
+  Description:
+    This function receives the IPC frame of the other controller which should already have 
+    arrived (see ipcxSYS_GetBufferinclWait()). The frame has the length of the frame sent last 
+    and its records must fill it exactly, else the Safety Handler is called.
+    The records are available via ipcxSYS_FrameGetBuffer() up to the next ipcxSYS_FrameSend().
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_FrameRecvinclWait( void );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameGetBuffer
+
+  Description:
+    This function returns the payload of a record of the received IPC frame. If the frame 
+    contains no record with the ID or the record has another length, the Safety Handler is 
+    called.
+
+  See also:
+    ipcxSYS_FrameRecvinclWait()
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC message.
+                        (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+    u8_dataLen (IN)   - Length of payload to receive
+                        (valid range: 0..IPCXSYS_SIZEOF_MAX_FRAME, checked)
+
+  Return value:
+    CONST UINT8*      - Payload of the record, valid up to the next ipcxSYS_FrameSend()
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+CONST UINT8* ipcxSYS_FrameGetBuffer( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_FrameGetUINT32
+
+  Description:
+    This function returns the UINT32 data of a record of the received IPC frame.
+
+  See also:
+    ipcxSYS_FrameGetBuffer()
+
+  Parameters:
+    u8_ipcId (IN)  - ID of the IPC message.
+                     (valid range: 0..IPCXSYS_IPC_ID_MASK, not checked)
+
+  Return value:
+    UINT32         - Received IPC value
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+UINT32 ipcxSYS_FrameGetUINT32( CONST UINT8 u8_ipcId );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatCycle
+
+  Description:
+    This function adds the time waited for IPC telegrams and in ipcsSYS_Sync() during the last
+    scheduler cycle to the wait time statistic. It is called once per scheduler cycle.
+
+  See also:
+    ipcsSYS_GetWaitTime()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatCycle( void );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatGet
+
+  Description:
+    This function returns the wait time statistic.
+
+  See also:
+    -
+
+  Parameters:
+    ps_stat (OUT)     - wait time statistic
+                        (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatGet( IPCXSYS_WAIT_STAT_STRUCT* ps_stat );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_WaitStatReset
+
+  Description:
+    This function clears the wait time statistic.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_WaitStatReset( void );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_LinkStatGet
+
+  Description:
+    This function returns the link statistic of an IPC ID: received IPC telegrams, CRC failures 
+    of the first copy, IPC telegrams recovered from the second copy and the time waited for the 
+    IPC telegrams by ipcxSYS_RxViewinclWait() and ipcxSYS_ExChangeUINT32Data().
+
+  See also:
+    -
+
+  Parameters:
+    u8_ipcId (IN)     - ID of the IPC telegram
+                        (valid range: 0..IPCXSYS_IPC_ID_CNT-1, not checked, checked by caller)
+    ps_stat (OUT)     - link statistic
+                        (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_LinkStatGet( CONST UINT8 u8_ipcId, IPCXSYS_LINK_STAT_STRUCT* ps_stat );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_LinkStatReset
+
+  Description:
+    This function clears the link statistic of all IPC IDs.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void ipcxSYS_LinkStatReset( void );
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_RxComplete
+
+  Description:
+    This function is called by the transport when the IPC telegram is completely received in the
+    Rx DMA buffer. It sets the completion flag and stores the time of the reception.
+
+  See also:
+    ipcxSYS_RxViewinclWait(), ipctSYS_RxStart()
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: DMA1 Channel 5 IRQ (ipct_TransportUsart-sys.c)
+    Context: receive thread of the host transport (ipct_TransportHost-sys.c)
+
+***************************************************************************************************/
+void ipcxSYS_RxComplete( void );
+
 #endif
 
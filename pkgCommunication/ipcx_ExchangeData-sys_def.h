@@ -57,6 +57,21 @@
 /* Macro is used to calculate the size of the complete IPC telegram (header + payload + crc) */
 #define IPCXSYS_SIZEOF_TGM_VAR(x)   ( (UINT32)IPCXSYS_SIZEOF_ID + (x) + IPCXSYS_SIZEOF_CRC )
 
+/*! Various constants for the records of an IPC frame (see ipcxSYS_FrameSend()). The payload of
+ * the frame telegram is a list of records, each record consists of ID, length and payload. */
+/*!< Size of the record header, ID and payload length. */
+#define IPCXSYS_SIZEOF_REC_HEADER   ( ( UINT8 ) 2u )
+/*!< Max. size of the records of an IPC frame, the frame is sent as one IPC telegram. */
+#define IPCXSYS_SIZEOF_MAX_FRAME    IPCXSYS_SIZEOF_MAX_PAYLOAD
+
+/* Macro is used to calculate the size of a record of an IPC frame (record header + payload) */
+#define IPCXSYS_SIZEOF_REC_VAR(x)   ( (UINT32)IPCXSYS_SIZEOF_REC_HEADER + (x) )
+
+/*! These constants defines the index of ID, length and payload in a record of an IPC frame. */
+#define IPCXSYS_IDX_REC_ID          ((UINT8) 0u)
+#define IPCXSYS_IDX_REC_LEN         ((UINT8) 1u)
+#define IPCXSYS_IDX_REC_PAYLOAD     ((UINT8) 2u)
+
 /*! These constants defines the index of the ID and the payload in the IPC telegram. */
 #define IPCXSYS_IDX_ID              ((UINT8) 0u)                           /*!< Index of the ID. */
 #define IPCXSYS_IDX_PAYLOAD         ( IPCXSYS_IDX_ID   \
@@ -84,6 +99,14 @@
 #define IPCXSYS_IPC_ID_NV_CRC        ( ( UINT8 ) 0x0Au )  /* see [SRS_2189] */
 #define IPCXSYS_IPC_ID_FAILCODE_NUM  ( ( UINT8 ) 0x0Bu )  /* see [SRS_2230] */
 #define IPCXSYS_IPC_ID_FAILCODE_VAL  ( ( UINT8 ) 0x0Cu )  /* see [SRS_2230] */
+#ifdef RFID_ACTIVE
+#define IPCXSYS_IPC_ID_RFID_DIGEST   ( ( UINT8 ) 0x0Du )
+#endif /* RFID_ACTIVE */
+#define IPCXSYS_IPC_ID_FRAME         ( ( UINT8 ) 0x0Eu )  /* IPC frame, see ipcxSYS_FrameSend() */
+
+/*! Number of IPC IDs (highest IPC ID + 1) the link statistic is kept for, see 
+ * ipcxSYS_LinkStatGet(). Shall be adapted if an IPC ID is added. */
+#define IPCXSYS_IPC_ID_CNT           ( ( UINT8 ) 0x0Fu )
 
 /*! Timeout for the IPC communication */
 #define IPCXSYS_TIMEOUT              ( ( UINT32 ) 100u ) /*!< Timeout for the IPC in usec. */
@@ -87,6 +87,26 @@
 /*! This constant defines the system clock. */
 #define GLOBDEF_SYSTEM_CLOCK        72000000UL
 
+/*! This constant defines the cycle time of the IRQ scheduler (T-cyc) in microseconds. The
+ *  cycle time defines the number and the length of the time slices (SCHAPP_TIME_SLICE_CNT,
+ *  2ms: 20 x 100us, 4ms: 40 x 100us, 8ms: 40 x 200us) and selects the task tables of the
+ *  scheduler (RFID_ACTIVE not at 2ms). It can be set by the compiler options, default is 4ms. */
+#ifndef GLOBDEF_CYCLE_TIME_US
+  #define GLOBDEF_CYCLE_TIME_US     4000u
+#endif
+
+#if (GLOBDEF_CYCLE_TIME_US != 2000u) && (GLOBDEF_CYCLE_TIME_US != 4000u) && \
+    (GLOBDEF_CYCLE_TIME_US != 8000u)
+  #error "Invalid GLOBDEF_CYCLE_TIME_US, supported: 2000u, 4000u, 8000u"
+#endif
+
+/*! Cycle time of the IRQ scheduler in milliseconds. */
+#define GLOBDEF_CYCLE_TIME_MS       (GLOBDEF_CYCLE_TIME_US / 1000u)
+
+/*! Tolerance of the cycle time (+/-10%), see [SRS_2234]. */
+#define GLOBDEF_CYCLE_TIME_MIN_US   ((GLOBDEF_CYCLE_TIME_US * 9u) / 10u)
+#define GLOBDEF_CYCLE_TIME_MAX_US   ((GLOBDEF_CYCLE_TIME_US * 11u) / 10u)
+
 
 /*******************************************************************************
 **
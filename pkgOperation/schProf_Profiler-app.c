@@ -0,0 +1,416 @@
+/***************************************************************************************************
+**    Copyright (C) 2016-2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: schProf_Profiler-app.c
+**     Summary: This module measures the execution time of the time slices and tasks of the
+**              scheduler with the DWT cycle counter of the Cortex-M3. The statistic is read via
+**              the Diagnostic Object. The module is only compiled if SCH_PROFILER_ACTIVE is set.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: schProf_Init
+**             schProf_Reset
+**             schProf_SliceEnd
+**             schProf_TaskEnd
+**             schProf_SliceGet
+**             schProf_TaskMaxGet
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifdef SCH_PROFILER_ACTIVE
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+
+/* time slices of the scheduler (SCHAPP_TIME_SLICE_CNT) */
+#include "sch_Scheduler-app.h"
+
+/* Header-file of module */
+#include "schProf_Profiler-app.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Unique file id used to build additional info */
+#define k_FILEID      43u
+
+/* DWT control register and cycle counter enable bit */
+#define k_DWT_CTRL            (*(volatile UINT32 *)0xE0001000uL)
+#define k_DWT_CTRL_CYCCNTENA  0x00000001uL
+
+/* CPU clock cycles per histogram bucket */
+#define k_HIST_BUCKET_CYCLES  (SCHPROF_SLICE_CYCLES / SCHPROF_HIST_BUCKET_CNT)
+
+/* Number of samples after which sum and number of samples of the mean value are halved, the
+** mean value follows changes of the execution time and the sum can not overflow */
+#define k_MEAN_WINDOW         0x8000u
+
+/** PRE-PROCESSOR CHECK **/
+/* The slice time must be divisible into the histogram buckets */
+/*lint -e(948) */
+IXX_TASSERT(((SCHPROF_SLICE_CYCLES % SCHPROF_HIST_BUCKET_CNT) == 0u), schProf_chk1)
+/*lint -esym(751, IXX_DUMMY_schProf_chk1) not referenced - just for checks */
+
+/* t_SLICE_STAT:
+** Internal statistic of one time slice
+*/
+typedef struct
+{
+  UINT32 u32_sum;                                 /* sum of the execution times */
+  UINT16 u16_cnt;                                 /* number of samples of u32_sum */
+  UINT16 u16_min;                                 /* shortest execution time */
+  UINT16 u16_max;                                 /* longest execution time */
+  UINT16 au16_hist[SCHPROF_HIST_BUCKET_CNT];      /* histogram */
+} t_SLICE_STAT;
+
+/* as_SliceStat:
+** Statistic of all time slices
+*/
+STATIC t_SLICE_STAT as_SliceStat[SCHPROF_SLICE_CNT];
+
+/* au16_TaskMax:
+** Longest execution time of all tasks of both task tables
+*/
+STATIC UINT16 au16_TaskMax[SCHPROF_MODE_CNT][SCHPROF_TASK_CNT];
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    schProf_Init
+
+  Description:
+    This function enables the DWT cycle counter and clears the statistic.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void schProf_Init (void)
+{
+  /* enable trace unit and cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  SCHPROF_CYCCNT = 0u;
+  k_DWT_CTRL |= k_DWT_CTRL_CYCCNTENA;
+
+  schProf_Reset();
+}
+
+/***************************************************************************************************
+  Function:
+    schProf_Reset
+
+  Description:
+    This function clears the statistic of all time slices and tasks.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schProf_Reset (void)
+{
+  UINT8 u8_slice;
+  UINT8 u8_idx;
+
+  for (u8_slice = 0u; u8_slice < SCHPROF_SLICE_CNT; u8_slice++)
+  {
+    as_SliceStat[u8_slice].u32_sum = 0u;
+    as_SliceStat[u8_slice].u16_cnt = 0u;
+    as_SliceStat[u8_slice].u16_min = (UINT16)UINT16_MAX;
+    as_SliceStat[u8_slice].u16_max = 0u;
+    for (u8_idx = 0u; u8_idx < SCHPROF_HIST_BUCKET_CNT; u8_idx++)
+    {
+      as_SliceStat[u8_slice].au16_hist[u8_idx] = 0u;
+    }
+  }
+
+  for (u8_idx = 0u; u8_idx < SCHPROF_TASK_CNT; u8_idx++)
+  {
+    au16_TaskMax[SCHPROF_MODE_STARTUP][u8_idx] = 0u;
+    au16_TaskMax[SCHPROF_MODE_RUN][u8_idx] = 0u;
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    schProf_SliceEnd
+
+  Description:
+    This function adds the execution time of a time slice to its statistic.
+
+  See also:
+    -
+
+  Parameters:
+    u8_slice (IN)   - time slice
+                      (valid range: 0..SCHPROF_SLICE_CNT-1, checked)
+    u32_cycles (IN) - execution time of the time slice in CPU clock cycles
+                      (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void schProf_SliceEnd (UINT8 u8_slice, UINT32 u32_cycles)
+{
+  t_SLICE_STAT *ps_stat;
+  UINT16 u16_cycles;
+  UINT32 u32_bucket;
+
+  /* if time slice valid (a corrupted block index is handled by the scheduler) */
+  if (u8_slice < SCHPROF_SLICE_CNT)
+  {
+    ps_stat = &as_SliceStat[u8_slice];
+    u16_cycles = (u32_cycles > (UINT32)UINT16_MAX) ? (UINT16)UINT16_MAX : (UINT16)u32_cycles;
+
+    if (u16_cycles < ps_stat->u16_min)
+    {
+      ps_stat->u16_min = u16_cycles;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    if (u16_cycles > ps_stat->u16_max)
+    {
+      ps_stat->u16_max = u16_cycles;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* mean value over a sliding window */
+    if (ps_stat->u16_cnt >= k_MEAN_WINDOW)
+    {
+      ps_stat->u32_sum >>= 1u;
+      ps_stat->u16_cnt >>= 1u;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    ps_stat->u32_sum += u16_cycles;
+    ps_stat->u16_cnt++;
+
+    /* histogram, last bucket includes the overruns */
+    u32_bucket = (UINT32)u16_cycles / k_HIST_BUCKET_CYCLES;
+    if (u32_bucket >= SCHPROF_HIST_BUCKET_CNT)
+    {
+      u32_bucket = SCHPROF_HIST_BUCKET_CNT - 1u;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    if (ps_stat->au16_hist[u32_bucket] < (UINT16)UINT16_MAX)
+    {
+      ps_stat->au16_hist[u32_bucket]++;
+    }
+    else
+    {
+      /* empty branch, counter saturated */
+    }
+  }
+  /* else: invalid time slice, ignored */
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    schProf_TaskEnd
+
+  Description:
+    This function updates the longest execution time of a task.
+
+  See also:
+    -
+
+  Parameters:
+    u8_mode (IN)    - task table, SCHPROF_MODE_xxx
+                      (valid range: 0..SCHPROF_MODE_CNT-1, checked)
+    u8_task (IN)    - index of the task in the task table
+                      (valid range: 0..SCHPROF_TASK_CNT-1, checked)
+    u32_cycles (IN) - execution time of the task in CPU clock cycles
+                      (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void schProf_TaskEnd (UINT8 u8_mode, UINT8 u8_task, UINT32 u32_cycles)
+{
+  UINT16 u16_cycles;
+
+  if ((u8_mode < SCHPROF_MODE_CNT) && (u8_task < SCHPROF_TASK_CNT))
+  {
+    u16_cycles = (u32_cycles > (UINT32)UINT16_MAX) ? (UINT16)UINT16_MAX : (UINT16)u32_cycles;
+    if (u16_cycles > au16_TaskMax[u8_mode][u8_task])
+    {
+      au16_TaskMax[u8_mode][u8_task] = u16_cycles;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  /* else: invalid task, ignored */
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    schProf_SliceGet
+
+  Description:
+    This function returns the statistic of a time slice.
+
+  See also:
+    -
+
+  Parameters:
+    u8_slice (IN)  - time slice
+                     (valid range: 0..SCHPROF_SLICE_CNT-1, not checked, checked by caller)
+    ps_slice (OUT) - statistic of the time slice
+                     (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schProf_SliceGet (UINT8 u8_slice, t_SCHPROF_SLICE *ps_slice)
+{
+  CONST t_SLICE_STAT *ps_stat = &as_SliceStat[u8_slice];
+  UINT8 u8_idx;
+
+  /* no sample yet: report 0 instead of the init value of the minimum */
+  if (ps_stat->u16_cnt == 0u)
+  {
+    ps_slice->u16_min  = 0u;
+    ps_slice->u16_mean = 0u;
+  }
+  else
+  {
+    ps_slice->u16_min  = ps_stat->u16_min;
+    ps_slice->u16_mean = (UINT16)(ps_stat->u32_sum / ps_stat->u16_cnt);
+  }
+  ps_slice->u16_max = ps_stat->u16_max;
+
+  for (u8_idx = 0u; u8_idx < SCHPROF_HIST_BUCKET_CNT; u8_idx++)
+  {
+    ps_slice->au16_hist[u8_idx] = ps_stat->au16_hist[u8_idx];
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    schProf_TaskMaxGet
+
+  Description:
+    This function copies the longest execution times of the tasks of a task table, starting with
+    the given task index.
+
+  See also:
+    -
+
+  Parameters:
+    u8_mode (IN)      - task table, SCHPROF_MODE_xxx
+                        (valid range: 0..SCHPROF_MODE_CNT-1, not checked, checked by caller)
+    u8_first (IN)     - index of the first task
+                        (valid range: any, checked)
+    pau16_max (OUT)   - buffer for the execution times in CPU clock cycles (saturated)
+                        (valid range: <>NULL, not checked)
+    u8_maxCnt (IN)    - size of the buffer
+                        (valid range: any, not checked)
+
+  Return value:
+    Number of copied execution times
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+UINT8 schProf_TaskMaxGet (UINT8 u8_mode, UINT8 u8_first, UINT16 *pau16_max, UINT8 u8_maxCnt)
+{
+  UINT8 u8_cnt = 0u;
+
+  while ((u8_cnt < u8_maxCnt) && (((UINT16)u8_first + u8_cnt) < SCHPROF_TASK_CNT))
+  {
+    /*lint -esym(960, 17.4)*/
+    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+     * other than array indexing used
+     * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
+    pau16_max[u8_cnt] = au16_TaskMax[u8_mode][u8_first + u8_cnt];
+    /*lint +esym(960, 17.4)*/
+    u8_cnt++;
+  }
+
+  return u8_cnt;
+}
+
+#endif /* SCH_PROFILER_ACTIVE */
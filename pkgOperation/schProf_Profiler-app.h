@@ -0,0 +1,241 @@
+/***************************************************************************************************
+**    Copyright (C) 2016-2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: schProf_Profiler-app.h
+**     Summary: Header of module schProf_Profiler-app.c
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: schProf_Init
+**             schProf_Reset
+**             schProf_SliceEnd
+**             schProf_TaskEnd
+**             schProf_SliceGet
+**             schProf_TaskMaxGet
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef SCHPROF_H
+#define SCHPROF_H
+
+/* The profiler is only compiled if SCH_PROFILER_ACTIVE is set by the compiler options */
+#ifdef SCH_PROFILER_ACTIVE
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Max. number of time slices supervised by the profiler (see SCHEDULER_BLOCK_COUNT), the
+** statistic of the time slices which do not exist at the configured cycle time stays empty */
+#define SCHPROF_SLICE_CNT           40u
+
+/* Max. number of tasks per task table of the scheduler */
+#define SCHPROF_TASK_CNT            48u
+
+/* Task tables of the scheduler */
+#define SCHPROF_MODE_STARTUP        0u
+#define SCHPROF_MODE_RUN            1u
+#define SCHPROF_MODE_CNT            2u
+
+/* Number of histogram buckets per time slice. The time of a time slice is divided into equal
+** buckets, the last bucket also counts the time slices which exceeded their time. */
+#define SCHPROF_HIST_BUCKET_CNT     8u
+
+/* CPU clock cycles per time slice (72MHz, GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_CNT, 7200 at
+** 100us) */
+#define SCHPROF_SLICE_CYCLES        ((GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_CNT) * 72u)
+
+/* SCHPROF_CYCCNT:
+** Cycle counter of the Data Watchpoint and Trace unit (DWT_CYCCNT), read directly by the
+** scheduler to keep the measurement overhead low.
+*/
+#define SCHPROF_CYCCNT              (*(volatile UINT32 *)0xE0001004uL)
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/* t_SCHPROF_SLICE:
+** Execution time statistic of one time slice, all values in CPU clock cycles
+*/
+typedef struct
+{
+  UINT16 u16_min;                                 /* shortest execution time */
+  UINT16 u16_max;                                 /* longest execution time */
+  UINT16 u16_mean;                                /* mean execution time */
+  UINT16 au16_hist[SCHPROF_HIST_BUCKET_CNT];      /* histogram (saturated counters) */
+} t_SCHPROF_SLICE;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    schProf_Init
+
+  Description:
+    This function enables the DWT cycle counter and clears the statistic.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main (during initialization)
+
+***************************************************************************************************/
+void schProf_Init (void);
+
+/***************************************************************************************************
+  Function:
+    schProf_Reset
+
+  Description:
+    This function clears the statistic of all time slices and tasks.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schProf_Reset (void);
+
+/***************************************************************************************************
+  Function:
+    schProf_SliceEnd
+
+  Description:
+    This function adds the execution time of a time slice to its statistic.
+
+  See also:
+    -
+
+  Parameters:
+    u8_slice (IN)   - time slice
+                      (valid range: 0..SCHPROF_SLICE_CNT-1, checked)
+    u32_cycles (IN) - execution time of the time slice in CPU clock cycles
+                      (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void schProf_SliceEnd (UINT8 u8_slice, UINT32 u32_cycles);
+
+/***************************************************************************************************
+  Function:
+    schProf_TaskEnd
+
+  Description:
+    This function updates the longest execution time of a task.
+
+  See also:
+    -
+
+  Parameters:
+    u8_mode (IN)    - task table, SCHPROF_MODE_xxx
+                      (valid range: 0..SCHPROF_MODE_CNT-1, checked)
+    u8_task (IN)    - index of the task in the task table
+                      (valid range: 0..SCHPROF_TASK_CNT-1, checked)
+    u32_cycles (IN) - execution time of the task in CPU clock cycles
+                      (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+void schProf_TaskEnd (UINT8 u8_mode, UINT8 u8_task, UINT32 u32_cycles);
+
+/***************************************************************************************************
+  Function:
+    schProf_SliceGet
+
+  Description:
+    This function returns the statistic of a time slice.
+
+  See also:
+    -
+
+  Parameters:
+    u8_slice (IN)  - time slice
+                     (valid range: 0..SCHPROF_SLICE_CNT-1, not checked, checked by caller)
+    ps_slice (OUT) - statistic of the time slice
+                     (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schProf_SliceGet (UINT8 u8_slice, t_SCHPROF_SLICE *ps_slice);
+
+/***************************************************************************************************
+  Function:
+    schProf_TaskMaxGet
+
+  Description:
+    This function copies the longest execution times of the tasks of a task table, starting with
+    the given task index.
+
+  See also:
+    -
+
+  Parameters:
+    u8_mode (IN)      - task table, SCHPROF_MODE_xxx
+                        (valid range: 0..SCHPROF_MODE_CNT-1, not checked, checked by caller)
+    u8_first (IN)     - index of the first task
+                        (valid range: any, checked)
+    pau16_max (OUT)   - buffer for the execution times in CPU clock cycles (saturated)
+                        (valid range: <>NULL, not checked)
+    u8_maxCnt (IN)    - size of the buffer
+                        (valid range: any, not checked)
+
+  Return value:
+    Number of copied execution times
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+UINT8 schProf_TaskMaxGet (UINT8 u8_mode, UINT8 u8_first, UINT16 *pau16_max, UINT8 u8_maxCnt);
+
+#endif /* SCH_PROFILER_ACTIVE */
+
+#endif /* SCHPROF_H */
@@ -18,12 +18,19 @@
 **             schAPP_StartScheduler
 **             schAPP_StopScheduler
 **             schAPP_TriggerCycleStatistic
+**             schAPP_OverrunGet
+**             schAPP_TimeSliceGet
 **             TIM1_UP_IRQHandler
 **
 **             CheckSchedulerTimeout
 **             CheckMainExecution
 **             timeSlicesStartup
 **             timeSlicesRunMode
+**             dispatchTasks
+**             CheckTaskBudgets
+**             TaskTimerValAndSelfTests
+**             TaskSelfTests
+**             TaskStartupSendAsmTgm
 **
 **    History:
 **
@@ -42,6 +49,9 @@
 #include "xdefs.h"
 #include "rds.h"
 
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+
 /* Header-file of module */
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
@@ -91,6 +101,10 @@
   #include "RFID.h"
 #endif /* RFID_ACTIVE */
 
+#ifdef SCH_PROFILER_ACTIVE
+  #include "schProf_Profiler-app.h"
+#endif /* SCH_PROFILER_ACTIVE */
+
 /***************************************************************************************************
 **    global variables
 ***************************************************************************************************/
@@ -103,8 +117,8 @@
 /* Unique file id used to build additional info */
 #define k_FILEID      15u
 
-/*! Number of task blocks. */
-#define SCHEDULER_BLOCK_COUNT       40u
+/*! Number of task blocks (time slices), derived from the cycle time. */
+#define SCHEDULER_BLOCK_COUNT       SCHAPP_TIME_SLICE_CNT
 
 /*! Index of first block to execute. */
 #define SCHEDULER_BLOCK_START_IDX   0u
@@ -116,8 +130,8 @@
 
 /*! This constant defines the timeout for the scheduler, the unit is in
  * microseconds, see [SRS_2234] */
-#define SCHEDULER_TIMEOUT_MAX_US  ((UINT32)4400u) /* microseconds */
-#define SCHEDULER_TIMEOUT_MIN_US  ((UINT32)3600u) /* microseconds */
+#define SCHEDULER_TIMEOUT_MAX_US  ((UINT32)GLOBDEF_CYCLE_TIME_MAX_US) /* microseconds */
+#define SCHEDULER_TIMEOUT_MIN_US  ((UINT32)GLOBDEF_CYCLE_TIME_MIN_US) /* microseconds */
 
 /*! This constant defines the timeout for the main execution check, the unit is in
  * microseconds. */
@@ -130,14 +144,167 @@ STATIC volatile UINT8 u8_BlockIdx = SCHEDULER_BLOCK_START_IDX;
 /*  This variable contains the time stamp of the last main trigger time */
 STATIC volatile RDS_UINT32 u32_RdsMainLoopTriggerTime;
 
+/*! Time of one time slice and the part of it which is available for the tasks of the task
+ * tables. The remaining time is used by the watchdog trigger, the IPC synchronization, the
+ * sampling of the DIs and the dispatcher itself. */
+#define SCHEDULER_SLICE_US          (GLOBDEF_CYCLE_TIME_US / SCHEDULER_BLOCK_COUNT) /* us */
+#define SCHEDULER_SLICE_OVERHEAD_US 15u  /* microseconds */
+#define SCHEDULER_SLICE_BUDGET_US   (SCHEDULER_SLICE_US - SCHEDULER_SLICE_OVERHEAD_US)
+
+/*! Number of timer 1 ticks per time slice (reload value + 1), one tick is 100/72 us */
+#define SCHEDULER_SLICE_TICKS       ((SCHEDULER_SLICE_US * 72u) / 100u)
+
+/*! Timeout of the window watchdog (see timerHAL_StartWwdg()), triggered in every time slice */
+#define SCHEDULER_WWDG_TIMEOUT_US   455u /* microseconds */
+
+/*! Converts a declared worst case execution time into timer 1 ticks (rounded up) */
+#define SCH_US(us)                  ((UINT8)((((us) * SCHEDULER_SLICE_TICKS) + \
+                                              (SCHEDULER_SLICE_US - 1u)) / SCHEDULER_SLICE_US))
+
+/*! Slice mask of a task: slices 0..31 are mapped to the low word, slices 32..39 to the high
+ * byte. The macros below expand to both initializers of a task table entry. */
+#define SCH_MASK_LO(n)              ((((UINT32)(n)) < 32u) ? ((UINT32)1u << ((n) & 31u)) : 0u)
+#define SCH_MASK_HI(n)              ((((UINT32)(n)) >= 32u) ? (UINT8)(1u << ((n) & 7u)) : 0u)
+
+#define SCH_SLICE(a)                SCH_MASK_LO(a), SCH_MASK_HI(a)
+#define SCH_SLICES2(a, b)           (SCH_MASK_LO(a) | SCH_MASK_LO(b)), \
+                                    (SCH_MASK_HI(a) | SCH_MASK_HI(b))
+#define SCH_SLICES3(a, b, c)        (SCH_MASK_LO(a) | SCH_MASK_LO(b) | SCH_MASK_LO(c)), \
+                                    (SCH_MASK_HI(a) | SCH_MASK_HI(b) | SCH_MASK_HI(c))
+/* Slices of the slice mask which exist at the configured cycle time (0..SCHEDULER_BLOCK_COUNT-1),
+** the periodic masks below are limited to them */
+#define SCH_VALID_LO                ((SCHEDULER_BLOCK_COUNT >= 32u) ? 0xFFFFFFFFu : \
+                                     (((UINT32)1u << (SCHEDULER_BLOCK_COUNT & 31u)) - 1u))
+#define SCH_VALID_HI                ((SCHEDULER_BLOCK_COUNT > 32u) ? \
+                                     (UINT8)(0xFFu >> ((40u - SCHEDULER_BLOCK_COUNT) & 7u)) : 0u)
+/* every 4th slice starting with slice ofs (0..3) */
+#define SCH_EVERY_4TH(ofs)          (((UINT32)0x11111111u << (ofs)) & SCH_VALID_LO), \
+                                    ((UINT8)((0x11u << (ofs)) & SCH_VALID_HI))
+/* every 5th slice starting with slice ofs (0..4) */
+#define SCH_EVERY_5TH(ofs)          ((SCH_MASK_LO(ofs) | SCH_MASK_LO((ofs) + 5u) | \
+                                      SCH_MASK_LO((ofs) + 10u) | SCH_MASK_LO((ofs) + 15u) | \
+                                      SCH_MASK_LO((ofs) + 20u) | SCH_MASK_LO((ofs) + 25u) | \
+                                      SCH_MASK_LO((ofs) + 30u) | SCH_MASK_LO((ofs) + 35u)) & \
+                                     SCH_VALID_LO), \
+                                    ((SCH_MASK_HI(ofs) | SCH_MASK_HI((ofs) + 5u) | \
+                                      SCH_MASK_HI((ofs) + 10u) | SCH_MASK_HI((ofs) + 15u) | \
+                                      SCH_MASK_HI((ofs) + 20u) | SCH_MASK_HI((ofs) + 25u) | \
+                                      SCH_MASK_HI((ofs) + 30u) | SCH_MASK_HI((ofs) + 35u)) & \
+                                     SCH_VALID_HI)
+
+/* t_SCH_TASK_FUNC:
+** Task called by the scheduler
+*/
+typedef void (*t_SCH_TASK_FUNC)(void);
+
+/* t_SCH_TASK:
+** Entry of a task table. A task is called in every time slice set in its slice mask. Tasks of
+** the same time slice are called in the order of the table.
+*/
+typedef struct
+{
+  t_SCH_TASK_FUNC pf_task;          /* task function */
+  UINT32          u32_sliceMaskLo;  /* time slices 0..31 */
+  UINT8           u8_sliceMaskHi;   /* time slices 32..39 */
+  UINT8           u8_budget;        /* declared worst case execution time [timer 1 ticks] */
+} t_SCH_TASK;
+
+/** PRE-PROCESSOR CHECK **/
+/* The slice mask covers max. 40 time slices, the cycle time is a whole number of time slices.
+** The budget of a time slice must fit into the timer 1 period to be measurable. The time slice
+** must be a whole number of timer 1 ticks, the timer 1 period and the budget in ticks must fit
+** into the UINT8 budget of the task table. The watchdog is triggered once per time slice.
+*/
+/*lint -e(948) */
+IXX_TASSERT((SCHEDULER_BLOCK_COUNT <= SCHAPP_TIME_SLICE_MAX), sch_chk1)
+/*lint -e(948) */
+IXX_TASSERT((SCHEDULER_SLICE_BUDGET_US < SCHEDULER_SLICE_US), sch_chk2)
+/*lint -e(948) */
+IXX_TASSERT((SCH_US(SCHEDULER_SLICE_BUDGET_US) < SCHEDULER_SLICE_TICKS), sch_chk3)
+/*lint -e(948) */
+IXX_TASSERT((((SCHEDULER_SLICE_US * 72u) % 100u) == 0u), sch_chk7)
+/*lint -e(948) */
+IXX_TASSERT((SCHEDULER_SLICE_TICKS <= 255u), sch_chk8)
+/*lint -e(948) */
+IXX_TASSERT((SCHEDULER_SLICE_US < SCHEDULER_WWDG_TIMEOUT_US), sch_chk9)
+
+/* Mute lint warning type not referenced. These types are just defined for    */
+/* being able to do some elementary checks. */
+/*lint -esym(751, IXX_DUMMY_sch_chk1, IXX_DUMMY_sch_chk2) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_sch_chk3, IXX_DUMMY_sch_chk7) not referenced - just for checks */
+/*lint -e(948) */
+IXX_TASSERT(((SCHEDULER_SLICE_US * SCHEDULER_BLOCK_COUNT) == GLOBDEF_CYCLE_TIME_US), sch_chk12)
+/*lint -esym(751, IXX_DUMMY_sch_chk8, IXX_DUMMY_sch_chk9) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_sch_chk12) not referenced - just for checks */
+
+/* Statistic of the budget monitoring, see schAPP_OverrunGet() */
+STATIC t_SCHAPP_OVERRUN s_Overrun;
+
 /***************************************************************************************************
 **    static function-prototypes
 ***************************************************************************************************/
 
 STATIC void timeSlicesStartup (void);
 STATIC void timeSlicesRunMode (void);
+STATIC void dispatchTasks (UINT8 u8_mode, CONST t_SCH_TASK *pas_tasks, UINT8 u8_taskCnt);
+STATIC void CheckTaskBudgets (CONST t_SCH_TASK *pas_tasks, UINT8 u8_taskCnt);
 STATIC void CheckSchedulerTimeout (void);
 STATIC void CheckMainExecution (void);
+STATIC void TaskTimerValAndSelfTests (void);
+STATIC void TaskSelfTests (void);
+STATIC void TaskStartupSendAsmTgm (void);
+
+/***************************************************************************************************
+**    task tables
+***************************************************************************************************/
+
+/* as_StartupTasks, as_RunModeTasks:
+** The task tables are generated by tools/sch_SliceGen.py from sch_Scheduler-app_tasks.cfg. The
+** tool assigns the tasks to the time slices with the lowest worst-case load of a time slice
+** considering the constraints of the tasks (fixed slices, IPC send/receive order). The header is
+** included here since it needs t_SCH_TASK and the prototypes of the local tasks.
+*/
+/* Note 961: Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments
+** before '#include' --> generated task tables, included only once */
+/*lint -e(961) */
+#include "sch_Scheduler-app_tbl.h"
+
+/** PRE-PROCESSOR CHECK **/
+/* The generated task tables of the configured cycle time must use its time slices and fit into the
+** budget of a time slice, otherwise the tables must be generated again (tools/sch_SliceGen.py).
+** The check of every single time slice is done by CheckTaskBudgets().
+*/
+/*lint -e(948) */
+IXX_TASSERT((SCH_TBL_STARTUP_MAX_LOAD_US <= SCHEDULER_SLICE_BUDGET_US), sch_chk10)
+/*lint -e(948) */
+IXX_TASSERT((SCH_TBL_RUN_MAX_LOAD_US <= SCHEDULER_SLICE_BUDGET_US), sch_chk11)
+/*lint -e(948) */
+IXX_TASSERT((SCH_TBL_SLICE_CNT == SCHEDULER_BLOCK_COUNT), sch_chk13)
+/*lint -esym(751, IXX_DUMMY_sch_chk10, IXX_DUMMY_sch_chk11) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_sch_chk13) not referenced - just for checks */
+
+/* Number of entries of the task tables */
+#define k_STARTUP_TASK_CNT    ((UINT8)(sizeof(as_StartupTasks) / sizeof(as_StartupTasks[0])))
+#define k_RUN_MODE_TASK_CNT   ((UINT8)(sizeof(as_RunModeTasks) / sizeof(as_RunModeTasks[0])))
+
+/* Task tables, used as index of the profiler statistic */
+#define k_MODE_STARTUP        0u
+#define k_MODE_RUN            1u
+
+#ifdef SCH_PROFILER_ACTIVE
+/** PRE-PROCESSOR CHECK **/
+/* The profiler must provide a statistic for every time slice and every task */
+/*lint -e(948) */
+IXX_TASSERT((SCHEDULER_BLOCK_COUNT <= SCHPROF_SLICE_CNT), sch_chk4)
+/*lint -e(948) */
+IXX_TASSERT(((k_STARTUP_TASK_CNT <= SCHPROF_TASK_CNT) && (k_RUN_MODE_TASK_CNT <= SCHPROF_TASK_CNT)),
+            sch_chk5)
+/*lint -e(948) */
+IXX_TASSERT(((k_MODE_STARTUP == SCHPROF_MODE_STARTUP) && (k_MODE_RUN == SCHPROF_MODE_RUN)),
+            sch_chk6)
+/*lint -esym(751, IXX_DUMMY_sch_chk4, IXX_DUMMY_sch_chk5) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_sch_chk6) not referenced - just for checks */
+#endif /* SCH_PROFILER_ACTIVE */
 
 /***************************************************************************************************
 **    global functions
@@ -206,20 +373,30 @@ void schAPP_Init (void)
   /* RSM_IGNORE_BEGIN Notice #50   - Variable assignment to a literal number 
   ** Accepted, Timer Configuration, already used in T100/PS */
   
-  /* init timer to get 100us time slices (40 of them fulfill the cycle time, see [SRS_2234]) */
+  /* init timer to get the time slices (SCHEDULER_BLOCK_COUNT of them fulfill the cycle time,
+  ** see [SRS_2234]) */
   s_timerConfig.eTimer             = TIMERDEF_TIMER1;
   s_timerConfig.pThis              = &s_timerConfig;
   /* prescaler will divide 72MHz Frequency by (value+1) => 72MHz/(99+1) = 720kHz  */
   s_timerConfig.u16Prescaler       = (UINT16)99u; 
   /* scheduler frequency: when prescaler=99, then 72 steps are necessary to get 100us steps 
-  ** (0...71 => 72 steps => reload value 71) */
-  s_timerConfig.u16AutoReloadValue = (UINT16)71u; 
+  ** (0...71 => 72 steps => reload value 71 for a 100us time slice) */
+  s_timerConfig.u16AutoReloadValue = (UINT16)(SCHEDULER_SLICE_TICKS - 1u); 
   s_timerConfig.u16CounterValue    = (UINT16)0u;
   s_timerConfig.u8IrqPriority      = (UINT8)2u;
   /* RSM_IGNORE_END */
 
   timerHAL_InitIrq(&s_timerConfig);
 
+#ifdef SCH_PROFILER_ACTIVE
+  /* enable the cycle counter used by the profiler */
+  schProf_Init();
+#endif
+
+  /* check the declared budgets of the task tables */
+  CheckTaskBudgets(as_StartupTasks, k_STARTUP_TASK_CNT);
+  CheckTaskBudgets(as_RunModeTasks, k_RUN_MODE_TASK_CNT);
+
   /* initialization of variable used for check of the main loop execution by using the
    * timeout trigger function */
   schAPP_TriggerMainExecTime();
@@ -330,6 +507,63 @@ void schAPP_TriggerCycleStatistic (void)
   }
 }
 
+/***************************************************************************************************
+  Function:
+    schAPP_OverrunGet
+
+  Description:
+    This function returns the statistic of the task budget monitoring: number of tasks which
+    exceeded their declared budget, number of time slices which exceeded their time and the time
+    slice/task table index of the last task budget overrun.
+
+  See also:
+    -
+
+  Parameters:
+    ps_overrun (OUT) - statistic of the budget monitoring
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schAPP_OverrunGet (t_SCHAPP_OVERRUN *ps_overrun)
+{
+  *ps_overrun = s_Overrun;
+}
+
+/***************************************************************************************************
+  Function:
+    schAPP_TimeSliceGet
+
+  Description:
+    This function returns the index of the time slice which is executed next by the scheduler.
+    Called from a task of the scheduler it is the index of the current time slice. Called from
+    main it is the index of the time slice following the current one.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    Index of the time slice (0..SCHAPP_TIME_SLICE_CNT-1)
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main, while(FOREVER)
+
+***************************************************************************************************/
+UINT8 schAPP_TimeSliceGet (void)
+{
+  /* variable is written by IRQ Scheduler but read access is considered as 'atomic' here */
+  return u8_BlockIdx;
+}
+
 /***************************************************************************************************
   Function:
     TIM1_UP_IRQHandler
@@ -354,6 +588,12 @@ void schAPP_TriggerCycleStatistic (void)
 ***************************************************************************************************/
 void TIM1_UP_IRQHandler (void)
 {
+#ifdef SCH_PROFILER_ACTIVE
+  /* entry of the time slice for the profiler */
+  UINT32 u32_profStart = SCHPROF_CYCCNT;
+  UINT8  u8_profSlice  = u8_BlockIdx;
+#endif
+
   /* FIT to test the watchdog, with this FIT the watchdog is not triggered */
   /* RSM_IGNORE_QUALITY_BEGIN Notice #9    - 'goto' keyword identified 
   ** only used for FIT test */
@@ -422,17 +662,42 @@ void TIM1_UP_IRQHandler (void)
   u8_BlockIdx++;
 
   /* reset block index if last time slice reached, the maximum time is defined by the cycle time
-   * of 4ms, see [SRS_2234]
+   * GLOBDEF_CYCLE_TIME_US, see [SRS_2234]
    * In case of a falsification (u8_BlockIdx > SCHEDULER_BLOCK_COUNT), the SafetyHandler is 
    * called during next cycle inside timeSlicesRunMode() respectively timeSlicesStartup() */
   if (SCHEDULER_BLOCK_COUNT == u8_BlockIdx)
   {
     u8_BlockIdx = SCHEDULER_BLOCK_START_IDX;
+
+    /* end of the scheduler cycle: time waited for the other controller */
+    ipcxSYS_WaitStatCycle();
   }
   else
   {
     /* empty branch, last time slice not reached yet */
   }
+
+  /* if the next update event already occurred, the time slice exceeded SCHEDULER_SLICE_US */
+  if (TIMERHAL_TIMER1_IRQ_PENDING)
+  {
+    if (s_Overrun.u16_sliceCnt < (UINT16)UINT16_MAX)
+    {
+      s_Overrun.u16_sliceCnt++;
+    }
+    else
+    {
+      /* empty branch, counter saturated */
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+#ifdef SCH_PROFILER_ACTIVE
+  /* exit of the time slice for the profiler */
+  schProf_SliceEnd(u8_profSlice, SCHPROF_CYCCNT - u32_profStart);
+#endif
 /* This function has a lot of paths because of all possible AIC states catched inside
 ** switch/case. But de facto the function is not really complex. */
 /* RSM_IGNORE_QUALITY_BEGIN Notice #28   - Cyclomatic complexity > 15 */
@@ -474,9 +739,11 @@ STATIC void CheckSchedulerTimeout (void)
   u32_currentTime = timerHAL_GetSystemTime3(); /* in us */
   /* FIT to test the timeout-check for the scheduler. With this FIT the
    * selftests are not executed and a timeout shall be detected after
-   * the time T-cyc:asm = (3600..4400)us. */
-  GLOBFIT_FITTEST( GLOBFIT_CMD_TCYC_HI, (u32_currentTime = u32_LastTime + 4401u));
-  GLOBFIT_FITTEST( GLOBFIT_CMD_TCYC_LO, (u32_currentTime = u32_LastTime + 3599));    
+   * the time T-cyc:asm = (GLOBDEF_CYCLE_TIME_MIN_US..GLOBDEF_CYCLE_TIME_MAX_US)us. */
+  GLOBFIT_FITTEST( GLOBFIT_CMD_TCYC_HI,
+                   (u32_currentTime = u32_LastTime + SCHEDULER_TIMEOUT_MAX_US + 1u));
+  GLOBFIT_FITTEST( GLOBFIT_CMD_TCYC_LO,
+                   (u32_currentTime = u32_LastTime + SCHEDULER_TIMEOUT_MIN_US - 1u));    
   
   switch (e_FirstRun)
   {
@@ -568,7 +835,7 @@ STATIC void CheckMainExecution (void)
     timeSlicesStartup
 
   Description:
-    executes the different tasks for all time-slices in startup mode
+    executes the different tasks for all time-slices in startup mode (see as_StartupTasks)
 
   See also:
     -
@@ -584,352 +851,17 @@ STATIC void CheckMainExecution (void)
 
 ***************************************************************************************************/
 STATIC void timeSlicesStartup (void)
-{ 
-  /* Execute tasks in startup mode */
-  switch (u8_BlockIdx)
+{
+  /* if block index valid */
+  if (u8_BlockIdx < SCHEDULER_BLOCK_COUNT)
   {
-    case 0:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 1:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 2:
-    {
-      /* read HW counter/timer and send to other controller via IPC */
-      TIM_SendTimerVal();
-    
-      /* do some selftests */
-      stHan_DoSelfTests();
-      break;
-    }
-
-    case 3:
-    {
-      aicMgrRx_CheckForNewTgm();  /* see [SRS_2235] */
-    
-      /* check HW timer/counter and set global systemtime used by both controllers */ 
-      TIM_CheckAndSetTimerVal();
-
-      /* read softerror variable and CSS path */
-      SAPLipc_SetStackVarAndPath();
-      break;
-    }
-
-    case 4:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      aicMgrRx_PrepAicSync();
-      gpio_SendAicSyncViaIPC(); /* see [SRS_685], [SRS_686] */
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 5:
-    {
-      gpio_GetAicSyncFromIPC(); /* see [SRS_685], [SRS_686] */
-      aicMgrRx_DoAicSync();
-      /* call sync function because after AIC sync uCs might differ */
-      ipcsSYS_Sync();
-      break;
-    }
-
-    case 6:
-    {
-      /* NV Memory handler  */
-      /* ATTENTION: This function shall only be called in time slices where no NV Memory access
-      ** through background task is possible!!!
-      */
-      SAPL_NvLowHandler();
-
-      /* Update SPDU buffers accessed by application/CSS and 
-      ** process non-safe part of the last received AIC message */
-      aicMgrRx_ProcessTgm();
-      /* Reset Input IO Data since no DI/DO module active */
-      aicMgrTx_ResetIoData();
-      /* Set background task runnable */
-      SAPL_BkgdTaskTrigger();
-      break;
-    }
-
-    case 7:
-    {
-      /* do nothing in this time slice */
-      #ifdef RFID_ACTIVE
-         RFID_Reader_Boot();
-      #endif /* RFID_ACTIVE */
-      break;
-    }
-
-    case 8:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 9:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      break;
-    }
-
-    case 10:
-    {
-      /* check temperature (incl. IPC transmission), see [SRS_662], [SRS_215],
-       * [SRS_397] */
-      tmSRV_CheckTemperature();
-      break;
-    }
-
-    case 11:
-    {
-      /* check temperature of other channel (received via IPC), see [SRS_662],
-       * [SRS_215], [SRS_397] */
-      tmSRV_SyncTemperature();
-      break;
-    }
-
-    case 12:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 13:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 14:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      
-      /* send static/global variables for soft error check and CSS control flow via
-      ** IPC
-      */
-      SAPLipc_SendVar();
-      break;
-    }
-
-    case 15:
-    {
-      /* check static/global variables and control flow path received from other controller */
-      SAPLipc_RecvAndCheckVar();
-      break;
-    }
-
-    case 16:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 17:
-    {
-      aicMgrRx_CheckForNewTgm();  /* see [SRS_2235] */
-      break;
-    }
-
-    case 18:
-    {
-      /* call function to send timer/clock value to other channel,
-       * see [SRS_663], [SRS_541] */
-      clkCtrl_CalcAndSendTimeDiff();
-      break;
-    }
-
-    case 19:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      
-      /* call function to compare timer/clock value with other channel,
-       * see [SRS_663], [SRS_541] */
-      clkCtrl_CheckTimerVal();
-      break;
-    }
-
-    case 20:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 21:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 22:
-    {
-      /* do some selftests */
-      stHan_DoSelfTests();
-      break;
-    }
-
-    case 23:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 24:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 25:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 26:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 27:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 28:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 29:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      break;
-    }
-
-    case 30:
-    {
-      aicMgrRx_CheckForNewTgm();  /* see [SRS_2235] */
-      CheckMainExecution();
-      break;
-    }
-
-    case 31:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 32:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 33:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 34:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      break;
-    }
-
-    case 35:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 36:
-    {
-      /* switch outputs off (cyclically done for more security) */
-      gpio_SwitchOutputsOff();
-      break;
-    }
-
-    case 37:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
-
-    case 38:
-    {
-      /* check background task cycle, this ensures that all tasks of the background
-      ** are finished */
-      SAPL_BkgdTaskCheck();
-      
-      /* if AIC in startup mode, dont call building of startup telegram and 
-       * sending of AIC-telegram here,
-       * the sending of startup-telegram is triggered below independent of
-       * time slices */
-      if (AICSM_AIC_STARTUP != aicSm_eAicState)
-      {
-        /* build AIC ASM telegram (TX) */
-        aicMgrTx_BuildAsmTgm();
-        /* merge and send AIC ASM telegram if not in startup mode
-         * (see [SRS_2235], [SRS_428]) */
-        aicMgrTx_MergeSendAsmTgm();
-      }
-      else
-      {
-        /* empty branch */
-      }
-
-      /* check scheduler cycle of appr. 4ms */
-      CheckSchedulerTimeout();
-
-      break;
-    }
-
-    case 39:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-    
-      /* call state handling of ASM 
-      ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the 
-      ** functions afterwards! */
-      aicSm_Statemachine();
-      break;
-    }
-
-    default:
-    {
-      GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(5u));
-      break;
-    }
+    /* Execute tasks in startup mode */
+    dispatchTasks(k_MODE_STARTUP, as_StartupTasks, k_STARTUP_TASK_CNT);
+  }
+  /* else: variable error */
+  else
+  {
+    GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(5u));
   }
 
   /* in AIC startup mode call sending of telegram always for more accuracy
@@ -943,18 +875,15 @@ STATIC void timeSlicesStartup (void)
   {
     /* empty branch */
   }
-/* This function has a lot of paths because of all possible time slices.
-** But de facto the function is not really complex. */
-/* RSM_IGNORE_QUALITY_BEGIN Notice #28   - Cyclomatic complexity > 15 */
 }
-/* RSM_IGNORE_QUALITY_END */
 
 /***************************************************************************************************
   Function:
     timeSlicesRunMode
 
   Description:
-    executes the different tasks for all time-slices in run mode (data exchange mode)
+    executes the different tasks for all time-slices in run mode (data exchange mode, see
+    as_RunModeTasks)
 
   See also:
     -
@@ -971,421 +900,295 @@ STATIC void timeSlicesStartup (void)
 ***************************************************************************************************/
 STATIC void timeSlicesRunMode (void)
 {
-  /* Execute tasks in run (data-exchange) mode */
-  switch (u8_BlockIdx)
+  /* if block index valid */
+  if (u8_BlockIdx < SCHEDULER_BLOCK_COUNT)
   {
-    case 0:
-    {
-      /* in case of first entry in scheduler, the values read during initialization phase are 
-      ** handled here */
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC(); /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;  /* end of "case 0" */
-    }
+    /* Execute tasks in run (data-exchange) mode */
+    dispatchTasks(k_MODE_RUN, as_RunModeTasks, k_RUN_MODE_TASK_CNT);
+  }
+  /* else: variable error */
+  else
+  {
+    GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(6u));
+  }
+}
 
-    case 1:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+/***************************************************************************************************
+  Function:
+    dispatchTasks
 
-    case 2:
-    {
-      /* FIT to test the timeout-check for the selftests. With this FIT the
-       * selftests are not executed and a timeout shall be detected after
-       * the time T-st. */
-      /* RSM_IGNORE_QUALITY_BEGIN Notice #9    - 'goto' keyword identified 
-      ** only used for FIT test */
-      GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_NO_SELFTEST_TRIGGER, goto _FitOverJumpSelfTestTrigger);
-      /* RSM_IGNORE_END */
-      
-      /* read HW counter/timer and send to other controller via IPC */
-      TIM_SendTimerVal();
+  Description:
+    This function calls all tasks of the given task table which are assigned to the current time
+    slice, in the order of the table. The execution time of each task is measured with the
+    counter of the scheduler timer and compared with its declared budget. Budget overruns are
+    counted (see schAPP_OverrunGet()), the hard limit of the cycle time is still supervised by
+    CheckSchedulerTimeout() and the watchdog.
+    If the profiler is active (SCH_PROFILER_ACTIVE), the execution time is additionally measured
+    in CPU clock cycles.
 
-      /* do some selftests */
-      stHan_DoSelfTests();
-    
-#ifdef GLOBFIT_FITTEST_ACTIVE
-      _FitOverJumpSelfTestTrigger: /* CCT_NO_PRE_WARNING, only used for FIT test */
-#endif
-      break;
-    }
+  See also:
+    -
 
-    case 3:
-    {
-      gpio_ProcessDOs();
-      aicMgrRx_CheckForNewTgm();  /* see [SRS_2235] */
-    
-      /* check HW timer/counter and set global systemtime used by both controllers */ 
-      TIM_CheckAndSetTimerVal();
-
-      /* read softerror variable and CSS path */
-      SAPLipc_SetStackVarAndPath();
-      break;
-    }
+  Parameters:
+    u8_mode (IN)    - task table k_MODE_xxx, only used by the profiler
+                      (valid range: any, not checked, only called locally)
+    pas_tasks (IN)  - task table of the current mode
+                      (valid range: <>NULL, not checked, only called locally)
+    u8_taskCnt (IN) - number of entries of the task table
+                      (valid range: any, not checked, only called locally)
 
-    case 4:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      gpio_FilterDiRelValues();
-      aicMgrRx_PrepAicSync();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC(); /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  Return value:
+    -
 
-    case 5:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+  Remarks:
+    Context: IRQ Scheduler
 
-    case 6:
-    {
-      /* NV Memory handler  */
-      /* ATTENTION: This function shall only be called in time slices where no NV Memory access
-      ** through background task is possible!!!
-      */
-      SAPL_NvLowHandler();
-
-      aicMgrRx_DoAicSync();
-      /* call sync function because after AIC sync uCs might differ */
-      ipcsSYS_Sync();
-    
-      /* Update SPDU buffers accessed by application/CSS and
-      ** process non-safe part of the last received AIC message */
-      aicMgrRx_ProcessTgm();
-      /* Sample Input IO Data do be accessible through CSS stack */
-      aicMgrTx_SampleIoData();
-      /* Set background task runnable */
-      SAPL_BkgdTaskTrigger();
-      break;
-    }
+***************************************************************************************************/
+/* Note 715: u8_mode is only used by the profiler */
+/*lint -esym(715, u8_mode) */
+STATIC void dispatchTasks (UINT8 u8_mode, CONST t_SCH_TASK *pas_tasks, UINT8 u8_taskCnt)
+{
+  UINT32 u32_maskLo = SCH_MASK_LO(u8_BlockIdx);
+  UINT8  u8_maskHi  = SCH_MASK_HI(u8_BlockIdx);
+  UINT16 u16_start;
+  UINT16 u16_elapsed;
+  UINT8  u8_idx;
+#ifdef SCH_PROFILER_ACTIVE
+  UINT32 u32_profStart;
+#endif
 
-    case 7:
+  for (u8_idx = 0u; u8_idx < u8_taskCnt; u8_idx++)
+  {
+    /* if task assigned to the current time slice */
+    if (   ((pas_tasks[u8_idx].u32_sliceMaskLo & u32_maskLo) != 0u)
+        || ((pas_tasks[u8_idx].u8_sliceMaskHi & u8_maskHi) != 0u))
     {
-      gpio_ProcessDOs();
-      #ifdef RFID_ACTIVE
-        RFID_ReadTag();
-      #endif /* RFID_ACTIVE */
-      break;
-    }
+#ifdef SCH_PROFILER_ACTIVE
+      u32_profStart = SCHPROF_CYCCNT;
+#endif
+      u16_start = TIMERHAL_TIMER1_COUNTER;
+      pas_tasks[u8_idx].pf_task();
+      u16_elapsed = TIMERHAL_TIMER1_COUNTER;
+#ifdef SCH_PROFILER_ACTIVE
+      schProf_TaskEnd(u8_mode, u8_idx, SCHPROF_CYCCNT - u32_profStart);
+#endif
 
-    case 8:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+      /* the counter restarts at the end of the time slice */
+      if (u16_elapsed < u16_start)
+      {
+        u16_elapsed += (UINT16)SCHEDULER_SLICE_TICKS;
+      }
+      else
+      {
+        /* empty branch */
+      }
+      u16_elapsed -= u16_start;
 
-    case 9:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
+      /* if declared budget exceeded */
+      if (u16_elapsed > pas_tasks[u8_idx].u8_budget)
+      {
+        if (s_Overrun.u16_taskCnt < (UINT16)UINT16_MAX)
+        {
+          s_Overrun.u16_taskCnt++;
+        }
+        else
+        {
+          /* empty branch, counter saturated */
+        }
+        s_Overrun.u8_lastSlice = u8_BlockIdx;
+        s_Overrun.u8_lastTask  = u8_idx;
+      }
+      /* else: task within budget */
+      else
+      {
+        /* empty branch */
+      }
     }
-
-    case 10:
+    /* else: task not assigned to this time slice */
+    else
     {
-      /* check temperature (incl. IPC transmission), see [SRS_662], [SRS_215],
-       * [SRS_397] */
-      tmSRV_CheckTemperature();
-      break;
+      /* empty branch */
     }
+  }
+}
 
-    case 11:
-    {
-      gpio_ProcessDOs();
-      /* check temperature of other channel (received via IPC), see [SRS_662],
-       * [SRS_215], [SRS_397] */
-      tmSRV_SyncTemperature();
-      break;
-    }
+/***************************************************************************************************
+  Function:
+    CheckTaskBudgets
 
-    case 12:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  Description:
+    This function checks that the declared budgets of all tasks of a time slice fit into the part
+    of the time slice available for the tasks (SCHEDULER_SLICE_BUDGET_US). The task tables are
+    constant, but their contents can not be summed up by the preprocessor, so the check is done
+    once during initialization. If a time slice is overbooked the Safety Handler is called.
 
-    case 13:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+  See also:
+    -
 
-    case 14:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
+  Parameters:
+    pas_tasks (IN)  - task table to be checked
+                      (valid range: <>NULL, not checked, only called locally)
+    u8_taskCnt (IN) - number of entries of the task table
+                      (valid range: any, not checked, only called locally)
 
-      /* send static/global variables for soft error check and CSS control flow via
-      ** IPC
-      */
-      SAPLipc_SendVar();
-      break;
-    }
+  Return value:
+    -
 
-    case 15:
-    {
-      gpio_ProcessDOs();
-      /* check static/global variables and control flow path received from other controller */
-      SAPLipc_RecvAndCheckVar();
-      break;
-    }
+  Remarks:
+    Context: main (during initialization)
 
-    case 16:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+***************************************************************************************************/
+STATIC void CheckTaskBudgets (CONST t_SCH_TASK *pas_tasks, UINT8 u8_taskCnt)
+{
+  UINT16 u16_sum;
+  UINT8  u8_slice;
+  UINT8  u8_idx;
 
-    case 17:
+  for (u8_slice = 0u; u8_slice < SCHEDULER_BLOCK_COUNT; u8_slice++)
+  {
+    u16_sum = 0u;
+    for (u8_idx = 0u; u8_idx < u8_taskCnt; u8_idx++)
     {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
+      if (   ((pas_tasks[u8_idx].u32_sliceMaskLo & SCH_MASK_LO(u8_slice)) != 0u)
+          || ((pas_tasks[u8_idx].u8_sliceMaskHi & SCH_MASK_HI(u8_slice)) != 0u))
+      {
+        u16_sum += pas_tasks[u8_idx].u8_budget;
+      }
+      else
+      {
+        /* empty branch */
+      }
     }
 
-    case 18:
+    /* if time slice overbooked */
+    if (u16_sum > SCH_US(SCHEDULER_SLICE_BUDGET_US))
     {
-      /* call function to send timer/clock value to other channel,
-       * see [SRS_663], [SRS_541] */
-      clkCtrl_CalcAndSendTimeDiff();
-      break;
+      GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_INVALID_CONFIG, GLOBFAIL_ADDINFO_FILE(7u));
     }
-
-    case 19:
+    else
     {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-         
-      /* call function to compare timer/clock value with other channel,
-       * see [SRS_663], [SRS_541] */
-      clkCtrl_CheckTimerVal();
-
-      gpio_ProcessDOs();
-      break;
+      /* empty branch */
     }
+  }
+}
 
-    case 20:
-    {
-      /* in case of first entry in scheduler, the values read during initialization phase are 
-      ** handled here */
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC(); /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;  /* end of "case 0" */
-    }
+/***************************************************************************************************
+  Function:
+    TaskTimerValAndSelfTests
 
-    case 21:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+  Description:
+    Task of time slice 2 in run mode: reads the HW counter/timer and sends it to the other
+    controller via IPC, afterwards some selftests are executed.
 
-    case 22:
-    {
-      /* FIT to test the timeout-check for the selftests. With this FIT the
-       * selftests are not executed and a timeout shall be detected after
-       * the time T-st. */
-      /* RSM_IGNORE_QUALITY_BEGIN Notice #9    - 'goto' keyword identified 
-      ** only used for FIT test */
-      GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_NO_SELFTEST_TRIGGER, goto _FitOverJumpSelfTestTrigger2);
-      /* RSM_IGNORE_END */
-
-      /* do some selftests */
-      stHan_DoSelfTests();
-    
-#ifdef GLOBFIT_FITTEST_ACTIVE
-      _FitOverJumpSelfTestTrigger2: /* CCT_NO_PRE_WARNING, only used for FIT test */
-#endif
-      break;
-    }
+  See also:
+    -
 
-    case 23:
-    {
-      gpio_ProcessDOs();
-      aicMgrRx_CheckForNewTgm();  /* see [SRS_2235] */
-      break;
-    }
+  Parameters:
+    -
 
-    case 24:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC(); /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  Return value:
+    -
 
-    case 25:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+  Remarks:
+    Context: IRQ Scheduler
 
-    case 26:
-    {
-      /* do nothing in this time slice */
-      break;
-    }
+***************************************************************************************************/
+STATIC void TaskTimerValAndSelfTests (void)
+{
+  /* FIT to test the timeout-check for the selftests. With this FIT the
+   * selftests are not executed and a timeout shall be detected after
+   * the time T-st. */
+  /* RSM_IGNORE_QUALITY_BEGIN Notice #9    - 'goto' keyword identified 
+  ** only used for FIT test */
+  GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_NO_SELFTEST_TRIGGER, goto _FitOverJumpSelfTestTrigger);
+  /* RSM_IGNORE_END */
 
-    case 27:
-    {
-      gpio_ProcessDOs();
-      break;
-    }
+  /* read HW counter/timer and send to other controller via IPC */
+  TIM_SendTimerVal();
 
-    case 28:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  /* do some selftests */
+  stHan_DoSelfTests();
 
-    case 29:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+#ifdef GLOBFIT_FITTEST_ACTIVE
+  _FitOverJumpSelfTestTrigger: /* CCT_NO_PRE_WARNING, only used for FIT test */
+#endif
+  return;
+}
 
-    case 30:
-    {
-      CheckMainExecution();
-      break;
-    }
+/***************************************************************************************************
+  Function:
+    TaskSelfTests
 
-    case 31:
-    {
-      gpio_ProcessDOs();
-      break;
-    }
+  Description:
+    Task of time slice 22 in run mode: executes some selftests.
 
-    case 32:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  See also:
+    -
 
-    case 33:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+  Parameters:
+    -
 
-    case 34:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
+  Return value:
+    -
 
-      /* send subframe(s) (Data Message, Time Coordination Message) generated by CIP Safety stack
-      ** to other safety controller.
-      */
-      spduIn_SendSafeTgm();
-      break;
-    }
+  Remarks:
+    Context: IRQ Scheduler
 
-    case 35:
-    {
-      gpio_ProcessDOs();
-      /* receive subframe(s) (Data Message, Time Coordination Message) from other safety
-      ** controller. This data is necessary to generate valid CIP Safety frames.
-      */
-      spduIn_RecvSafeTgm();
-      break;
-    }
+***************************************************************************************************/
+STATIC void TaskSelfTests (void)
+{
+  /* FIT to test the timeout-check for the selftests. With this FIT the
+   * selftests are not executed and a timeout shall be detected after
+   * the time T-st. */
+  /* RSM_IGNORE_QUALITY_BEGIN Notice #9    - 'goto' keyword identified 
+  ** only used for FIT test */
+  GLOBFIT_FITTEST_NOCMDRESET(GLOBFIT_NO_SELFTEST_TRIGGER, goto _FitOverJumpSelfTestTrigger2);
+  /* RSM_IGNORE_END */
 
-    case 36:
-    {
-      gpio_FilterDiRelValues();
-      gpio_HandleToTestExecution();
-      gpio_SendIOvaluesViaIPC();  /* see [SRS_685], [SRS_686] */
-      doState_ProcessDOsLight();
-      break;
-    }
+  /* do some selftests */
+  stHan_DoSelfTests();
 
-    case 37:
-    {
-      gpio_GetIOvaluesFromIPC(); /* see [SRS_685], [SRS_686] */
-      gpio_ProcessDIs();
-      break;
-    }
+#ifdef GLOBFIT_FITTEST_ACTIVE
+  _FitOverJumpSelfTestTrigger2: /* CCT_NO_PRE_WARNING, only used for FIT test */
+#endif
+  return;
+}
 
-    case 38:
-    {
-      doSafeBoundSS1t_UpdateTimers();
+/***************************************************************************************************
+  Function:
+    TaskStartupSendAsmTgm
 
-      /* check background task cycle, this ensures that all tasks of the background
-      ** are finished */
-      SAPL_BkgdTaskCheck();
-      
-      /* build AIC ASM telegram (TX) */
-      aicMgrTx_BuildAsmTgm();
-      /* merge and send AIC ASM telegram (TX) */
-      aicMgrTx_MergeSendAsmTgm();   /* see [SRS_2235] */
-      
-      /* check scheduler cycle of appr. 4ms */
-      CheckSchedulerTimeout();
-      break;
-    }
+  Description:
+    Task of time slice 38 in startup mode: builds and sends the AIC ASM telegram.
+    If AIC is in startup mode, the building of the startup telegram and the sending of the
+    AIC-telegram is not done here, the sending of the startup-telegram is triggered by
+    timeSlicesStartup() independent of time slices.
 
-    case 39:
-    {
-      /* trigger life signal and CC select generation, see [SRS_40] */
-      gpio_CyclicSignals();
-      
-      /* call state handling of ASM 
-      ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the 
-      ** functions afterwards! */
-      aicSm_Statemachine();
-    
-      /* get IO data processed by safety stack */
-      aicMgrRx_GetOutputData();
-
-      gpio_ProcessDOs();
-      break;
-    }
+  See also:
+    -
 
-    default:
-    {
-      GLOBFAIL_SAFETY_HANDLER(GLOB_FAILCODE_VARIABLE_ERR_EX, GLOBFAIL_ADDINFO_FILE(6u));
-      break;
-    }
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+STATIC void TaskStartupSendAsmTgm (void)
+{
+  if (AICSM_AIC_STARTUP != aicSm_eAicState)
+  {
+    /* build AIC ASM telegram (TX) */
+    aicMgrTx_BuildAsmTgm();
+    /* merge and send AIC ASM telegram if not in startup mode
+     * (see [SRS_2235], [SRS_428]) */
+    aicMgrTx_MergeSendAsmTgm();
+  }
+  else
+  {
+    /* empty branch */
   }
-/* This function has a lot of paths because of all possible time slices.
-** But de facto the function is not really complex. */
-/* RSM_IGNORE_QUALITY_BEGIN Notice #28   - Cyclomatic complexity > 15 */
 }
-/* RSM_IGNORE_QUALITY_END */
@@ -17,6 +17,8 @@
 **             schAPP_StartScheduler
 **             schAPP_StopScheduler
 **             schAPP_TriggerCycleStatistic
+**             schAPP_OverrunGet
+**             schAPP_TimeSliceGet
 **
 **    History:
 **
@@ -31,11 +33,36 @@
 **    constants and macros
 ***************************************************************************************************/
 
+/* Max. number of time slices of a scheduler cycle (width of the slice mask of the task tables) */
+#define SCHAPP_TIME_SLICE_MAX     40u
+
+/* Min. time of a time slice in microseconds */
+#define SCHAPP_TIME_SLICE_MIN_US  100u
+
+/* Number of time slices of a scheduler cycle, derived from the cycle time GLOBDEF_CYCLE_TIME_US:
+** as many time slices as possible, each at least SCHAPP_TIME_SLICE_MIN_US long
+** (2ms: 20 x 100us, 4ms: 40 x 100us, 8ms: 40 x 200us) */
+#define SCHAPP_TIME_SLICE_CNT     (((GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_MIN_US) \
+                                    < SCHAPP_TIME_SLICE_MAX) \
+                                   ? (GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_MIN_US) \
+                                   : SCHAPP_TIME_SLICE_MAX)
+
 
 /***************************************************************************************************
 **    data types
 ***************************************************************************************************/
 
+/* t_SCHAPP_OVERRUN:
+** Statistic of the task budget monitoring of the scheduler
+*/
+typedef struct
+{
+  UINT16 u16_taskCnt;   /* number of tasks which exceeded their declared budget (saturated) */
+  UINT16 u16_sliceCnt;  /* number of time slices which exceeded their time (saturated) */
+  UINT8  u8_lastSlice;  /* time slice of the last task budget overrun */
+  UINT8  u8_lastTask;   /* task table index of the last task budget overrun */
+} t_SCHAPP_OVERRUN;
+
 /***************************************************************************************************
 **    global variables
 ***************************************************************************************************/
@@ -160,5 +187,55 @@ void schAPP_StopScheduler (void);
 ***************************************************************************************************/
 void schAPP_TriggerCycleStatistic (void);
 
+/***************************************************************************************************
+  Function:
+    schAPP_OverrunGet
+
+  Description:
+    This function returns the statistic of the task budget monitoring: number of tasks which
+    exceeded their declared budget, number of time slices which exceeded their time and the time
+    slice/task table index of the last task budget overrun.
+
+  See also:
+    -
+
+  Parameters:
+    ps_overrun (OUT) - statistic of the budget monitoring
+                       (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task (IRQs disabled by caller)
+
+***************************************************************************************************/
+void schAPP_OverrunGet (t_SCHAPP_OVERRUN *ps_overrun);
+
+/***************************************************************************************************
+  Function:
+    schAPP_TimeSliceGet
+
+  Description:
+    This function returns the index of the time slice which is executed next by the scheduler.
+    Called from a task of the scheduler it is the index of the current time slice. Called from
+    main it is the index of the time slice following the current one.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    Index of the time slice (0..SCHAPP_TIME_SLICE_CNT-1)
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: main, while(FOREVER)
+
+***************************************************************************************************/
+UINT8 schAPP_TimeSliceGet (void);
+
 #endif /* SCHAPP_H */
 
@@ -0,0 +1,417 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: sch_Scheduler-app_tbl.h
+**     Summary: Task tables of the scheduler, only included by sch_Scheduler-app.c.
+**              GENERATED FILE, DO NOT EDIT! Generated by tools/sch_SliceGen.py from
+**              sch_Scheduler-app_tasks.cfg.
+**              The tables are selected by the cycle time GLOBDEF_CYCLE_TIME_US.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+** T-cyc 2000us: 20 time slices of 100us, budget 85us
+**
+** startup mode, declared load per time slice [us] (* = IPC telegram):
+**   0:  5   1: 25   2: 10*  3: 30*  4: 30*  5: 25*  6: 32   7: 50   8:  5   9:  5
+**  10: 45* 11: 35* 12:  5  13: 10  14: 25* 15: 20* 16:  5  17:  5  18: 55  19: 25
+**  worst case: 55 us (slice 18)
+**
+** run mode, declared load per time slice [us] (* = IPC telegram):
+**   0: 45*  1: 50*  2: 60*  3: 40*  4: 55*  5: 30*  6: 62*  7: 30*  8: 45*  9: 30*
+**  10: 45* 11: 45* 12: 45* 13: 35* 14: 70* 15: 25* 16: 45* 17: 25* 18: 60  19: 45
+**  worst case: 70 us (slice 14)
+**
+** T-cyc 4000us: 40 time slices of 100us, budget 85us
+** T-cyc 8000us: 40 time slices of 200us, budget 185us
+**
+** startup mode, declared load per time slice [us] (* = IPC telegram):
+**   0:  5   1: 25   2: 10*  3: 30*  4: 30*  5: 25*  6: 32   7: 20   8:  5   9:  5
+**  10: 45* 11: 35* 12:  5  13: 50  14:  5  15:  5  16:  5  17: 10  18:  0  19:  5
+**  20:  5  21: 20* 22: 20* 23:  0  24: 10  25:  0  26:  0  27:  0  28:  5  29:  5
+**  30: 10  31:  0  32:  5  33: 50  34:  5  35:  0  36:  5  37:  0  38: 55  39: 25
+**  worst case: 55 us (slice 38)
+**
+** run mode, declared load per time slice [us] (* = IPC telegram):
+**   0: 45*  1: 50*  2: 60*  3: 40*  4: 55*  5: 25*  6: 42   7: 10   8: 45*  9: 30*
+**  10: 45* 11: 45* 12: 45* 13: 25* 14: 25* 15: 30* 16: 45* 17: 25* 18: 40  19: 15
+**  20: 45* 21: 25* 22: 50  23: 20  24: 50* 25: 25* 26: 20* 27: 40* 28: 45* 29: 30*
+**  30:  5  31: 10  32: 45* 33: 25* 34: 20* 35: 25* 36: 45* 37: 25* 38: 60  39: 45
+**  worst case: 60 us (slice 2)
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef SCH_SCHEDULER_APP_TBL_H
+#define SCH_SCHEDULER_APP_TBL_H
+
+#if (GLOBDEF_CYCLE_TIME_US == 2000u)
+
+#ifdef RFID_ACTIVE
+  #error "RFID_ACTIVE not supported with T-cyc 2000us, see sch_Scheduler-app_tasks.cfg"
+#endif /* RFID_ACTIVE */
+
+/* Number of time slices of the task tables, checked against the number of time
+** slices of the scheduler by sch_Scheduler-app.c */
+#define SCH_TBL_SLICE_CNT               20u
+
+/* Worst-case declared load of a time slice [us], checked against the budget of the
+** time slice by sch_Scheduler-app.c */
+#define SCH_TBL_STARTUP_MAX_LOAD_US     55u
+#define SCH_TBL_RUN_MAX_LOAD_US         70u
+
+/* as_StartupTasks:
+** Tasks executed in startup mode. Declared budgets in microseconds.
+*/
+STATIC CONST t_SCH_TASK as_StartupTasks[] =
+{
+  /* check background task cycle, this ensures that all tasks of the background are finished */
+  { SAPL_BkgdTaskCheck,             SCH_SLICE(18u),             SCH_US(5u)  },
+  /* build and send AIC ASM telegram if not in startup mode (see [SRS_2235], [SRS_428]) */
+  { TaskStartupSendAsmTgm,          SCH_SLICE(18u),             SCH_US(45u) },
+  /* check scheduler cycle time (GLOBDEF_CYCLE_TIME_US) */
+  { CheckSchedulerTimeout,          SCH_SLICE(18u),             SCH_US(5u)  },
+
+  /* NV Memory handler
+  ** ATTENTION: This function shall only be called in time slices where no NV Memory access
+  ** through background task is possible!!! */
+  { SAPL_NvLowHandler,              SCH_SLICE(1u),              SCH_US(25u) },
+  /* Update SPDU buffers accessed by application/CSS and
+  ** process non-safe part of the last received AIC message */
+  { aicMgrRx_ProcessTgm,            SCH_SLICE(6u),              SCH_US(20u) },
+  /* Reset Input IO Data since no DI/DO module active */
+  { aicMgrTx_ResetIoData,           SCH_SLICE(6u),              SCH_US(10u) },
+  /* Set background task runnable */
+  { SAPL_BkgdTaskTrigger,           SCH_SLICE(6u),              SCH_US(2u)  },
+
+  /* AIC sync, see [SRS_685], [SRS_686], call sync function because after AIC sync uCs might
+  ** differ */
+  { gpio_GetAicSyncFromIPC,         SCH_SLICE(5u),              SCH_US(15u) },
+  { aicMgrRx_DoAicSync,             SCH_SLICE(5u),              SCH_US(5u)  },
+  { ipcsSYS_Sync,                   SCH_SLICE(5u),              SCH_US(5u)  },
+
+  /* trigger life signal and CC select generation, see [SRS_40] */
+  { gpio_CyclicSignals,             SCH_EVERY_5TH(4u),          SCH_US(5u)  },
+  /* send static/global variables for soft error check and CSS control flow via IPC */
+  { SAPLipc_SendVar,                SCH_SLICE(14u),             SCH_US(20u) },
+  /* call state handling of ASM
+  ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the
+  ** functions afterwards! */
+  { aicSm_Statemachine,             SCH_SLICE(19u),             SCH_US(20u) },
+
+  /* send AIC sync via IPC, see [SRS_685], [SRS_686] */
+  { aicMgrRx_PrepAicSync,           SCH_SLICE(4u),              SCH_US(5u)  },
+  { gpio_SendAicSyncViaIPC,         SCH_SLICE(4u),              SCH_US(15u) },
+  /* switch outputs off (cyclically done for more security) */
+  { gpio_SwitchOutputsOff,          SCH_EVERY_4TH(0u),          SCH_US(5u)  },
+
+  /* read HW counter/timer and send to other controller via IPC */
+  { TIM_SendTimerVal,               SCH_SLICE(2u),              SCH_US(10u) },
+  /* do some selftests */
+  { stHan_DoSelfTests,              SCH_SLICE(7u),              SCH_US(50u) },
+  /* see [SRS_2235] */
+  { aicMgrRx_CheckForNewTgm,        SCH_SLICES2(3u, 13u),       SCH_US(10u) },
+  /* check HW timer/counter and set global systemtime used by both controllers */
+  { TIM_CheckAndSetTimerVal,        SCH_SLICE(3u),              SCH_US(10u) },
+  /* read softerror variable and CSS path */
+  { SAPLipc_SetStackVarAndPath,     SCH_SLICE(3u),              SCH_US(10u) },
+  { CheckMainExecution,             SCH_SLICE(17u),             SCH_US(5u)  },
+  /* check temperature, the test result is sent in the IPC frame, see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_CheckTemperature,         SCH_SLICE(10u),             SCH_US(20u) },
+  /* calculate timer/clock value, it is sent in the IPC frame, see [SRS_663], [SRS_541] */
+  { clkCtrl_CalcAndSendTimeDiff,    SCH_SLICE(10u),             SCH_US(10u) },
+  /* exchange the IPC frame (temperature test result and timer/clock value) with the other
+  ** channel */
+  { ipcxSYS_FrameSend,              SCH_SLICE(10u),             SCH_US(15u) },
+  { ipcxSYS_FrameRecvinclWait,      SCH_SLICE(11u),             SCH_US(15u) },
+  /* check temperature of other channel (received via IPC frame), see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_SyncTemperature,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* compare timer/clock value with other channel, see [SRS_663], [SRS_541] */
+  { clkCtrl_CheckTimerVal,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* check static/global variables and control flow path received from other controller */
+  { SAPLipc_RecvAndCheckVar,        SCH_SLICE(15u),             SCH_US(20u) }
+};
+
+/* as_RunModeTasks:
+** Tasks executed in run mode (data exchange mode). Declared budgets in microseconds.
+*/
+STATIC CONST t_SCH_TASK as_RunModeTasks[] =
+{
+  { doSafeBoundSS1t_UpdateTimers,   SCH_SLICE(18u),             SCH_US(5u)  },
+  /* check background task cycle, this ensures that all tasks of the background are finished */
+  { SAPL_BkgdTaskCheck,             SCH_SLICE(18u),             SCH_US(5u)  },
+  /* build and merge/send AIC ASM telegram (TX), see [SRS_2235] */
+  { aicMgrTx_BuildAsmTgm,           SCH_SLICE(18u),             SCH_US(20u) },
+  { aicMgrTx_MergeSendAsmTgm,       SCH_SLICE(18u),             SCH_US(25u) },
+  /* check scheduler cycle time (GLOBDEF_CYCLE_TIME_US) */
+  { CheckSchedulerTimeout,          SCH_SLICE(18u),             SCH_US(5u)  },
+
+  /* NV Memory handler
+  ** ATTENTION: This function shall only be called in time slices where no NV Memory access
+  ** through background task is possible!!! */
+  { SAPL_NvLowHandler,              SCH_SLICE(1u),              SCH_US(25u) },
+  /* AIC sync, call sync function because after AIC sync uCs might differ */
+  { aicMgrRx_DoAicSync,             SCH_SLICE(6u),              SCH_US(5u)  },
+  { ipcsSYS_Sync,                   SCH_SLICE(6u),              SCH_US(5u)  },
+  /* Update SPDU buffers accessed by application/CSS and
+  ** process non-safe part of the last received AIC message */
+  { aicMgrRx_ProcessTgm,            SCH_SLICE(6u),              SCH_US(20u) },
+  /* Sample Input IO Data do be accessible through CSS stack */
+  { aicMgrTx_SampleIoData,          SCH_SLICE(6u),              SCH_US(10u) },
+  /* Set background task runnable */
+  { SAPL_BkgdTaskTrigger,           SCH_SLICE(6u),              SCH_US(2u)  },
+
+  /* trigger life signal and CC select generation, see [SRS_40] */
+  { gpio_CyclicSignals,             SCH_EVERY_5TH(4u),          SCH_US(5u)  },
+  /* call state handling of ASM
+  ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the
+  ** functions afterwards! */
+  { aicSm_Statemachine,             SCH_SLICE(19u),             SCH_US(20u) },
+  /* get IO data processed by safety stack */
+  { aicMgrRx_GetOutputData,         SCH_SLICE(19u),             SCH_US(10u) },
+
+  /* filter DIs and exchange IO values, in case of first entry in scheduler the values read
+  ** during initialization phase are handled here, see [SRS_685], [SRS_686] */
+  { gpio_FilterDiRelValues,         SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { aicMgrRx_PrepAicSync,           SCH_SLICE(4u),              SCH_US(5u)  },
+  { gpio_HandleToTestExecution,     SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { gpio_SendIOvaluesViaIPC,        SCH_EVERY_4TH(0u),          SCH_US(15u) },
+  { doState_ProcessDOsLight,        SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { gpio_GetIOvaluesFromIPC,        SCH_EVERY_4TH(1u),          SCH_US(15u) },
+  { gpio_ProcessDIs,                SCH_EVERY_4TH(1u),          SCH_US(10u) },
+
+  /* read HW counter/timer, send it to other controller and do some selftests */
+  { TaskTimerValAndSelfTests,       SCH_SLICE(2u),              SCH_US(60u) },
+  /* do some selftests */
+  { TaskSelfTests,                  SCH_SLICE(14u),             SCH_US(50u) },
+
+  { gpio_ProcessDOs,                SCH_EVERY_4TH(3u),          SCH_US(10u) },
+  /* see [SRS_2235] */
+  { aicMgrRx_CheckForNewTgm,        SCH_SLICES2(3u, 13u),       SCH_US(10u) },
+  /* check HW timer/counter and set global systemtime used by both controllers */
+  { TIM_CheckAndSetTimerVal,        SCH_SLICE(3u),              SCH_US(10u) },
+  /* read softerror variable and CSS path */
+  { SAPLipc_SetStackVarAndPath,     SCH_SLICE(3u),              SCH_US(10u) },
+  /* check temperature, the test result is sent in the IPC frame, see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_CheckTemperature,         SCH_SLICE(10u),             SCH_US(20u) },
+  /* calculate timer/clock value, it is sent in the IPC frame, see [SRS_663], [SRS_541] */
+  { clkCtrl_CalcAndSendTimeDiff,    SCH_SLICE(10u),             SCH_US(10u) },
+  /* exchange the IPC frame (temperature test result and timer/clock value) with the other
+  ** channel */
+  { ipcxSYS_FrameSend,              SCH_SLICE(10u),             SCH_US(15u) },
+  { ipcxSYS_FrameRecvinclWait,      SCH_SLICE(11u),             SCH_US(15u) },
+  /* check temperature of other channel (received via IPC frame), see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_SyncTemperature,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* compare timer/clock value with other channel, see [SRS_663], [SRS_541] */
+  { clkCtrl_CheckTimerVal,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* send static/global variables for soft error check and CSS control flow via IPC */
+  { SAPLipc_SendVar,                SCH_SLICE(6u),              SCH_US(20u) },
+  /* check static/global variables and control flow path received from other controller */
+  { SAPLipc_RecvAndCheckVar,        SCH_SLICE(7u),              SCH_US(20u) },
+  { CheckMainExecution,             SCH_SLICE(5u),              SCH_US(5u)  },
+  /* send subframe(s) (Data Message, Time Coordination Message) generated by CIP Safety stack
+  ** to other safety controller. */
+  { spduIn_SendSafeTgm,             SCH_SLICE(14u),             SCH_US(15u) },
+  /* receive subframe(s) from other safety controller. This data is necessary to generate
+  ** valid CIP Safety frames. */
+  { spduIn_RecvSafeTgm,             SCH_SLICE(15u),             SCH_US(15u) }
+};
+
+#elif ((GLOBDEF_CYCLE_TIME_US == 4000u) || (GLOBDEF_CYCLE_TIME_US == 8000u))
+
+/* Number of time slices of the task tables, checked against the number of time
+** slices of the scheduler by sch_Scheduler-app.c */
+#define SCH_TBL_SLICE_CNT               40u
+
+/* Worst-case declared load of a time slice [us], checked against the budget of the
+** time slice by sch_Scheduler-app.c */
+#define SCH_TBL_STARTUP_MAX_LOAD_US     55u
+#define SCH_TBL_RUN_MAX_LOAD_US         60u
+
+/* as_StartupTasks:
+** Tasks executed in startup mode. Declared budgets in microseconds.
+*/
+STATIC CONST t_SCH_TASK as_StartupTasks[] =
+{
+  /* check background task cycle, this ensures that all tasks of the background are finished */
+  { SAPL_BkgdTaskCheck,             SCH_SLICE(38u),             SCH_US(5u)  },
+  /* build and send AIC ASM telegram if not in startup mode (see [SRS_2235], [SRS_428]) */
+  { TaskStartupSendAsmTgm,          SCH_SLICE(38u),             SCH_US(45u) },
+  /* check scheduler cycle time (GLOBDEF_CYCLE_TIME_US) */
+  { CheckSchedulerTimeout,          SCH_SLICE(38u),             SCH_US(5u)  },
+
+  /* NV Memory handler
+  ** ATTENTION: This function shall only be called in time slices where no NV Memory access
+  ** through background task is possible!!! */
+  { SAPL_NvLowHandler,              SCH_SLICE(1u),              SCH_US(25u) },
+  /* Update SPDU buffers accessed by application/CSS and
+  ** process non-safe part of the last received AIC message */
+  { aicMgrRx_ProcessTgm,            SCH_SLICE(6u),              SCH_US(20u) },
+  /* Reset Input IO Data since no DI/DO module active */
+  { aicMgrTx_ResetIoData,           SCH_SLICE(6u),              SCH_US(10u) },
+  /* Set background task runnable */
+  { SAPL_BkgdTaskTrigger,           SCH_SLICE(6u),              SCH_US(2u)  },
+
+  /* AIC sync, see [SRS_685], [SRS_686], call sync function because after AIC sync uCs might
+  ** differ */
+  { gpio_GetAicSyncFromIPC,         SCH_SLICE(5u),              SCH_US(15u) },
+  { aicMgrRx_DoAicSync,             SCH_SLICE(5u),              SCH_US(5u)  },
+  { ipcsSYS_Sync,                   SCH_SLICE(5u),              SCH_US(5u)  },
+
+  /* trigger life signal and CC select generation, see [SRS_40] */
+  { gpio_CyclicSignals,             SCH_EVERY_5TH(4u),          SCH_US(5u)  },
+  /* send static/global variables for soft error check and CSS control flow via IPC */
+  { SAPLipc_SendVar,                SCH_SLICE(21u),             SCH_US(20u) },
+  /* call state handling of ASM
+  ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the
+  ** functions afterwards! */
+  { aicSm_Statemachine,             SCH_SLICE(39u),             SCH_US(20u) },
+
+  /* send AIC sync via IPC, see [SRS_685], [SRS_686] */
+  { aicMgrRx_PrepAicSync,           SCH_SLICE(4u),              SCH_US(5u)  },
+  { gpio_SendAicSyncViaIPC,         SCH_SLICE(4u),              SCH_US(15u) },
+  /* switch outputs off (cyclically done for more security) */
+  { gpio_SwitchOutputsOff,          SCH_EVERY_4TH(0u),          SCH_US(5u)  },
+
+  /* read HW counter/timer and send to other controller via IPC */
+  { TIM_SendTimerVal,               SCH_SLICE(2u),              SCH_US(10u) },
+  /* do some selftests */
+  { stHan_DoSelfTests,              SCH_SLICES2(13u, 33u),      SCH_US(50u) },
+  /* see [SRS_2235] */
+  { aicMgrRx_CheckForNewTgm,        SCH_SLICES3(3u, 17u, 30u),  SCH_US(10u) },
+  /* check HW timer/counter and set global systemtime used by both controllers */
+  { TIM_CheckAndSetTimerVal,        SCH_SLICE(3u),              SCH_US(10u) },
+  /* read softerror variable and CSS path */
+  { SAPLipc_SetStackVarAndPath,     SCH_SLICE(3u),              SCH_US(10u) },
+  { CheckMainExecution,             SCH_SLICE(15u),             SCH_US(5u)  },
+#ifdef RFID_ACTIVE
+  { RFID_Reader_Boot,               SCH_SLICE(7u),              SCH_US(20u) },
+#endif /* RFID_ACTIVE */
+  /* check temperature, the test result is sent in the IPC frame, see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_CheckTemperature,         SCH_SLICE(10u),             SCH_US(20u) },
+  /* calculate timer/clock value, it is sent in the IPC frame, see [SRS_663], [SRS_541] */
+  { clkCtrl_CalcAndSendTimeDiff,    SCH_SLICE(10u),             SCH_US(10u) },
+  /* exchange the IPC frame (temperature test result and timer/clock value) with the other
+  ** channel */
+  { ipcxSYS_FrameSend,              SCH_SLICE(10u),             SCH_US(15u) },
+  { ipcxSYS_FrameRecvinclWait,      SCH_SLICE(11u),             SCH_US(15u) },
+  /* check temperature of other channel (received via IPC frame), see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_SyncTemperature,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* compare timer/clock value with other channel, see [SRS_663], [SRS_541] */
+  { clkCtrl_CheckTimerVal,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* check static/global variables and control flow path received from other controller */
+  { SAPLipc_RecvAndCheckVar,        SCH_SLICE(22u),             SCH_US(20u) }
+};
+
+/* as_RunModeTasks:
+** Tasks executed in run mode (data exchange mode). Declared budgets in microseconds.
+*/
+STATIC CONST t_SCH_TASK as_RunModeTasks[] =
+{
+  { doSafeBoundSS1t_UpdateTimers,   SCH_SLICE(38u),             SCH_US(5u)  },
+  /* check background task cycle, this ensures that all tasks of the background are finished */
+  { SAPL_BkgdTaskCheck,             SCH_SLICE(38u),             SCH_US(5u)  },
+  /* build and merge/send AIC ASM telegram (TX), see [SRS_2235] */
+  { aicMgrTx_BuildAsmTgm,           SCH_SLICE(38u),             SCH_US(20u) },
+  { aicMgrTx_MergeSendAsmTgm,       SCH_SLICE(38u),             SCH_US(25u) },
+  /* check scheduler cycle time (GLOBDEF_CYCLE_TIME_US) */
+  { CheckSchedulerTimeout,          SCH_SLICE(38u),             SCH_US(5u)  },
+
+  /* NV Memory handler
+  ** ATTENTION: This function shall only be called in time slices where no NV Memory access
+  ** through background task is possible!!! */
+  { SAPL_NvLowHandler,              SCH_SLICE(1u),              SCH_US(25u) },
+  /* AIC sync, call sync function because after AIC sync uCs might differ */
+  { aicMgrRx_DoAicSync,             SCH_SLICE(6u),              SCH_US(5u)  },
+  { ipcsSYS_Sync,                   SCH_SLICE(6u),              SCH_US(5u)  },
+  /* Update SPDU buffers accessed by application/CSS and
+  ** process non-safe part of the last received AIC message */
+  { aicMgrRx_ProcessTgm,            SCH_SLICE(6u),              SCH_US(20u) },
+  /* Sample Input IO Data do be accessible through CSS stack */
+  { aicMgrTx_SampleIoData,          SCH_SLICE(6u),              SCH_US(10u) },
+  /* Set background task runnable */
+  { SAPL_BkgdTaskTrigger,           SCH_SLICE(6u),              SCH_US(2u)  },
+
+  /* trigger life signal and CC select generation, see [SRS_40] */
+  { gpio_CyclicSignals,             SCH_EVERY_5TH(4u),          SCH_US(5u)  },
+  /* call state handling of ASM
+  ** ATTENTION: Afterwards the AIC state might be changed, this shall be considered in the
+  ** functions afterwards! */
+  { aicSm_Statemachine,             SCH_SLICE(39u),             SCH_US(20u) },
+  /* get IO data processed by safety stack */
+  { aicMgrRx_GetOutputData,         SCH_SLICE(39u),             SCH_US(10u) },
+
+  /* filter DIs and exchange IO values, in case of first entry in scheduler the values read
+  ** during initialization phase are handled here, see [SRS_685], [SRS_686] */
+  { gpio_FilterDiRelValues,         SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { aicMgrRx_PrepAicSync,           SCH_SLICE(4u),              SCH_US(5u)  },
+  { gpio_HandleToTestExecution,     SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { gpio_SendIOvaluesViaIPC,        SCH_EVERY_4TH(0u),          SCH_US(15u) },
+  { doState_ProcessDOsLight,        SCH_EVERY_4TH(0u),          SCH_US(10u) },
+  { gpio_GetIOvaluesFromIPC,        SCH_EVERY_4TH(1u),          SCH_US(15u) },
+  { gpio_ProcessDIs,                SCH_EVERY_4TH(1u),          SCH_US(10u) },
+
+  /* read HW counter/timer, send it to other controller and do some selftests */
+  { TaskTimerValAndSelfTests,       SCH_SLICE(2u),              SCH_US(60u) },
+  /* do some selftests */
+  { TaskSelfTests,                  SCH_SLICE(22u),             SCH_US(50u) },
+
+  { gpio_ProcessDOs,                SCH_EVERY_4TH(3u),          SCH_US(10u) },
+  /* see [SRS_2235] */
+  { aicMgrRx_CheckForNewTgm,        SCH_SLICES2(3u, 23u),       SCH_US(10u) },
+  /* check HW timer/counter and set global systemtime used by both controllers */
+  { TIM_CheckAndSetTimerVal,        SCH_SLICE(3u),              SCH_US(10u) },
+  /* read softerror variable and CSS path */
+  { SAPLipc_SetStackVarAndPath,     SCH_SLICE(3u),              SCH_US(10u) },
+#ifdef RFID_ACTIVE
+  { RFID_ReadTag,                   SCH_SLICE(18u),             SCH_US(40u) },
+#endif /* RFID_ACTIVE */
+  /* check temperature, the test result is sent in the IPC frame, see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_CheckTemperature,         SCH_SLICE(10u),             SCH_US(20u) },
+  /* calculate timer/clock value, it is sent in the IPC frame, see [SRS_663], [SRS_541] */
+  { clkCtrl_CalcAndSendTimeDiff,    SCH_SLICE(10u),             SCH_US(10u) },
+  /* exchange the IPC frame (temperature test result and timer/clock value) with the other
+  ** channel */
+  { ipcxSYS_FrameSend,              SCH_SLICE(10u),             SCH_US(15u) },
+  { ipcxSYS_FrameRecvinclWait,      SCH_SLICE(11u),             SCH_US(15u) },
+  /* check temperature of other channel (received via IPC frame), see [SRS_662], [SRS_215],
+  ** [SRS_397] */
+  { tmSRV_SyncTemperature,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* compare timer/clock value with other channel, see [SRS_663], [SRS_541] */
+  { clkCtrl_CheckTimerVal,          SCH_SLICE(11u),             SCH_US(10u) },
+  /* send static/global variables for soft error check and CSS control flow via IPC */
+  { SAPLipc_SendVar,                SCH_SLICE(14u),             SCH_US(20u) },
+  /* check static/global variables and control flow path received from other controller */
+  { SAPLipc_RecvAndCheckVar,        SCH_SLICE(15u),             SCH_US(20u) },
+#ifdef RFID_ACTIVE
+  /* exchange the digest of a newly verified RFID tag */
+  { RFID_DigestSend,                SCH_SLICE(26u),             SCH_US(20u) },
+  { RFID_DigestRecv,                SCH_SLICE(27u),             SCH_US(30u) },
+#endif /* RFID_ACTIVE */
+  { CheckMainExecution,             SCH_SLICE(30u),             SCH_US(5u)  },
+  /* send subframe(s) (Data Message, Time Coordination Message) generated by CIP Safety stack
+  ** to other safety controller. */
+  { spduIn_SendSafeTgm,             SCH_SLICE(34u),             SCH_US(15u) },
+  /* receive subframe(s) from other safety controller. This data is necessary to generate
+  ** valid CIP Safety frames. */
+  { spduIn_RecvSafeTgm,             SCH_SLICE(35u),             SCH_US(15u) }
+};
+
+#else
+  #error "No task tables for GLOBDEF_CYCLE_TIME_US, run tools/sch_SliceGen.py"
+#endif /* GLOBDEF_CYCLE_TIME_US */
+
+#endif /* SCH_SCHEDULER_APP_TBL_H */
@@ -26,6 +26,21 @@
 /* Baudrate constants for the RFID reader */   
 #define RFID_38400_BAUDRATE         38400u  
 #define RFID_115200_BAUD            115200u
+
+/* Baud rate which is negotiated with the reader after the boot. The reader starts with
+ * RFID_38400_BAUDRATE, RFID_38400_BAUDRATE disables the negotiation.
+ */
+#ifndef RFID_BAUD_TARGET
+  #define RFID_BAUD_TARGET          RFID_115200_BAUD
+#endif
+
+/* Number of consecutive UID timeouts with the negotiated baud rate after which the reader is
+ * booted again with RFID_38400_BAUDRATE. A reader which was restarted (power on) answers with
+ * the boot baud rate only.
+ */
+#ifndef RFID_BAUD_RESYNC_TIMEOUTS
+  #define RFID_BAUD_RESYNC_TIMEOUTS 3u
+#endif
 /* RFID Protocol Constants */
 
 /* RFID Tag Status Codes
@@ -63,6 +78,13 @@
 #define RFID_REC_IDX_S2L_ID         4u
 #define RFID_REC_IDX_R_CRC          8u
 
+/* RFID Tag Memory Structure for the full memory read
+ * 8 records followed by the memory CRC (M_CRC) over all records
+ */
+#define RFID_REC_COUNT              8u
+#define RFID_MEM_CRC_LEN            4u
+#define RFID_MEM_TOTAL_LEN          ((RFID_REC_COUNT * RFID_REC_TOTAL_LEN) + RFID_MEM_CRC_LEN)
+
 /*  Error codes for RFID operations on file and function level */
 #define RFID_OK                     0u
 #define RFID_POWER_ON_NOTIFICATION  2
@@ -93,6 +115,54 @@
 #define RFID_BOOT_READER_TIMEOUT    30000u // 30 ms
 #define RFID_READ_UID_TIMEOUT       30000u // 30 ms
 #define RFID_READ_REC_TIMEOUT       50000u // 50 ms
+#define RFID_READ_FULL_MEM_TIMEOUT  100000u // 100 ms
+
+/* Adaptive poll rate: after RFID_POLL_BACKOFF_CNT consecutive "no tag" responses the UID is
+ * polled every RFID_POLL_BACKOFF_START, the interval doubles with each further "no tag" response
+ * up to RFID_POLL_IDLE_INTERVAL. The first UID response with a tag restores the full rate.
+ * A tag is detected at the latest RFID_POLL_IDLE_INTERVAL + RFID_READ_UID_TIMEOUT after it is
+ * placed in front of the reader. RFID_POLL_IDLE_INTERVAL 0 disables the adaptive poll rate.
+ */
+#ifndef RFID_POLL_IDLE_INTERVAL
+  #define RFID_POLL_IDLE_INTERVAL   64000u // 64 ms
+#endif
+#define RFID_POLL_BACKOFF_START     8000u  // 8 ms
+#define RFID_POLL_BACKOFF_CNT       4u
+/* Number of RFID_ReadTag() calls of the duty cycle measurement window (ca. 1 s) */
+#define RFID_POLL_DUTY_WINDOW       250u
+
+/* Maximum age of the verified tag cache. Afterwards the tag is verified completely again, in
+ * between only one record per cycle is checked (spot check). 0 disables the cache.
+ */
+#ifndef RFID_TAG_CACHE_MAX_AGE
+  #define RFID_TAG_CACHE_MAX_AGE    1000000u // 1 s
+#endif
+
+/* Default read mode, can be overridden by the compiler options
+ * (see t_RFID_READ_MODE)
+ */
+#ifndef RFID_READ_MODE_DEFAULT
+  #define RFID_READ_MODE_DEFAULT    RFID_READ_MODE_ROTATION
+#endif
+
+/* Send the next read command from the receive interrupt as soon as a positive response is
+ * received (1) or from the time slice after the verification of the response (0).
+ */
+#ifndef RFID_RX_IRQ_CHAIN
+  #define RFID_RX_IRQ_CHAIN         1u
+#endif
+
+/* Read the even and the odd record of the rotation mode with one Single Read Words command (1)
+ * or with one command per record (0).
+ */
+#ifndef RFID_READ_REC_PAIR
+  #define RFID_READ_REC_PAIR        1u
+#endif
+
+/* Number of buckets of the latency histograms (see t_RFID_HIST). The upper bound of bucket n
+ * is 1 ms * 2^n, the last bucket collects all longer durations (>= 256 ms).
+ */
+#define RFID_HIST_BUCKET_CNT        10u
 
 /* Failure types for RFID operations for global error handling */
 typedef enum {
@@ -110,10 +180,40 @@ typedef enum {
   RFID_FAIL_ODD_REC_VERIFY,
   RFID_FAIL_ODD_REC_SEQ_NUM_ERROR,
   RFID_FAIL_ODD_REC_CRC_ERROR,
+  RFID_FAIL_FULL_MEM_TIMEOUT,
+  RFID_FAIL_FULL_MEM_VERIFY,
+  RFID_FAIL_FULL_MEM_SEQ_NUM_ERROR,
+  RFID_FAIL_FULL_MEM_CRC_ERROR,
+  RFID_FAIL_FULL_MEM_MCRC_ERROR,
+  RFID_FAIL_SPOT_REC_VERIFY,
+  RFID_FAIL_SPOT_REC_SEQ_NUM_ERROR,
+  RFID_FAIL_SPOT_REC_CRC_ERROR,
   RFID_FAIL_S2L_ID_VERIFY,
+  RFID_FAIL_DIGEST_VERIFY,
   RFID_FAIL_UNKNOWN,
 } t_RFID_FAILURE;
 
+/* Number of failure types, size of the failure counter array */
+#define RFID_FAIL_CNT               ((UINT8)RFID_FAIL_UNKNOWN + 1u)
+
+/* Latency histograms of the tag read pipeline (diagnostics)
+ *
+ * RFID_HIST_UID:         Single Read Fix Code command until the UID response is received
+ * RFID_HIST_REC_EVEN:    Read command until the response of an even record (or of the record
+ *                        pair, see RFID_READ_REC_PAIR) is received
+ * RFID_HIST_REC_ODD:     Read command until the response of an odd record is received
+ * RFID_HIST_FULL_VERIFY: Detection of a new tag until its S2L ID is verified completely
+ * RFID_HIST_TAG_REMOVAL: Last read of a tag until the reader reports no tag
+ */
+typedef enum {
+  RFID_HIST_UID,
+  RFID_HIST_REC_EVEN,
+  RFID_HIST_REC_ODD,
+  RFID_HIST_FULL_VERIFY,
+  RFID_HIST_TAG_REMOVAL,
+  RFID_HIST_CNT
+} t_RFID_HIST;
+
 typedef enum {
   WF_TX_BOOT_FIRMWARE,
   WF_RX_BOOT_FIRMWARE,
@@ -138,6 +238,8 @@ typedef enum {
 typedef enum {
   TX_BOOT_FIRMWARE,
   RX_BOOT_FIRMWARE,
+  TX_SET_BAUD,
+  RX_SET_BAUD,
   TX_READ_UID,
   RX_READ_UID,
   TX_READ_REC_EVEN,
@@ -146,11 +248,30 @@ typedef enum {
   TX_READ_REC_ODD,
   RX_READ_REC_ODD,
   CHECK_REC_ODD,
+  TX_READ_FULL_MEM,
+  RX_READ_FULL_MEM,
+  CHECK_FULL_MEM,
+  TX_READ_REC_SPOT,
+  RX_READ_REC_SPOT,
+  CHECK_REC_SPOT,
   CHECK_TAG_RECORDS,
   STATE_SUCCESS,
   RFID_FAIL_SAFE,
 } t_RFID_TAG_READ_STATE;
 
+/* RFID Tag Read Modes
+ *
+ * RFID_READ_MODE_ROTATION:    Each cycle reads one even and one odd record, the record pair
+ *                             rotates from cycle to cycle (two commands per cycle, three
+ *                             without RFID_READ_REC_PAIR).
+ * RFID_READ_MODE_FULL_MEMORY: Each cycle reads all records and the memory CRC with one Single
+ *                             Read Words command (two commands per cycle).
+ */
+typedef enum {
+  RFID_READ_MODE_ROTATION,
+  RFID_READ_MODE_FULL_MEMORY,
+} t_RFID_READ_MODE;
+
 
 /**************************************************************************************************    
 **   data types     
@@ -184,5 +305,19 @@ void RFID_Reader_Boot(void);
 void RFID_ReadTag(void);
 UINT32 RFID_InfoGet(void);
 void RFID_InfoSet(UINT32 u32_info);
+UINT8 RFID_DigestCntGet(void);
+void RFID_DigestCntSet(UINT8 u8_cnt);
+UINT8 RFID_DigestAckGet(void);
+void RFID_DigestAckSet(UINT8 u8_ack);
+void RFID_DigestSend(void);
+void RFID_DigestRecv(void);
+void RFID_ReadModeSet(t_RFID_READ_MODE e_mode);
+t_RFID_READ_MODE RFID_ReadModeGet(void);
+UINT32 RFID_BaudRateGet(void);
+UINT32 RFID_PollIntervalGet(void);
+UINT16 RFID_PollDutyGet(void);
+void RFID_DiagHistGet(t_RFID_HIST e_hist, UINT16 *pau16_bucket);
+UINT8 RFID_DiagFailCntGet(UINT8 u8_first, UINT16 *pau16_cnt, UINT8 u8_maxCnt);
+void RFID_DiagReset(void);
 #endif /* #ifdef RFID_ACTIVE */    
 #endif /* #ifndef RFID_H */    
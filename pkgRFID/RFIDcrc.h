@@ -0,0 +1,73 @@
+/**************************************************************************************************
+**    Copyright (C) 2016 HMS Technology Center Ravensburg GmbH, all rights reserved
+***************************************************************************************************
+**
+**        File: RFIDcrc.h
+**     Summary: Interface of the CRC engine used for the RFID tag record verification
+**   $Revision: $
+**       $Date: $
+**     Author: ChSe
+**
+***************************************************************************************************
+***************************************************************************************************
+**
+** Functions: RFID_CrcInit
+**            RFID_Crc32
+**            RFID_Crc32Update
+**            RFID_Crc32Rewind
+**
+***************************************************************************************************
+**    Template Version 5
+**************************************************************************************************/
+#ifndef RFIDCRC_H
+#define RFIDCRC_H
+#ifdef RFID_ACTIVE
+/**************************************************************************************************
+**    constants and macros
+**************************************************************************************************/
+/* CRC parameters of the tag record CRC (R_CRC)
+ * MSB first, no reflection (CRC-32/BZIP2 parameter set).
+ */
+#define RFID_CRC_POLY               0x04C11DB7uL
+/* Only for test purposes, seed is actually a safe configuration parameter */
+#define RFID_CRC_SEED               0xFFFFFFFFuL
+#define RFID_CRC_XOROUT             0xFFFFFFFFuL
+
+/* Available CRC engines */
+#define RFID_CRC_ENGINE_TABLE       1u  /* byte-wise, one 256 entry table (1 kByte flash) */
+#define RFID_CRC_ENGINE_SLICE4      2u  /* slicing-by-4, four 256 entry tables (4 kByte flash) */
+#define RFID_CRC_ENGINE_HW          3u  /* STM32 CRC calculation unit */
+
+/* Selection of the CRC engine, can be overridden by the compiler options */
+#ifndef RFID_CRC_ENGINE
+  #define RFID_CRC_ENGINE           RFID_CRC_ENGINE_SLICE4
+#endif
+
+#if (RFID_CRC_ENGINE != RFID_CRC_ENGINE_TABLE) && \
+    (RFID_CRC_ENGINE != RFID_CRC_ENGINE_SLICE4) && \
+    (RFID_CRC_ENGINE != RFID_CRC_ENGINE_HW)
+  #error "Invalid RFID_CRC_ENGINE!"
+#endif
+
+/* The reset value of the STM32 CRC unit is fixed to 0xFFFFFFFF */
+#if (RFID_CRC_ENGINE == RFID_CRC_ENGINE_HW) && (RFID_CRC_SEED != 0xFFFFFFFFuL)
+  #error "RFID_CRC_ENGINE_HW requires RFID_CRC_SEED 0xFFFFFFFF!"
+#endif
+
+/**************************************************************************************************
+**   data types
+**************************************************************************************************/
+
+/**************************************************************************************************
+**   global variables
+**************************************************************************************************/
+
+/**************************************************************************************************
+**   function prototypes
+**************************************************************************************************/
+void RFID_CrcInit(void);
+UINT32 RFID_Crc32(const UINT8 *pau8_data, UINT8 u8_len);
+UINT32 RFID_Crc32Update(UINT32 u32_crc, const UINT8 *pau8_data, UINT8 u8_len);
+UINT32 RFID_Crc32Rewind(UINT32 u32_crc, const UINT8 *pau8_data, UINT8 u8_len);
+#endif /* #ifdef RFID_ACTIVE */
+#endif /* #ifndef RFIDCRC_H */
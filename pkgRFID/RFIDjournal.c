@@ -0,0 +1,221 @@
+/**************************************************************************************************
+**    Copyright (C) 2016 HMS Technology Center Ravensburg GmbH, all rights reserved
+***************************************************************************************************
+**
+**        File: RFIDjournal.c
+**     Summary: Ring journal of the RFID tag events (arrival, verification, removal, failure).
+**              The journal is written by the tag read state machine (IRQ Scheduler) and read
+**              without locking by the diagnostic object (Background Task).
+**   $Revision: $
+**       $Date: $
+**     Author: ChSe
+**
+***************************************************************************************************
+***************************************************************************************************
+**
+** Functions: RFID_JournalAdd
+**            RFID_JournalRead
+**            RFID_JournalClear
+**
+***************************************************************************************************
+**    Template Version 5
+**************************************************************************************************/
+
+#ifdef RFID_ACTIVE
+
+/**************************************************************************************************
+**    Include Files
+**************************************************************************************************/
+/* Project header */
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globPreChk.h"
+#include "TIM.h"
+#include "RFIDjournal.h"
+/**************************************************************************************************
+**    global variables
+**************************************************************************************************/
+
+/**************************************************************************************************
+**    static constants, types, macros, variables
+**************************************************************************************************/
+/* Unique file id used to build additional info */
+#define k_FILEID      42u
+
+/* Index mask of the journal ring */
+#define k_JOURNAL_IDX_MASK    (RFID_JOURNAL_SIZE - 1u)
+/* Number of read attempts if the writer overtakes the reader */
+#define k_JOURNAL_READ_TRIES  3u
+
+/** PRE-PROCESSOR CHECK **/
+/* The ring index is derived from the sequence number with a mask */
+/*lint -e(948) */
+IXX_TASSERT(((RFID_JOURNAL_SIZE & k_JOURNAL_IDX_MASK) == 0u), rfidJournal_chk1)
+/*lint -esym(751, IXX_DUMMY_rfidJournal_chk1) not referenced - just for checks */
+
+/* Journal ring, entry of sequence number n is stored at index n & k_JOURNAL_IDX_MASK */
+STATIC volatile t_RFID_JOURNAL_ENTRY as_Journal[RFID_JOURNAL_SIZE];
+/* Sequence number of the next entry (number of written entries, wraps around) */
+STATIC volatile UINT16 u16_JournalWrCnt = 0u;
+/* Sequence number of the oldest entry after RFID_JournalClear */
+STATIC volatile UINT16 u16_JournalBase = 0u;
+
+/**************************************************************************************************
+**    static function prototypes
+**************************************************************************************************/
+
+/**************************************************************************************************
+**    global functions
+**************************************************************************************************/
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_JournalAdd(t_RFID_EVENT e_event, UINT8 u8_detail, UINT32 u32_s2lId,
+**                         UINT32 u32_uidLow, UINT32 u32_durationUs)
+**
+**  Description:
+**    This function adds an entry with the current system time to the journal. The oldest
+**    entry is overwritten. The write counter is incremented after the entry is complete, so a
+**    reader never sees a partly written entry as valid (see RFID_JournalRead).
+**
+**  See also:
+**    RFID_JournalRead
+**  Parameters:
+**    e_event (IN)        - Event type
+**    u8_detail (IN)      - Detail of the event (t_RFID_FAILURE for RFID_EVT_FAILURE)
+**    u32_s2lId (IN)      - S2L ID of the tag, 0 if not known
+**    u32_uidLow (IN)     - Lower 4 bytes of the tag UID
+**    u32_durationUs (IN) - Duration of the event in us
+**
+**  Return value:
+**    -
+**
+**  Remarks:
+**    Context: IRQ Scheduler
+**************************************************************************************************/
+void RFID_JournalAdd(t_RFID_EVENT e_event, UINT8 u8_detail, UINT32 u32_s2lId, UINT32 u32_uidLow,
+                     UINT32 u32_durationUs)
+{
+  UINT16 u16_wrCnt = u16_JournalWrCnt;
+  volatile t_RFID_JOURNAL_ENTRY *ps_entry = &as_Journal[u16_wrCnt & k_JOURNAL_IDX_MASK];
+  UINT32 u32_duration = u32_durationUs >> 7;
+
+  ps_entry->u32_time128us = TIM_TimeGet_128us();
+  ps_entry->u32_s2lId = u32_s2lId;
+  ps_entry->u32_uidLow = u32_uidLow;
+  ps_entry->u16_duration = (u32_duration > 0xFFFFuL) ? 0xFFFFu : (UINT16)u32_duration;
+  ps_entry->u8_event = (UINT8)e_event;
+  ps_entry->u8_detail = u8_detail;
+
+  u16_JournalWrCnt = (UINT16)(u16_wrCnt + 1u);
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_JournalRead(UINT16 *pu16_seq, t_RFID_JOURNAL_ENTRY *pas_entry, UINT8 u8_maxCnt)
+**
+**  Description:
+**    This function copies up to u8_maxCnt entries starting with the given sequence number. If
+**    the requested entry is not available anymore (overwritten or cleared), the copy starts
+**    with the oldest available entry and *pu16_seq is updated accordingly. The sequence number
+**    of the next entry to be requested is *pu16_seq plus the returned number of entries.
+**    No lock is used: the writer interrupts the reader only, so an entry which was overwritten
+**    during the copy is detected with the write counter afterwards and the copy is repeated.
+**
+**  See also:
+**    RFID_JournalAdd
+**  Parameters:
+**    pu16_seq (IN/OUT) - Sequence number of the first requested (IN) and returned (OUT) entry
+**    pas_entry (OUT)   - Buffer for u8_maxCnt entries
+**    u8_maxCnt (IN)    - Maximum number of entries to be copied
+**
+**  Return value:
+**    Number of copied entries
+**
+**  Remarks:
+**    Context: Background Task
+**************************************************************************************************/
+UINT8 RFID_JournalRead(UINT16 *pu16_seq, t_RFID_JOURNAL_ENTRY *pas_entry, UINT8 u8_maxCnt)
+{
+  volatile const t_RFID_JOURNAL_ENTRY *ps_entry;
+  UINT16 u16_wrCnt;
+  UINT16 u16_avail;
+  UINT16 u16_seq = *pu16_seq;
+  UINT8 u8_cnt = 0u;
+  UINT8 u8_try;
+  UINT8 i;
+
+  for (u8_try = 0u; u8_try < k_JOURNAL_READ_TRIES; u8_try++)
+  {
+    u16_wrCnt = u16_JournalWrCnt;
+
+    /* number of available entries, limited by the clear and the ring size */
+    u16_avail = (UINT16)(u16_wrCnt - u16_JournalBase);
+    if (u16_avail > RFID_JOURNAL_SIZE)
+    {
+      u16_avail = RFID_JOURNAL_SIZE;
+    }
+    /* start with the oldest entry if the requested entry is not available */
+    if ((UINT16)(u16_wrCnt - u16_seq) > u16_avail)
+    {
+      u16_seq = (UINT16)(u16_wrCnt - u16_avail);
+    }
+
+    u8_cnt = ((UINT16)(u16_wrCnt - u16_seq) < u8_maxCnt) ? (UINT8)(u16_wrCnt - u16_seq)
+                                                           : u8_maxCnt;
+    for (i = 0u; i < u8_cnt; i++)
+    {
+      ps_entry = &as_Journal[(UINT16)(u16_seq + i) & k_JOURNAL_IDX_MASK];
+      pas_entry[i].u32_time128us = ps_entry->u32_time128us;
+      pas_entry[i].u32_s2lId = ps_entry->u32_s2lId;
+      pas_entry[i].u32_uidLow = ps_entry->u32_uidLow;
+      pas_entry[i].u16_duration = ps_entry->u16_duration;
+      pas_entry[i].u8_event = ps_entry->u8_event;
+      pas_entry[i].u8_detail = ps_entry->u8_detail;
+    }
+
+    /* the copied entries are still valid if the writer did not reach their ring positions */
+    if ((UINT16)(u16_JournalWrCnt - u16_seq) <= RFID_JOURNAL_SIZE)
+    {
+      break;
+    }
+    u8_cnt = 0u;
+  }
+
+  *pu16_seq = u16_seq;
+  return u8_cnt;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_JournalClear(void)
+**
+**  Description:
+**    This function discards all entries. The sequence numbers continue, so a reader which
+**    polls with the next sequence number does not see old entries again.
+**
+**  See also:
+**    RFID_JournalRead
+**  Parameters:
+**    -
+**
+**  Return value:
+**    -
+**
+**  Remarks:
+**    Context: Background Task (IRQs disabled)
+**************************************************************************************************/
+void RFID_JournalClear(void)
+{
+  u16_JournalBase = u16_JournalWrCnt;
+}
+
+/**************************************************************************************************
+**    static functions
+**************************************************************************************************/
+
+#endif /* #ifdef RFID_ACTIVE */
@@ -0,0 +1,69 @@
+/**************************************************************************************************
+**    Copyright (C) 2016 HMS Technology Center Ravensburg GmbH, all rights reserved
+***************************************************************************************************
+**
+**        File: RFIDjournal.h
+**     Summary: Interface of the RFID tag event journal
+**   $Revision: $
+**       $Date: $
+**     Author: ChSe
+**
+***************************************************************************************************
+***************************************************************************************************
+**
+** Functions: RFID_JournalAdd
+**            RFID_JournalRead
+**            RFID_JournalClear
+**
+***************************************************************************************************
+**    Template Version 5
+**************************************************************************************************/
+#ifndef RFIDJOURNAL_H
+#define RFIDJOURNAL_H
+#ifdef RFID_ACTIVE
+/**************************************************************************************************
+**    constants and macros
+**************************************************************************************************/
+/* Number of journal entries, must be a power of 2. The oldest entry is overwritten. */
+#define RFID_JOURNAL_SIZE           32u
+
+/**************************************************************************************************
+**   data types
+**************************************************************************************************/
+/* Journal event types
+ *
+ * RFID_EVT_TAG_ARRIVAL:  A tag was detected after no tag was in front of the reader
+ * RFID_EVT_TAG_VERIFIED: The S2L ID of the tag was verified completely
+ * RFID_EVT_TAG_REMOVAL:  The reader reports no tag after a tag was detected
+ * RFID_EVT_FAILURE:      The tag read failed, the detail contains the t_RFID_FAILURE
+ */
+typedef enum {
+  RFID_EVT_TAG_ARRIVAL,
+  RFID_EVT_TAG_VERIFIED,
+  RFID_EVT_TAG_REMOVAL,
+  RFID_EVT_FAILURE,
+} t_RFID_EVENT;
+
+/* Journal entry */
+typedef struct {
+  UINT32 u32_time128us;                   /* System time (TIM_TimeGet_128us) */
+  UINT32 u32_s2lId;                       /* S2L ID (format of RFID_InfoGet), 0: unknown */
+  UINT32 u32_uidLow;                      /* Lower 4 bytes of the tag UID */
+  UINT16 u16_duration;                    /* Duration of the event in 128 us, saturated */
+  UINT8 u8_event;                         /* t_RFID_EVENT */
+  UINT8 u8_detail;                        /* t_RFID_FAILURE of RFID_EVT_FAILURE, else 0 */
+} t_RFID_JOURNAL_ENTRY;
+
+/**************************************************************************************************
+**   global variables
+**************************************************************************************************/
+
+/**************************************************************************************************
+**   function prototypes
+**************************************************************************************************/
+void RFID_JournalAdd(t_RFID_EVENT e_event, UINT8 u8_detail, UINT32 u32_s2lId, UINT32 u32_uidLow,
+                     UINT32 u32_durationUs);
+UINT8 RFID_JournalRead(UINT16 *pu16_seq, t_RFID_JOURNAL_ENTRY *pas_entry, UINT8 u8_maxCnt);
+void RFID_JournalClear(void);
+#endif /* #ifdef RFID_ACTIVE */
+#endif /* #ifndef RFIDJOURNAL_H */
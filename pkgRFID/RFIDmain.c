@@ -34,11 +34,17 @@
 
 #include "timer-def.h"
 #include "timer-hal.h"
+#include "hist-sys.h"
 
+#include "globPreChk.h"
 #include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
 #include "RFID.h"
+#include "RFIDcrc.h"
+#include "RFIDjournal.h"
 /**************************************************************************************************
 **    global variables
 **************************************************************************************************/
@@ -52,9 +58,19 @@
 #define RFID_DMA_CHANNEL_TX ( DMA1_Channel2 )
 #define RFID_DMA_CHANNEL_RX ( DMA1_Channel3 )
 
+/* Interrupt priority of the USART IDLE line interrupt. The priority is equal to the
+** scheduler interrupt (TIM1), so the state machine and the receive interrupt never preempt
+** each other. */
+#define RFID_IRQ_PRIORITY   ((UINT32)2u)
+
+/* Number of completed frames which can be buffered for the state machine */
+#define RFID_RX_FRAME_CNT   2u
+
 /* Time measurement */
 #define TIMER_START(timer)  timerStart(&s_TimeDurations.timer)
-#define TIMER_STOP(timer)   timerStop(&s_TimeDurations.timer)
+#define TIMER_STOP(timer)   (void)timerStop(&s_TimeDurations.timer)
+/* Stop the timer and add the measured duration to the latency histogram */
+#define TIMER_STOP_HIST(timer, hist)  RFID_HistAdd((hist), timerStop(&s_TimeDurations.timer))
 
 
 
@@ -65,6 +81,12 @@
 #define RFID_EXPEC_RES_VE_LEN 70u
 #define RFID_RES_VE_ERROR_LEN 3u
 
+// Command to change the baud rate of the reader (command, rate code, checksum, ETX)
+#define RFID_CMD_BR_LEN 5u
+/* Rate codes of the change baud rate command (see RFID Reader Manual tdoct3728d_ger.pdf) */
+#define RFID_BAUD_CODE_38400  0x33u   /* ASCII '3' */
+#define RFID_BAUD_CODE_115200 0x35u   /* ASCII '5' */
+
 #define RFID_CMD_SF_LEN 4u
 #define RFID_EXPEC_RES_SF_LEN 11u
 #define RFID_RES_SF_ERROR_LEN 3u
@@ -74,11 +96,58 @@
 #define RFID_EXPEC_RES_SR_LEN 15u
 #define RFID_RES_SR_ERROR_LEN 3u
 
-// CRC-parmeter 
-#define CRC_POLY 0x04C11DB7
-// Only for test purposes, seed is actually a safe configuration parameter
-#define CRC_SEED 0xFFFFFFFF
-#define CRC_XOROUT 0xFFFFFFFF
+// Single Read Words command for an even/odd record pair (status + 2 records + checksum + ETX)
+#define RFID_EXPEC_RES_SR2_LEN (1u + (2u * RFID_REC_TOTAL_LEN) + 2u)
+
+/* Single Read Words command frame:
+** 'S' 'R' <word address: 4 ASCII hex digits> <number of words: 2 ASCII hex digits> <CHCK> <ETX>
+** The frames and their checksums are built by the preprocessor (see the frame tables). */
+#define RFID_CMD_SR_ID0       0x53u   /* ASCII 'S' */
+#define RFID_CMD_SR_ID1       0x52u   /* ASCII 'R' */
+/* Number of bytes of one word of the tag memory */
+#define RFID_WORD_LEN         4u
+#define RFID_REC_WORDS        (RFID_REC_TOTAL_LEN / RFID_WORD_LEN)
+#define RFID_MEM_WORDS        (RFID_MEM_TOTAL_LEN / RFID_WORD_LEN)
+
+/* ASCII hex digit of the nibble of val at bit position shift */
+#define RFID_ASCII_HEX(val, shift) \
+  ((UINT8)((((val) >> (shift)) & 0x0Fu) + (((((val) >> (shift)) & 0x0Fu) < 10u) ? 0x30u : 0x37u)))
+
+/* Checksum of the Single Read Words command (sum of all bytes in front of <CHCK>) */
+#define RFID_SR_CHCK(addr, cnt) \
+  ((UINT8)((RFID_CMD_SR_ID0 + RFID_CMD_SR_ID1 + \
+            RFID_ASCII_HEX((addr), 12u) + RFID_ASCII_HEX((addr), 8u) + \
+            RFID_ASCII_HEX((addr), 4u) + RFID_ASCII_HEX((addr), 0u) + \
+            RFID_ASCII_HEX((cnt), 4u) + RFID_ASCII_HEX((cnt), 0u)) & 0xFFu))
+
+/* Single Read Words command for cnt words starting at the word address addr */
+#define RFID_SR_FRAME(addr, cnt) \
+  {{ RFID_CMD_SR_ID0, RFID_CMD_SR_ID1, \
+     RFID_ASCII_HEX((addr), 12u), RFID_ASCII_HEX((addr), 8u), \
+     RFID_ASCII_HEX((addr), 4u), RFID_ASCII_HEX((addr), 0u), \
+     RFID_ASCII_HEX((cnt), 4u), RFID_ASCII_HEX((cnt), 0u), \
+     RFID_SR_CHCK((addr), (cnt)), RFID_ETX }}
+
+/* Single Read Words command for the record with the sequence number seq */
+#define RFID_SR_FRAME_REC(seq)        RFID_SR_FRAME((seq) * RFID_REC_WORDS, RFID_REC_WORDS)
+/* Single Read Words command for the even record seq and the following odd record */
+#define RFID_SR_FRAME_REC_PAIR(seq)   RFID_SR_FRAME((seq) * RFID_REC_WORDS, 2u * RFID_REC_WORDS)
+
+// Single Read Words command for the full memory (status + memory + checksum + ETX)
+#define RFID_EXPEC_RES_FM_LEN (1u + RFID_MEM_TOTAL_LEN + 2u)
+
+/* USART3 is clocked with PCLK1 = RFID_SYSCLOCK / 2 (see uartInit()) */
+#define RFID_USART_BRR(baud)  ((UINT16)((UINT32)RFID_SYSCLOCK / ((UINT32)(baud) * 2u)))
+
+/** PRE-PROCESSOR CHECK **/
+/* The generated checksums must match the checksums of the reader documentation */
+IXX_TASSERT((RFID_SR_CHCK(0u, RFID_REC_WORDS) == 0xC8u), rfid_chk1)
+IXX_TASSERT((RFID_SR_CHCK(4u * RFID_REC_WORDS, RFID_REC_WORDS) == 0xDBu), rfid_chk2)
+IXX_TASSERT((RFID_SR_CHCK(0u, RFID_MEM_WORDS) == 0xCFu), rfid_chk3)
+
+/* Size of the circular receive buffer. The ring indices are UINT8 and wrap around with the
+** buffer, so the size must be 256. */
+#define RFID_RX_RING_SIZE   256u
 
 typedef struct
 {
@@ -92,10 +161,141 @@ typedef struct
   t_TIME s_BootFirmware;
   t_TIME s_readUid;
   t_TIME s_readRecord;
+  t_TIME s_crcCalc;
+  t_TIME s_tagToValidId;
 } t_TIME_DURATIONS;
 
 t_TIME_DURATIONS s_TimeDurations;
 
+/* Upper bounds of the latency histogram buckets in us, the last bucket has no upper bound */
+STATIC CONST UINT32 au32_rfidHistBound[RFID_HIST_BUCKET_CNT - 1u] =
+{
+  1000uL, 2000uL, 4000uL, 8000uL, 16000uL, 32000uL, 64000uL, 128000uL, 256000uL
+};
+
+/* Latency histograms (see t_RFID_HIST), all buckets of a histogram are halved if one reaches
+** 0xFFFF, and failure counters per t_RFID_FAILURE, saturated at 0xFFFF. Read and reset by the
+** diagnostic object. */
+UINT16 au16_rfidHist[RFID_HIST_CNT][RFID_HIST_BUCKET_CNT];
+UINT16 au16_rfidFailCnt[RFID_FAIL_CNT];
+
+/* Tag was read by the last UID read and end time of this UID response */
+UINT8 u8_rfidTagPresent = 0u;
+UINT32 u32_rfidTagSeenTime = 0uL;
+
+/* Number of states of the tag read state machine */
+#define RFID_STATE_CNT      ((UINT8)RFID_FAIL_SAFE + 1u)
+
+/* Number of RFID_ReadTag() calls per state, shows where the read cycles spend their time */
+UINT32 au32_rfidStateCycles[RFID_STATE_CNT];
+
+/* A tag was detected and its S2L ID is not published yet (s_tagToValidId is running) */
+UINT8 u8_rfidValidIdPending = 0u;
+
+/* Verified tag cache */
+typedef struct
+{
+  UINT8 u8_valid;                           /* Cache entry is valid */
+  UINT8 au8_tag_uid[RFID_UID_LEN];          /* Tag UID */
+  UINT8 au8_s2l_id[RFID_S2L_ID_LEN];        /* S2L ID of the even records */
+  UINT32 u32_verifyTime;                    /* Time of the complete verification */
+} t_RFID_TAG_CACHE;
+
+/* Command frame of the Single Read Words command */
+typedef struct
+{
+  UINT8 au8_frame[RFID_CMD_SR_LEN];
+} t_RFID_CMD_FRAME;
+
+/* Single Read Words commands for the single records, index: sequence number */
+STATIC CONST t_RFID_CMD_FRAME as_rfidCmdReadRecord[RFID_REC_COUNT] =
+{
+  RFID_SR_FRAME_REC(0u), RFID_SR_FRAME_REC(1u), RFID_SR_FRAME_REC(2u), RFID_SR_FRAME_REC(3u),
+  RFID_SR_FRAME_REC(4u), RFID_SR_FRAME_REC(5u), RFID_SR_FRAME_REC(6u), RFID_SR_FRAME_REC(7u)
+};
+
+/* Single Read Words commands for the even/odd record pairs, index: sequence number / 2 */
+STATIC CONST t_RFID_CMD_FRAME as_rfidCmdReadRecordPair[RFID_REC_COUNT / 2u] =
+{
+  RFID_SR_FRAME_REC_PAIR(0u), RFID_SR_FRAME_REC_PAIR(2u),
+  RFID_SR_FRAME_REC_PAIR(4u), RFID_SR_FRAME_REC_PAIR(6u)
+};
+
+/* Single Read Words command for the complete memory incl. the memory CRC */
+STATIC CONST t_RFID_CMD_FRAME s_rfidCmdReadFullMemory = RFID_SR_FRAME(0u, RFID_MEM_WORDS);
+
+/* Completed receive frame */
+typedef struct
+{
+  UINT8 u8_start;                     /* Start index of the frame in the receive ring */
+  UINT8 u8_len;                       /* Length of the received frame */
+  UINT8 u8_chained;                   /* Next command was sent by the receive interrupt */
+  UINT32 u32_time;                    /* End of the frame (system time 3) */
+} t_RFID_RX_FRAME;
+
+/* Receive control, shared between the receive interrupt and the state machine */
+typedef struct
+{
+  UINT8 u8_active;                    /* Frame is expected and not yet complete */
+  UINT8 u8_expLen;                    /* Expected length of the frame */
+  UINT8 u8_frameStart;                /* Start index of the current frame in the receive ring */
+  UINT8 u8_scanPos;                   /* Next index to be scanned by the frame extraction */
+  UINT8 u8_scanSum;                   /* Sum of the scanned bytes of the current frame */
+  UINT8 u8_scanPrev;                  /* Last scanned byte of the current frame */
+  UINT8 u8_wrCnt;                     /* Number of completed frames (written by the interrupt) */
+  UINT8 u8_rdCnt;                     /* Number of fetched frames (written by the state machine) */
+  t_RFID_RX_FRAME as_frame[RFID_RX_FRAME_CNT];
+  const t_RFID_CMD_FRAME *ps_chainCmd; /* Command which is sent on a positive response */
+  UINT8 u8_chainLen;                  /* Expected response length of the chained command */
+} t_RFID_RX_CTRL;
+
+volatile t_RFID_RX_CTRL s_rfidRxCtrl;
+
+/* Cross-channel digest of a completely verified record pair (see RFID_DigestSend). The record
+** CRCs are transferred as read from the tag (MSB first). */
+typedef struct
+{
+  UINT8 au8_s2lId[RFID_S2L_ID_LEN];       /* S2L ID of the even record */
+  UINT8 au8_crcEven[RFID_RECORD_CRC_LEN]; /* R_CRC of the even record */
+  UINT8 au8_crcOdd[RFID_RECORD_CRC_LEN];  /* R_CRC of the odd record */
+  UINT8 au8_uidHash[2];                   /* Lower 16 bit of the CRC register after the UID */
+  UINT8 u8_seqNum;                        /* Bit 0..3: even, bit 4..7: odd sequence number */
+  UINT8 u8_ctrl;                          /* Bit 0..1: first used byte of the odd S2L ID,
+                                          ** bit 2..7: digest counter */
+} t_RFID_DIGEST;
+
+/* Coding of t_RFID_DIGEST.u8_ctrl */
+#define RFID_DIGEST_FIRST_MASK    0x03u
+#define RFID_DIGEST_CNT_SHIFT     2u
+#define RFID_DIGEST_CNT_MASK      0x3Fu
+/* Coding of the verdict of controller 2 (see RFID_DigestAckGet): bit 0..5 digest counter,
+** bit 7 set if the digest was confirmed */
+#define RFID_DIGEST_ACK_OK        0x80u
+/* Record data after the UID which is covered by the R_CRC (sequence number, reserved, S2L ID) */
+#define RFID_DIGEST_TRAILER_LEN   (RFID_SEQ_NUM_LEN + RFID_RES_LEN + RFID_S2L_ID_LEN)
+
+/* The digest is transferred with one IPC telegram */
+/*lint -e(948) */
+IXX_TASSERT((sizeof(t_RFID_DIGEST) <= IPCXSYS_SIZEOF_MAX_PAYLOAD), rfid_chk4)
+/*lint -esym(751, IXX_DUMMY_rfid_chk4) not referenced - just for checks */
+
+/* Digest of the last verified record pair (controller 1) or received digest (controller 2) */
+t_RFID_DIGEST s_rfidDigest;
+/* Counter of the built digests (controller 1) */
+UINT8 u8_rfidDigestCnt = 0u;
+/* Digest counter of the last IO telegram, sent (controller 1) or received (controller 2) */
+UINT8 u8_rfidDigestCntIpc = 0u;
+/* Digest counter of the last exchanged digest */
+UINT8 u8_rfidDigestCntDone = 0u;
+/* The digest is exchanged in the current scheduler cycle */
+UINT8 u8_rfidDigestXfer = 0u;
+/* S2L ID (format of u32_RfidInfo) of the last digest which was confirmed by both controllers */
+UINT32 u32_rfidDigestInfo = 0uL;
+/* A digest was built for the current read, i.e. since the last RFID_InfoReset (controller 1) */
+UINT8 u8_rfidDigestCur = 0u;
+/* Verdict of controller 2 on the last checked digest, coded as RFID_DIGEST_ACK_OK | counter */
+UINT8 u8_rfidDigestAck = 0u;
+
 UINT32 u32_elapsedRunTime = 0uL;
 /* Transmit and Receive DMA buffer which are used from the DMA. These buffers are
 ** attached the DMA buffer section in the RAM. This is a specified section in the
@@ -105,7 +305,17 @@ UINT32 u32_elapsedRunTime = 0uL;
 ** The DMA buffer section is not under the control of the RAM Test!
 */
 UINT8 au8_rfidDmaBufferTx[255] __attribute__((section("DMA_BUFFER_SECTION")));
-UINT8 au8_rfidDmaBufferRx[255] __attribute__((section("DMA_BUFFER_SECTION")));
+/* The receive buffer is a ring which is written continuously by the DMA (circular mode) */
+UINT8 au8_rfidDmaBufferRx[RFID_RX_RING_SIZE] __attribute__((section("DMA_BUFFER_SECTION")));
+
+/* Linear copy of a received frame which wraps around the end of the receive ring, also the copy
+** of the full memory frame which is checked after it was fetched (CHECK_FULL_MEM) */
+UINT8 au8_rfidRxFrameCopy[RFID_EXPEC_RES_FM_LEN];
+
+/* Data, chain flag and end time of the last frame fetched by the state machine */
+const UINT8 *pau8_rfidRxFrame = NULL;
+UINT8 u8_rfidRxFrameChained = 0u;
+UINT32 u32_rfidRxFrameTime = 0uL;
 
 /* RFID reader access state */
 
@@ -126,9 +336,44 @@ UINT8 u8_OddSequenceNumber = 1u;
 t_RFID_TAG_DATA s_rfidTagRecordEven;
 t_RFID_TAG_DATA s_rfidTagRecordOdd;
 
+/* Read mode which is used after the next successful UID read */
+t_RFID_READ_MODE e_rfidReadMode = RFID_READ_MODE_DEFAULT;
+/* Read mode of the current read cycle */
+t_RFID_READ_MODE e_rfidCycleReadMode = RFID_READ_MODE_DEFAULT;
+
+/* Verified tag cache: UID and S2L ID of the last completely verified tag. As long as the same
+** tag is in front of the reader, only one record (spot check) is read per cycle. The spot
+** check record rotates through all records. After RFID_TAG_CACHE_MAX_AGE the tag is
+** verified completely again. */
+t_RFID_TAG_CACHE s_rfidTagCache;
+/* Current read cycle is a spot check */
+UINT8 u8_rfidSpotCheck = 0u;
+/* Sequence number of the spot check record */
+UINT8 u8_rfidSpotSeqNum = 0u;
+
 /* Store the lower 4 bytes of the RFID tag UID */
 UINT32 u32_RfidInfo = 0uL;
 
+/* Active baud rate of the reader and the UART */
+UINT32 u32_rfidBaudRate = RFID_38400_BAUDRATE;
+/* The version command is sent with RFID_BAUD_TARGET to verify the new baud rate */
+UINT8 u8_rfidBaudTrial = 0u;
+/* The negotiation failed, the reader is used with RFID_38400_BAUDRATE */
+UINT8 u8_rfidBaudFallback = 0u;
+/* Consecutive UID timeouts, see RFID_BAUD_RESYNC_TIMEOUTS */
+UINT8 u8_rfidUidTimeoutCnt = 0u;
+
+/* Adaptive poll rate: current UID poll interval (0: full rate), start of the last UID read and
+** number of consecutive "no tag" responses */
+UINT32 u32_rfidPollInterval = 0uL;
+UINT32 u32_rfidPollLast = 0uL;
+UINT8 u8_rfidNoTagCnt = 0u;
+/* Duty cycle: RFID_ReadTag() calls of the current window, calls which were not idle and the
+** result of the last window in per mille */
+UINT16 u16_rfidDutyCalls = 0u;
+UINT16 u16_rfidDutyActive = 0u;
+UINT16 u16_rfidDutyPermille = 1000u;
+
 /* RFID information */
 
 /**************************************************************************************************
@@ -139,16 +384,9 @@ UINT32 u32_RfidInfo = 0uL;
 
 /* RFID Commands */
 STATIC void RFID_BootReader(void);
+STATIC void RFID_FrameTxSetBaud(UINT8 u8_rateCode);
 STATIC void RFID_FrameTxSingleReadFixCode(void);
-STATIC void RFID_FrameTxReadRecord_0(void);
-STATIC void RFID_FrameTxReadRecord_1(void);
-STATIC void RFID_FrameTxReadRecord_2(void);
-STATIC void RFID_FrameTxReadRecord_3(void);
-STATIC void RFID_FrameTxReadRecord_4(void);
-STATIC void RFID_FrameTxReadRecord_5(void);
-STATIC void RFID_FrameTxReadRecord_6(void);
-STATIC void RFID_FrameTxReadRecord_7(void);
-STATIC void RFID_FrameTxReadFullMemory(void);
+STATIC void RFID_FrameTxCmd(const t_RFID_CMD_FRAME *ps_cmd);
 
 /* RFID Response verification  */
 STATIC UINT8 RFID_VerifySWVersion(const UINT8 *buffer);
@@ -163,18 +401,45 @@ STATIC UINT8 RFID_ResLength(const UINT8 *buffer, UINT8 maxLength);
 STATIC UINT32 RFID_CalculateCRC(t_RFID_TAG_DATA *s_rfidTagData);
 STATIC UINT8 RFID_CheckTagRecordFields(void);
 STATIC UINT8 RFID_CheckS2LID(void);
+STATIC UINT8 RFID_VerifyFullMemory(const UINT8 *buffer);
+STATIC UINT8 RFID_VerifyRecordPair(const UINT8 *buffer, UINT8 u8_len);
+STATIC t_RFID_FAILURE RFID_CheckFullMemory(const UINT8 *buffer);
+STATIC void RFID_TagCacheStore(void);
+STATIC void RFID_TagCacheInvalidate(void);
+STATIC UINT8 RFID_TagCacheUsable(void);
+STATIC UINT8 RFID_TagCacheMatch(const UINT8 *pau8_tagUid);
 /* Utility functions */
 STATIC void uartInit(void);
 STATIC void uartInitDmaTx(void);
 STATIC void uartInitDmaRx(void);
 STATIC void RFID_FrameTxTrigger(UINT8 u8_len);
 STATIC void RFID_FrameRxInit(UINT8 u8_len);
+STATIC void RFID_FrameRxExtract(void);
+STATIC void RFID_FrameRxChain(const t_RFID_CMD_FRAME *ps_cmd, UINT8 u8_len);
+STATIC void RFID_FrameRxComplete(UINT8 u8_len, UINT8 u8_chkOk);
+STATIC const UINT8 *RFID_FrameRxGet(UINT8 *pu8_len);
+STATIC UINT8 RFID_FrameRxChained(void);
+STATIC UINT8 RFID_FrameRxPending(void);
+STATIC const t_RFID_CMD_FRAME *RFID_CmdReadRecord(UINT8 u8_seqNum);
+STATIC const t_RFID_CMD_FRAME *RFID_CmdReadRotation(void);
+STATIC void uartInitIrq(void);
+STATIC void uartBaudSet(UINT32 u32_baud);
+STATIC void RFID_BaudFallback(void);
+STATIC void RFID_BaudResync(void);
+STATIC void RFID_PollBackoff(UINT8 u8_tagPresent);
+STATIC void RFID_PollDutyUpdate(UINT8 u8_active);
 STATIC void RFID_DetermineNextRecords(void);
 STATIC void RFID_PurgeOutdatedTagData(void);
 STATIC void RFID_HandleFailure(t_RFID_FAILURE e_failure);
 STATIC void timerStart(t_TIME *ps_timer);
-STATIC void timerStop(t_TIME *ps_timer);
-STATIC UINT32 CRC32(const UINT8* data, UINT8 length);
+STATIC UINT32 timerStop(t_TIME *ps_timer);
+STATIC void RFID_HistAdd(t_RFID_HIST e_hist, UINT32 u32_time);
+STATIC void RFID_FailCntInc(t_RFID_FAILURE e_failure);
+STATIC UINT32 RFID_UidLowGet(void);
+STATIC void RFID_InfoReset(void);
+STATIC void RFID_DigestBuild(void);
+STATIC UINT8 RFID_DigestCheck(void);
+STATIC void RFID_DigestTrailer(UINT8 *pau8_trailer, UINT8 u8_seqNum, const UINT8 *pau8_s2lId);
 
 /**************************************************************************************************
 **    global functions
@@ -200,6 +465,10 @@ STATIC UINT32 CRC32(const UINT8* data, UINT8 length);
 void RFID_Init(void)
 {
   TIMER_START(s_RFIDRunTime);
+  /* Initialize the record CRC engine incl. known answer test, both controllers check the
+  ** record CRCs (see RFID_DigestRecv) */
+  RFID_CrcInit();
+
   /* Initialize the RFID reader */
   if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_1)
   {
@@ -208,6 +477,8 @@ void RFID_Init(void)
 
     uartInitDmaTx();
     uartInitDmaRx();
+    uartInitIrq();
+    RFID_TagCacheInvalidate();
     e_rfidAccessState = TX_BOOT_FIRMWARE;
   }
 }
@@ -219,6 +490,10 @@ void RFID_Init(void)
 **
 **  Description:
 **    This function returns the UID of the verified RFID tag.
+**    The value is only returned after its digest was confirmed by both controllers (see
+**    RFID_DigestRecv), until then 0 is returned. Controller 1 only accepts the confirmation of
+**    a digest of the current read (see RFID_DigestAckSet), controller 2 only releases the
+**    value sent by controller 1.
 **
 **  See also:
 **    -
@@ -229,7 +504,7 @@ void RFID_Init(void)
 **************************************************************************************************/
 UINT32 RFID_InfoGet(void)
 {
-  return u32_RfidInfo;
+  return (u32_RfidInfo == u32_rfidDigestInfo) ? u32_RfidInfo : 0uL;
 }
 
 /**************************************************************************************************
@@ -256,292 +531,971 @@ void RFID_InfoSet(UINT32 u32_rfidInfo)
 /**************************************************************************************************
 **
 **  Function:
-**    void RFID_Reader_Boot(void)
+**    UINT8 RFID_DigestCntGet(void)
 **
 **  Description:
-**    This function processes the RFID reader.
+**    This function returns the counter of the last built digest (controller 1). The counter
+**    is sent with the IO telegram, so both controllers know whether a new digest has to be
+**    exchanged. The returned value is stored as the counter of the last IO telegram.
+**
+**  See also:
+**    RFID_DigestCntSet, RFID_DigestSend
+**  Parameters:
+**    -
+**  Return value:
+**    Digest counter
+**************************************************************************************************/
+UINT8 RFID_DigestCntGet(void)
+{
+  u8_rfidDigestCntIpc = u8_rfidDigestCnt;
+  return u8_rfidDigestCntIpc;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DigestCntSet(UINT8 u8_cnt)
+**
+**  Description:
+**    This function stores the digest counter received with the IO telegram (controller 2).
 **
 **  See also:
+**    RFID_DigestCntGet, RFID_DigestSend
+**  Parameters:
+**    u8_cnt (IN) - Digest counter of controller 1
+**  Return value:
 **    -
+**************************************************************************************************/
+void RFID_DigestCntSet(UINT8 u8_cnt)
+{
+  u8_rfidDigestCntIpc = u8_cnt;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_DigestAckGet(void)
+**
+**  Description:
+**    This function returns the verdict on the last checked digest (controller 2). The verdict
+**    is sent back with the IO telegram, the digest exchange itself transfers in both
+**    directions at the same time and cannot carry it.
 **
+**  See also:
+**    RFID_DigestAckSet, RFID_DigestRecv
 **  Parameters:
 **    -
+**  Return value:
+**    Digest counter of the last checked digest, RFID_DIGEST_ACK_OK set if it was confirmed
+**************************************************************************************************/
+UINT8 RFID_DigestAckGet(void)
+{
+  return u8_rfidDigestAck;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DigestAckSet(UINT8 u8_ack)
+**
+**  Description:
+**    This function evaluates the verdict of controller 2 received with the IO telegram
+**    (controller 1). Only the verdict on the last built digest of the current read is taken
+**    into account, so a confirmation of an earlier read (e.g. before the tag was removed and
+**    put back) does not release the S2L ID. A confirmed digest releases its S2L ID, a rejected
+**    digest withdraws it. After a rejection the tag cache is invalidated, so the next read
+**    cycle verifies the tag completely and builds a new digest.
 **
+**  See also:
+**    RFID_DigestAckGet, RFID_InfoGet
+**  Parameters:
+**    u8_ack (IN) - Verdict of controller 2, see RFID_DigestAckGet
 **  Return value:
 **    -
 **************************************************************************************************/
-void RFID_Reader_Boot(void)
+void RFID_DigestAckSet(UINT8 u8_ack)
 {
-  switch (e_rfidAccessState)
+  UINT32 u32_info = 0uL;
+  UINT8 i;
+
+  if ((u8_rfidDigestCur != 0u) &&
+      ((u8_ack & RFID_DIGEST_CNT_MASK) == u8_rfidDigestCnt))
   {
-    case TX_BOOT_FIRMWARE:    
+    if ((u8_ack & RFID_DIGEST_ACK_OK) != 0u)
     {
-      //u32_funcCallCount = 0u;
-      TIMER_START(s_BootFirmware);
-      RFID_BootReader();
-      RFID_FrameRxInit(RFID_EXPEC_RES_VE_LEN);
-      e_rfidAccessState = RX_BOOT_FIRMWARE;
-      break;
-    }
-    case RX_BOOT_FIRMWARE:
-    { 
-      //u32_funcCallCount++;
-      // Function calls * t100 time slice is 100 us
-      //UINT32 u32_timeElapsed = u32_funcCallCount * T100_TIME_SLICE_US;
-
-      UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_BootFirmware.u32_cur;
-      // Wait for the DMA transfer to complete
-      if (RFID_DMA_CHANNEL_RX->CNDTR == 0)
-      {
-        TIMER_STOP(s_BootFirmware);
-        if (RFID_VerifySWVersion(au8_rfidDmaBufferRx) == RFID_OK)
-        {
-          e_rfidAccessState = TX_READ_UID;
-        }
-        else
-        {
-          RFID_HandleFailure(RFID_FAIL_BOOT_READER);
-        }
-      }
-      else if (u32_elapsed > RFID_BOOT_READER_TIMEOUT)
+      /* same byte order as RFID_CheckTagRecordFields */
+      for (i = 0u; i < RFID_S2L_ID_LEN; i++)
       {
-        // Timeout occurred, handle failure
-        RFID_HandleFailure(RFID_FAIL_BOOT_READER_TIMEOUT);
+        u32_info |= ((UINT32)s_rfidDigest.au8_s2lId[i]) << (8u * i);
       }
-      break; 
     }
-    default:
+    else
     {
-      break;
+      /* The S2L ID is withdrawn, further verdicts on this digest are ignored */
+      u8_rfidDigestCur = 0u;
+      RFID_TagCacheInvalidate();
     }
+    u32_rfidDigestInfo = u32_info;
+  }
+  else
+  {
+    /* verdict on an earlier digest, ignored */
   }
 }
 
 /**************************************************************************************************
 **
 **  Function:
-**    void RFID_ReadTag(void)
+**    void RFID_DigestSend(void)
 **
 **  Description:
-**    This function implements the state machine for reading the RFID tag.
+**    This function sends the digest of the last verified record pair to the other controller.
+**    The digest is only exchanged if the digest counter of the last IO telegram differs from
+**    the counter of the last exchanged digest. Both controllers know this counter, so both
+**    call the IPC in the same time slice. The IPC transfers in both directions, controller 2
+**    sends an empty digest.
 **
 **  See also:
-**    -
+**    RFID_DigestRecv
 **  Parameters:
 **    -
 **  Return value:
-**    RFID_OK (0) - Response is OK
+**    -
+**
+**  Remarks:
+**    Context: IRQ Scheduler
 **************************************************************************************************/
- void RFID_ReadTag(void)
- {
+void RFID_DigestSend(void)
+{
+  t_RFID_DIGEST s_empty = {{0u}, {0u}, {0u}, {0u}, 0u, 0u};
+  const t_RFID_DIGEST *ps_digest = &s_empty;
 
-   t_RFID_RAW_DATA s_rfidRawData;
-   t_RFID_TAG_DATA s_rfidTagData;
+  u8_rfidDigestXfer = (u8_rfidDigestCntIpc != u8_rfidDigestCntDone) ? 1u : 0u;
+  if (u8_rfidDigestXfer != 0u)
+  {
+    if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_1)
+    {
+      ps_digest = &s_rfidDigest;
+    }
+    ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_RFID_DIGEST, (UINT8)sizeof(t_RFID_DIGEST),
+                       (CONST UINT8*)ps_digest);
+  }
+}
 
-   u32_elapsedRunTime = timerHAL_GetSystemTime3() - s_TimeDurations.s_RFIDRunTime.u32_cur;
-   /* Reset Failercount and runtime after 1 hour*/
-   if (u32_elapsedRunTime > RFID_TICKS_PER_HOUR_TEST)
-   {
-      TIMER_STOP(s_RFIDRunTime);
-      u8_rfidFailureCount = 0u;
-      u32_elapsedRunTime = 0uL;
-      TIMER_START(s_RFIDRunTime);
-   }
-   /* Check if failure count exceeds maximum allowed */
-   if (u8_rfidFailureCount  > RFID_MAX_FAILURE_COUNT)
-   {
-      e_rfidAccessState = RFID_FAIL_SAFE;
-   }
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DigestRecv(void)
+**
+**  Description:
+**    This function receives the digest sent with RFID_DigestSend. Controller 2 checks the
+**    record CRCs and the complement relationship of the S2L IDs independently of controller 1
+**    and stores its verdict for the next IO telegram (see RFID_DigestAckGet). The S2L ID of a
+**    confirmed digest is released by RFID_InfoGet on both controllers, a rejected digest
+**    withdraws the S2L ID on both controllers. Controller 1 only completes the exchange, it
+**    releases the S2L ID when the verdict arrives (see RFID_DigestAckSet).
+**
+**  See also:
+**    RFID_DigestSend, RFID_DigestAckSet
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**
+**  Remarks:
+**    Context: IRQ Scheduler
+**************************************************************************************************/
+void RFID_DigestRecv(void)
+{
+  t_RFID_DIGEST s_rxDigest;
+  UINT32 u32_info = 0uL;
+  UINT8 u8_res;
+  UINT8 u8_ack;
+  UINT8 i;
 
-   switch (e_rfidAccessState)
-   {
-     case TX_READ_UID:
-     {
-        /* Determine the current sequence number for reading records */
-        RFID_DetermineNextRecords();
-        TIMER_START(s_readUid);
-        RFID_FrameTxSingleReadFixCode();
-        RFID_FrameRxInit(RFID_EXPEC_RES_SF_LEN);
-        e_rfidAccessState = RX_READ_UID;
-        break;
-     }
-     case RX_READ_UID:
-     {
-        UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readUid.u32_cur;
-        UINT8 dma_rx_len = RFID_EXPEC_RES_SF_LEN - RFID_DMA_CHANNEL_RX->CNDTR;
+  if (u8_rfidDigestXfer != 0u)
+  {
+    u8_rfidDigestXfer = 0u;
+    u8_rfidDigestCntDone = u8_rfidDigestCntIpc;
+    ipcxSYS_GetBufferinclWait(IPCXSYS_IPC_ID_RFID_DIGEST, (UINT8)sizeof(t_RFID_DIGEST),
+                              (UINT8*)&s_rxDigest);
 
-        if (dma_rx_len >= RFID_ERROR_RES_LEN)
-        //if (RFID_DMA_CHANNEL_RX->CNDTR == 0) 
-        {
-          if (au8_rfidDmaBufferRx[dma_rx_len -1u] == RFID_ETX) // Check for ETX
-          {
-            TIMER_STOP(s_readUid);
-            // Verify the received Single Read Fix Code message
-            UINT8 res = RFID_VerifySingleReadFixCode(au8_rfidDmaBufferRx, &s_rfidRawData);
-            if( res == RFID_OK)
-            {
-              RFID_ParseSingleFixCode(&s_rfidRawData, &s_rfidTagData);
-              /* Copy Fix Code and store it in both records for R_CRC calculation */
-              UINT8 i;
-              for (i = 0; i < RFID_UID_LEN; i++)
-              {
-                s_rfidTagRecordEven.au8_tag_uid[i] = s_rfidTagData.au8_tag_uid[i];
-                s_rfidTagRecordOdd.au8_tag_uid[i] = s_rfidTagData.au8_tag_uid[i];
-              }
-              // Tag found, proceed to read the even record
-              e_rfidAccessState = TX_READ_REC_EVEN;
-            }
-            else if (res == RFID_NO_TAG)
-            {
-                // No tag detected, retry reading
-                e_rfidAccessState = TX_READ_UID;
-                // Reset the RFID information
-                u32_RfidInfo = 0uL; 
-                RFID_PurgeOutdatedTagData();
-            }
-            else
-            {
-              /* Handle failure */
-              RFID_HandleFailure(RFID_FAIL_UID_VERIFY);
-            } 
-          }
-        }
-        else 
-        {
-          // Check for timeout
-          if (u32_elapsed > RFID_READ_UID_TIMEOUT)
-          {
-            // Timeout occurred, go back to retry reading UID
-            e_rfidAccessState = TX_READ_UID;
-            /* Reset the RFID information */
-            u32_RfidInfo = 0uL;
-            RFID_PurgeOutdatedTagData();
-          }
+    if (cfgSYS_GetControllerID() == SAFETY_CONTROLLER_2)
+    {
+      s_rfidDigest = s_rxDigest;
+      u8_res = RFID_DigestCheck();
+      u8_ack = (UINT8)(u8_rfidDigestCntIpc & RFID_DIGEST_CNT_MASK);
 
-        }
-      break;
-     }
-     case TX_READ_REC_EVEN: 
-     {  
-        TIMER_START(s_readRecord);
-        if (u8_SequenceNumber == 0u)
-        {
-          RFID_FrameTxReadRecord_0();
-        }
-        else if (u8_SequenceNumber == 2u)
-        {
-          RFID_FrameTxReadRecord_2();
-        }
-        else if (u8_SequenceNumber == 4u)
-        {
-          RFID_FrameTxReadRecord_4();
-        }
-        else if (u8_SequenceNumber == 6u)
-        {
-          RFID_FrameTxReadRecord_6();
-        }
-        else
-        {
-          // Invalid sequence number, handle failure
-          RFID_HandleFailure(RFID_FAIL_INVALID_SEQ_NUM);
-        }
-        RFID_FrameRxInit(RFID_EXPEC_RES_SR_LEN);
-        e_rfidAccessState = RX_READ_REC_EVEN;
-        break;  
-     }
-     case RX_READ_REC_EVEN:
-     {
-      UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readRecord.u32_cur;
-      if (RFID_DMA_CHANNEL_RX->CNDTR == 0) 
+      if (u8_res == RFID_OK)
       {
-        TIMER_STOP(s_readRecord);
-        if (RFID_VerifySingleReadWord(au8_rfidDmaBufferRx, &s_rfidRawData) == RFID_OK)
-        { 
-          if (RFID_ParseRecord(&s_rfidRawData, &s_rfidTagRecordEven) == RFID_OK)
-          {
-            e_rfidAccessState = CHECK_REC_EVEN;
-          }
-          else
-          {
-            RFID_HandleFailure(RFID_FAIL_EVEN_REC_VERIFY);
-          }
-        } 
-        else
+        /* same byte order as RFID_CheckTagRecordFields */
+        for (i = 0u; i < RFID_S2L_ID_LEN; i++)
         {
-          RFID_HandleFailure(RFID_FAIL_EVEN_REC_VERIFY);
+          u32_info |= ((UINT32)s_rfidDigest.au8_s2lId[i]) << (8u * i);
         }
+        u8_ack |= RFID_DIGEST_ACK_OK;
       }
       else
       {
-        // Check for timeout
-        if (u32_elapsed > RFID_READ_REC_TIMEOUT)
-        {
-          // Timeout occurred, go back to retry reading UID
-          e_rfidAccessState = TX_READ_UID;
-          /* Reset the RFID information */
-          u32_RfidInfo = 0uL;
-          RFID_PurgeOutdatedTagData();
-        }
+        RFID_FailCntInc(RFID_FAIL_DIGEST_VERIFY);
       }
-      break;
-     }
-     case CHECK_REC_EVEN:
-     {
-        /* Check expected sequence number and CRC for the even record */
-        if (u8_SequenceNumber == s_rfidTagRecordEven.u8_seq_num)
-        {
-          // Sequence number matches, proceed to check CRC
-          if (RFID_CalculateCRC(&s_rfidTagRecordEven) == RFID_OK)
-          {
-            e_rfidAccessState = TX_READ_REC_ODD;
-          }
-          else
-          {
-            RFID_HandleFailure(RFID_FAIL_EVEN_REC_CRC_ERROR);
+      u32_rfidDigestInfo = u32_info;
+      u8_rfidDigestAck = u8_ack;
+    }
+    else
+    {
+      /* empty branch, controller 1 waits for the verdict of controller 2 */
+    }
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_ReadModeSet(t_RFID_READ_MODE e_mode)
+**
+**  Description:
+**    This function selects the read mode of the tag records. The new mode is used with the
+**    next read cycle, a running read sequence is not interrupted.
+**    Invalid modes are ignored.
+**
+**  See also:
+**    RFID_ReadModeGet
+**  Parameters:
+**    e_mode (IN) - The new read mode
+**  Return value:
+**    -
+**************************************************************************************************/
+void RFID_ReadModeSet(t_RFID_READ_MODE e_mode)
+{
+  if ((e_mode == RFID_READ_MODE_ROTATION) || (e_mode == RFID_READ_MODE_FULL_MEMORY))
+  {
+    e_rfidReadMode = e_mode;
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    t_RFID_READ_MODE RFID_ReadModeGet(void)
+**
+**  Description:
+**    This function returns the selected read mode of the tag records.
+**
+**  See also:
+**    RFID_ReadModeSet
+**  Parameters:
+**    -
+**  Return value:
+**    e_rfidReadMode - The selected read mode
+**************************************************************************************************/
+t_RFID_READ_MODE RFID_ReadModeGet(void)
+{
+  return e_rfidReadMode;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT32 RFID_BaudRateGet(void)
+**
+**  Description:
+**    This function returns the baud rate which is used for the communication with the reader.
+**
+**  See also:
+**    -
+**  Parameters:
+**    -
+**  Return value:
+**    u32_rfidBaudRate - Active baud rate
+**************************************************************************************************/
+UINT32 RFID_BaudRateGet(void)
+{
+  return u32_rfidBaudRate;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT32 RFID_PollIntervalGet(void)
+**
+**  Description:
+**    This function returns the current interval of the UID polling.
+**
+**  See also:
+**    RFID_PollDutyGet
+**  Parameters:
+**    -
+**  Return value:
+**    u32_rfidPollInterval - Poll interval in us, 0: every cycle (full rate)
+**************************************************************************************************/
+UINT32 RFID_PollIntervalGet(void)
+{
+  return u32_rfidPollInterval;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT16 RFID_PollDutyGet(void)
+**
+**  Description:
+**    This function returns the duty cycle of the tag read state machine of the last measurement
+**    window (RFID_POLL_DUTY_WINDOW calls), i.e. the part of the RFID_ReadTag() calls which were
+**    not idle because of the adaptive poll rate.
+**
+**  See also:
+**    RFID_PollIntervalGet
+**  Parameters:
+**    -
+**  Return value:
+**    u16_rfidDutyPermille - Duty cycle in per mille
+**************************************************************************************************/
+UINT16 RFID_PollDutyGet(void)
+{
+  return u16_rfidDutyPermille;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DiagHistGet(t_RFID_HIST e_hist, UINT16 *pau16_bucket)
+**
+**  Description:
+**    This function copies the buckets of a latency histogram. The caller must lock the
+**    interrupts, the histograms are written in the time slice.
+**
+**  See also:
+**    RFID_DiagReset
+**  Parameters:
+**    e_hist (IN)        - Requested histogram
+**    pau16_bucket (OUT) - Array of RFID_HIST_BUCKET_CNT counters
+**  Return value:
+**    -
+**************************************************************************************************/
+void RFID_DiagHistGet(t_RFID_HIST e_hist, UINT16 *pau16_bucket)
+{
+  UINT8 i;
+
+  for (i = 0u; i < RFID_HIST_BUCKET_CNT; i++)
+  {
+    pau16_bucket[i] = (e_hist < RFID_HIST_CNT) ? au16_rfidHist[e_hist][i] : 0u;
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_DiagFailCntGet(UINT8 u8_first, UINT16 *pau16_cnt, UINT8 u8_maxCnt)
+**
+**  Description:
+**    This function copies the failure counters starting with the failure type u8_first. The
+**    caller must lock the interrupts, the counters are written in the time slice.
+**
+**  See also:
+**    RFID_DiagReset
+**  Parameters:
+**    u8_first (IN)   - First failure type (t_RFID_FAILURE)
+**    pau16_cnt (OUT) - Array for the counters
+**    u8_maxCnt (IN)  - Size of the array
+**  Return value:
+**    Number of copied counters
+**************************************************************************************************/
+UINT8 RFID_DiagFailCntGet(UINT8 u8_first, UINT16 *pau16_cnt, UINT8 u8_maxCnt)
+{
+  UINT8 i;
+
+  for (i = 0u; (i < u8_maxCnt) && ((UINT8)(u8_first + i) < RFID_FAIL_CNT); i++)
+  {
+    pau16_cnt[i] = au16_rfidFailCnt[u8_first + i];
+  }
+  return i;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DiagReset(void)
+**
+**  Description:
+**    This function clears the latency histograms and the failure counters. The caller must
+**    lock the interrupts.
+**
+**  See also:
+**    RFID_DiagHistGet, RFID_DiagFailCntGet
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**************************************************************************************************/
+void RFID_DiagReset(void)
+{
+  UINT8 i;
+  UINT8 j;
+
+  for (i = 0u; i < (UINT8)RFID_HIST_CNT; i++)
+  {
+    for (j = 0u; j < RFID_HIST_BUCKET_CNT; j++)
+    {
+      au16_rfidHist[i][j] = 0u;
+    }
+  }
+  for (i = 0u; i < RFID_FAIL_CNT; i++)
+  {
+    au16_rfidFailCnt[i] = 0u;
+  }
+  RFID_JournalClear();
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_Reader_Boot(void)
+**
+**  Description:
+**    This function processes the RFID reader.
+**
+**  See also:
+**    -
+**
+**  Parameters:
+**    -
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+void RFID_Reader_Boot(void)
+{
+  switch (e_rfidAccessState)
+  {
+    case TX_BOOT_FIRMWARE:    
+    {
+      //u32_funcCallCount = 0u;
+      TIMER_START(s_BootFirmware);
+      RFID_BootReader();
+      RFID_FrameRxInit(RFID_EXPEC_RES_VE_LEN);
+      e_rfidAccessState = RX_BOOT_FIRMWARE;
+      break;
+    }
+    case RX_BOOT_FIRMWARE:
+    { 
+      //u32_funcCallCount++;
+      // Function calls * t100 time slice is 100 us
+      //UINT32 u32_timeElapsed = u32_funcCallCount * T100_TIME_SLICE_US;
+
+      UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_BootFirmware.u32_cur;
+      UINT8 u8_rxLen;
+      const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+      // Wait for the receive interrupt to signal the complete frame
+      if (pau8_rxFrame != NULL)
+      {
+        TIMER_STOP(s_BootFirmware);
+        if (RFID_VerifySWVersion(pau8_rxFrame) == RFID_OK)
+        {
+          if (u8_rfidBaudTrial != 0u)
+          {
+            /* Reader answers with the new baud rate */
+            u8_rfidBaudTrial = 0u;
+            u32_rfidBaudRate = RFID_BAUD_TARGET;
+          }
+
+          if ((u32_rfidBaudRate != RFID_BAUD_TARGET) && (u8_rfidBaudFallback == 0u))
+          {
+            e_rfidAccessState = TX_SET_BAUD;
+          }
+          else
+          {
+            e_rfidAccessState = TX_READ_UID;
+          }
+        }
+        else if (u8_rfidBaudTrial != 0u)
+        {
+          RFID_BaudFallback();
+        }
+        else
+        {
+          RFID_HandleFailure(RFID_FAIL_BOOT_READER);
+        }
+      }
+      else if (u32_elapsed > RFID_BOOT_READER_TIMEOUT)
+      {
+        if (u8_rfidBaudTrial != 0u)
+        {
+          RFID_BaudFallback();
+        }
+        else
+        {
+          // Timeout occurred, handle failure
+          RFID_HandleFailure(RFID_FAIL_BOOT_READER_TIMEOUT);
+        }
+      }
+      break; 
+    }
+    case TX_SET_BAUD:
+    {
+      /* Request the new baud rate, the reader answers with the old baud rate */
+      TIMER_START(s_BootFirmware);
+      RFID_FrameTxSetBaud((RFID_BAUD_TARGET == RFID_115200_BAUD) ? RFID_BAUD_CODE_115200
+                                                                 : RFID_BAUD_CODE_38400);
+      RFID_FrameRxInit(RFID_RES_LEN);
+      e_rfidAccessState = RX_SET_BAUD;
+      break;
+    }
+    case RX_SET_BAUD:
+    {
+      UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_BootFirmware.u32_cur;
+      UINT8 u8_rxLen;
+      const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+
+      if (u8_rfidBaudFallback != 0u)
+      {
+        /* Reset of the reader to the boot baud rate, the response is not evaluated */
+        if ((pau8_rxFrame != NULL) || (u32_elapsed > RFID_BOOT_READER_TIMEOUT))
+        {
+          TIMER_STOP(s_BootFirmware);
+          uartBaudSet(RFID_38400_BAUDRATE);
+          e_rfidAccessState = TX_BOOT_FIRMWARE;
+        }
+      }
+      else if (pau8_rxFrame != NULL)
+      {
+        TIMER_STOP(s_BootFirmware);
+        if ((u8_rxLen == RFID_RES_LEN) && (pau8_rxFrame[0] == RFID_CMD_OK) &&
+            (RFID_VerifyChecksum(pau8_rxFrame, u8_rxLen) == RFID_OK))
+        {
+          /* Switch the UART and verify the new baud rate with the version command */
+          uartBaudSet(RFID_BAUD_TARGET);
+          u8_rfidBaudTrial = 1u;
+        }
+        else
+        {
+          /* Baud rate not supported, keep the boot baud rate */
+          u8_rfidBaudFallback = 1u;
+        }
+        e_rfidAccessState = TX_BOOT_FIRMWARE;
+      }
+      else if (u32_elapsed > RFID_BOOT_READER_TIMEOUT)
+      {
+        /* No response, verify the communication with the boot baud rate */
+        u8_rfidBaudFallback = 1u;
+        e_rfidAccessState = TX_BOOT_FIRMWARE;
+      }
+      else
+      {
+        /* Wait for the response */
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_ReadTag(void)
+**
+**  Description:
+**    This function implements the state machine for reading the RFID tag.
+**
+**  See also:
+**    -
+**  Parameters:
+**    -
+**  Return value:
+**    RFID_OK (0) - Response is OK
+**************************************************************************************************/
+ void RFID_ReadTag(void)
+ {
+
+   t_RFID_RAW_DATA s_rfidRawData;
+   t_RFID_TAG_DATA s_rfidTagData;
+
+   u32_elapsedRunTime = timerHAL_GetSystemTime3() - s_TimeDurations.s_RFIDRunTime.u32_cur;
+   /* Reset Failercount and runtime after 1 hour*/
+   if (u32_elapsedRunTime > RFID_TICKS_PER_HOUR_TEST)
+   {
+      TIMER_STOP(s_RFIDRunTime);
+      u8_rfidFailureCount = 0u;
+      u32_elapsedRunTime = 0uL;
+      TIMER_START(s_RFIDRunTime);
+   }
+   /* Check if failure count exceeds maximum allowed */
+   if (u8_rfidFailureCount  > RFID_MAX_FAILURE_COUNT)
+   {
+      e_rfidAccessState = RFID_FAIL_SAFE;
+   }
+
+   if ((UINT8)e_rfidAccessState < RFID_STATE_CNT)
+   {
+     au32_rfidStateCycles[e_rfidAccessState]++;
+   }
+
+   /* Calls in TX_READ_UID are idle until the poll interval is expired */
+   RFID_PollDutyUpdate(((e_rfidAccessState != TX_READ_UID) || (u32_rfidPollInterval == 0uL) ||
+                        ((UINT32)(timerHAL_GetSystemTime3() - u32_rfidPollLast) >=
+                         u32_rfidPollInterval)) ? 1u : 0u);
+
+   switch (e_rfidAccessState)
+   {
+     case TX_BOOT_FIRMWARE:
+     case RX_BOOT_FIRMWARE:
+     case TX_SET_BAUD:
+     case RX_SET_BAUD:
+     {
+        /* Boot sequence or baud rate negotiation was not finished in the startup phase */
+        RFID_Reader_Boot();
+        break;
+     }
+     case TX_READ_UID:
+     {
+        /* Wait until the response of a command which was sent by the receive interrupt is
+         * received completely, otherwise it would be received as UID response */
+        if (RFID_FrameRxPending() != 0u)
+        {
+          break;
+        }
+        /* No tag in front of the reader, poll with the reduced rate */
+        if ((u32_rfidPollInterval != 0uL) &&
+            ((UINT32)(timerHAL_GetSystemTime3() - u32_rfidPollLast) < u32_rfidPollInterval))
+        {
+          break;
+        }
+        u32_rfidPollLast = timerHAL_GetSystemTime3();
+        /* Determine the current sequence number for reading records */
+        RFID_DetermineNextRecords();
+        e_rfidCycleReadMode = e_rfidReadMode;
+        /* A spot check is done if the cache is valid and the tag is not replaced */
+        u8_rfidSpotCheck = RFID_TagCacheUsable();
+        TIMER_START(s_readUid);
+        RFID_FrameTxSingleReadFixCode();
+        RFID_FrameRxInit(RFID_EXPEC_RES_SF_LEN);
+        if (u8_rfidSpotCheck != 0u)
+        {
+          u8_rfidSpotSeqNum = (u8_rfidSpotSeqNum + 1u) % RFID_REC_COUNT;
+          RFID_FrameRxChain(RFID_CmdReadRecord(u8_rfidSpotSeqNum), RFID_EXPEC_RES_SR_LEN);
+        }
+        else if (e_rfidCycleReadMode == RFID_READ_MODE_FULL_MEMORY)
+        {
+          RFID_FrameRxChain(&s_rfidCmdReadFullMemory, RFID_EXPEC_RES_FM_LEN);
+        }
+        else
+        {
+          RFID_FrameRxChain(RFID_CmdReadRotation(),
+                            (RFID_READ_REC_PAIR == 1u) ? RFID_EXPEC_RES_SR2_LEN
+                                                       : RFID_EXPEC_RES_SR_LEN);
+        }
+        e_rfidAccessState = RX_READ_UID;
+        break;
+     }
+     case RX_READ_UID:
+     {
+        UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readUid.u32_cur;
+        UINT8 u8_rxLen;
+        const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+
+        if (pau8_rxFrame != NULL)
+        {
+          TIMER_STOP_HIST(s_readUid, RFID_HIST_UID);
+          u8_rfidUidTimeoutCnt = 0u;
+          // Verify the received Single Read Fix Code message
+          UINT8 res = RFID_VerifySingleReadFixCode(pau8_rxFrame, &s_rfidRawData);
+          if( res == RFID_OK)
+          {
+            RFID_ParseSingleFixCode(&s_rfidRawData, &s_rfidTagData);
+            /* Copy Fix Code and store it in both records for R_CRC calculation */
+            UINT8 i;
+            for (i = 0; i < RFID_UID_LEN; i++)
+            {
+              s_rfidTagRecordEven.au8_tag_uid[i] = s_rfidTagData.au8_tag_uid[i];
+              s_rfidTagRecordOdd.au8_tag_uid[i] = s_rfidTagData.au8_tag_uid[i];
+            }
+            if (u8_rfidTagPresent == 0u)
+            {
+              RFID_JournalAdd(RFID_EVT_TAG_ARRIVAL, 0u, 0uL, RFID_UidLowGet(), 0uL);
+            }
+            u8_rfidTagPresent = 1u;
+            u32_rfidTagSeenTime = u32_rfidRxFrameTime;
+            RFID_PollBackoff(1u);
+            /* Measure the time from the detection of a new tag to the published S2L ID */
+            if ((s_rfidTagCache.u8_valid == 0u) && (u8_rfidValidIdPending == 0u))
+            {
+              TIMER_START(s_tagToValidId);
+              u8_rfidValidIdPending = 1u;
+            }
+            if (u8_rfidSpotCheck != 0u)
+            {
+              if (RFID_TagCacheMatch(s_rfidTagData.au8_tag_uid) == RFID_OK)
+              {
+                // Same tag as in the cache, proceed with the spot check record
+                if (RFID_FrameRxChained() != 0u)
+                {
+                  /* Read command was already sent by the receive interrupt */
+                  s_TimeDurations.s_readRecord.u32_cur = u32_rfidRxFrameTime;
+                  e_rfidAccessState = RX_READ_REC_SPOT;
+                }
+                else
+                {
+                  e_rfidAccessState = TX_READ_REC_SPOT;
+                }
+              }
+              else
+              {
+                // Tag was replaced, verify the new tag completely with the next read cycle
+                e_rfidAccessState = TX_READ_UID;
+                RFID_InfoReset();
+                RFID_PurgeOutdatedTagData();
+                RFID_TagCacheInvalidate();
+              }
+            }
+            else if (e_rfidCycleReadMode == RFID_READ_MODE_FULL_MEMORY)
+            {
+              // Tag found, proceed to read the complete memory
+              if (RFID_FrameRxChained() != 0u)
+              {
+                /* Read command was already sent by the receive interrupt */
+                s_TimeDurations.s_readRecord.u32_cur = u32_rfidRxFrameTime;
+                e_rfidAccessState = RX_READ_FULL_MEM;
+              }
+              else
+              {
+                e_rfidAccessState = TX_READ_FULL_MEM;
+              }
+            }
+            else
+            {
+              // Tag found, proceed to read the even record
+              if (RFID_FrameRxChained() != 0u)
+              {
+                /* Read command was already sent by the receive interrupt */
+                s_TimeDurations.s_readRecord.u32_cur = u32_rfidRxFrameTime;
+                if (RFID_READ_REC_PAIR == 0u)
+                {
+                  RFID_FrameRxChain(RFID_CmdReadRecord(u8_OddSequenceNumber),
+                                    RFID_EXPEC_RES_SR_LEN);
+                }
+                e_rfidAccessState = RX_READ_REC_EVEN;
+              }
+              else
+              {
+                e_rfidAccessState = TX_READ_REC_EVEN;
+              }
+            }
+          }
+          else if (res == RFID_NO_TAG)
+          {
+              // No tag detected, retry reading
+              e_rfidAccessState = TX_READ_UID;
+              u8_rfidValidIdPending = 0u;
+              RFID_PollBackoff(0u);
+              if (u8_rfidTagPresent != 0u)
+              {
+                UINT32 u32_removalTime = u32_rfidRxFrameTime - u32_rfidTagSeenTime;
+
+                RFID_HistAdd(RFID_HIST_TAG_REMOVAL, u32_removalTime);
+                RFID_JournalAdd(RFID_EVT_TAG_REMOVAL, 0u, u32_RfidInfo, RFID_UidLowGet(),
+                                u32_removalTime);
+                u8_rfidTagPresent = 0u;
+              }
+              // Reset the RFID information
+              RFID_InfoReset();
+              RFID_PurgeOutdatedTagData();
+              RFID_TagCacheInvalidate();
           }
+          else
+          {
+            /* Handle failure */
+            RFID_HandleFailure(RFID_FAIL_UID_VERIFY);
+          } 
         }
-        else
+        else 
         {
-          RFID_HandleFailure(RFID_FAIL_EVEN_REC_SEQ_NUM_ERROR);
+          // Check for timeout
+          if (u32_elapsed > RFID_READ_UID_TIMEOUT)
+          {
+            // Timeout occurred, go back to retry reading UID
+            RFID_FailCntInc(RFID_FAIL_UID_TIMEOUT);
+            e_rfidAccessState = TX_READ_UID;
+            /* Reset the RFID information */
+            RFID_InfoReset();
+            RFID_PurgeOutdatedTagData();
+            RFID_TagCacheInvalidate();
+            u8_rfidUidTimeoutCnt++;
+            if ((u32_rfidBaudRate != RFID_38400_BAUDRATE) &&
+                (u8_rfidUidTimeoutCnt >= RFID_BAUD_RESYNC_TIMEOUTS))
+            {
+              RFID_BaudResync();
+            }
+          }
+
         }
+      break;
+     }
+     case TX_READ_REC_EVEN: 
+     {  
+        const t_RFID_CMD_FRAME *ps_cmd = RFID_CmdReadRotation();
 
-         break;
+        TIMER_START(s_readRecord);
+        if (ps_cmd != NULL)
+        {
+          RFID_FrameTxCmd(ps_cmd);
+          if (RFID_READ_REC_PAIR == 1u)
+          {
+            RFID_FrameRxInit(RFID_EXPEC_RES_SR2_LEN);
+          }
+          else
+          {
+            RFID_FrameRxInit(RFID_EXPEC_RES_SR_LEN);
+            RFID_FrameRxChain(RFID_CmdReadRecord(u8_OddSequenceNumber), RFID_EXPEC_RES_SR_LEN);
+          }
+          e_rfidAccessState = RX_READ_REC_EVEN;
+        }
+        else
+        {
+          // Invalid sequence number, handle failure
+          RFID_HandleFailure(RFID_FAIL_INVALID_SEQ_NUM);
+        }
+        break;  
      }
-     case TX_READ_REC_ODD:
+     case RX_READ_REC_EVEN:
      {
-        TIMER_START(s_readRecord);
-        if (u8_OddSequenceNumber == 1u)
+      UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readRecord.u32_cur;
+      UINT8 u8_rxLen;
+      const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+
+      if ((pau8_rxFrame != NULL) && (u8_rxLen == RFID_ERROR_RES_LEN))
+      {
+        /* Short error response (e.g. tag removed), go back to retry reading UID */
+        TIMER_STOP_HIST(s_readRecord, RFID_HIST_REC_EVEN);
+        e_rfidAccessState = TX_READ_UID;
+        RFID_InfoReset();
+        RFID_PurgeOutdatedTagData();
+        RFID_TagCacheInvalidate();
+      }
+      else if ((pau8_rxFrame != NULL) && (RFID_READ_REC_PAIR == 1u))
+      {
+        TIMER_STOP_HIST(s_readRecord, RFID_HIST_REC_EVEN);
+        /* Even and odd record are parsed from one response */
+        if (RFID_VerifyRecordPair(pau8_rxFrame, u8_rxLen) == RFID_OK)
+        {
+          e_rfidAccessState = CHECK_REC_EVEN;
+        }
+        else
+        {
+          RFID_HandleFailure(RFID_FAIL_EVEN_REC_VERIFY);
+        }
+      }
+      else if (pau8_rxFrame != NULL)
+      {
+        TIMER_STOP_HIST(s_readRecord, RFID_HIST_REC_EVEN);
+        if (RFID_VerifySingleReadWord(pau8_rxFrame, &s_rfidRawData) == RFID_OK)
+        { 
+          if (RFID_ParseRecord(&s_rfidRawData, &s_rfidTagRecordEven) == RFID_OK)
+          {
+            e_rfidAccessState = CHECK_REC_EVEN;
+          }
+          else
+          {
+            RFID_HandleFailure(RFID_FAIL_EVEN_REC_VERIFY);
+          }
+        } 
+        else
+        {
+          RFID_HandleFailure(RFID_FAIL_EVEN_REC_VERIFY);
+        }
+      }
+      else
+      {
+        // Check for timeout
+        if (u32_elapsed > RFID_READ_REC_TIMEOUT)
         {
-          RFID_FrameTxReadRecord_1();
+          // Timeout occurred, go back to retry reading UID
+          RFID_FailCntInc(RFID_FAIL_EVEN_REC_TIMEOUT);
+          e_rfidAccessState = TX_READ_UID;
+          /* Reset the RFID information */
+          RFID_InfoReset();
+          RFID_PurgeOutdatedTagData();
+          RFID_TagCacheInvalidate();
         }
-        else if (u8_OddSequenceNumber == 3u)
+      }
+      break;
+     }
+     case CHECK_REC_EVEN:
+     {
+        /* Check expected sequence number and CRC for the even record */
+        if (u8_SequenceNumber == s_rfidTagRecordEven.u8_seq_num)
         {
-          RFID_FrameTxReadRecord_3();
+          // Sequence number matches, proceed to check CRC
+          if (RFID_CalculateCRC(&s_rfidTagRecordEven) == RFID_OK)
+          {
+            if (RFID_READ_REC_PAIR == 1u)
+            {
+              /* Odd record was received with the even record */
+              e_rfidAccessState = CHECK_REC_ODD;
+            }
+            else if (RFID_FrameRxChained() != 0u)
+            {
+              /* Read command was already sent by the receive interrupt */
+              s_TimeDurations.s_readRecord.u32_cur = u32_rfidRxFrameTime;
+              e_rfidAccessState = RX_READ_REC_ODD;
+            }
+            else
+            {
+              e_rfidAccessState = TX_READ_REC_ODD;
+            }
+          }
+          else
+          {
+            RFID_HandleFailure(RFID_FAIL_EVEN_REC_CRC_ERROR);
+          }
         }
-        else if (u8_OddSequenceNumber == 5u)
+        else
         {
-          RFID_FrameTxReadRecord_5();
+          RFID_HandleFailure(RFID_FAIL_EVEN_REC_SEQ_NUM_ERROR);
         }
-        else if (u8_OddSequenceNumber == 7u)
+
+         break;
+     }
+     case TX_READ_REC_ODD:
+     {
+        const t_RFID_CMD_FRAME *ps_cmd = RFID_CmdReadRecord(u8_OddSequenceNumber);
+
+        TIMER_START(s_readRecord);
+        if (ps_cmd != NULL)
         {
-          RFID_FrameTxReadRecord_7();
+          RFID_FrameTxCmd(ps_cmd);
+          RFID_FrameRxInit(RFID_EXPEC_RES_SR_LEN);
+          e_rfidAccessState = RX_READ_REC_ODD;
         }
         else
         {
           // Invalid sequence number, handle failure
           RFID_HandleFailure(RFID_FAIL_INVALID_SEQ_NUM);
         }
-        RFID_FrameRxInit(RFID_EXPEC_RES_SR_LEN);
-        e_rfidAccessState = RX_READ_REC_ODD;      
       break;
      }
      case RX_READ_REC_ODD:
      {
         UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readRecord.u32_cur;
-        if (RFID_DMA_CHANNEL_RX->CNDTR == 0) 
+        UINT8 u8_rxLen;
+        const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+
+        if ((pau8_rxFrame != NULL) && (u8_rxLen == RFID_ERROR_RES_LEN))
         {
-          TIMER_STOP(s_readRecord);
-          if (RFID_VerifySingleReadWord(au8_rfidDmaBufferRx, &s_rfidRawData) == RFID_OK)
+          /* Short error response (e.g. tag removed), go back to retry reading UID */
+          TIMER_STOP_HIST(s_readRecord, RFID_HIST_REC_ODD);
+          e_rfidAccessState = TX_READ_UID;
+          RFID_InfoReset();
+          RFID_PurgeOutdatedTagData();
+          RFID_TagCacheInvalidate();
+        }
+        else if (pau8_rxFrame != NULL)
+        {
+          TIMER_STOP_HIST(s_readRecord, RFID_HIST_REC_ODD);
+          if (RFID_VerifySingleReadWord(pau8_rxFrame, &s_rfidRawData) == RFID_OK)
           { 
             if (RFID_ParseRecord(&s_rfidRawData, &s_rfidTagRecordOdd) == RFID_OK)
             {
@@ -562,10 +1516,12 @@ void RFID_Reader_Boot(void)
           if (u32_elapsed > RFID_READ_REC_TIMEOUT)
           {
             //Timeout occurred, go to retry reading UID
+            RFID_FailCntInc(RFID_FAIL_ODD_REC_TIMEOUT);
             e_rfidAccessState = TX_READ_UID;
             /* Reset the RFID information */
-            u32_RfidInfo = 0uL;
+            RFID_InfoReset();
             RFID_PurgeOutdatedTagData();
+            RFID_TagCacheInvalidate();
           }
         }
         break;
@@ -590,12 +1546,225 @@ void RFID_Reader_Boot(void)
       }
       break;
      }
+     case TX_READ_FULL_MEM:
+     {
+        TIMER_START(s_readRecord);
+        RFID_FrameTxCmd(&s_rfidCmdReadFullMemory);
+        RFID_FrameRxInit(RFID_EXPEC_RES_FM_LEN);
+        e_rfidAccessState = RX_READ_FULL_MEM;
+        break;
+     }
+     case RX_READ_FULL_MEM:
+     {
+        UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readRecord.u32_cur;
+        UINT8 u8_rxLen;
+        const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+
+        if ((pau8_rxFrame != NULL) && (u8_rxLen == RFID_ERROR_RES_LEN))
+        {
+          /* Short error response (e.g. tag removed between UID and memory read) */
+          TIMER_STOP(s_readRecord);
+          e_rfidAccessState = TX_READ_UID;
+          RFID_InfoReset();
+          RFID_PurgeOutdatedTagData();
+          RFID_TagCacheInvalidate();
+        }
+        else if (pau8_rxFrame != NULL)
+        {
+          TIMER_STOP(s_readRecord);
+          /* The frame is checked in the next cycle (CHECK_FULL_MEM), until then the DMA can
+          ** overwrite the receive ring. So the frame is copied out of the ring and the copy is
+          ** verified and checked. */
+          if ((u8_rxLen == RFID_EXPEC_RES_FM_LEN) && (pau8_rxFrame != au8_rfidRxFrameCopy))
+          {
+            UINT8 i;
+            for (i = 0; i < RFID_EXPEC_RES_FM_LEN; i++)
+            {
+              au8_rfidRxFrameCopy[i] = pau8_rxFrame[i];
+            }
+          }
+          if ((u8_rxLen == RFID_EXPEC_RES_FM_LEN) &&
+              (RFID_VerifyFullMemory(au8_rfidRxFrameCopy) == RFID_OK))
+          {
+            e_rfidAccessState = CHECK_FULL_MEM;
+          }
+          else
+          {
+            RFID_HandleFailure(RFID_FAIL_FULL_MEM_VERIFY);
+          }
+        }
+        else
+        {
+          if (u32_elapsed > RFID_READ_FULL_MEM_TIMEOUT)
+          {
+            // Timeout occurred, go back to retry reading UID
+            RFID_FailCntInc(RFID_FAIL_FULL_MEM_TIMEOUT);
+            e_rfidAccessState = TX_READ_UID;
+            /* Reset the RFID information */
+            RFID_InfoReset();
+            RFID_PurgeOutdatedTagData();
+            RFID_TagCacheInvalidate();
+          }
+        }
+        break;
+     }
+     case CHECK_FULL_MEM:
+     {
+        /* Check all records, their CRCs and the memory CRC in the copy of the frame */
+        t_RFID_FAILURE e_failure = RFID_CheckFullMemory(au8_rfidRxFrameCopy);
+        if (e_failure == RFID_FAIL_NONE)
+        {
+          e_rfidAccessState = CHECK_TAG_RECORDS;
+        }
+        else
+        {
+          RFID_HandleFailure(e_failure);
+        }
+        break;
+     }
+     case TX_READ_REC_SPOT:
+     {
+        const t_RFID_CMD_FRAME *ps_cmd = RFID_CmdReadRecord(u8_rfidSpotSeqNum);
+
+        TIMER_START(s_readRecord);
+        if (ps_cmd != NULL)
+        {
+          RFID_FrameTxCmd(ps_cmd);
+          RFID_FrameRxInit(RFID_EXPEC_RES_SR_LEN);
+          e_rfidAccessState = RX_READ_REC_SPOT;
+        }
+        else
+        {
+          // Invalid sequence number, handle failure
+          RFID_HandleFailure(RFID_FAIL_INVALID_SEQ_NUM);
+        }
+        break;
+     }
+     case RX_READ_REC_SPOT:
+     {
+        UINT32 u32_elapsed = timerHAL_GetSystemTime3() - s_TimeDurations.s_readRecord.u32_cur;
+        UINT8 u8_rxLen;
+        const UINT8 *pau8_rxFrame = RFID_FrameRxGet(&u8_rxLen);
+        /* Even records are parsed into the even record, odd records into the odd record */
+        t_RFID_TAG_DATA *ps_record = ((u8_rfidSpotSeqNum & 0x01u) == 0u) ? &s_rfidTagRecordEven
+                                                                          : &s_rfidTagRecordOdd;
+        t_RFID_HIST e_hist = ((u8_rfidSpotSeqNum & 0x01u) == 0u) ? RFID_HIST_REC_EVEN
+                                                                  : RFID_HIST_REC_ODD;
+
+        if ((pau8_rxFrame != NULL) && (u8_rxLen == RFID_ERROR_RES_LEN))
+        {
+          /* Short error response (e.g. tag removed), go back to retry reading UID */
+          TIMER_STOP_HIST(s_readRecord, e_hist);
+          e_rfidAccessState = TX_READ_UID;
+          RFID_InfoReset();
+          RFID_PurgeOutdatedTagData();
+          RFID_TagCacheInvalidate();
+        }
+        else if (pau8_rxFrame != NULL)
+        {
+          TIMER_STOP_HIST(s_readRecord, e_hist);
+          if ((RFID_VerifySingleReadWord(pau8_rxFrame, &s_rfidRawData) == RFID_OK) &&
+              (RFID_ParseRecord(&s_rfidRawData, ps_record) == RFID_OK))
+          {
+            e_rfidAccessState = CHECK_REC_SPOT;
+          }
+          else
+          {
+            RFID_HandleFailure(RFID_FAIL_SPOT_REC_VERIFY);
+          }
+        }
+        else
+        {
+          if (u32_elapsed > RFID_READ_REC_TIMEOUT)
+          {
+            // Timeout occurred, go back to retry reading UID
+            RFID_FailCntInc(((u8_rfidSpotSeqNum & 0x01u) == 0u) ? RFID_FAIL_EVEN_REC_TIMEOUT
+                                                                 : RFID_FAIL_ODD_REC_TIMEOUT);
+            e_rfidAccessState = TX_READ_UID;
+            /* Reset the RFID information */
+            RFID_InfoReset();
+            RFID_PurgeOutdatedTagData();
+            RFID_TagCacheInvalidate();
+          }
+        }
+        break;
+     }
+     case CHECK_REC_SPOT:
+     {
+        /* Check sequence number, CRC and S2L ID of the spot check record against the cache */
+        t_RFID_TAG_DATA *ps_record = ((u8_rfidSpotSeqNum & 0x01u) == 0u) ? &s_rfidTagRecordEven
+                                                                          : &s_rfidTagRecordOdd;
+        UINT8 u8_res = RFID_OK;
+        UINT8 i;
+
+        if (ps_record->u8_seq_num != u8_rfidSpotSeqNum)
+        {
+          RFID_HandleFailure(RFID_FAIL_SPOT_REC_SEQ_NUM_ERROR);
+        }
+        else if (RFID_CalculateCRC(ps_record) != RFID_OK)
+        {
+          RFID_HandleFailure(RFID_FAIL_SPOT_REC_CRC_ERROR);
+        }
+        else
+        {
+          if (ps_record == &s_rfidTagRecordEven)
+          {
+            /* Even record contains the S2L ID */
+            for (i = 0; i < RFID_S2L_ID_LEN; i++)
+            {
+              if (s_rfidTagRecordEven.au8_s2l_id[i] != s_rfidTagCache.au8_s2l_id[i])
+              {
+                u8_res = RFID_FAIL_S2L_ID_VERIFY;
+              }
+            }
+          }
+          else
+          {
+            /* Odd record contains the complement, check it against the cached S2L ID */
+            for (i = 0; i < RFID_S2L_ID_LEN; i++)
+            {
+              s_rfidTagRecordEven.au8_s2l_id[i] = s_rfidTagCache.au8_s2l_id[i];
+            }
+            u8_res = RFID_CheckS2LID();
+          }
+
+          if (u8_res == RFID_OK)
+          {
+            /* Publish the S2L ID of the even record (equal to the cached S2L ID) */
+            for (i = 0; i < RFID_S2L_ID_LEN; i++)
+            {
+              s_rfidTagRecordEven.au8_s2l_id[i] = s_rfidTagCache.au8_s2l_id[i];
+            }
+            (void)RFID_CheckTagRecordFields();
+            RFID_PurgeOutdatedTagData();
+            e_rfidAccessState = TX_READ_UID;
+          }
+          else
+          {
+            RFID_HandleFailure(RFID_FAIL_S2L_ID_VERIFY);
+          }
+        }
+        break;
+     }
      case CHECK_TAG_RECORDS:
      {
         if (RFID_CheckS2LID() == RFID_OK)
         {
           if (RFID_CheckTagRecordFields() == RFID_OK)
           {
+            /* Tag is verified completely, following cycles can use spot checks */
+            RFID_TagCacheStore();
+            RFID_DigestBuild();
+            /* New tag: time since its detection, otherwise time since the UID of this cycle */
+            UINT32 u32_verifyTime = timerHAL_GetSystemTime3() - u32_rfidTagSeenTime;
+            if (u8_rfidValidIdPending != 0u)
+            {
+              u32_verifyTime = timerStop(&s_TimeDurations.s_tagToValidId);
+              RFID_HistAdd(RFID_HIST_FULL_VERIFY, u32_verifyTime);
+              u8_rfidValidIdPending = 0u;
+            }
+            RFID_JournalAdd(RFID_EVT_TAG_VERIFIED, 0u, u32_RfidInfo, RFID_UidLowGet(),
+                            u32_verifyTime);
             RFID_PurgeOutdatedTagData();
             e_rfidAccessState = TX_READ_UID;
           }
@@ -623,6 +1792,37 @@ void RFID_Reader_Boot(void)
     }  
   }
 
+/**************************************************************************************************
+**
+**  Function:
+**    void USART3_IRQHandler(void)
+**
+**  Description:
+**    Interrupt service routine of the RFID reader UART. The IDLE line detection is signaled after
+**    each burst of received bytes, the received bytes are searched for the end of the expected
+**    frame. A pause inside a frame is no problem, the search continues with the next burst.
+**
+**  See also:
+**    RFID_FrameRxExtract
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**************************************************************************************************/
+void USART3_IRQHandler(void)
+{
+  volatile UINT32 u32_dummy;
+
+  if ((USART3->SR & USART_SR_IDLE) != 0u)
+  {
+    /* IDLE flag is cleared by reading SR followed by DR */
+    u32_dummy = USART3->DR;
+    (void)u32_dummy;
+
+    RFID_FrameRxExtract();
+  }
+}
+
 /**************************************************************************************************
 **    static functions
 **************************************************************************************************/
@@ -705,10 +1905,10 @@ STATIC UINT8 RFID_VerifySingleReadFixCode(const UINT8 *buffer, t_RFID_RAW_DATA *
   UINT8 i; 
   for (i = 0; i < RFID_EXPEC_RES_SF_LEN; i++)
   {
-    au8_rfidRxBuffer[i] = au8_rfidDmaBufferRx[i];
+    au8_rfidRxBuffer[i] = buffer[i];
   }
   /* Calculate the received message length */ 
-  UINT8 msg_len = RFID_ResLength(au8_rfidDmaBufferRx, RFID_EXPEC_RES_SF_LEN); 
+  UINT8 msg_len = RFID_ResLength(buffer, RFID_EXPEC_RES_SF_LEN); 
   if (msg_len < 3)
   {
     return RFID_SYNTAX_ERROR;
@@ -985,125 +2185,432 @@ STATIC UINT32 RFID_CalculateCRC(t_RFID_TAG_DATA *s_rfidTagData)
   UINT8 offset = 0;
   UINT8 i;
 
-  /* 1. UID */
+  /* 1. UID */
+  for (i = 0; i < RFID_UID_LEN; i++)
+  {
+    au8_crc_input[offset++] = s_rfidTagData->au8_tag_uid[i];
+    //au8_crc_input[offset++] = s_rfidTagData->au8_tag_uid[RFID_UID_LEN - 1 - i]; // Reverse order
+  }
+
+  /* 2. Sequence number */
+  au8_crc_input[offset++] = s_rfidTagData->u8_seq_num;
+
+  /* 3. Reserved bytes (3 bytes 0x00) */
+  for (i = 0; i < RFID_RES_LEN; i++)
+  {
+    au8_crc_input[offset++] = au8_reserved[i];
+  }
+
+  /* 4. S2L ID (4 bytes) */
+  for (i = 0; i < RFID_S2L_ID_LEN; i++)
+  {
+    au8_crc_input[offset++] = s_rfidTagData->au8_s2l_id[i];
+  }
+
+  /* Calculate CRC and compare with received CRC */
+  TIMER_START(s_crcCalc);
+  UINT32 u32_calcCRC = RFID_Crc32(au8_crc_input, offset);
+  TIMER_STOP(s_crcCalc);
+
+  if (u32_calcCRC == u32_receivedCRC)
+  {
+   /* CRC is valid, proceed with the tag data */
+   return RFID_OK;
+  }
+  else
+  {
+    /* CRC error, handle accordingly */
+    return RFID_REC_CRC_ERROR;
+  }
+}
+
+/****************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_CheckTagRecordFields(void)
+**
+**  Description:
+**    This function checks the plausibility of of all fields of the read records from 
+**    the RFID tag. It checks the sequence number, reserved bytes and S2L ID. The second safety
+**    controller checks the record pair with the digest (see RFID_DigestRecv).
+**
+**  See also:
+**    -
+**  Parameters:
+**    -
+**  Return value:
+**    RFID_REC_OK (0) - All fields are valid
+**    RFID_REC_INVALID_LEN (1) - Record length is invalid
+**    RFID_REC_INVALID_S2L_ID (4) - S2L ID is invalid
+**    RFID_REC_INVALID_SEQ_NUM (5) - Sequence number is invalid
+**    RFID_REC_INVALID_UID (6) - UID is invalid
+*****************************************************************************************************
+*/
+STATIC UINT8 RFID_CheckTagRecordFields(void)
+{
+  u32_RfidInfo = 0uL;
+  UINT8 i;
+  for (i = 0; i < 4; i++)
+  {
+    /* switch the order of the bytes */
+    u32_RfidInfo |= ((UINT32)s_rfidTagRecordEven.au8_s2l_id[i]) << (8 * i);
+  }
+  /* Search for new tag again */
+  return RFID_OK;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_CheckS2LID(void)
+**
+**  Description:
+**    This function checks the S2L ID of the read records from the RFID tag.
+**    It calculates the complement S2L ID from the odd-numbered record and compares it
+**    with the S2L ID in the even-numbered record to verify integrity.
+**
+**    Note: The record with an even sequence number contains the original Tag ID.
+**          The record with an odd sequence number contains the bitwise complement of the Tag ID.
+** See also:
+**    -
+**  Parameters:
+**    -
+**  Return value:
+**    RFID_OK (0) - S2L ID is valid
+**    RFID_FAIL_S2L_ID_VERIFY - S2L ID is invalid
+*/
+STATIC UINT8 RFID_CheckS2LID(void)
+{
+  UINT8 firstUsedIndex = RFID_S2L_ID_LEN;
+
+  // Find the first non-zero byte in the complement S2L ID (odd record)
+  for (UINT8 i = 0; i < RFID_S2L_ID_LEN; i++)
+  {
+    if (s_rfidTagRecordOdd.au8_s2l_id[i] != 0x00)
+    {
+      firstUsedIndex = i;
+      break;
+    }
+  }
+
+  // If all bytes are 0x00, the ID is considered invalid
+  if (firstUsedIndex == RFID_S2L_ID_LEN)
+    return RFID_FAIL_S2L_ID_VERIFY;
+
+  // Compare each relevant byte of the original and complemented S2L ID
+  for (UINT8 i = firstUsedIndex; i < RFID_S2L_ID_LEN; i++)
+  {
+    UINT8 even = s_rfidTagRecordEven.au8_s2l_id[i];   // Original S2L ID byte
+    UINT8 odd  = s_rfidTagRecordOdd.au8_s2l_id[i];    // Complement S2L ID byte
+
+    if ((UINT8)(~odd) != even)
+      return RFID_FAIL_S2L_ID_VERIFY; // Mismatch found
+  }
+
+  return RFID_OK; // All checks passed
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_VerifyFullMemory(const UINT8 *buffer)
+**
+**  Description:
+**    This function verifies the frame of the Single Read Words response for the full memory.
+**    It checks the status byte, the ETX and the checksum. The frame has a fixed length, so ETX
+**    values inside the payload need not be considered.
+**
+**  See also:
+**    RFID_CheckFullMemory
+**  Parameters:
+**    buffer (IN) - Pointer to the buffer containing the response from the RFID reader
+**
+**  Return value:
+**    RFID_OK (0) - Response is OK
+**    RFID_SYNTAX_ERROR (4) - Syntax error
+**    RFID_CHCK_ERROR (3) - Checksum error
+**************************************************************************************************/
+STATIC UINT8 RFID_VerifyFullMemory(const UINT8 *buffer)
+{
+  // Check start byte
+  if (buffer[0] != RFID_CMD_OK) return RFID_SYNTAX_ERROR;
+  // Check end byte
+  if (buffer[RFID_EXPEC_RES_FM_LEN - 1u] != RFID_ETX) return RFID_SYNTAX_ERROR;
+
+  // Check the checksum
+  return RFID_VerifyChecksum(buffer, RFID_EXPEC_RES_FM_LEN);
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_VerifyRecordPair(const UINT8 *buffer, UINT8 u8_len)
+**
+**  Description:
+**    This function verifies the Single Read Words response for an even/odd record pair and
+**    parses the records into s_rfidTagRecordEven and s_rfidTagRecordOdd. The frame has a fixed
+**    length, so ETX values inside the payload need not be considered.
+**
+**  See also:
+**    RFID_CmdReadRotation
+**  Parameters:
+**    buffer (IN) - Pointer to the buffer containing the response from the RFID reader
+**    u8_len (IN) - Length of the received frame
+**
+**  Return value:
+**    RFID_OK (0) - Response is OK
+**    RFID_SYNTAX_ERROR (4) - Syntax error
+**    RFID_CHCK_ERROR (3) - Checksum error
+**    RFID_REC_xxx - Record can not be parsed
+**************************************************************************************************/
+STATIC UINT8 RFID_VerifyRecordPair(const UINT8 *buffer, UINT8 u8_len)
+{
+  t_RFID_RAW_DATA s_rfidRawData;
+  UINT8 u8_res;
+  UINT8 i;
+
+  // Check length, start byte and end byte
+  if (u8_len != RFID_EXPEC_RES_SR2_LEN) return RFID_SYNTAX_ERROR;
+  if (buffer[0] != RFID_CMD_OK) return RFID_SYNTAX_ERROR;
+  if (buffer[RFID_EXPEC_RES_SR2_LEN - 1u] != RFID_ETX) return RFID_SYNTAX_ERROR;
+
+  // Check the checksum
+  if (RFID_VerifyChecksum(buffer, RFID_EXPEC_RES_SR2_LEN) != RFID_OK)
+  {
+    return RFID_CHCK_ERROR;
+  }
+
+  // Parse the even record (first) and the odd record (second)
+  s_rfidRawData.u8_len = RFID_REC_TOTAL_LEN;
+  for (i = 0; i < RFID_REC_TOTAL_LEN; i++)
+  {
+    s_rfidRawData.au8_data[i] = buffer[1u + i];
+  }
+  u8_res = RFID_ParseRecord(&s_rfidRawData, &s_rfidTagRecordEven);
+  if (u8_res == RFID_REC_OK)
+  {
+    for (i = 0; i < RFID_REC_TOTAL_LEN; i++)
+    {
+      s_rfidRawData.au8_data[i] = buffer[1u + RFID_REC_TOTAL_LEN + i];
+    }
+    u8_res = RFID_ParseRecord(&s_rfidRawData, &s_rfidTagRecordOdd);
+  }
+  return (u8_res == RFID_REC_OK) ? RFID_OK : u8_res;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    t_RFID_FAILURE RFID_CheckFullMemory(const UINT8 *buffer)
+**
+**  Description:
+**    This function checks the complete tag memory of a verified full memory response. First the
+**    memory CRC (M_CRC) over all records is checked. Afterwards each record is parsed and its
+**    sequence number and record CRC are checked. Every even/odd record pair must contain the
+**    same S2L ID and its complement.
+**    The records are processed pairwise in s_rfidTagRecordEven and s_rfidTagRecordOdd, so
+**    CHECK_TAG_RECORDS can publish the S2L ID as in the rotation mode.
+**
+**    Note: The M_CRC uses the same parameters as the record CRC and is stored MSB first.
+**
+**  See also:
+**    RFID_VerifyFullMemory
+**  Parameters:
+**    buffer (IN) - Pointer to the buffer containing the response from the RFID reader
+**
+**  Return value:
+**    RFID_FAIL_NONE - All records are valid
+**    RFID_FAIL_FULL_MEM_xxx, RFID_FAIL_S2L_ID_VERIFY - Type of the detected failure
+**************************************************************************************************/
+STATIC t_RFID_FAILURE RFID_CheckFullMemory(const UINT8 *buffer)
+{
+  /* Memory starts after the status byte */
+  const UINT8 *pau8_mem = &buffer[1];
+  t_RFID_RAW_DATA s_rfidRawData;
+  t_RFID_TAG_DATA *ps_record;
+  UINT8 au8_s2l_id[RFID_S2L_ID_LEN];
+  UINT32 u32_receivedCRC = 0x00000000;
+  UINT8 u8_rec;
+  UINT8 i;
+
+  /* 1. Memory CRC */
+  for (i = 0; i < RFID_MEM_CRC_LEN; i++)
+  {
+    u32_receivedCRC = (u32_receivedCRC << 8) |
+                      (UINT32)pau8_mem[(RFID_REC_COUNT * RFID_REC_TOTAL_LEN) + i];
+  }
+  if (RFID_Crc32(pau8_mem, RFID_REC_COUNT * RFID_REC_TOTAL_LEN) != u32_receivedCRC)
+  {
+    return RFID_FAIL_FULL_MEM_MCRC_ERROR;
+  }
+
+  /* 2. Records */
+  s_rfidRawData.u8_len = RFID_REC_TOTAL_LEN;
+  for (u8_rec = 0; u8_rec < RFID_REC_COUNT; u8_rec++)
+  {
+    ps_record = ((u8_rec & 0x01u) == 0u) ? &s_rfidTagRecordEven : &s_rfidTagRecordOdd;
+
+    for (i = 0; i < RFID_REC_TOTAL_LEN; i++)
+    {
+      s_rfidRawData.au8_data[i] = pau8_mem[(u8_rec * RFID_REC_TOTAL_LEN) + i];
+    }
+    if (RFID_ParseRecord(&s_rfidRawData, ps_record) != RFID_REC_OK)
+    {
+      return RFID_FAIL_FULL_MEM_VERIFY;
+    }
+    if (ps_record->u8_seq_num != u8_rec)
+    {
+      return RFID_FAIL_FULL_MEM_SEQ_NUM_ERROR;
+    }
+    if (RFID_CalculateCRC(ps_record) != RFID_OK)
+    {
+      return RFID_FAIL_FULL_MEM_CRC_ERROR;
+    }
+
+    /* 3. S2L ID of the record pair, all pairs must contain the same S2L ID */
+    if ((u8_rec & 0x01u) != 0u)
+    {
+      if (RFID_CheckS2LID() != RFID_OK)
+      {
+        return RFID_FAIL_S2L_ID_VERIFY;
+      }
+      for (i = 0; i < RFID_S2L_ID_LEN; i++)
+      {
+        if (u8_rec == 1u)
+        {
+          au8_s2l_id[i] = s_rfidTagRecordEven.au8_s2l_id[i];
+        }
+        else if (au8_s2l_id[i] != s_rfidTagRecordEven.au8_s2l_id[i])
+        {
+          return RFID_FAIL_S2L_ID_VERIFY;
+        }
+      }
+    }
+  }
+  return RFID_FAIL_NONE;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_TagCacheStore(void)
+**
+**  Description:
+**    This function stores the UID and the S2L ID of the completely verified tag (even record)
+**    in the verified tag cache.
+**
+**  See also:
+**    RFID_TagCacheUsable
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_TagCacheStore(void)
+{
+  UINT8 i;
+
   for (i = 0; i < RFID_UID_LEN; i++)
   {
-    au8_crc_input[offset++] = s_rfidTagData->au8_tag_uid[i];
-    //au8_crc_input[offset++] = s_rfidTagData->au8_tag_uid[RFID_UID_LEN - 1 - i]; // Reverse order
-  }
-
-  /* 2. Sequence number */
-  au8_crc_input[offset++] = s_rfidTagData->u8_seq_num;
-
-  /* 3. Reserved bytes (3 bytes 0x00) */
-  for (i = 0; i < RFID_RES_LEN; i++)
-  {
-    au8_crc_input[offset++] = au8_reserved[i];
+    s_rfidTagCache.au8_tag_uid[i] = s_rfidTagRecordEven.au8_tag_uid[i];
   }
-
-  /* 4. S2L ID (4 bytes) */
   for (i = 0; i < RFID_S2L_ID_LEN; i++)
   {
-    au8_crc_input[offset++] = s_rfidTagData->au8_s2l_id[i];
-  }
-
-  /* Calculate CRC and compare with received CRC */
-  if (CRC32(au8_crc_input, offset) == u32_receivedCRC)
-  {
-   /* CRC is valid, proceed with the tag data */
-   return RFID_OK;
-  }
-  else
-  {
-    /* CRC error, handle accordingly */
-    return RFID_REC_CRC_ERROR;
+    s_rfidTagCache.au8_s2l_id[i] = s_rfidTagRecordEven.au8_s2l_id[i];
   }
+  s_rfidTagCache.u32_verifyTime = timerHAL_GetSystemTime3();
+  s_rfidTagCache.u8_valid = 1u;
 }
 
-/****************************************************************************************************
+/**************************************************************************************************
 **
 **  Function:
-**    UINT8 RFID_CheckTagRecordFields(void)
+**    void RFID_TagCacheInvalidate(void)
 **
 **  Description:
-**    This function checks the plausibility of of all fields of the read records from 
-**    the RFID tag. It checks the sequence number, reserved bytes and S2L ID. And compares it 
-**    with the the received data from the second safety controller.
+**    This function invalidates the verified tag cache. The next read cycle verifies the tag
+**    completely.
 **
 **  See also:
 **    -
 **  Parameters:
 **    -
 **  Return value:
-**    RFID_REC_OK (0) - All fields are valid
-**    RFID_REC_INVALID_LEN (1) - Record length is invalid
-**    RFID_REC_INVALID_S2L_ID (4) - S2L ID is invalid
-**    RFID_REC_INVALID_SEQ_NUM (5) - Sequence number is invalid
-**    RFID_REC_INVALID_UID (6) - UID is invalid
-*****************************************************************************************************
-*/
-STATIC UINT8 RFID_CheckTagRecordFields(void)
+**    -
+**************************************************************************************************/
+STATIC void RFID_TagCacheInvalidate(void)
 {
-  u32_RfidInfo = 0uL;
   UINT8 i;
-  for (i = 0; i < 4; i++)
+
+  s_rfidTagCache.u8_valid = 0u;
+  for (i = 0; i < RFID_UID_LEN; i++)
   {
-    /* switch the order of the bytes */
-    u32_RfidInfo |= ((UINT32)s_rfidTagRecordEven.au8_s2l_id[i]) << (8 * i);
+    s_rfidTagCache.au8_tag_uid[i] = 0xFF;
+  }
+  for (i = 0; i < RFID_S2L_ID_LEN; i++)
+  {
+    s_rfidTagCache.au8_s2l_id[i] = 0xFF;
   }
-  /* Search for new tag again */
-  return RFID_OK;
 }
 
 /**************************************************************************************************
 **
 **  Function:
-**    UINT8 RFID_CheckS2LID(void)
+**    UINT8 RFID_TagCacheUsable(void)
 **
 **  Description:
-**    This function checks the S2L ID of the read records from the RFID tag.
-**    It calculates the complement S2L ID from the odd-numbered record and compares it
-**    with the S2L ID in the even-numbered record to verify integrity.
+**    This function checks if the next read cycle can be a spot check. The cache must be valid
+**    and the complete verification must not be older than RFID_TAG_CACHE_MAX_AGE.
 **
-**    Note: The record with an even sequence number contains the original Tag ID.
-**          The record with an odd sequence number contains the bitwise complement of the Tag ID.
-** See also:
-**    -
+**  See also:
+**    RFID_TagCacheMatch
 **  Parameters:
 **    -
 **  Return value:
-**    RFID_OK (0) - S2L ID is valid
-**    RFID_FAIL_S2L_ID_VERIFY - S2L ID is invalid
-*/
-STATIC UINT8 RFID_CheckS2LID(void)
+**    0 - complete verification necessary
+**    1 - spot check possible
+**************************************************************************************************/
+STATIC UINT8 RFID_TagCacheUsable(void)
 {
-  UINT8 firstUsedIndex = RFID_S2L_ID_LEN;
+  UINT8 u8_usable = 0u;
 
-  // Find the first non-zero byte in the complement S2L ID (odd record)
-  for (UINT8 i = 0; i < RFID_S2L_ID_LEN; i++)
+  if ((s_rfidTagCache.u8_valid != 0u) &&
+      ((timerHAL_GetSystemTime3() - s_rfidTagCache.u32_verifyTime) < RFID_TAG_CACHE_MAX_AGE))
   {
-    if (s_rfidTagRecordOdd.au8_s2l_id[i] != 0x00)
-    {
-      firstUsedIndex = i;
-      break;
-    }
+    u8_usable = 1u;
   }
+  return u8_usable;
+}
 
-  // If all bytes are 0x00, the ID is considered invalid
-  if (firstUsedIndex == RFID_S2L_ID_LEN)
-    return RFID_FAIL_S2L_ID_VERIFY;
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_TagCacheMatch(const UINT8 *pau8_tagUid)
+**
+**  Description:
+**    This function compares the given UID with the UID of the verified tag cache.
+**
+**  See also:
+**    RFID_TagCacheUsable
+**  Parameters:
+**    pau8_tagUid (IN) - UID of the tag in front of the reader
+**  Return value:
+**    RFID_OK (0) - UID matches the cache
+**    RFID_UNKNOWN_ERROR (7) - Other tag
+**************************************************************************************************/
+STATIC UINT8 RFID_TagCacheMatch(const UINT8 *pau8_tagUid)
+{
+  UINT8 u8_res = RFID_OK;
+  UINT8 i;
 
-  // Compare each relevant byte of the original and complemented S2L ID
-  for (UINT8 i = firstUsedIndex; i < RFID_S2L_ID_LEN; i++)
+  for (i = 0; i < RFID_UID_LEN; i++)
   {
-    UINT8 even = s_rfidTagRecordEven.au8_s2l_id[i];   // Original S2L ID byte
-    UINT8 odd  = s_rfidTagRecordOdd.au8_s2l_id[i];    // Complement S2L ID byte
-
-    if ((UINT8)(~odd) != even)
-      return RFID_FAIL_S2L_ID_VERIFY; // Mismatch found
+    if (pau8_tagUid[i] != s_rfidTagCache.au8_tag_uid[i])
+    {
+      u8_res = RFID_UNKNOWN_ERROR;
+    }
   }
-
-  return RFID_OK; // All checks passed
+  return u8_res;
 }
 
 /**************************************************************************************************
@@ -1241,394 +2748,98 @@ void delay_ms(uint32_t ms)
     RFID_FrameTxTrigger(RFID_CMD_VE_LEN);
  }
 
-
-
  /**************************************************************************************************
  **
  **  Function:
- **    void RFID_FrameTxSingleReadFixCode(void)
+ **    void RFID_FrameTxSetBaud(UINT8 u8_rateCode)
  **
  **  Description:
- **    This function sends the Single Read Fix Code command to the RFID reader.
+ **    This function sends the change baud rate command to the RFID reader. The reader sends
+ **    the response with the old baud rate and uses the new baud rate afterwards.
  **
  **  See also:
- **    -
+ **    uartBaudSet
  **
  **  Parameters:
- **    -
+ **    u8_rateCode (IN) - Rate code of the new baud rate (RFID_BAUD_CODE_...)
  **
  **  Return value:
  **    -
  **************************************************************************************************/
- STATIC void RFID_FrameTxSingleReadFixCode(void)
- {
-   /* Single read fix code command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x46;
-   au8_rfidDmaBufferTx[2] = 0x99; /* CHECKSUM */
-   au8_rfidDmaBufferTx[3] = 0x03; /* ETX */
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SF_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_0(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the first record from the 
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of 
-**   record 0 (0x000000 (ASCII 0x30)).
-** 
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_0(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x30; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   au8_rfidDmaBufferTx[8] = 0xC8; /* CHECKSUM */
-   au8_rfidDmaBufferTx[9] = 0x03; /* ETX */
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_1(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_1(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x33; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xCB; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_2(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_2(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x36; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xCE; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_3(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_3(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x39; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xD1; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_4(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_4(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x43; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xDB; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_5(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_5(void)
- {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x46; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xDE; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
-
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
-
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_6(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_6(void)
+ STATIC void RFID_FrameTxSetBaud(UINT8 u8_rateCode)
  {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
+   /* Change baud rate command */
+   au8_rfidDmaBufferTx[0] = 0x42;
    au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x31; 
-   au8_rfidDmaBufferTx[5] = 0x32; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xCB; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
+   /* Rate code */
+   au8_rfidDmaBufferTx[2] = u8_rateCode;
+   au8_rfidDmaBufferTx[3] = RFID_CalculateChecksum(au8_rfidDmaBufferTx, 3u); /* CHECKSUM */
+   au8_rfidDmaBufferTx[4] = 0x03; /* ETX */
 
    /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
+   RFID_FrameTxTrigger(RFID_CMD_BR_LEN);
  }
 
-/**************************************************************************************************
-**
-** Function:
-**   void RFID_FrameTxReadRecord_7(void)
-**
-** Description:
-**   This function sends the Single Read Words command to read the second record from the
-**   preprogrammed RFID tag memory. The command is used to read 3 words with a start address of
-**   record 1 (0x000003 (ASCII 0x33)).
-**
-** See also:
-**   -
-** Parameters:
-**   -
-** Return value:
-**   -
-**************************************************************************************************/
- STATIC void RFID_FrameTxReadRecord_7(void)
+
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    void RFID_FrameTxSingleReadFixCode(void)
+ **
+ **  Description:
+ **    This function sends the Single Read Fix Code command to the RFID reader.
+ **
+ **  See also:
+ **    -
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    -
+ **************************************************************************************************/
+ STATIC void RFID_FrameTxSingleReadFixCode(void)
  {
-   /* Currenly one records -> 3 words*/
-   /* Single Read Words command */
+   /* Single read fix code command */
    au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x31; 
-   au8_rfidDmaBufferTx[5] = 0x35; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x30;
-   au8_rfidDmaBufferTx[7] = 0x33;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xCE; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
+   au8_rfidDmaBufferTx[1] = 0x46;
+   au8_rfidDmaBufferTx[2] = 0x99; /* CHECKSUM */
+   au8_rfidDmaBufferTx[3] = 0x03; /* ETX */
 
    /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
+   RFID_FrameTxTrigger(RFID_CMD_SF_LEN);
  }
 
 /**************************************************************************************************
 **
 ** Function:
-**   void RFID_FrameTxReadFullMemory(void)
+**   void RFID_FrameTxCmd(const t_RFID_CMD_FRAME *ps_cmd)
 **
 ** Description:
-**  This function sends the Read Full Memory command to read the complete memory of the RFID tag.
-**  This function can be used to to read all records which are secured by the memory CRC which is 
-**  stored after the last record.
+**   This function sends a Single Read Words command from the frame tables. The frame is copied
+**   to the transmit DMA buffer.
 **
 ** See also:
-**   -
+**   RFID_CmdReadRecord
 ** Parameters:
-**   -
+**   ps_cmd (IN) - Command frame (not checked, only called with frames of the frame tables)
 ** Return value:
 **   -
 **************************************************************************************************/
-STATIC void RFID_FrameTxReadFullMemory(void)
+STATIC void RFID_FrameTxCmd(const t_RFID_CMD_FRAME *ps_cmd)
 {
+  UINT8 i;
 
-   /* Single Read Words command */
-   au8_rfidDmaBufferTx[0] = 0x53;
-   au8_rfidDmaBufferTx[1] = 0x52;
-   /* Word address */
-   au8_rfidDmaBufferTx[2] = 0x30; 
-   au8_rfidDmaBufferTx[3] = 0x30; 
-   au8_rfidDmaBufferTx[4] = 0x30; 
-   au8_rfidDmaBufferTx[5] = 0x30; 
-   /* Number of words */
-   au8_rfidDmaBufferTx[6] = 0x31;
-   au8_rfidDmaBufferTx[7] = 0x39;
-   /* CHECKSUM */
-   au8_rfidDmaBufferTx[8] = 0xCF; 
-   /* ETX */
-   au8_rfidDmaBufferTx[9] = 0x03;
+  for (i = 0u; i < RFID_CMD_SR_LEN; i++)
+  {
+    au8_rfidDmaBufferTx[i] = ps_cmd->au8_frame[i];
+  }
+
+  /* Send the frame */
+  RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
+}
 
-   /* Send the frame */
-   RFID_FrameTxTrigger(RFID_CMD_SR_LEN);
- }
 /**************************************************************************************************
  **
  **  Function:
@@ -1664,10 +2875,13 @@ STATIC void RFID_FrameTxReadFullMemory(void)
  **    void RFID_FrameRxInit(UINT8 u8_len)
  **
  **  Description:
- **    This function gets the length of the expected response frame and initializes the DMA buffer.
+ **    This function gets the length of the expected response frame. The receive DMA runs
+ **    continuously, so the frame extraction just starts at the current write position of the
+ **    ring. All received bytes, all frames which were not fetched by the state machine and a
+ **    chained command which was not sent yet are discarded.
  **
  **  See also:
- **    -
+ **    RFID_FrameRxChain
  **
  **  Parameters:
  **    u8_len (IN) - Length of the frame
@@ -1677,22 +2891,342 @@ STATIC void RFID_FrameTxReadFullMemory(void)
  **************************************************************************************************/
  STATIC void RFID_FrameRxInit(UINT8 u8_len)
  {
+   s_rfidRxCtrl.ps_chainCmd = NULL;
+   s_rfidRxCtrl.u8_rdCnt = s_rfidRxCtrl.u8_wrCnt;
+   u8_rfidRxFrameChained = 0u;
+
+   /* Start the next frame at the current write position of the DMA */
+   s_rfidRxCtrl.u8_frameStart = (UINT8)(RFID_RX_RING_SIZE - RFID_DMA_CHANNEL_RX->CNDTR);
+   s_rfidRxCtrl.u8_scanPos = s_rfidRxCtrl.u8_frameStart;
+   s_rfidRxCtrl.u8_scanSum = 0u;
+   s_rfidRxCtrl.u8_scanPrev = 0u;
+   s_rfidRxCtrl.u8_expLen = u8_len;
+   s_rfidRxCtrl.u8_active = 1u;
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    void RFID_FrameRxExtract(void)
+ **
+ **  Description:
+ **    This function searches the receive ring for the end of the expected frame. It processes
+ **    all bytes between the last scan position and the write position of the DMA.
+ **    A frame ends with
+ **      - the expected length or
+ **      - an ETX with a valid checksum in front, if the status is not RFID_CMD_OK. These
+ **        are the error responses, which are shorter than the expected frame.
+ **    The checksum is calculated in place while scanning. A 0x03 inside the payload of a
+ **    positive response therefore does not end the frame.
+ **    The function is called by the IDLE line interrupt and by the state machine. Both have the
+ **    same interrupt priority and never preempt each other.
+ **
+ **  See also:
+ **    RFID_FrameRxComplete
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    -
+ **************************************************************************************************/
+ STATIC void RFID_FrameRxExtract(void)
+ {
+   UINT8 u8_wrPos = (UINT8)(RFID_RX_RING_SIZE - RFID_DMA_CHANNEL_RX->CNDTR);
+   UINT8 u8_byte;
+   UINT8 u8_len;
+   UINT8 u8_chkOk;
+
+   while ((s_rfidRxCtrl.u8_active != 0u) && (s_rfidRxCtrl.u8_scanPos != u8_wrPos))
+   {
+     u8_byte = au8_rfidDmaBufferRx[s_rfidRxCtrl.u8_scanPos];
+     u8_len = (UINT8)(s_rfidRxCtrl.u8_scanPos - s_rfidRxCtrl.u8_frameStart) + 1u;
+
+     /* <CHCK> is the byte in front of <ETX>, it is the sum of all bytes in front of <CHCK> */
+     u8_chkOk = ((u8_byte == RFID_ETX) && (u8_len >= RFID_ERROR_RES_LEN) &&
+                 ((UINT8)(s_rfidRxCtrl.u8_scanSum - s_rfidRxCtrl.u8_scanPrev) ==
+                  s_rfidRxCtrl.u8_scanPrev)) ? 1u : 0u;
+
+     s_rfidRxCtrl.u8_scanSum += u8_byte;
+     s_rfidRxCtrl.u8_scanPrev = u8_byte;
+     s_rfidRxCtrl.u8_scanPos++;
+
+     if ((u8_len == s_rfidRxCtrl.u8_expLen) ||
+         ((u8_chkOk != 0u) && (au8_rfidDmaBufferRx[s_rfidRxCtrl.u8_frameStart] != RFID_CMD_OK)))
+     {
+       RFID_FrameRxComplete(u8_len, u8_chkOk);
+     }
+   }
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    void RFID_FrameRxChain(const t_RFID_CMD_FRAME *ps_cmd, UINT8 u8_len)
+ **
+ **  Description:
+ **    This function stores the command which is sent by the receive interrupt as soon as the
+ **    expected frame is received as positive response (RFID_CMD_OK) with a valid checksum. The
+ **    state machine verifies the frame in the receive ring while the next response is received
+ **    behind it. If the verification fails the response of the chained command is discarded.
+ **    Without RFID_RX_IRQ_CHAIN all commands are sent by the state machine.
+ **
+ **  See also:
+ **    RFID_FrameRxComplete
+ **
+ **  Parameters:
+ **    ps_cmd (IN) - Command frame (NULL: no chained command)
+ **    u8_len (IN) - Length of the expected response of the chained command
+ **
+ **  Return value:
+ **    -
+ **************************************************************************************************/
+ STATIC void RFID_FrameRxChain(const t_RFID_CMD_FRAME *ps_cmd, UINT8 u8_len)
+ {
+#if (RFID_RX_IRQ_CHAIN == 1u)
+   s_rfidRxCtrl.u8_chainLen = u8_len;
+   s_rfidRxCtrl.ps_chainCmd = ps_cmd;
+#else
+   (void)ps_cmd;
+   (void)u8_len;
+#endif
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    void RFID_FrameRxComplete(UINT8 u8_len, UINT8 u8_chkOk)
+ **
+ **  Description:
+ **    This function is called by the frame extraction at the end of a frame. It stores the
+ **    frame for the state machine and sends the chained command, if there is one. The next
+ **    frame starts directly behind the completed one.
+ **
+ **  See also:
+ **    RFID_FrameRxExtract
+ **
+ **  Parameters:
+ **    u8_len (IN)   - Length of the received frame
+ **    u8_chkOk (IN) - 1: <CHCK> and <ETX> of the frame are valid
+ **
+ **  Return value:
+ **    -
+ **************************************************************************************************/
+ STATIC void RFID_FrameRxComplete(UINT8 u8_len, UINT8 u8_chkOk)
+ {
+   UINT8 u8_idx = s_rfidRxCtrl.u8_wrCnt % RFID_RX_FRAME_CNT;
+   UINT8 u8_start = s_rfidRxCtrl.u8_frameStart;
+
+   s_rfidRxCtrl.u8_active = 0u;
+   s_rfidRxCtrl.u8_frameStart = s_rfidRxCtrl.u8_scanPos;
+   s_rfidRxCtrl.u8_scanSum = 0u;
+   s_rfidRxCtrl.u8_scanPrev = 0u;
+
+   /* Frame is lost if the state machine did not fetch the older frames, it runs into the
+    * timeout in this case */
+   if ((UINT8)(s_rfidRxCtrl.u8_wrCnt - s_rfidRxCtrl.u8_rdCnt) < RFID_RX_FRAME_CNT)
+   {
+     s_rfidRxCtrl.as_frame[u8_idx].u8_start = u8_start;
+     s_rfidRxCtrl.as_frame[u8_idx].u8_len = u8_len;
+     s_rfidRxCtrl.as_frame[u8_idx].u32_time = timerHAL_GetSystemTime3();
+     s_rfidRxCtrl.as_frame[u8_idx].u8_chained = 0u;
+
+     if ((s_rfidRxCtrl.ps_chainCmd != NULL) && (u8_len == s_rfidRxCtrl.u8_expLen) &&
+         (u8_chkOk != 0u) && (au8_rfidDmaBufferRx[u8_start] == RFID_CMD_OK))
+     {
+       s_rfidRxCtrl.as_frame[u8_idx].u8_chained = 1u;
+
+       RFID_FrameTxCmd(s_rfidRxCtrl.ps_chainCmd);
+       s_rfidRxCtrl.ps_chainCmd = NULL;
+       s_rfidRxCtrl.u8_expLen = s_rfidRxCtrl.u8_chainLen;
+       s_rfidRxCtrl.u8_active = 1u;
+     }
+
+     s_rfidRxCtrl.u8_wrCnt++;
+   }
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    const UINT8 *RFID_FrameRxGet(UINT8 *pu8_len)
+ **
+ **  Description:
+ **    This function returns the oldest complete frame which was not fetched yet by the state
+ **    machine. A frame which wraps around the end of the receive ring is copied to a linear
+ **    buffer. The frame stays valid until the next frame is fetched.
+ **
+ **  See also:
+ **    RFID_FrameRxChained
+ **
+ **  Parameters:
+ **    pu8_len (OUT) - Length of the received frame
+ **
+ **  Return value:
+ **    Pointer to the received frame, NULL if no frame is complete
+ **************************************************************************************************/
+ STATIC const UINT8 *RFID_FrameRxGet(UINT8 *pu8_len)
+ {
+   const UINT8 *pau8_frame = NULL;
+   UINT8 u8_idx;
+   UINT8 u8_start;
    UINT8 i;
 
-   for (i = 0; i < 100; i++)
+   /* process the bytes received since the last IDLE line interrupt */
+   RFID_FrameRxExtract();
+
+   u8_idx = s_rfidRxCtrl.u8_rdCnt % RFID_RX_FRAME_CNT;
+   if (s_rfidRxCtrl.u8_rdCnt != s_rfidRxCtrl.u8_wrCnt)
+   {
+     u8_start = s_rfidRxCtrl.as_frame[u8_idx].u8_start;
+     *pu8_len = s_rfidRxCtrl.as_frame[u8_idx].u8_len;
+
+     if (((UINT16)u8_start + (UINT16)*pu8_len) <= RFID_RX_RING_SIZE)
+     {
+       pau8_frame = &au8_rfidDmaBufferRx[u8_start];
+     }
+     else
+     {
+       for (i = 0; i < *pu8_len; i++)
+       {
+         au8_rfidRxFrameCopy[i] = au8_rfidDmaBufferRx[(UINT8)(u8_start + i)];
+       }
+       pau8_frame = au8_rfidRxFrameCopy;
+     }
+
+     pau8_rfidRxFrame = pau8_frame;
+     u8_rfidRxFrameChained = s_rfidRxCtrl.as_frame[u8_idx].u8_chained;
+     u32_rfidRxFrameTime = s_rfidRxCtrl.as_frame[u8_idx].u32_time;
+     s_rfidRxCtrl.u8_rdCnt++;
+   }
+   else
    {
-     au8_rfidDmaBufferRx[i] = 0x00u;
+     *pu8_len = 0u;
    }
+   return pau8_frame;
+ }
 
-   /* Disable DMA1 channel 5, to write data into the CNDTR and CMAR register 
-   * NOTE: If it is enabled, the registers are write protected */
-   RFID_DMA_CHANNEL_RX->CCR &= ~DMA_CCR5_EN; /* RX */
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    UINT8 RFID_FrameRxChained(void)
+ **
+ **  Description:
+ **    This function returns if the receive interrupt has already sent the next command after
+ **    the last fetched frame. The command was sent at u32_rfidRxFrameTime.
+ **
+ **  See also:
+ **    RFID_FrameRxGet
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    0 - next command must be sent by the state machine
+ **    1 - next command was sent by the receive interrupt
+ **************************************************************************************************/
+ STATIC UINT8 RFID_FrameRxChained(void)
+ {
+   return u8_rfidRxFrameChained;
+ }
 
-   /* Write DMA-size in CNTR-Register */
-   RFID_DMA_CHANNEL_RX->CNDTR = u8_len;
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    UINT8 RFID_FrameRxPending(void)
+ **
+ **  Description:
+ **    This function returns if the response of a command which was sent by the receive interrupt
+ **    is still expected. The response is not expected anymore after the longest read timeout.
+ **
+ **  See also:
+ **    -
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    0 - no response pending
+ **    1 - response pending
+ **************************************************************************************************/
+ STATIC UINT8 RFID_FrameRxPending(void)
+ {
+   UINT8 u8_pending = 0u;
 
-   /* Enable DMA and UART */
-   RFID_DMA_CHANNEL_RX->CCR |= DMA_CCR5_EN; /* RX */
+   if ((u8_rfidRxFrameChained != 0u) && (s_rfidRxCtrl.u8_active != 0u) &&
+       ((timerHAL_GetSystemTime3() - u32_rfidRxFrameTime) <= RFID_READ_FULL_MEM_TIMEOUT))
+   {
+     u8_pending = 1u;
+   }
+   return u8_pending;
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    const t_RFID_CMD_FRAME *RFID_CmdReadRecord(UINT8 u8_seqNum)
+ **
+ **  Description:
+ **    This function returns the Single Read Words command for the record with the given
+ **    sequence number.
+ **
+ **  See also:
+ **    RFID_FrameTxCmd
+ **
+ **  Parameters:
+ **    u8_seqNum (IN) - Sequence number of the record
+ **
+ **  Return value:
+ **    Command frame, NULL for an invalid sequence number
+ **************************************************************************************************/
+ STATIC const t_RFID_CMD_FRAME *RFID_CmdReadRecord(UINT8 u8_seqNum)
+ {
+   const t_RFID_CMD_FRAME *ps_cmd = NULL;
+
+   if (u8_seqNum < RFID_REC_COUNT)
+   {
+     ps_cmd = &as_rfidCmdReadRecord[u8_seqNum];
+   }
+   return ps_cmd;
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    const t_RFID_CMD_FRAME *RFID_CmdReadRotation(void)
+ **
+ **  Description:
+ **    This function returns the first Single Read Words command of the rotation mode. With
+ **    RFID_READ_REC_PAIR the command reads the even record u8_SequenceNumber and the odd record
+ **    behind it, otherwise only the even record.
+ **
+ **  See also:
+ **    RFID_DetermineNextRecords
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    Command frame, NULL for an invalid sequence number
+ **************************************************************************************************/
+ STATIC const t_RFID_CMD_FRAME *RFID_CmdReadRotation(void)
+ {
+   const t_RFID_CMD_FRAME *ps_cmd = NULL;
+
+   if (RFID_READ_REC_PAIR == 0u)
+   {
+     ps_cmd = RFID_CmdReadRecord(u8_SequenceNumber);
+   }
+   else if ((u8_SequenceNumber < RFID_REC_COUNT) && ((u8_SequenceNumber & 0x01u) == 0u) &&
+            (u8_OddSequenceNumber == (u8_SequenceNumber + 1u)))
+   {
+     ps_cmd = &as_rfidCmdReadRecordPair[u8_SequenceNumber / 2u];
+   }
+   else
+   {
+     /* Invalid sequence number */
+   }
+   return ps_cmd;
  }
 
  
@@ -1796,12 +3330,15 @@ STATIC void RFID_PurgeOutdatedTagData(void)
  **************************************************************************************************/
 STATIC void RFID_HandleFailure(t_RFID_FAILURE e_failure)
 {
+  RFID_JournalAdd(RFID_EVT_FAILURE, (UINT8)e_failure, u32_RfidInfo, RFID_UidLowGet(), 0uL);
   /* Reset the RFID info */
   RFID_PurgeOutdatedTagData();
-  u32_RfidInfo = 0uL;
+  RFID_TagCacheInvalidate();
+  RFID_InfoReset();
   /* Increment the failure count and set the last failure type */
   u8_rfidFailureCount++;
   e_rfidLastFailure = e_failure;
+  RFID_FailCntInc(e_failure);
 
   switch (e_failure)
   {
@@ -1814,6 +3351,14 @@ STATIC void RFID_HandleFailure(t_RFID_FAILURE e_failure)
     case RFID_FAIL_ODD_REC_TIMEOUT:
     case RFID_FAIL_ODD_REC_VERIFY:
     case RFID_FAIL_ODD_REC_CRC_ERROR:
+    case RFID_FAIL_FULL_MEM_TIMEOUT:
+    case RFID_FAIL_FULL_MEM_VERIFY:
+    case RFID_FAIL_FULL_MEM_SEQ_NUM_ERROR:
+    case RFID_FAIL_FULL_MEM_CRC_ERROR:
+    case RFID_FAIL_FULL_MEM_MCRC_ERROR:
+    case RFID_FAIL_SPOT_REC_VERIFY:
+    case RFID_FAIL_SPOT_REC_SEQ_NUM_ERROR:
+    case RFID_FAIL_SPOT_REC_CRC_ERROR:
     case RFID_FAIL_S2L_ID_VERIFY:
       /* Reset the access state to retry reading the UID */
       e_rfidAccessState = TX_READ_UID;
@@ -1877,8 +3422,9 @@ STATIC void RFID_HandleFailure(t_RFID_FAILURE e_failure)
   *
   * and (16 * USARTDIV) == USART_BRR
   */
-  USART3->BRR = (UINT16) ((UINT32) RFID_SYSCLOCK / (UINT32)((UINT32) RFID_38400_BAUDRATE * 2u));
-  // TODO check it later sUsart->BRR = (UINT16) ((UINT32) RFID_SYSCLOCK / (UINT32) ((UINT32) RFID_115200_BAUD * 2u));
+  /* The reader boots with 38400 baud, the baud rate is negotiated in RFID_Reader_Boot() */
+  USART3->BRR = RFID_USART_BRR(RFID_38400_BAUDRATE);
+  u32_rfidBaudRate = RFID_38400_BAUDRATE;
 
   /* activate transmit and receive */
   USART3->CR1 = (USART_CR1_RE | USART_CR1_TE);
@@ -1954,69 +3500,229 @@ STATIC void RFID_HandleFailure(t_RFID_FAILURE e_failure)
  **************************************************************************************************/
  STATIC void uartInitDmaRx(void)
  {
-   /* enable DMA1 clock */
-   RCC->AHBENR |= RCC_AHBENR_DMA1EN;
-
-   /* enable DMA transfer for USART3 */
-   USART3->CR3 |= USART_CR3_DMAR; /* DMA enable receiver */
-
-   /* settings for RX DMA:
-    * Memory increment mode : 1: Memory increment mode enabled
-    * Channel priority level: 11: Very high */
-   RFID_DMA_CHANNEL_RX->CCR = (DMA_CCR5_MINC | DMA_CCR5_PL);
+   /* enable DMA1 clock */
+   RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+
+   /* enable DMA transfer for USART3 */
+   USART3->CR3 |= USART_CR3_DMAR; /* DMA enable receiver */
+
+   /* settings for RX DMA:
+    * Memory increment mode : 1: Memory increment mode enabled
+    * Channel priority level: 11: Very high
+    * Circular mode         : 1: the receive buffer is used as ring */
+   RFID_DMA_CHANNEL_RX->CCR = (DMA_CCR5_MINC | DMA_CCR5_PL | DMA_CCR5_CIRC);
+
+   /* write the the USART3_DR address into the DMA channel peripheral address register */
+   RFID_DMA_CHANNEL_RX->CPAR = (UINT32) &USART3->DR;/*lint !e923*/
+   /* Lint message disabled because the register address is written to the
+    * DMA register as integer value. */
+
+   /* write address of RxBuffer in CMAR-Register */
+   RFID_DMA_CHANNEL_RX->CMAR = (UINT32)au8_rfidDmaBufferRx;
+
+   /* Write size of the ring in CNTR-Register, reloaded automatically in circular mode */
+   RFID_DMA_CHANNEL_RX->CNDTR = RFID_RX_RING_SIZE;
+
+   /* enables the USART3 DMA receive, the DMA runs continuously from now on */
+   RFID_DMA_CHANNEL_RX->CCR |= DMA_CCR5_EN; /* RX */
+ }
+
+ /**************************************************************************************************
+ **
+ **  Function:
+ **    void uartInitIrq(void)
+ **
+ **  Description:
+ **    This function enables the IDLE line interrupt of the UART and the UART interrupt in the
+ **    NVIC.
+ **
+ **  See also:
+ **    -
+ **
+ **  Parameters:
+ **    -
+ **
+ **  Return value:
+ **    -
+ **************************************************************************************************/
+ STATIC void uartInitIrq(void)
+ {
+   s_rfidRxCtrl.u8_active = 0u;
+   s_rfidRxCtrl.u8_wrCnt = 0u;
+   s_rfidRxCtrl.u8_rdCnt = 0u;
+   s_rfidRxCtrl.ps_chainCmd = NULL;
 
-   /* write the the USART3_DR address into the DMA channel peripheral address register */
-   RFID_DMA_CHANNEL_RX->CPAR = (UINT32) &USART3->DR;/*lint !e923*/
-   /* Lint message disabled because the register address is written to the
-    * DMA register as integer value. */
+   /* enable IDLE line interrupt */
+   USART3->CR1 |= USART_CR1_IDLEIE;
 
-   /* write address of RxBuffer in CMAR-Register */
-   RFID_DMA_CHANNEL_RX->CMAR = (UINT32)au8_rfidDmaBufferRx;
+   /* set priority */
+   NVIC_SetPriority(USART3_IRQn, RFID_IRQ_PRIORITY);
 
-   /* enables the USART3 DMA receive */
-   /* TODO serialHAL_ReceiveUSART3Dma(u32DataLength); */
+   /* enable interrupt */
+   NVIC_EnableIRQ(USART3_IRQn);
  }
 
 /**************************************************************************************************
-** 
+**
+**  Function:
+**    void uartBaudSet(UINT32 u32_baud)
+**
+**  Description:
+**    This function changes the baud rate of the UART. It must only be called if no frame is
+**    transmitted, i.e. after the response of the last command was received.
+**
+**  See also:
+**    uartInit
+**
+**  Parameters:
+**    u32_baud (IN) - New baud rate
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void uartBaudSet(UINT32 u32_baud)
+{
+  USART3->CR1 &= ~USART_CR1_UE;
+  USART3->BRR = RFID_USART_BRR(u32_baud);
+  USART3->CR1 |= USART_CR1_UE;
+  u32_rfidBaudRate = u32_baud;
+}
+
+/**************************************************************************************************
+**
 **  Function:
-**    UINT32 CRC32(const UINT8* data, UINT8 length)
+**    void RFID_BaudFallback(void)
 **
 **  Description:
-**    This function calculates the CRC32 checksum for the given data.
+**    This function is called if the reader does not answer with the negotiated baud rate. The
+**    reader is requested to return to the boot baud rate, afterwards the communication is
+**    verified again with the boot baud rate (see RX_SET_BAUD).
 **
 **  See also:
+**    RFID_Reader_Boot
+**
+**  Parameters:
+**    -
+**
+**  Return value:
 **    -
+**************************************************************************************************/
+STATIC void RFID_BaudFallback(void)
+{
+  u8_rfidBaudTrial = 0u;
+  u8_rfidBaudFallback = 1u;
+  TIMER_START(s_BootFirmware);
+  RFID_FrameTxSetBaud(RFID_BAUD_CODE_38400);
+  RFID_FrameRxInit(RFID_RES_LEN);
+  e_rfidAccessState = RX_SET_BAUD;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_BaudResync(void)
+**
+**  Description:
+**    This function is called if the reader does not answer with the negotiated baud rate any
+**    more, e.g. after a power cycle of the reader which resets it to RFID_38400_BAUDRATE. The
+**    UART is switched to RFID_38400_BAUDRATE and the reader is booted again incl. the baud rate
+**    negotiation. If the reader does not answer with the boot baud rate either, the boot
+**    failure handling applies (see RX_BOOT_FIRMWARE).
+**
+**  See also:
+**    RFID_Reader_Boot, RFID_BAUD_RESYNC_TIMEOUTS
+**
 **  Parameters:
-**    data (IN)   - Pointer to the data
-**    length (IN) - Length of the data
+**    -
 **
 **  Return value:
 **    -
-*****************************************************************************************************/
-STATIC UINT32 CRC32(const UINT8 * data, UINT8 length)
+**************************************************************************************************/
+STATIC void RFID_BaudResync(void)
 {
- UINT32 crc = CRC_SEED; 
+  u8_rfidUidTimeoutCnt = 0u;
+  u8_rfidBaudTrial = 0u;
+  u8_rfidBaudFallback = 0u;
+  uartBaudSet(RFID_38400_BAUDRATE);
+  e_rfidAccessState = TX_BOOT_FIRMWARE;
+}
 
- UINT8 i;
- UINT8 j;
- for (i = 0; i< length; i++)
- {
-    crc ^= (UINT32)data[i] << 24;
-    for (j = 0; j <  8; j++) 
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_PollBackoff(UINT8 u8_tagPresent)
+**
+**  Description:
+**    This function adapts the UID poll interval to the result of the last UID read. A tag
+**    restores the full rate, consecutive "no tag" responses increase the interval up to
+**    RFID_POLL_IDLE_INTERVAL (see RFID.h).
+**
+**  See also:
+**    RFID_PollIntervalGet
+**
+**  Parameters:
+**    u8_tagPresent (IN) - 1: UID response with a tag, 0: "no tag" response
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_PollBackoff(UINT8 u8_tagPresent)
+{
+  if ((u8_tagPresent != 0u) || (RFID_POLL_IDLE_INTERVAL == 0u))
+  {
+    u8_rfidNoTagCnt = 0u;
+    u32_rfidPollInterval = 0uL;
+  }
+  else if (u8_rfidNoTagCnt < RFID_POLL_BACKOFF_CNT)
+  {
+    u8_rfidNoTagCnt++;
+  }
+  else if (u32_rfidPollInterval == 0uL)
+  {
+    u32_rfidPollInterval = RFID_POLL_BACKOFF_START;
+  }
+  else
+  {
+    u32_rfidPollInterval *= 2u;
+    if (u32_rfidPollInterval > RFID_POLL_IDLE_INTERVAL)
     {
-      if (crc & 0x80000000)
-      {
-        crc = (crc << 1) ^ CRC_POLY;
-      }
-      else
-      {
-        crc <<=1;
-      }
+      u32_rfidPollInterval = RFID_POLL_IDLE_INTERVAL;
     }
   }
- crc ^= CRC_XOROUT;
- return crc;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_PollDutyUpdate(UINT8 u8_active)
+**
+**  Description:
+**    This function counts one RFID_ReadTag() call for the duty cycle measurement. At the end of
+**    the window the duty cycle is calculated and a new window is started.
+**
+**  See also:
+**    RFID_PollDutyGet
+**
+**  Parameters:
+**    u8_active (IN) - 1: call was active, 0: call was idle because of the reduced poll rate
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_PollDutyUpdate(UINT8 u8_active)
+{
+  u16_rfidDutyCalls++;
+  if (u8_active != 0u)
+  {
+    u16_rfidDutyActive++;
+  }
+
+  if (u16_rfidDutyCalls >= RFID_POLL_DUTY_WINDOW)
+  {
+    u16_rfidDutyPermille = (UINT16)(((UINT32)u16_rfidDutyActive * 1000uL) / u16_rfidDutyCalls);
+    u16_rfidDutyCalls = 0u;
+    u16_rfidDutyActive = 0u;
+  }
 }
 
 /**************************************************************************************************
@@ -2044,7 +3750,7 @@ STATIC void timerStart(t_TIME *ps_timer)
 /**************************************************************************************************
 **
 **  Function:
-**    void timerStop(t_TIME *ps_timer)
+**    UINT32 timerStop(t_TIME *ps_timer)
 **
 **  Description:
 **    This function stops the timer.
@@ -2056,9 +3762,9 @@ STATIC void timerStart(t_TIME *ps_timer)
 **    ps_timer (IN) - Pointer to the timer structure
 **
 **  Return value:
-**    -
+**    Measured duration in us
 **************************************************************************************************/
-STATIC void timerStop(t_TIME *ps_timer)
+STATIC UINT32 timerStop(t_TIME *ps_timer)
 {
   UINT32 u32_curTime = (UINT32)(timerHAL_GetSystemTime3() - ps_timer->u32_cur);
 
@@ -2066,6 +3772,278 @@ STATIC void timerStop(t_TIME *ps_timer)
   {
     ps_timer->u32_max = u32_curTime;
   }
+  return u32_curTime;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_HistAdd(t_RFID_HIST e_hist, UINT32 u32_time)
+**
+**  Description:
+**    This function increments the bucket of the latency histogram which contains the given
+**    duration. If the bucket reached 0xFFFF, all buckets of the histogram are halved before, so
+**    the distribution is kept (see histSYS_Add()).
+**
+**  See also:
+**    RFID_DiagHistGet
+**
+**  Parameters:
+**    e_hist (IN)   - Histogram
+**    u32_time (IN) - Duration in us
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_HistAdd(t_RFID_HIST e_hist, UINT32 u32_time)
+{
+  UINT8 u8_bucket = 0u;
+
+  while ((u8_bucket < (RFID_HIST_BUCKET_CNT - 1u)) && (u32_time >= au32_rfidHistBound[u8_bucket]))
+  {
+    u8_bucket++;
+  }
+  if (e_hist < RFID_HIST_CNT)
+  {
+    histSYS_Add(au16_rfidHist[e_hist], (UINT8)RFID_HIST_BUCKET_CNT, (UINT32)u8_bucket);
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_FailCntInc(t_RFID_FAILURE e_failure)
+**
+**  Description:
+**    This function increments the counter of the given failure type. The counters saturate.
+**
+**  See also:
+**    RFID_DiagFailCntGet
+**
+**  Parameters:
+**    e_failure (IN) - Failure type
+**
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_FailCntInc(t_RFID_FAILURE e_failure)
+{
+  if (((UINT8)e_failure < RFID_FAIL_CNT) && (au16_rfidFailCnt[e_failure] < 0xFFFFu))
+  {
+    au16_rfidFailCnt[e_failure]++;
+  }
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT32 RFID_UidLowGet(void)
+**
+**  Description:
+**    This function returns the lower 4 bytes of the UID of the last read tag (journal).
+**
+**  See also:
+**    RFID_JournalAdd
+**
+**  Parameters:
+**    -
+**
+**  Return value:
+**    Lower 4 bytes of the UID (last UID byte in bit 0..7)
+**************************************************************************************************/
+STATIC UINT32 RFID_UidLowGet(void)
+{
+  UINT32 u32_uidLow = 0uL;
+  UINT8 i;
+
+  for (i = RFID_UID_LEN - 4u; i < RFID_UID_LEN; i++)
+  {
+    u32_uidLow = (u32_uidLow << 8) | (UINT32)s_rfidTagRecordEven.au8_tag_uid[i];
+  }
+  return u32_uidLow;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_InfoReset(void)
+**
+**  Description:
+**    This function resets the RFID information when the current read is abandoned (tag removed
+**    or replaced, error response, timeout, failure). The confirmation of the last digest is
+**    cleared as well, so the S2L ID of a new read is only released after the digest of the new
+**    read was confirmed by controller 2 (see RFID_DigestAckSet).
+**
+**  See also:
+**    RFID_InfoGet
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_InfoReset(void)
+{
+  u32_RfidInfo = 0uL;
+  u32_rfidDigestInfo = 0uL;
+  u8_rfidDigestCur = 0u;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DigestBuild(void)
+**
+**  Description:
+**    This function builds the digest of the completely verified record pair (controller 1).
+**    Instead of the UID the lower 16 bit of the CRC register after the UID are transferred.
+**    The odd S2L ID is described by the index of its first used byte, the remaining bytes are
+**    the complement of the even S2L ID (see RFID_CheckS2LID).
+**
+**  See also:
+**    RFID_DigestCheck
+**  Parameters:
+**    -
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_DigestBuild(void)
+{
+  UINT32 u32_uidHash = RFID_Crc32Update(RFID_CRC_SEED, s_rfidTagRecordEven.au8_tag_uid,
+                                        RFID_UID_LEN);
+  UINT8 u8_first = 0u;
+  UINT8 i;
+
+  while ((u8_first < (RFID_S2L_ID_LEN - 1u)) && (s_rfidTagRecordOdd.au8_s2l_id[u8_first] == 0u))
+  {
+    u8_first++;
+  }
+
+  for (i = 0u; i < RFID_S2L_ID_LEN; i++)
+  {
+    s_rfidDigest.au8_s2lId[i] = s_rfidTagRecordEven.au8_s2l_id[i];
+  }
+  for (i = 0u; i < RFID_RECORD_CRC_LEN; i++)
+  {
+    s_rfidDigest.au8_crcEven[i] = s_rfidTagRecordEven.au8_r_crc[i];
+    s_rfidDigest.au8_crcOdd[i] = s_rfidTagRecordOdd.au8_r_crc[i];
+  }
+  s_rfidDigest.au8_uidHash[0] = (UINT8)(u32_uidHash >> 8);
+  s_rfidDigest.au8_uidHash[1] = (UINT8)u32_uidHash;
+  s_rfidDigest.u8_seqNum = (UINT8)((s_rfidTagRecordEven.u8_seq_num & 0x0Fu) |
+                                   (UINT8)(s_rfidTagRecordOdd.u8_seq_num << 4));
+
+  u8_rfidDigestCnt = (UINT8)((u8_rfidDigestCnt + 1u) & RFID_DIGEST_CNT_MASK);
+  s_rfidDigest.u8_ctrl = (UINT8)((u8_rfidDigestCnt << RFID_DIGEST_CNT_SHIFT) | u8_first);
+  u8_rfidDigestCur = 1u;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    UINT8 RFID_DigestCheck(void)
+**
+**  Description:
+**    This function checks the received digest (controller 2). The odd S2L ID is rebuilt as
+**    complement of the even S2L ID. The CRC register after the UID is calculated backwards
+**    from the even R_CRC and compared with the UID hash, then the odd R_CRC is calculated
+**    forwards from it. So both records must have been written for the same UID and the odd
+**    record must contain the complement of the even S2L ID.
+**
+**  See also:
+**    RFID_DigestBuild
+**  Parameters:
+**    -
+**  Return value:
+**    RFID_OK (0) - Digest is valid
+**    RFID_FAIL_DIGEST_VERIFY - Digest is invalid
+**************************************************************************************************/
+STATIC UINT8 RFID_DigestCheck(void)
+{
+  UINT8 au8_s2lOdd[RFID_S2L_ID_LEN];
+  UINT8 au8_trailer[RFID_DIGEST_TRAILER_LEN];
+  UINT8 u8_seqEven = s_rfidDigest.u8_seqNum & 0x0Fu;
+  UINT8 u8_seqOdd = (UINT8)(s_rfidDigest.u8_seqNum >> 4);
+  UINT8 u8_first = s_rfidDigest.u8_ctrl & RFID_DIGEST_FIRST_MASK;
+  UINT32 u32_crcEven = 0uL;
+  UINT32 u32_crcOdd = 0uL;
+  UINT32 u32_crc;
+  UINT8 i;
+
+  /* digest belongs to the counter of the IO telegram, sequence numbers form a record pair */
+  if (((s_rfidDigest.u8_ctrl >> RFID_DIGEST_CNT_SHIFT) !=
+       (u8_rfidDigestCntIpc & RFID_DIGEST_CNT_MASK)) ||
+      ((u8_seqEven & 0x01u) != 0u) || (u8_seqOdd != (u8_seqEven + 1u)) ||
+      (u8_seqOdd >= RFID_REC_COUNT))
+  {
+    return RFID_FAIL_DIGEST_VERIFY;
+  }
+
+  /* odd S2L ID: unused leading bytes are 0, the first used byte must not be 0 */
+  for (i = 0u; i < RFID_S2L_ID_LEN; i++)
+  {
+    au8_s2lOdd[i] = (i < u8_first) ? 0u : (UINT8)(~s_rfidDigest.au8_s2lId[i]);
+  }
+  if (au8_s2lOdd[u8_first] == 0u)
+  {
+    return RFID_FAIL_DIGEST_VERIFY;
+  }
+
+  for (i = 0u; i < RFID_RECORD_CRC_LEN; i++)
+  {
+    u32_crcEven = (u32_crcEven << 8) | (UINT32)s_rfidDigest.au8_crcEven[i];
+    u32_crcOdd = (u32_crcOdd << 8) | (UINT32)s_rfidDigest.au8_crcOdd[i];
+  }
+
+  /* CRC register after the UID from the even record */
+  RFID_DigestTrailer(au8_trailer, u8_seqEven, s_rfidDigest.au8_s2lId);
+  u32_crc = RFID_Crc32Rewind(u32_crcEven ^ RFID_CRC_XOROUT, au8_trailer, RFID_DIGEST_TRAILER_LEN);
+  if ((s_rfidDigest.au8_uidHash[0] != (UINT8)(u32_crc >> 8)) ||
+      (s_rfidDigest.au8_uidHash[1] != (UINT8)u32_crc))
+  {
+    return RFID_FAIL_DIGEST_VERIFY;
+  }
+
+  /* odd record with the same UID */
+  RFID_DigestTrailer(au8_trailer, u8_seqOdd, au8_s2lOdd);
+  u32_crc = RFID_Crc32Update(u32_crc, au8_trailer, RFID_DIGEST_TRAILER_LEN) ^ RFID_CRC_XOROUT;
+  if (u32_crc != u32_crcOdd)
+  {
+    return RFID_FAIL_DIGEST_VERIFY;
+  }
+  return RFID_OK;
+}
+
+/**************************************************************************************************
+**
+**  Function:
+**    void RFID_DigestTrailer(UINT8 *pau8_trailer, UINT8 u8_seqNum, const UINT8 *pau8_s2lId)
+**
+**  Description:
+**    This function builds the record data after the UID as used for the R_CRC (see
+**    RFID_CalculateCRC): sequence number, reserved bytes (0) and S2L ID.
+**
+**  See also:
+**    RFID_CalculateCRC
+**  Parameters:
+**    pau8_trailer (OUT) - Buffer of RFID_DIGEST_TRAILER_LEN bytes
+**    u8_seqNum (IN)     - Sequence number
+**    pau8_s2lId (IN)    - S2L ID
+**  Return value:
+**    -
+**************************************************************************************************/
+STATIC void RFID_DigestTrailer(UINT8 *pau8_trailer, UINT8 u8_seqNum, const UINT8 *pau8_s2lId)
+{
+  UINT8 i;
+
+  pau8_trailer[0] = u8_seqNum;
+  for (i = 0u; i < RFID_RES_LEN; i++)
+  {
+    pau8_trailer[RFID_SEQ_NUM_LEN + i] = 0u;
+  }
+  for (i = 0u; i < RFID_S2L_ID_LEN; i++)
+  {
+    pau8_trailer[RFID_SEQ_NUM_LEN + RFID_RES_LEN + i] = pau8_s2lId[i];
+  }
 }
 
 #endif /* #ifdef RFID_ACTIVE */
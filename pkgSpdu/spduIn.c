@@ -26,6 +26,8 @@
 **             spduIn_PrepIpcTcoo
 **             setTgmTcoo
 **             setTgmIo
+**             splitSubframe
+**             mergeSubframe
 **
 **    History:
 **
@@ -96,24 +98,23 @@ typedef struct
 
 
 /** PRE-PROCESSOR CHECK **/
-/* This module expects the IO Data Message size of 14 bytes and the 
-** Time Coordination Message size of 6 byte. No generic approach because
-** of performance reasons.
+/* The sub frames are split into even and odd bytes (see splitSubframe() and mergeSubframe()),
+** so the IO Data Message and the Time Coordination Message must have an even size. Both sub
+** frames are exchanged in one IPC telegram.
 */
 /* Deactivated Lint Note 948: Operator '==' always evaluates to True */
 /*lint -e(948) */
-#ifdef RFID_ACTIVE
-IXX_TASSERT((AICMSGDEF_CIP_IN_DATA_SIZE  == 14u + (4u * 2)), spduIn_chk1)
-#else
-IXX_TASSERT((AICMSGDEF_CIP_IN_DATA_SIZE  == 14u), spduIn_chk1)
-#endif
+IXX_TASSERT(((AICMSGDEF_CIP_IN_DATA_SIZE  % 2u) == 0u), spduIn_chk1)
 /*lint -e(948) */
-IXX_TASSERT((AICMSGDEF_CIP_IN_DATA2_SIZE == 6u),  spduIn_chk2)
+IXX_TASSERT(((AICMSGDEF_CIP_IN_DATA2_SIZE % 2u) == 0u), spduIn_chk2)
+/*lint -e(948) */
+IXX_TASSERT((sizeof(t_SAFETGM_IPC) <= IPCXSYS_SIZEOF_MAX_PAYLOAD), spduIn_chk3)
 
 /* Mute lint warning type not referenced. These types are just defined for    */
 /* being able to do some elementary checks. */
 /*lint -esym(751, IXX_DUMMY_spduIn_chk1) not referenced - just for checks */
 /*lint -esym(751, IXX_DUMMY_spduIn_chk2) not referenced - just for checks */
+/*lint -esym(751, IXX_DUMMY_spduIn_chk3) not referenced - just for checks */
 
 
 /* u8_LastSentIoDui:
@@ -166,6 +167,10 @@ STATIC volatile UINT32 u32_TcooAddInfoTx   = 0u;
 
 STATIC void setTgmTcoo(void);
 STATIC void setTgmIo(void);
+STATIC void splitSubframe(volatile UINT8 *pau8_dst, const UINT8 *pau8_src, UINT8 u8_ofs,
+                          UINT8 u8_len);
+STATIC void mergeSubframe(UINT8 *pau8_dst, const volatile UINT8 *pau8_even,
+                          const volatile UINT8 *pau8_odd, UINT8 u8_len);
 
 /***************************************************************************************************
 **    global functions
@@ -422,15 +427,20 @@ void spduIn_ResetTgmTcco (void)
 ***************************************************************************************************/
 void spduIn_SendSafeTgm(void)
 { 
+  t_SAFETGM_IPC* ps_tgmTx;
+
+  /* reserve the IPC telegram in the Tx DMA buffer */
+  /* Cast from pointer to pointer is intended here because the subframes are written directly 
+  ** into the DMA buffer, t_SAFETGM_IPC only consists of bytes (no alignment). */
+  ps_tgmTx = (t_SAFETGM_IPC*)ipcxSYS_TxReserve(IPCXSYS_IPC_ID_SAFETGM, 
+                                               (UINT8)sizeof(t_SAFETGM_IPC)); /*lint !e927 */
+
+  /* write the subframes as one block, s_SafeTgmIpcTx is volatile because of the access in 
+  ** spduIn_PrepIpcIo and spduIn_PrepIpcTcoo */
+  *ps_tgmTx = s_SafeTgmIpcTx;
+
   /* send data via IPC */
-  /* Cast from pointer to pointer is intended here because the underlying function directly writes
-  ** into the DMA buffer. */
-  /* Note 960: Violates MISRA 2004 Required Rule 11.5, attempt to cast away const/volatile from a 
-  ** pointer or reference. It is accepted to cast away volatile here because data must be set 
-  ** because of volatile access in spduIn_PrepIpcIo and spduIn_PrepIpcTcoo */
-  ipcxSYS_SendBuffer(IPCXSYS_IPC_ID_SAFETGM, 
-                     (UINT8)sizeof(s_SafeTgmIpcTx), 
-                     (UINT8*)&s_SafeTgmIpcTx); /*lint !e928, !e960 */
+  ipcxSYS_TxCommit();
 }
 
 /***************************************************************************************************
@@ -457,12 +467,17 @@ void spduIn_SendSafeTgm(void)
 ***************************************************************************************************/
 void spduIn_RecvSafeTgm(void)
 {
-  /* receive data via IPC */
-  /* Cast from pointer to pointer is intended here because the underlying function directly reads
-  ** from the DMA buffer. */
-  ipcxSYS_GetBufferinclWait(IPCXSYS_IPC_ID_SAFETGM, 
-                            (UINT8)sizeof(s_SafeTgmIpcRx), 
-                            (UINT8*)&s_SafeTgmIpcRx); /*lint !e928 */
+  CONST t_SAFETGM_IPC* ps_tgmRx;
+
+  /* receive data via IPC, the IPC telegram is read once (consumed) */
+  /* Cast from pointer to pointer is intended here because the subframes are read directly 
+  ** from the DMA buffer, t_SAFETGM_IPC only consists of bytes (no alignment). */
+  ps_tgmRx = (CONST t_SAFETGM_IPC*)ipcxSYS_RxViewinclWait(
+               IPCXSYS_IPC_ID_SAFETGM, (UINT8)sizeof(t_SAFETGM_IPC)); /*lint !e927 */
+
+  /* keep the subframes as one block for spduIn_BuildTgm(), the DMA buffer is reused by the next
+  ** IPC telegram */
+  s_SafeTgmIpcRx = *ps_tgmRx;
 }
 
 /***************************************************************************************************
@@ -514,26 +529,8 @@ void spduIn_PrepIpcIo (UINT32 u32_addInfo, const UINT8* au8_ioData)
     /* store data for IPC exchange */
     s_SafeTgmIpcTx.u8_dataTgmCnt  = RDS_GET(u8_SubframeIoDui);
     
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-     * other than array indexing used
-     * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
     /* extract even bytes */
-    s_SafeTgmIpcTx.u8_dataTgm[0] = au8_ioData[0];
-    s_SafeTgmIpcTx.u8_dataTgm[1] = au8_ioData[2];
-    s_SafeTgmIpcTx.u8_dataTgm[2] = au8_ioData[4];
-    s_SafeTgmIpcTx.u8_dataTgm[3] = au8_ioData[6];
-    s_SafeTgmIpcTx.u8_dataTgm[4] = au8_ioData[8];
-    s_SafeTgmIpcTx.u8_dataTgm[5] = au8_ioData[10];
-    s_SafeTgmIpcTx.u8_dataTgm[6] = au8_ioData[12];
-#ifdef RFID_ACTIVE
-    s_SafeTgmIpcTx.u8_dataTgm[7] = au8_ioData[14];
-    s_SafeTgmIpcTx.u8_dataTgm[8] = au8_ioData[16];
-    s_SafeTgmIpcTx.u8_dataTgm[9] = au8_ioData[18];
-    s_SafeTgmIpcTx.u8_dataTgm[10] = au8_ioData[20];
-#endif    
-    /*lint +esym(960, 17.4)*/
-
+    splitSubframe(s_SafeTgmIpcTx.u8_dataTgm, au8_ioData, 0u, k_IODATA_MSG_IPC_LEN);
     
     /* Attention: Enable IRQs again */
     __enable_irq();
@@ -552,25 +549,8 @@ void spduIn_PrepIpcIo (UINT32 u32_addInfo, const UINT8* au8_ioData)
     /* store data for IPC exchange */
     s_SafeTgmIpcTx.u8_dataTgmCnt  = RDS_GET(u8_SubframeIoDui);
     
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-     * other than array indexing used
-     * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
     /* extract odd bytes */
-    s_SafeTgmIpcTx.u8_dataTgm[0] = au8_ioData[1];
-    s_SafeTgmIpcTx.u8_dataTgm[1] = au8_ioData[3];
-    s_SafeTgmIpcTx.u8_dataTgm[2] = au8_ioData[5];
-    s_SafeTgmIpcTx.u8_dataTgm[3] = au8_ioData[7];
-    s_SafeTgmIpcTx.u8_dataTgm[4] = au8_ioData[9];
-    s_SafeTgmIpcTx.u8_dataTgm[5] = au8_ioData[11];
-    s_SafeTgmIpcTx.u8_dataTgm[6] = au8_ioData[13];
-#ifdef RFID_ACTIVE
-    s_SafeTgmIpcTx.u8_dataTgm[7] = au8_ioData[15];
-    s_SafeTgmIpcTx.u8_dataTgm[8] = au8_ioData[17];
-    s_SafeTgmIpcTx.u8_dataTgm[9] = au8_ioData[19];
-    s_SafeTgmIpcTx.u8_dataTgm[10] = au8_ioData[21];
-#endif
-    /*lint +esym(960, 17.4)*/
+    splitSubframe(s_SafeTgmIpcTx.u8_dataTgm, au8_ioData, 1u, k_IODATA_MSG_IPC_LEN);
     
     /* Attention: Enable IRQs again */
     __enable_irq();
@@ -631,15 +611,8 @@ void spduIn_PrepIpcTcoo (UINT32 u32_addInfo, const UINT8* au8_tcoo)
     /* store data for IPC exchange */
     s_SafeTgmIpcTx.u8_tcooTgmCnt  = RDS_GET(u8_SubframeTcooDui);
       
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-     * other than array indexing used
-     * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
     /* extract even bytes */
-    s_SafeTgmIpcTx.u8_tcooTgm[0] = au8_tcoo[0];
-    s_SafeTgmIpcTx.u8_tcooTgm[1] = au8_tcoo[2];
-    s_SafeTgmIpcTx.u8_tcooTgm[2] = au8_tcoo[4];
-    /*lint +esym(960, 17.4)*/
+    splitSubframe(s_SafeTgmIpcTx.u8_tcooTgm, au8_tcoo, 0u, k_TCCO_MSG_IPC_LEN);
     
     /* Attention: Enable IRQs again */
     __enable_irq();
@@ -658,15 +631,8 @@ void spduIn_PrepIpcTcoo (UINT32 u32_addInfo, const UINT8* au8_tcoo)
     /* store data for IPC exchange */
     s_SafeTgmIpcTx.u8_tcooTgmCnt  = RDS_GET(u8_SubframeTcooDui);
     
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-     * other than array indexing used
-     * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
     /* extract odd bytes */
-    s_SafeTgmIpcTx.u8_tcooTgm[0] = au8_tcoo[1];
-    s_SafeTgmIpcTx.u8_tcooTgm[1] = au8_tcoo[3];
-    s_SafeTgmIpcTx.u8_tcooTgm[2] = au8_tcoo[5];
-    /*lint +esym(960, 17.4)*/
+    splitSubframe(s_SafeTgmIpcTx.u8_tcooTgm, au8_tcoo, 1u, k_TCCO_MSG_IPC_LEN);
     
     /* Attention: Enable IRQs again */
     __enable_irq();
@@ -720,35 +686,17 @@ STATIC void setTgmTcoo(void)
   */
   spduIn_s_Paket.u16_halcAddInfo2 = (UINT16)u32_TcooAddInfoTx;
   
-  /* if controller 1 */
+  /* if controller 1: even bytes are local, odd bytes are remote */
   if (eControllerId == SAFETY_CONTROLLER_1)
   {
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-    * other than array indexing used
-    * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
-    spduIn_s_Paket.au8_data2[0] = s_SafeTgmIpcTx.u8_tcooTgm[0];
-    spduIn_s_Paket.au8_data2[1] = s_SafeTgmIpcRx.u8_tcooTgm[0];
-    spduIn_s_Paket.au8_data2[2] = s_SafeTgmIpcTx.u8_tcooTgm[1];
-    spduIn_s_Paket.au8_data2[3] = s_SafeTgmIpcRx.u8_tcooTgm[1];
-    spduIn_s_Paket.au8_data2[4] = s_SafeTgmIpcTx.u8_tcooTgm[2];
-    spduIn_s_Paket.au8_data2[5] = s_SafeTgmIpcRx.u8_tcooTgm[2];
-    /*lint +esym(960, 17.4)*/
+    mergeSubframe(spduIn_s_Paket.au8_data2, s_SafeTgmIpcTx.u8_tcooTgm,
+                  s_SafeTgmIpcRx.u8_tcooTgm, k_TCCO_MSG_IPC_LEN);
   }
-  /* else if controller 2 */
+  /* else if controller 2: even bytes are remote, odd bytes are local */
   else if (eControllerId == SAFETY_CONTROLLER_2)
   {
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-    * other than array indexing used
-    * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
-    spduIn_s_Paket.au8_data2[0] = s_SafeTgmIpcRx.u8_tcooTgm[0];
-    spduIn_s_Paket.au8_data2[1] = s_SafeTgmIpcTx.u8_tcooTgm[0];
-    spduIn_s_Paket.au8_data2[2] = s_SafeTgmIpcRx.u8_tcooTgm[1];
-    spduIn_s_Paket.au8_data2[3] = s_SafeTgmIpcTx.u8_tcooTgm[1];
-    spduIn_s_Paket.au8_data2[4] = s_SafeTgmIpcRx.u8_tcooTgm[2];
-    spduIn_s_Paket.au8_data2[5] = s_SafeTgmIpcTx.u8_tcooTgm[2];
-    /*lint +esym(960, 17.4)*/
+    mergeSubframe(spduIn_s_Paket.au8_data2, s_SafeTgmIpcRx.u8_tcooTgm,
+                  s_SafeTgmIpcTx.u8_tcooTgm, k_TCCO_MSG_IPC_LEN);
   }
   /* else: variable error */
   else
@@ -799,71 +747,17 @@ STATIC void setTgmIo(void)
   ** (only 2 bytes because Safety validator instance ID is 2 bytes inside CSS) */
   spduIn_s_Paket.u16_halcAddInfo = (UINT16)u32_IoDataAddInfoTx;
   
-  /* if running on safety controller 1 */
+  /* if running on safety controller 1: even bytes are local, odd bytes are remote */
   if (eControllerId == SAFETY_CONTROLLER_1)
   {
-    /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-    * other than array indexing used
-    * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
-    spduIn_s_Paket.au8_data[0]  = s_SafeTgmIpcTx.u8_dataTgm[0];
-    spduIn_s_Paket.au8_data[1]  = s_SafeTgmIpcRx.u8_dataTgm[0];
-    spduIn_s_Paket.au8_data[2]  = s_SafeTgmIpcTx.u8_dataTgm[1];
-    spduIn_s_Paket.au8_data[3]  = s_SafeTgmIpcRx.u8_dataTgm[1];
-    spduIn_s_Paket.au8_data[4]  = s_SafeTgmIpcTx.u8_dataTgm[2];
-    spduIn_s_Paket.au8_data[5]  = s_SafeTgmIpcRx.u8_dataTgm[2];
-    spduIn_s_Paket.au8_data[6]  = s_SafeTgmIpcTx.u8_dataTgm[3];
-    spduIn_s_Paket.au8_data[7]  = s_SafeTgmIpcRx.u8_dataTgm[3];
-    spduIn_s_Paket.au8_data[8]  = s_SafeTgmIpcTx.u8_dataTgm[4];
-    spduIn_s_Paket.au8_data[9]  = s_SafeTgmIpcRx.u8_dataTgm[4];
-    spduIn_s_Paket.au8_data[10] = s_SafeTgmIpcTx.u8_dataTgm[5];
-    spduIn_s_Paket.au8_data[11] = s_SafeTgmIpcRx.u8_dataTgm[5];
-    spduIn_s_Paket.au8_data[12] = s_SafeTgmIpcTx.u8_dataTgm[6];
-    spduIn_s_Paket.au8_data[13] = s_SafeTgmIpcRx.u8_dataTgm[6];
-#ifdef RFID_ACTIVE
-    spduIn_s_Paket.au8_data[14] = s_SafeTgmIpcTx.u8_dataTgm[7];
-    spduIn_s_Paket.au8_data[15] = s_SafeTgmIpcRx.u8_dataTgm[7];
-    spduIn_s_Paket.au8_data[16] = s_SafeTgmIpcTx.u8_dataTgm[8];
-    spduIn_s_Paket.au8_data[17] = s_SafeTgmIpcRx.u8_dataTgm[8];
-    spduIn_s_Paket.au8_data[18] = s_SafeTgmIpcTx.u8_dataTgm[9];
-    spduIn_s_Paket.au8_data[19] = s_SafeTgmIpcRx.u8_dataTgm[9];
-    spduIn_s_Paket.au8_data[20] = s_SafeTgmIpcTx.u8_dataTgm[10];
-    spduIn_s_Paket.au8_data[21] = s_SafeTgmIpcRx.u8_dataTgm[10];
-#endif
-    /*lint +esym(960, 17.4)*/
+    mergeSubframe(spduIn_s_Paket.au8_data, s_SafeTgmIpcTx.u8_dataTgm,
+                  s_SafeTgmIpcRx.u8_dataTgm, k_IODATA_MSG_IPC_LEN);
   }
-  /* else if running on safety controller 2 */
+  /* else if running on safety controller 2: even bytes are remote, odd bytes are local */
   else if (eControllerId == SAFETY_CONTROLLER_2)
   {
-     /*lint -esym(960, 17.4)*/
-    /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
-    * other than array indexing used
-    * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
-    spduIn_s_Paket.au8_data[0]  = s_SafeTgmIpcRx.u8_dataTgm[0];
-    spduIn_s_Paket.au8_data[1]  = s_SafeTgmIpcTx.u8_dataTgm[0];
-    spduIn_s_Paket.au8_data[2]  = s_SafeTgmIpcRx.u8_dataTgm[1];
-    spduIn_s_Paket.au8_data[3]  = s_SafeTgmIpcTx.u8_dataTgm[1];
-    spduIn_s_Paket.au8_data[4]  = s_SafeTgmIpcRx.u8_dataTgm[2];
-    spduIn_s_Paket.au8_data[5]  = s_SafeTgmIpcTx.u8_dataTgm[2];
-    spduIn_s_Paket.au8_data[6]  = s_SafeTgmIpcRx.u8_dataTgm[3];
-    spduIn_s_Paket.au8_data[7]  = s_SafeTgmIpcTx.u8_dataTgm[3];
-    spduIn_s_Paket.au8_data[8]  = s_SafeTgmIpcRx.u8_dataTgm[4];
-    spduIn_s_Paket.au8_data[9]  = s_SafeTgmIpcTx.u8_dataTgm[4];
-    spduIn_s_Paket.au8_data[10] = s_SafeTgmIpcRx.u8_dataTgm[5];
-    spduIn_s_Paket.au8_data[11] = s_SafeTgmIpcTx.u8_dataTgm[5];
-    spduIn_s_Paket.au8_data[12] = s_SafeTgmIpcRx.u8_dataTgm[6];
-    spduIn_s_Paket.au8_data[13] = s_SafeTgmIpcTx.u8_dataTgm[6];
-#ifdef RFID_ACTIVE
-    spduIn_s_Paket.au8_data[14] = s_SafeTgmIpcRx.u8_dataTgm[7];
-    spduIn_s_Paket.au8_data[15] = s_SafeTgmIpcTx.u8_dataTgm[7];
-    spduIn_s_Paket.au8_data[16] = s_SafeTgmIpcRx.u8_dataTgm[8];
-    spduIn_s_Paket.au8_data[17] = s_SafeTgmIpcTx.u8_dataTgm[8];
-    spduIn_s_Paket.au8_data[18] = s_SafeTgmIpcRx.u8_dataTgm[9];
-    spduIn_s_Paket.au8_data[19] = s_SafeTgmIpcTx.u8_dataTgm[9];
-    spduIn_s_Paket.au8_data[20] = s_SafeTgmIpcRx.u8_dataTgm[10];
-    spduIn_s_Paket.au8_data[21] = s_SafeTgmIpcTx.u8_dataTgm[10];
-#endif
-    /*lint +esym(960, 17.4)*/
+    mergeSubframe(spduIn_s_Paket.au8_data, s_SafeTgmIpcRx.u8_dataTgm,
+                  s_SafeTgmIpcTx.u8_dataTgm, k_IODATA_MSG_IPC_LEN);
   }
   /* else: variable error */
   else
@@ -873,3 +767,144 @@ STATIC void setTgmIo(void)
   /* update DUI_data of telegram */
   spduIn_s_Paket.u8_duiData = s_SafeTgmIpcTx.u8_dataTgmCnt;
 }
+
+/***************************************************************************************************
+  Function:
+    splitSubframe
+
+  Description:
+    This function extracts every second byte of a sub frame generated by CSS, starting at the given
+    offset (0: even bytes, 1: odd bytes). If the source buffer is word aligned, four source bytes
+    are read with one access (little endian byte order of the Cortex-M3), the remaining bytes are
+    copied byte-wise.
+    The function is called with disabled IRQs, so the number of memory accesses is kept low.
+
+  See also:
+    mergeSubframe
+
+  Parameters:
+    pau8_dst (OUT) - Buffer for the extracted bytes, size u8_len
+                     (valid range: <>NULL, not checked, only called locally)
+    pau8_src (IN)  - Sub frame generated by CSS, size 2 * u8_len
+                     (valid range: <>NULL, not checked, buffer provided by CSS)
+    u8_ofs (IN)    - Offset of the first extracted byte
+                     (valid range: 0..1, not checked, only called locally)
+    u8_len (IN)    - Number of bytes to extract
+                     (valid range: any, not checked, only called locally)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: Background Task
+
+***************************************************************************************************/
+STATIC void splitSubframe(volatile UINT8 *pau8_dst, const UINT8 *pau8_src, UINT8 u8_ofs,
+                          UINT8 u8_len)
+{
+  const UINT32 *pu32_src;
+  UINT32 u32_word;
+  UINT8 u8_shift = (UINT8)(u8_ofs * 8u);
+  UINT8 i = 0u;
+
+  /*lint -esym(960, 17.4)*/
+  /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+   * other than array indexing used
+   * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
+  /* Note 923: cast from pointer to unsigned int, only used to check the alignment */
+  if (((UINT32)pau8_src & 0x03u) == 0u) /*lint !e923 */
+  {
+    /* Note 826/927: the buffer is word aligned, see check above */
+    pu32_src = (const UINT32 *)pau8_src; /*lint !e826, !e927 */
+    while ((UINT8)(u8_len - i) >= 2u)
+    {
+      u32_word = pu32_src[i / 2u] >> u8_shift;
+      pau8_dst[i]      = (UINT8)u32_word;
+      pau8_dst[i + 1u] = (UINT8)(u32_word >> 16u);
+      i += 2u;
+    }
+  }
+  /* unaligned source buffer, all bytes copied byte-wise below */
+  else
+  {
+    /* empty branch */
+  }
+
+  /* remaining bytes (or unaligned source buffer) */
+  while (i < u8_len)
+  {
+    pau8_dst[i] = pau8_src[(2u * i) + u8_ofs];
+    i++;
+  }
+  /*lint +esym(960, 17.4)*/
+} /* end of splitSubframe() */
+
+/***************************************************************************************************
+  Function:
+    mergeSubframe
+
+  Description:
+    This function builds a complete CIP Safety Message from the even and the odd bytes of the sub
+    frames. If the destination buffer is word aligned, two bytes of each sub frame are combined
+    and written with one access (little endian byte order of the Cortex-M3), the remaining bytes
+    are copied byte-wise.
+
+  See also:
+    splitSubframe
+
+  Parameters:
+    pau8_dst (OUT) - Buffer for the complete message, size 2 * u8_len
+                     (valid range: <>NULL, not checked, only called locally)
+    pau8_even (IN) - Sub frame with the even bytes of the message, size u8_len
+                     (valid range: <>NULL, not checked, only called locally)
+    pau8_odd (IN)  - Sub frame with the odd bytes of the message, size u8_len
+                     (valid range: <>NULL, not checked, only called locally)
+    u8_len (IN)    - Number of bytes of each sub frame
+                     (valid range: any, not checked, only called locally)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+
+***************************************************************************************************/
+STATIC void mergeSubframe(UINT8 *pau8_dst, const volatile UINT8 *pau8_even,
+                          const volatile UINT8 *pau8_odd, UINT8 u8_len)
+{
+  UINT32 *pu32_dst;
+  UINT8 i = 0u;
+
+  /*lint -esym(960, 17.4)*/
+  /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+   * other than array indexing used
+   * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
+  /* Note 923: cast from pointer to unsigned int, only used to check the alignment */
+  if (((UINT32)pau8_dst & 0x03u) == 0u) /*lint !e923 */
+  {
+    /* Note 826/927: the buffer is word aligned, see check above */
+    pu32_dst = (UINT32 *)pau8_dst; /*lint !e826, !e927 */
+    while ((UINT8)(u8_len - i) >= 2u)
+    {
+      pu32_dst[i / 2u] = (UINT32)pau8_even[i]
+                       | ((UINT32)pau8_odd[i] << 8u)
+                       | ((UINT32)pau8_even[i + 1u] << 16u)
+                       | ((UINT32)pau8_odd[i + 1u] << 24u);
+      i += 2u;
+    }
+  }
+  /* unaligned destination buffer, all bytes copied byte-wise below */
+  else
+  {
+    /* empty branch */
+  }
+
+  /* remaining bytes (or unaligned destination buffer) */
+  while (i < u8_len)
+  {
+    pau8_dst[2u * i]        = pau8_even[i];
+    pau8_dst[(2u * i) + 1u] = pau8_odd[i];
+    i++;
+  }
+  /*lint +esym(960, 17.4)*/
+} /* end of mergeSubframe() */
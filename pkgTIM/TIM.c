@@ -34,6 +34,7 @@
 #include "xdefs.h"
 
 /* Module header */
+#include "globDef_GlobalDefinitions.h"
 #include "globFail_Errorcodes.h"
 #include "globFail_SafetyHandler.h"
 #include "timer-def.h"
@@ -61,14 +62,17 @@
 /* Unique file id used to build additional info */
 #define k_FILEID      29u
 
-/* The exchange of the 128us time stamp is performed once within T-cyc:asm (~4ms). Since the
-** time stamp depends on the sampling time, the tolerance of the T-cyc;asm shall also be
-** considered here. According to [SRS_2234] we can expect the sampling between 3600us and 4400us.
-** (T-cyc:asm +-10%). Since the timer deviation check shall not restrict this specified range, the 
-** valid range for timer deviations is extended to 3584us..4480us here.
+/* The exchange of the 128us time stamp is performed once within T-cyc:asm
+** (GLOBDEF_CYCLE_TIME_US). Since the time stamp depends on the sampling time, the tolerance of
+** the T-cyc;asm shall also be considered here. According to [SRS_2234] we can expect the sampling
+** between GLOBDEF_CYCLE_TIME_MIN_US and GLOBDEF_CYCLE_TIME_MAX_US (T-cyc:asm +-10%). Since the
+** timer deviation check shall not restrict this specified range, the valid range for timer
+** deviations is extended to whole 128us ticks (4ms: 28 x 128us = 3584us..35 x 128us = 4480us).
 */
-#define k_MIN_TIMER_DIFF_TCYCL  28u /* (28 x 128us = 3584us) */
-#define k_MAX_TIMER_DIFF_TCYCL  35u /* (35 x 128us = 4480us) */
+#define k_TIMER_TICK_US         128u
+#define k_MIN_TIMER_DIFF_TCYCL  (GLOBDEF_CYCLE_TIME_MIN_US / k_TIMER_TICK_US)
+#define k_MAX_TIMER_DIFF_TCYCL  ((GLOBDEF_CYCLE_TIME_MAX_US + (k_TIMER_TICK_US - 1u)) / \
+                                 k_TIMER_TICK_US)
 
 /* This variable contains the current local time stamp captured by HW timer */
 STATIC RDS_UINT32 u32_LocalTimestampCurrCycl;
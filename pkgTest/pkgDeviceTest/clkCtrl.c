@@ -187,8 +187,9 @@ void clkCtrl_CalcAndSendTimeDiff (void)
    /* Note 948: Operator '==' always evaluates to False, Problem is in RDS_GET. */
 
 
-   /* call function to transmit the elapsed time via IPC */
-   ipcxSYS_SendUINT32(IPCXSYS_IPC_ID_CLKCTRL, u32SysTimeDiff);
+   /* add the elapsed time to the IPC frame, it is transmitted by
+    * ipcxSYS_FrameSend() */
+   ipcxSYS_FrameAddUINT32(IPCXSYS_IPC_ID_CLKCTRL, u32SysTimeDiff);
 
    /* store current time difference since last check */
    RDS_SET(clkCtrl_u32RdsSysTimeDiff, u32SysTimeDiff);
@@ -236,8 +237,8 @@ void clkCtrl_CheckTimerVal (void)
    u32SysTimeDiffTx = (UINT32)(RDS_GET(clkCtrl_u32RdsSysTimeDiff));  /*lint !e948*/
    /* Note 948: Operator '==' always evaluates to False, Problem is in RDS_GET. */
 
-   /* get received system time difference from other channel via IPC */
-   u32SysTimeDiffRx = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_CLKCTRL );
+   /* get received system time difference from other channel via IPC frame */
+   u32SysTimeDiffRx = ipcxSYS_FrameGetUINT32( IPCXSYS_IPC_ID_CLKCTRL );
 
    /* time for next clock control measurement reached (see [SRS_701])?
     * Then compare values with other channel
@@ -154,7 +154,8 @@ void tmSRV_Init (void)
 **    tmSRV_CheckTemperature must be called. In the next cycle the function
 **    tmSRV_SyncTemperature must be called. In the meantime of these functions
 **    an IPC communication is done to exchange the test results. So the gap
-**    should be large enough to fulfill an IPC.
+**    should be large enough to fulfill an IPC. The test result is exchanged
+**    in the IPC frame (ipcxSYS_FrameSend(), ipcxSYS_FrameRecvinclWait()).
 **
 **------------------------------------------------------------------------------
 ** Inputs:
@@ -219,18 +220,17 @@ void tmSRV_CheckTemperature (void)
    eFilteredResult = tmSRV_EvaluateTestResult(tmSRV_u8TestResult);
 
    /* If test of this controller was passed, then set status to
-    * PASSED, else to FAILED. In each case, call function to initiate IPC
-    * transmission and send the test result to the other controller
-    * (see [SRS_397]).
+    * PASSED, else to FAILED. In each case, add the test result to the IPC
+    * frame which is sent to the other controller (see [SRS_397]).
     * In case of an illegal result value, the Safety Handler is called. */
    if (GLOB_RET_OK == eFilteredResult)
    {
-      ipcxSYS_SendUINT32(IPCXSYS_IPC_ID_TEMP_MESS, (UINT32)TMSRV_TEMP_TEST_PASSED);
+      ipcxSYS_FrameAddUINT32(IPCXSYS_IPC_ID_TEMP_MESS, (UINT32)TMSRV_TEMP_TEST_PASSED);
       tmSRV_eTempTestStatusOwnChannel = TMSRV_TEMP_TEST_PASSED;
    }
    else if (GLOB_RET_TEMPERATURE_ERR == eFilteredResult)
    {
-      ipcxSYS_SendUINT32(IPCXSYS_IPC_ID_TEMP_MESS, (UINT32)TMSRV_TEMP_TEST_FAILED);
+      ipcxSYS_FrameAddUINT32(IPCXSYS_IPC_ID_TEMP_MESS, (UINT32)TMSRV_TEMP_TEST_FAILED);
       tmSRV_eTempTestStatusOwnChannel = TMSRV_TEMP_TEST_FAILED;
    }
    else
@@ -255,7 +255,8 @@ void tmSRV_CheckTemperature (void)
 **    tmSRV_CheckTemperature must be called. In the next cycle the function
 **    tmSRV_SyncTemperature must be called. In the meantime of these functions
 **    an IPC communication is done to exchange the test results. So the gap
-**    should be large enough to fulfill an IPC.
+**    should be large enough to fulfill an IPC. The test result is exchanged
+**    in the IPC frame (ipcxSYS_FrameSend(), ipcxSYS_FrameRecvinclWait()).
 **
 **------------------------------------------------------------------------------
 ** Inputs:
@@ -276,9 +277,9 @@ void tmSRV_SyncTemperature (void)
 {
    UINT32 u32IpcRecValue;
 
-   /* get temperature measurement from other channel (from IPC RX buffer),
+   /* get temperature measurement from other channel (from IPC frame),
     * see [SRS_397] */
-   u32IpcRecValue = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_TEMP_MESS );
+   u32IpcRecValue = ipcxSYS_FrameGetUINT32( IPCXSYS_IPC_ID_TEMP_MESS );
 
    if (u32IpcRecValue == (UINT32)TMSRV_TEMP_TEST_PASSED)
    {
@@ -0,0 +1,130 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: hist-sys.c
+**     Summary: Histogram functions of the diagnostic statistics (IPC wait times, background task
+**              statistic, RFID latencies).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: histSYS_WaitBucket
+**             histSYS_Add
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Project header */
+#include "xtypes.h"
+#include "xdefs.h"
+
+/* Header-file of module */
+#include "hist-sys.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    histSYS_WaitBucket
+
+  Description:
+    see hist-sys.h
+
+***************************************************************************************************/
+UINT32 histSYS_WaitBucket( CONST UINT32 u32_wait, CONST UINT32 u32_bucketUs )
+{
+  UINT32 u32_bucket = 0u;
+
+  /* bucket 0: no wait */
+  if (u32_wait != 0u)
+  {
+    u32_bucket = ((u32_wait - 1u) / u32_bucketUs) + 1u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  return u32_bucket;
+}
+
+/***************************************************************************************************
+  Function:
+    histSYS_Add
+
+  Description:
+    see hist-sys.h
+
+***************************************************************************************************/
+void histSYS_Add( UINT16* pau16_hist, CONST UINT8 u8_bucketCnt, CONST UINT32 u32_bucket )
+{
+  UINT32 u32_idx = u32_bucket;
+  UINT8  i;
+
+  /* the last bucket includes the buckets beyond the histogram */
+  if (u32_idx >= u8_bucketCnt)
+  {
+    u32_idx = (UINT32)u8_bucketCnt - 1u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  /*lint -esym(960, 17.4)*/
+  /* Note 960: Violates MISRA 2004 Required Rule 17.4, pointer arithmetic
+   * other than array indexing used
+   * --> Deactivate Misra Rule 17.4, Array-Indexing is wanted. */
+  /* if the bucket is saturated, halve all buckets */
+  if (pau16_hist[u32_idx] == (UINT16)UINT16_MAX)
+  {
+    for (i = 0u; i < u8_bucketCnt; i++)
+    {
+      pau16_hist[i] >>= 1u;
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+  pau16_hist[u32_idx]++;
+  /*lint +esym(960, 17.4)*/
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,111 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: hist-sys.h
+**     Summary: Interface of the histogram functions of the diagnostic statistics: the bucket of
+**              a wait time and the increment of a bucket with halving of all buckets on
+**              saturation.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: histSYS_WaitBucket
+**             histSYS_Add
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef HIST_SYS_H
+#define HIST_SYS_H
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    histSYS_WaitBucket
+
+  Description:
+    This function returns the bucket of a wait time: bucket 0 counts the waits of 0 usec, the
+    other buckets are u32_bucketUs wide (bucket 1: 1..u32_bucketUs usec). The bucket is not 
+    limited, histSYS_Add() counts the buckets beyond the histogram in its last bucket.
+
+  See also:
+    histSYS_Add()
+
+  Parameters:
+    u32_wait (IN)     - wait time in usec
+                        (valid range: any, not checked)
+    u32_bucketUs (IN) - width of the buckets in usec
+                        (valid range: >0, not checked)
+
+  Return value:
+    UINT32            - bucket
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: Background Task
+
+***************************************************************************************************/
+UINT32 histSYS_WaitBucket( CONST UINT32 u32_wait, CONST UINT32 u32_bucketUs );
+
+/***************************************************************************************************
+  Function:
+    histSYS_Add
+
+  Description:
+    This function increments a bucket of a histogram, the last bucket also counts the buckets 
+    beyond the histogram. If the bucket has reached UINT16_MAX, all buckets are halved before, so
+    the histogram keeps its shape.
+
+  See also:
+    histSYS_WaitBucket()
+
+  Parameters:
+    pau16_hist (IN/OUT) - histogram
+                          (valid range: <>NULL, not checked)
+    u8_bucketCnt (IN)   - number of buckets of the histogram
+                          (valid range: >0, not checked)
+    u32_bucket (IN)     - bucket to be incremented
+                          (valid range: any, limited)
+
+  Return value:
+    -
+
+  Remarks:
+    Context: IRQ Scheduler
+    Context: Background Task
+    Reentrant for different histograms.
+
+***************************************************************************************************/
+void histSYS_Add( UINT16* pau16_hist, CONST UINT8 u8_bucketCnt, CONST UINT32 u32_bucket );
+
+#endif /* HIST_SYS_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
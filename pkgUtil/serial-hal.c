@@ -494,6 +494,8 @@ void serialHAL_InitTxUsart1DmaCh ( CONST UINT32 u32TxBufferAddr )
 ** Description:
 ** This function initialize the DMA1 channel 5 for USART1 Rx
 ** and enables the USART-DMA-Interface for the data transfer.
+** The transfer complete interrupt is enabled, the interrupt itself
+** is enabled in the NVIC by the IPC (ipcxSYS_Init).
 ** Before this function is called, the USART1 must be
 ** initialized via the serialHAL_Init function to ensure the
 ** correct communication settings.
@@ -527,8 +529,9 @@ void serialHAL_InitRxUsart1DmaCh ( CONST UINT32 u32RxBufferAddr, CONST UINT32 u3
 
    /* settings for RX DMA:
     * Memory increment mode : 1: Memory increment mode enabled
-    * Channel priority level: 11: Very high */
-   SERIAL_USART1_RX_DMA1_CH5->CCR = (DMA_CCR5_MINC | DMA_CCR5_PL);
+    * Channel priority level: 11: Very high
+    * Transfer complete interrupt: 1: enabled (completion flag of the IPC) */
+   SERIAL_USART1_RX_DMA1_CH5->CCR = (DMA_CCR5_MINC | DMA_CCR5_PL | DMA_CCR5_TCIE);
 
    /* write the the USART1_DR address into the DMA channel peripheral address register */
    SERIAL_USART1_RX_DMA1_CH5->CPAR = (UINT32) &USART1->DR;/*lint !e923*/
@@ -596,8 +599,11 @@ void serialHAL_InitRxTxUart4Dma2Ch (void)
 
    /* settings for Rx DMA:
     * Memory increment mode : 1 : Memory increment mode enabled
-    * Channel priority level: 11: Very high */
-   AIC_RX_UART_DMA2_CHANNEL3->CCR = (DMA_CCR3_MINC | DMA_CCR3_PL);
+    * Channel priority level: 11: Very high
+    * Half transfer/transfer complete interrupt: 1: enabled, the CRC of the
+    * received bytes is calculated in the interrupt (see aicUart.c) */
+   AIC_RX_UART_DMA2_CHANNEL3->CCR = (DMA_CCR3_MINC | DMA_CCR3_PL |
+                                     DMA_CCR3_HTIE | DMA_CCR3_TCIE);
 
    /* write the the USART1_DR address into the
     * DMA channel peripheral address register */
@@ -104,6 +104,29 @@
    } \
 }
 
+/*------------------------------------------------------------------------------
+**
+** TIMERHAL_TIMER1_COUNTER
+** TIMERHAL_TIMER1_IRQ_PENDING
+**
+** Macros to read the counter and the pending update event of the scheduler
+** timer (timer 1). Used by the scheduler to measure the execution time of
+** its tasks without function call overhead.
+**------------------------------------------------------------------------------
+** Inputs:
+**    void
+**
+** Outputs:
+**    counter value (0..reload value) respectively TRUE if update event pending
+**
+** Usage:
+**    Context: IRQ Scheduler
+**
+**------------------------------------------------------------------------------
+*/
+#define TIMERHAL_TIMER1_COUNTER       ((UINT16)TIM1->CNT)
+#define TIMERHAL_TIMER1_IRQ_PENDING   ((TIM1->SR & (UINT16)TIM_SR_UIF) != 0u)
+
 
 /*******************************************************************************
 **
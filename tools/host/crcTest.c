@@ -0,0 +1,357 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: crcTest.c
+**     Summary: Known answer test, reference comparison and benchmark of the RFID CRC engine (see
+**              tools/host/Makefile). Runs pkgRFID/RFIDcrc.c unchanged, the engine is selected
+**              with RFID_CRC_ENGINE at compile time (one binary per software engine):
+**                - known answer test: RFID_CrcInit() and RFID_Crc32() over "123456789"
+**                - RFID_Crc32() against a bit-wise CRC-32/BZIP2 reference (the former CRC32()
+**                  of RFIDmain.c) on random data with random lengths (0..255) and random
+**                  alignments of the data (0..7 bytes offset)
+**                - RFID_Crc32Update() / RFID_Crc32Rewind() round trip on random data: the
+**                  rewind over the second part results in the CRC register after the first part,
+**                  the rewind over all data results in the seed
+**                - benchmark of the reference and the engine for the record CRC (16 bytes), the
+**                  memory CRC of the full memory read (96 bytes) and 255 bytes, reported in host
+**                  cycles (time stamp counter, x86) or nsec per call and in bytes per cycle/nsec
+**              The benchmark shows the ratio of the engines only, the absolute numbers of the
+**              target (Cortex-M3, flash wait states) differ.
+**
+**              Usage: crcTest [-n <random cases>] [-b <benchmark calls>] [-s <seed>]
+**              Exit code: 0 all tests passed, 1 test failed, 2 usage error, 3 safety handler
+**              (known answer test of RFID_CrcInit(), see hostHal.c).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: main
+**
+**             Bench
+**             CyclesGet
+**             RandGet
+**             RefCrc32
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+#endif
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globDef_GlobalDefinitions.h"
+
+/* Module header */
+#include "RFID.h"
+#include "RFIDcrc.h"
+#include "hostHal.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Default number of random cases and of benchmark calls per length */
+#define k_CASES                  100000u
+#define k_BENCH_CALLS            200000u
+
+/* Maximum offset of the data to an aligned address */
+#define k_ALIGN_MAX              8u
+
+/* Known answer test, see RFID_CrcInit() */
+#define k_KAT_RESULT             0xFC891918uL
+
+/* Length of the record CRC input (UID, sequence number, reserved bytes, S2L ID) */
+#define k_REC_CRC_LEN            ( RFID_UID_LEN + RFID_SEQ_NUM_LEN + RFID_RES_LEN + \
+                                   RFID_S2L_ID_LEN )
+
+/* Length of the memory CRC input of the full memory read (all records) */
+#define k_MEM_CRC_LEN            ( RFID_REC_COUNT * RFID_REC_TOTAL_LEN )
+
+/* Unit of CyclesGet() */
+#if defined(__x86_64__) || defined(__i386__)
+  #define k_CYCLE_UNIT           "cycle"
+#else
+  #define k_CYCLE_UNIT           "nsec"
+#endif
+
+/* Name of the engine under test */
+#if (RFID_CRC_ENGINE == RFID_CRC_ENGINE_TABLE)
+  #define k_ENGINE_NAME          "RFID_CRC_ENGINE_TABLE"
+#elif (RFID_CRC_ENGINE == RFID_CRC_ENGINE_SLICE4)
+  #define k_ENGINE_NAME          "RFID_CRC_ENGINE_SLICE4"
+#else
+  #error "The hardware CRC unit is not simulated, select a software engine!"
+#endif
+
+/* State of the random generator (xorshift32), see RandGet() */
+STATIC UINT32 u32_Rand = 1u;
+
+/* Result of the benchmark, prevents the removal of the calls by the compiler */
+STATIC volatile UINT32 u32_BenchSink;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC void Bench( CONST UINT8* pau8_data, CONST UINT8 u8_len, CONST UINT32 u32_calls );
+STATIC unsigned long long CyclesGet( void );
+STATIC UINT32 RandGet( void );
+STATIC UINT32 RefCrc32( CONST UINT8* pau8_data, CONST UINT8 u8_len );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    main
+
+  Description:
+    Parses the options, runs the tests and the benchmark.
+
+***************************************************************************************************/
+int main( int argc, char* argv[] )
+{
+  STATIC CONST UINT8 au8_kat[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  UINT8 au8_buf[255u + k_ALIGN_MAX];
+  UINT32 u32_cases = k_CASES;
+  UINT32 u32_calls = k_BENCH_CALLS;
+  UINT32 u32_fail = 0u;
+  UINT32 u32_crcA;
+  UINT32 u32_crcAB;
+  UINT32 i;
+  UINT32 j;
+  UINT8 u8_off;
+  UINT8 u8_len;
+  UINT8 u8_lenA;
+  int i_opt;
+
+  while ( ( i_opt = getopt( argc, argv, "n:b:s:" ) ) != -1 )
+  {
+    switch ( i_opt )
+    {
+      case 'n': u32_cases = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'b': u32_calls = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 's': u32_Rand = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      default:  return 2;
+    }
+  }
+  if ( ( optind != argc ) || ( u32_Rand == 0u ) )
+  {
+    (void)fprintf( stderr, "usage: crcTest [-n cases] [-b bench_calls] [-s seed (not 0)]\n" );
+    return 2;
+  }
+
+  (void)printf( "%s, %u random cases, seed %u\n", k_ENGINE_NAME, (unsigned)u32_cases,
+                (unsigned)u32_Rand );
+
+  /* known answer test, the Safety Handler ends the process on a mismatch */
+  RFID_CrcInit();
+  if ( ( RFID_Crc32( au8_kat, (UINT8)sizeof(au8_kat) ) != k_KAT_RESULT ) ||
+       ( RefCrc32( au8_kat, (UINT8)sizeof(au8_kat) ) != k_KAT_RESULT ) )
+  {
+    (void)printf( "known answer test failed\n" );
+    u32_fail++;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  for ( i = 0u; i < u32_cases; i++ )
+  {
+    u8_off = (UINT8)( RandGet() % k_ALIGN_MAX );
+    u8_len = (UINT8)RandGet();
+    for ( j = 0u; j < u8_len; j++ )
+    {
+      au8_buf[u8_off + j] = (UINT8)RandGet();
+    }
+
+    /* engine against the reference */
+    if ( RFID_Crc32( &au8_buf[u8_off], u8_len ) != RefCrc32( &au8_buf[u8_off], u8_len ) )
+    {
+      (void)printf( "case %u: RFID_Crc32() differs, length %u, offset %u\n", (unsigned)i,
+                    (unsigned)u8_len, (unsigned)u8_off );
+      u32_fail++;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* update / rewind round trip, the data is split in two parts */
+    u8_lenA = ( u8_len == 0u ) ? 0u : (UINT8)( RandGet() % ( (UINT32)u8_len + 1u ) );
+    u32_crcA = RFID_Crc32Update( RFID_CRC_SEED, &au8_buf[u8_off], u8_lenA );
+    u32_crcAB = RFID_Crc32Update( u32_crcA, &au8_buf[u8_off + u8_lenA],
+                                  (UINT8)( u8_len - u8_lenA ) );
+    if ( ( ( u32_crcAB ^ RFID_CRC_XOROUT ) != RefCrc32( &au8_buf[u8_off], u8_len ) ) ||
+         ( RFID_Crc32Rewind( u32_crcAB, &au8_buf[u8_off + u8_lenA], (UINT8)( u8_len - u8_lenA ) )
+           != u32_crcA ) ||
+         ( RFID_Crc32Rewind( u32_crcAB, &au8_buf[u8_off], u8_len ) != RFID_CRC_SEED ) )
+    {
+      (void)printf( "case %u: update/rewind differs, length %u + %u, offset %u\n", (unsigned)i,
+                    (unsigned)u8_lenA, (unsigned)( u8_len - u8_lenA ), (unsigned)u8_off );
+      u32_fail++;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+
+  /* benchmark */
+  for ( j = 0u; j < 255u; j++ )
+  {
+    au8_buf[j] = (UINT8)RandGet();
+  }
+  if ( u32_calls > 0u )
+  {
+    Bench( au8_buf, k_REC_CRC_LEN, u32_calls );
+    Bench( au8_buf, k_MEM_CRC_LEN, u32_calls );
+    Bench( au8_buf, 255u, u32_calls );
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  (void)printf( "%u failures\n%s\n", (unsigned)u32_fail, ( u32_fail == 0u ) ? "PASS" : "FAIL" );
+  return ( u32_fail == 0u ) ? 0 : 1;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    Bench
+
+  Description:
+    Measures the mean time of the reference and of the engine for one length and prints it with
+    the throughput and the gain of the engine.
+
+***************************************************************************************************/
+STATIC void Bench( CONST UINT8* pau8_data, CONST UINT8 u8_len, CONST UINT32 u32_calls )
+{
+  unsigned long long u64_start;
+  unsigned long long u64_ref;
+  unsigned long long u64_eng;
+  UINT32 i;
+
+  u64_start = CyclesGet();
+  for ( i = 0u; i < u32_calls; i++ )
+  {
+    u32_BenchSink = RefCrc32( pau8_data, u8_len );
+  }
+  u64_ref = CyclesGet() - u64_start;
+
+  u64_start = CyclesGet();
+  for ( i = 0u; i < u32_calls; i++ )
+  {
+    u32_BenchSink = RFID_Crc32( pau8_data, u8_len );
+  }
+  u64_eng = CyclesGet() - u64_start;
+
+  /* at least one unit, the bytes per unit are not divided by 0 */
+  u64_ref = ( u64_ref == 0u ) ? 1u : u64_ref;
+  u64_eng = ( u64_eng == 0u ) ? 1u : u64_eng;
+
+  (void)printf( "%3u bytes: bit-wise %7.1f %s/call %5.3f bytes/%s, engine %7.1f %s/call "
+                "%5.3f bytes/%s, gain %4.1f\n",
+                (unsigned)u8_len,
+                (double)u64_ref / u32_calls, k_CYCLE_UNIT,
+                (double)u8_len * u32_calls / u64_ref, k_CYCLE_UNIT,
+                (double)u64_eng / u32_calls, k_CYCLE_UNIT,
+                (double)u8_len * u32_calls / u64_eng, k_CYCLE_UNIT,
+                (double)u64_ref / u64_eng );
+}
+
+/***************************************************************************************************
+  Function:
+    CyclesGet
+
+  Description:
+    Returns the time stamp counter of the host (x86) or the monotonic clock in nsec.
+
+***************************************************************************************************/
+STATIC unsigned long long CyclesGet( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return (unsigned long long)__rdtsc();
+#else
+  struct timespec s_ts;
+
+  (void)clock_gettime( CLOCK_MONOTONIC, &s_ts );
+  return ( (unsigned long long)s_ts.tv_sec * 1000000000u ) + (unsigned long long)s_ts.tv_nsec;
+#endif
+}
+
+/***************************************************************************************************
+  Function:
+    RandGet
+
+  Description:
+    Returns the next value of the random generator (xorshift32, reproducible with -s).
+
+***************************************************************************************************/
+STATIC UINT32 RandGet( void )
+{
+  u32_Rand ^= u32_Rand << 13;
+  u32_Rand ^= u32_Rand >> 17;
+  u32_Rand ^= u32_Rand << 5;
+  return u32_Rand;
+}
+
+/***************************************************************************************************
+  Function:
+    RefCrc32
+
+  Description:
+    Bit-wise reference of the record CRC (CRC-32/BZIP2: polynomial 0x04C11DB7, MSB first, seed
+    and final XOR 0xFFFFFFFF), the calculation of the former CRC32() of RFIDmain.c.
+
+***************************************************************************************************/
+STATIC UINT32 RefCrc32( CONST UINT8* pau8_data, CONST UINT8 u8_len )
+{
+  UINT32 u32_crc = 0xFFFFFFFFuL;
+  UINT8 i;
+  UINT8 j;
+
+  for ( i = 0u; i < u8_len; i++ )
+  {
+    u32_crc ^= (UINT32)pau8_data[i] << 24;
+    for ( j = 0u; j < 8u; j++ )
+    {
+      u32_crc = ( ( u32_crc & 0x80000000uL ) != 0u ) ? ( ( u32_crc << 1 ) ^ 0x04C11DB7uL )
+                                                     : ( u32_crc << 1 );
+    }
+  }
+  return u32_crc ^ 0xFFFFFFFFuL;
+}
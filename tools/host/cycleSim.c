@@ -0,0 +1,1110 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: cycleSim.c
+**     Summary: Cycle simulation of both controllers (see tools/host/Makefile). The scheduler
+**              (pkgOperation/sch_Scheduler-app.c), the IPC (ipcx_ExchangeData-sys.c,
+**              ipcs_IpcSync-sys.c on ipct_TransportHost-sys.c) and the AIC manager
+**              (aicMgrRx.c, aicMgrTx.c, aicUart.c) run unchanged in two processes, one per
+**              controller, the other tasks are modelled by cycleSimTasks.c:
+**                - both processes run in a lockstep of the simulated time (1 usec steps, see
+**                  hostHAL_TimeStepSet()), the transport is polled every usec, so a run is
+**                  deterministic and repeatable
+**                - every usec the time hook simulates the scheduler timer TIM1 (72 MHz,
+**                  prescaler and reload of schAPP_Init()), the window watchdog, the IPC link
+**                  (delay, jitter, transfer time, dropped telegrams and bit flips of
+**                  ipct_TransportHost-sys.c) and the AIC master: its telegrams are received by
+**                  UART4/DMA2 channel 3 of both controllers byte by byte, with a CRC, an
+**                  adjustable phase, period and drift and bit errors on the line or on the
+**                  line of controller 2 only. The ASM telegrams of DMA2 channel 5 are counted.
+**                - the main loop executes the pending interrupts in the order of their
+**                  priority (TIM1 before DMA2 channel 3) and the background task
+**              Each controller reports the deadline and jitter statistic of the time slices and
+**              cycles, the statistic of the IPC, the transport, the AIC telegrams and the task
+**              models, with -v a trace line per cycle. The reports are printed one after the
+**              other, followed by the offset of the cycles of controller 2 to controller 1.
+**
+**              Usage: cycleSim [-n <cycles>] [-c <task description>] [-l <load %>]
+**                              [-b <background usec>] [-d <delay usec>] [-j <jitter usec>]
+**                              [-B <baud>] [-D <drop ppm>] [-F <flip ppm>] [-s <seed>]
+**                              [-p <AIC phase usec>] [-P <AIC period usec>] [-m <AIC drift ppm>]
+**                              [-S <AIC startup telegrams>] [-E <AIC line bit error ppm>]
+**                              [-e <AIC bit error ppm controller 2>] [-v] [-x]
+**              -x expects that both controllers end in the Safety Handler (e.g. with -e).
+**              Exit code: 0 both controllers passed (with -x: both ended in the Safety
+**              Handler), 1 failed, 2 usage error.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: main
+**
+**             Controller
+**             Hook
+**             TimerStep
+**             WwdgStep
+**             Dma2Clear
+**             AicMasterStep
+**             AicMasterTgm
+**             AsmTxStep
+**             Hash
+**             StatPrint
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+#include "globFail_Errorcodes.h"
+#include "cfg_Config-sys.h"
+#include "version.h"
+
+/* Module header */
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+#include "ipcs_IpcSync-sys.h"
+#include "ipct_TransportHost-sys.h"
+
+#include "aicMsgDef.h"
+#include "aicCrc.h"
+#include "aicUart.h"
+#include "aicMgrTx.h"
+#include "aicSm.h"
+
+#include "sch_Scheduler-app.h"
+
+#include "hostHal.h"
+#include "cycleSimTasks.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Default number of cycles */
+#define k_CYCLES                 200u
+
+/* Default task description, relative to tools/host */
+#define k_TASK_CFG               "../../pkgOperation/sch_Scheduler-app_tasks.cfg"
+
+/* Default execution time of the tasks in percent of their wcet */
+#define k_LOAD_PCT               90u
+
+/* Default execution time of a background cycle [us] */
+#define k_BKGD_US                300u
+
+/* Default baud rate of the IPC (USART1, SERIALHAL_4000000_BAUD) */
+#define k_IPC_BAUD               4000000u
+
+/* AIC master: baud rate of UART4 (SERIALHAL_1020000_BAUD), default phase of the first telegram
+** and number of telegrams before the data exchange is requested */
+#define k_AIC_BAUD               1020000u
+#define k_AIC_PHASE_US           1000u
+#define k_AIC_STARTUP_TGM        10u
+
+/* Clocks of the simulated peripherals [MHz]: TIM1 (APB2 timer clock), WWDG (PCLK1) */
+#define k_TIM1_CLK_MHZ           72u
+#define k_WWDG_CLK_MHZ           36u
+
+/* Watchdog: prescaler of the counter (PCLK1/4096/2^WDGTB), reset if T6 is cleared */
+#define k_WWDG_DIV               4096u
+#define k_WWDG_T6                0x40u
+
+/* Length of a time slice [us] */
+#define k_SLICE_US               ( GLOBDEF_CYCLE_TIME_US / SCHAPP_TIME_SLICE_CNT )
+
+/* Configuration word exchanged at the startup, see main_Config() of main.c */
+#define k_CONFIG_WORD            0x00C0FFEEu
+
+/* Exit codes: Safety Handler (see globFail_SafetyHandler() in hostHal.c), watchdog reset */
+#define k_EXIT_SAFETY            3
+#define k_EXIT_WWDG              4
+
+/* Number of the controller (1, 2) for the output, index of the controller */
+#define k_NUM(id)                ( ( (id) == SAFETY_CONTROLLER_1 ) ? 1u : 2u )
+#define k_IDX(id)                ( ( (id) == SAFETY_CONTROLLER_1 ) ? 0u : 1u )
+
+/* Salt of the bit errors of the line and of the line of controller 2, see Hash() */
+#define k_SALT_LINE              0x4C494E45u
+#define k_SALT_C2                0x43324332u
+
+/* t_SHARED:
+** Memory shared by the processes of both controllers
+*/
+typedef struct
+{
+  HOSTHAL_LOCKSTEP_STRUCT s_lockstep;                      /* lockstep of the simulated time */
+  volatile UINT32 au32_lines[HOSTHAL_SYNC_LINE_CNT];       /* IPC sync lines */
+  volatile UINT32 au32_cycleCnt[HOSTHAL_LOCKSTEP_CNT];     /* started cycles of the controller */
+} t_SHARED;
+
+/* t_STAT:
+** Deadline and jitter statistic of a controller, all times in usec
+*/
+typedef struct
+{
+  UINT32 u32_sliceCnt;                         /* executed time slices */
+  UINT32 u32_latencyMax;                       /* max. delay of the IRQ after the update event */
+  UINT32 au32_durMax[SCHAPP_TIME_SLICE_CNT];   /* max. execution time of every time slice */
+  UINT32 u32_cycleMin;                         /* min. time between the starts of two cycles */
+  UINT32 u32_cycleMax;                         /* max. time between the starts of two cycles */
+  UINT32 u32_timLostCnt;                       /* update events lost (UIF still set) */
+  UINT32 u32_dmaIrqCnt;                        /* executed DMA2 channel 3 IRQs */
+  UINT32 u32_aicTgmCnt;                        /* telegrams sent by the AIC master */
+  UINT32 u32_aicLostCnt;                       /* AIC bytes lost, reception not started */
+  UINT32 u32_aicErrCnt;                        /* AIC telegrams with a bit error */
+  UINT32 u32_asmTxCnt;                         /* ASM telegrams started on DMA2 channel 5 */
+  UINT32 u32_asmAbortCnt;                      /* ASM telegrams restarted before their end */
+  UINT32 u32_asmIntMin;                        /* min. time between two ASM telegrams */
+  UINT32 u32_asmIntMax;                        /* max. time between two ASM telegrams */
+  UINT32 u32_wdgGapMax;                        /* max. time between two watchdog refreshes */
+} t_STAT;
+
+/* Test parameters, see main() */
+STATIC UINT32 u32_Cycles = k_CYCLES;
+STATIC CONST char* pc_TaskCfg = k_TASK_CFG;
+STATIC UINT32 u32_LoadPct = k_LOAD_PCT;
+STATIC UINT32 u32_BkgdUs = k_BKGD_US;
+STATIC UINT32 u32_AicPhaseUs = k_AIC_PHASE_US;
+STATIC UINT32 u32_AicPeriodUs = GLOBDEF_CYCLE_TIME_US;
+STATIC INT32 i32_AicDriftPpm = 0;
+STATIC UINT32 u32_AicStartupTgm = k_AIC_STARTUP_TGM;
+STATIC UINT32 u32_AicLinePpm = 0u;
+STATIC UINT32 u32_AicC2Ppm = 0u;
+STATIC BOOL b_Trace = FALSE;
+STATIC IPCTHOST_CFG_STRUCT s_Cfg = { 0u, 0u, k_IPC_BAUD, 0u, 0u, 1u, 1u };
+
+/* Shared memory and start time of the cycles of both controllers (u32_Cycles per controller) */
+STATIC t_SHARED* ps_Shared = NULL_PNT;
+STATIC volatile UINT32* pau32_CycleStart = NULL_PNT;
+
+/* Statistic of the controller */
+STATIC t_STAT s_Stat;
+
+/* TIM1: counter and prescaler state of the last usec, time of the last update event */
+STATIC UINT16 u16_TimCnt = 0u;
+STATIC UINT32 u32_TimAcc = 0u;
+STATIC UINT32 u32_TimUpdate = 0u;
+
+/* WWDG: activated, control register of the last usec, prescaler state, last refresh */
+STATIC BOOL b_WdgActive = FALSE;
+STATIC UINT32 u32_WdgCr = 0u;
+STATIC UINT32 u32_WdgAcc = 0u;
+STATIC UINT32 u32_WdgRefresh = 0u;
+
+/* AIC master: telegram in transfer, its bytes as received by this controller, next byte */
+STATIC UINT32 u32_AicTgm = 0u;
+STATIC UINT8 au8_AicTgm[AICMSGDEF_AM_TGM_SIZE];
+STATIC UINT32 u32_AicByte = 0u;
+
+/* ASM telegram on DMA2 channel 5: remaining bytes, length and start of the last telegram */
+STATIC UINT32 u32_AsmCnd = 0u;
+STATIC UINT32 u32_AsmLen = 0u;
+STATIC UINT32 u32_AsmStart = 0u;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC int Controller( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST INT32 i32_fd );
+STATIC void Hook( CONST UINT32 u32_now );
+STATIC void TimerStep( CONST UINT32 u32_now );
+STATIC void WwdgStep( CONST UINT32 u32_now );
+STATIC void Dma2Clear( void );
+STATIC void AicMasterStep( CONST UINT32 u32_now );
+STATIC void AicMasterTgm( CONST UINT32 u32_tgm );
+STATIC void AsmTxStep( CONST UINT32 u32_now );
+STATIC UINT32 Hash( CONST UINT32 u32_a, CONST UINT32 u32_b, CONST UINT32 u32_salt );
+STATIC void StatPrint( CONST CFG_CONTROLLER_ID_ENUM e_id );
+
+/* IRQ handlers of the firmware (vector table of the startup code) */
+void TIM1_UP_IRQHandler( void );
+void DMA2_Channel3_IRQHandler( void );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    main
+
+  Description:
+    Parses the options, connects the two controller processes (socketpair, shared memory of the
+    lockstep and the sync lines), waits for both of them, prints their reports and the offset
+    of their cycles.
+
+***************************************************************************************************/
+int main( int argc, char* argv[] )
+{
+  INT32 ai32_fd[2];
+  FILE* aps_report[2];
+  pid_t ai_pid[2];
+  int ai_status[2];
+  BOOL b_expectSafety = FALSE;
+  BOOL b_pass = TRUE;
+  INT32 i32_offset;
+  INT32 i32_offsetMin = 0;
+  INT32 i32_offsetMax = 0;
+  UINT32 u32_cycles;
+  UINT32 i;
+  int i_opt;
+  int i_char;
+
+  while ( ( i_opt = getopt( argc, argv, "n:c:l:b:d:j:B:D:F:s:p:P:m:S:E:e:vx" ) ) != -1 )
+  {
+    switch ( i_opt )
+    {
+      case 'n': u32_Cycles = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'c': pc_TaskCfg = optarg; break;
+      case 'l': u32_LoadPct = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'b': u32_BkgdUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'd': s_Cfg.u32_delayUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'j': s_Cfg.u32_jitterUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'B': s_Cfg.u32_baudRate = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'D': s_Cfg.u32_dropPpm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'F': s_Cfg.u32_flipPpm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 's': s_Cfg.u32_seed = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'p': u32_AicPhaseUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'P': u32_AicPeriodUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'm': i32_AicDriftPpm = (INT32)strtol( optarg, NULL, 0 ); break;
+      case 'S': u32_AicStartupTgm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'E': u32_AicLinePpm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'e': u32_AicC2Ppm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'v': b_Trace = TRUE; break;
+      case 'x': b_expectSafety = TRUE; break;
+      default:  return 2;
+    }
+  }
+  if ( ( optind != argc ) || ( u32_Cycles == 0u ) || ( u32_AicPeriodUs == 0u ) )
+  {
+    (void)fprintf( stderr, "usage: cycleSim [-n cycles] [-c task_cfg] [-l load_pct] "
+                           "[-b bkgd_us] [-d delay_us] [-j jitter_us] [-B baud] [-D drop_ppm] "
+                           "[-F flip_ppm] [-s seed] [-p aic_phase_us] [-P aic_period_us] "
+                           "[-m aic_drift_ppm] [-S aic_startup_tgm] [-E aic_err_ppm] "
+                           "[-e aic_err_ppm_c2] [-v] [-x]\n" );
+    return 2;
+  }
+
+  (void)printf( "%u cycles, load %u %%, background %u us, IPC delay %u us, jitter %u us, "
+                "baud %u, drop %u ppm, flip %u ppm, seed %u\n",
+                (unsigned)u32_Cycles, (unsigned)u32_LoadPct, (unsigned)u32_BkgdUs,
+                (unsigned)s_Cfg.u32_delayUs, (unsigned)s_Cfg.u32_jitterUs,
+                (unsigned)s_Cfg.u32_baudRate, (unsigned)s_Cfg.u32_dropPpm,
+                (unsigned)s_Cfg.u32_flipPpm, (unsigned)s_Cfg.u32_seed );
+  (void)printf( "AIC master: phase %u us, period %u us, drift %d ppm, %u startup telegrams, "
+                "bit errors %u ppm, controller 2 %u ppm%s\n",
+                (unsigned)u32_AicPhaseUs, (unsigned)u32_AicPeriodUs, (int)i32_AicDriftPpm,
+                (unsigned)u32_AicStartupTgm, (unsigned)u32_AicLinePpm, (unsigned)u32_AicC2Ppm,
+                b_expectSafety ? ", Safety Handler expected" : "" );
+  (void)fflush( stdout );
+
+  /* the lockstep, the sync lines, the cycles and the socket are shared by both processes, the
+  ** reports are written into files and printed in the order of the controllers */
+  ps_Shared = (t_SHARED*)mmap( NULL, sizeof(t_SHARED), PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_ANONYMOUS, -1, 0 );
+  pau32_CycleStart = (volatile UINT32*)mmap( NULL, HOSTHAL_LOCKSTEP_CNT * u32_Cycles *
+                                                   sizeof(UINT32),
+                                             PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                                             -1, 0 );
+  aps_report[0] = tmpfile();
+  aps_report[1] = tmpfile();
+  if ( ( ps_Shared == (t_SHARED*)MAP_FAILED ) ||
+       ( pau32_CycleStart == (volatile UINT32*)MAP_FAILED ) ||
+       ( aps_report[0] == NULL ) || ( aps_report[1] == NULL ) ||
+       ( socketpair( AF_UNIX, SOCK_SEQPACKET, 0, ai32_fd ) != 0 ) )
+  {
+    perror( "cycleSim" );
+    return 1;
+  }
+  else
+  {
+    (void)memset( (void*)ps_Shared, 0, sizeof(t_SHARED) );
+  }
+
+  for ( i = 0u; i < 2u; i++ )
+  {
+    ai_pid[i] = fork();
+    if ( ai_pid[i] == 0 )
+    {
+      /* child: controller 1 uses the first end of the socketpair, controller 2 the second */
+      (void)close( ai32_fd[1u - i] );
+      (void)dup2( fileno( aps_report[i] ), STDOUT_FILENO );
+      exit( Controller( ( i == 0u ) ? SAFETY_CONTROLLER_1 : SAFETY_CONTROLLER_2, ai32_fd[i] ) );
+    }
+    else if ( ai_pid[i] < 0 )
+    {
+      perror( "cycleSim" );
+      return 1;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  (void)close( ai32_fd[0] );
+  (void)close( ai32_fd[1] );
+
+  for ( i = 0u; i < 2u; i++ )
+  {
+    if ( ( waitpid( ai_pid[i], &ai_status[i], 0 ) != ai_pid[i] ) || !WIFEXITED( ai_status[i] ) )
+    {
+      ai_status[i] = -1;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+
+  for ( i = 0u; i < 2u; i++ )
+  {
+    rewind( aps_report[i] );
+    while ( ( i_char = fgetc( aps_report[i] ) ) != EOF )
+    {
+      (void)putchar( i_char );
+    }
+    if ( ai_status[i] == -1 )
+    {
+      (void)printf( "controller %u: aborted\n", (unsigned)( i + 1u ) );
+      b_pass = FALSE;
+    }
+    else
+    {
+      (void)printf( "controller %u: exit code %d\n", (unsigned)( i + 1u ),
+                    WEXITSTATUS( ai_status[i] ) );
+      b_pass = ( b_pass &&
+                 ( WEXITSTATUS( ai_status[i] ) == ( b_expectSafety ? k_EXIT_SAFETY : 0 ) ) );
+    }
+  }
+
+  /* offset of the cycles started by both controllers */
+  u32_cycles = ps_Shared->au32_cycleCnt[0];
+  if ( ps_Shared->au32_cycleCnt[1] < u32_cycles )
+  {
+    u32_cycles = ps_Shared->au32_cycleCnt[1];
+  }
+  else
+  {
+    /* empty branch */
+  }
+  for ( i = 0u; i < u32_cycles; i++ )
+  {
+    i32_offset = (INT32)( pau32_CycleStart[u32_Cycles + i] - pau32_CycleStart[i] );
+    i32_offsetMin = ( ( i == 0u ) || ( i32_offset < i32_offsetMin ) ) ? i32_offset : i32_offsetMin;
+    i32_offsetMax = ( ( i == 0u ) || ( i32_offset > i32_offsetMax ) ) ? i32_offset : i32_offsetMax;
+  }
+  (void)printf( "cycle offset controller 2 - controller 1: %u cycles, min %d us, max %d us\n",
+                (unsigned)u32_cycles, (int)i32_offsetMin, (int)i32_offsetMax );
+
+  (void)printf( "%s\n", b_pass ? "PASS" : "FAIL" );
+  return b_pass ? 0 : 1;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    Controller
+
+  Description:
+    Process of one controller: startup as in main.c (scheduler timer, IPC, sync, AIC, exchange
+    of the configuration), then the main loop until u32_Cycles cycles are executed. The main
+    loop executes the scheduler IRQ if the update event of TIM1 is pending and enabled, else
+    the IRQ of the AIC reception, else one usec of the background task (if triggered) or of
+    idle time. The Safety Handler ends the process with k_EXIT_SAFETY, a watchdog reset with
+    k_EXIT_WWDG.
+
+  Return value:
+    int - exit code of the process, 0: data exchange reached, no time slice overrun, no update
+          event lost, 1: failed
+
+***************************************************************************************************/
+STATIC int Controller( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST INT32 i32_fd )
+{
+  CYCLESIMTASKS_STAT_STRUCT s_tasks;
+  t_SCHAPP_OVERRUN s_overrun;
+  UINT32 u32_cycle = 0u;
+  UINT32 u32_entry;
+  UINT32 u32_dur;
+  UINT32 u32_bkgdLeft = 0u;
+  UINT32 u32_traceMax = 0u;
+  UINT8 u8_traceSlice = 0u;
+  UINT8 u8_slice;
+  BOOL b_bkgd = FALSE;
+  BOOL b_ok = TRUE;
+
+  (void)memset( &s_Stat, 0, sizeof(s_Stat) );
+  s_Stat.u32_cycleMin = 0xFFFFFFFFu;
+  s_Stat.u32_asmIntMin = 0xFFFFFFFFu;
+
+  hostHAL_ControllerSet( e_id );
+  hostHAL_SyncLinesSet( ps_Shared->au32_lines );
+  hostHAL_TimeStepSet( &ps_Shared->s_lockstep, &Hook );
+  ipctHOST_Setup( i32_fd, &s_Cfg );
+
+  /* the startup telegram contains the serial number of the flash */
+  if ( ( mmap( (void*)VERSION_SERIAL_NUM_FLASH_ADDR, (size_t)getpagesize(),
+               PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+               -1, 0 ) == MAP_FAILED ) ||
+       !cycleSimTASKS_Init( pc_TaskCfg, u32_LoadPct ) )
+  {
+    (void)printf( "controller %u: setup failed (%s)\n", (unsigned)k_NUM(e_id), pc_TaskCfg );
+    return 1;
+  }
+  else
+  {
+    *(UINT32*)VERSION_SERIAL_NUM_FLASH_ADDR = 0x00010000u + (UINT32)k_NUM(e_id);
+  }
+
+  /* startup, see main_Init() and main_Config() of main.c */
+  schAPP_Init();
+  ipcxSYS_Init();
+  ipcsSYS_Init();
+  aicMgrTx_SysInit();
+  ipcsSYS_SyncStartup();
+  if ( ipcxSYS_ExChangeUINT32Data( k_CONFIG_WORD, IPCXSYS_IPC_ID_CONFIG ) != k_CONFIG_WORD )
+  {
+    (void)printf( "controller %u: configuration differs\n", (unsigned)k_NUM(e_id) );
+    return 1;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  schAPP_StartScheduler();
+
+  while ( u32_cycle < u32_Cycles )
+  {
+    Dma2Clear();
+
+    /* scheduler IRQ, priority 2 */
+    if ( ( ( TIM1->SR & TIM_SR_UIF ) != 0u ) && ( ( TIM1->DIER & TIM_DIER_UIE ) != 0u ) &&
+         hostHAL_IrqEnabled( TIM1_UP_IRQn ) )
+    {
+      u32_entry = hostHAL_TimeGet();
+      u8_slice = schAPP_TimeSliceGet();
+      s_Stat.u32_latencyMax = ( ( u32_entry - u32_TimUpdate ) > s_Stat.u32_latencyMax ) ?
+                              ( u32_entry - u32_TimUpdate ) : s_Stat.u32_latencyMax;
+      if ( u8_slice == 0u )
+      {
+        /* start of a cycle */
+        pau32_CycleStart[( k_IDX(e_id) * u32_Cycles ) + u32_cycle] = u32_entry;
+        ps_Shared->au32_cycleCnt[k_IDX(e_id)] = u32_cycle + 1u;
+        if ( u32_cycle != 0u )
+        {
+          u32_dur = u32_entry -
+                    pau32_CycleStart[( k_IDX(e_id) * u32_Cycles ) + u32_cycle - 1u];
+          s_Stat.u32_cycleMin = ( u32_dur < s_Stat.u32_cycleMin ) ? u32_dur : s_Stat.u32_cycleMin;
+          s_Stat.u32_cycleMax = ( u32_dur > s_Stat.u32_cycleMax ) ? u32_dur : s_Stat.u32_cycleMax;
+        }
+        else
+        {
+          u32_dur = 0u;
+        }
+        if ( b_Trace && ( u32_cycle != 0u ) )
+        {
+          cycleSimTASKS_StatGet( &s_tasks );
+          (void)printf( "controller %u cycle %u: start %u us, interval %u us, slice %u max "
+                        "%u us, AIC state 0x%04x, telegrams %u\n",
+                        (unsigned)k_NUM(e_id), (unsigned)( u32_cycle - 1u ), (unsigned)u32_entry,
+                        (unsigned)u32_dur, (unsigned)u8_traceSlice, (unsigned)u32_traceMax,
+                        (unsigned)aicSm_eAicState, (unsigned)s_tasks.u32_tgmCnt );
+        }
+        else
+        {
+          /* empty branch */
+        }
+        u32_traceMax = 0u;
+      }
+      else
+      {
+        /* empty branch */
+      }
+
+      TIM1_UP_IRQHandler();
+
+      u32_dur = hostHAL_TimeGet() - u32_entry;
+      s_Stat.u32_sliceCnt++;
+      s_Stat.au32_durMax[u8_slice] = ( u32_dur > s_Stat.au32_durMax[u8_slice] ) ?
+                                     u32_dur : s_Stat.au32_durMax[u8_slice];
+      if ( u32_dur >= u32_traceMax )
+      {
+        u32_traceMax = u32_dur;
+        u8_traceSlice = u8_slice;
+      }
+      else
+      {
+        /* empty branch */
+      }
+      u32_cycle += ( schAPP_TimeSliceGet() == 0u ) ? 1u : 0u;
+    }
+    /* AIC reception IRQ, priority 3 */
+    else if ( ( ( DMA2->ISR & ( DMA_ISR_HTIF3 | DMA_ISR_TCIF3 ) ) != 0u ) &&
+              ( ( DMA2_Channel3->CCR & ( DMA_CCR3_HTIE | DMA_CCR3_TCIE ) ) != 0u ) &&
+              hostHAL_IrqEnabled( DMA2_Channel3_IRQn ) )
+    {
+      DMA2_Channel3_IRQHandler();
+      s_Stat.u32_dmaIrqCnt++;
+    }
+    /* background task, see SAPL_BkgdTaskExec() and the main loop of main.c */
+    else if ( b_bkgd || cycleSimTASKS_BkgdPending() )
+    {
+      u32_bkgdLeft = b_bkgd ? u32_bkgdLeft : u32_BkgdUs;
+      b_bkgd = TRUE;
+      if ( u32_bkgdLeft != 0u )
+      {
+        hostHAL_TimeAdvance( 1u );
+        u32_bkgdLeft--;
+      }
+      else
+      {
+        b_bkgd = FALSE;
+        cycleSimTASKS_BkgdDone();
+        schAPP_TriggerCycleStatistic();
+        schAPP_TriggerMainExecTime();
+      }
+    }
+    else
+    {
+      hostHAL_TimeAdvance( 1u );
+    }
+  }
+
+  StatPrint( e_id );
+
+  schAPP_OverrunGet( &s_overrun );
+  if ( aicSm_eAicState != AICSM_AIC_EXEC_PROD_CONS )
+  {
+    (void)printf( "controller %u: data exchange not reached\n", (unsigned)k_NUM(e_id) );
+    b_ok = FALSE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  if ( ( s_overrun.u16_sliceCnt != 0u ) || ( s_Stat.u32_timLostCnt != 0u ) )
+  {
+    (void)printf( "controller %u: time slice overrun\n", (unsigned)k_NUM(e_id) );
+    b_ok = FALSE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  (void)fflush( stdout );
+  return b_ok ? 0 : 1;
+}
+
+/***************************************************************************************************
+  Function:
+    Hook
+
+  Description:
+    Time hook, called every usec of the simulated time (see hostHAL_TimeStepSet()): simulates
+    the peripherals and receives the IPC telegrams.
+
+***************************************************************************************************/
+STATIC void Hook( CONST UINT32 u32_now )
+{
+  TimerStep( u32_now );
+  WwdgStep( u32_now );
+  Dma2Clear();
+  AicMasterStep( u32_now );
+  AsmTxStep( u32_now );
+  ipctHOST_Poll( u32_now );
+}
+
+/***************************************************************************************************
+  Function:
+    TimerStep
+
+  Description:
+    Scheduler timer TIM1: the counter counts with the prescaled timer clock while it is
+    enabled, after the reload value the update event is set (the event is lost if the flag is
+    still set). A counter value written by the firmware (timerHAL_ClearTimer1Counter()) restarts
+    the prescaler.
+
+***************************************************************************************************/
+STATIC void TimerStep( CONST UINT32 u32_now )
+{
+  if ( TIM1->CNT != u16_TimCnt )
+  {
+    u16_TimCnt = TIM1->CNT;
+    u32_TimAcc = 0u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( TIM1->CR1 & TIM_CR1_CEN ) != 0u )
+  {
+    u32_TimAcc += k_TIM1_CLK_MHZ;
+    while ( u32_TimAcc >= ( (UINT32)TIM1->PSC + 1u ) )
+    {
+      u32_TimAcc -= (UINT32)TIM1->PSC + 1u;
+      if ( u16_TimCnt >= TIM1->ARR )
+      {
+        u16_TimCnt = 0u;
+        if ( ( TIM1->SR & TIM_SR_UIF ) != 0u )
+        {
+          s_Stat.u32_timLostCnt++;
+        }
+        else
+        {
+          TIM1->SR |= TIM_SR_UIF;
+        }
+        u32_TimUpdate = u32_now;
+      }
+      else
+      {
+        u16_TimCnt++;
+      }
+    }
+    TIM1->CNT = u16_TimCnt;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    WwdgStep
+
+  Description:
+    Window watchdog: activated by WDGA, the counter T counts down with PCLK1/4096/2^WDGTB. A
+    write of the firmware to the control register refreshes the counter, the watchdog resets if
+    it is refreshed while T is above the window or if T6 is cleared. The reset ends the process
+    with k_EXIT_WWDG.
+
+***************************************************************************************************/
+STATIC void WwdgStep( CONST UINT32 u32_now )
+{
+  BOOL b_reset = FALSE;
+
+  if ( !b_WdgActive )
+  {
+    b_WdgActive = ( ( WWDG->CR & WWDG_CR_WDGA ) != 0u ) ? TRUE : FALSE;
+    u32_WdgCr = WWDG->CR;
+    u32_WdgRefresh = u32_now;
+  }
+  else if ( WWDG->CR != u32_WdgCr )
+  {
+    /* refresh, WDGA can only be cleared by a reset */
+    b_reset = ( ( u32_WdgCr & WWDG_CR_T ) > ( WWDG->CFR & WWDG_CFR_W ) ) ? TRUE : FALSE;
+    s_Stat.u32_wdgGapMax = ( ( u32_now - u32_WdgRefresh ) > s_Stat.u32_wdgGapMax ) ?
+                           ( u32_now - u32_WdgRefresh ) : s_Stat.u32_wdgGapMax;
+    u32_WdgRefresh = u32_now;
+    WWDG->CR = ( WWDG->CR & WWDG_CR_T ) | WWDG_CR_WDGA;
+    u32_WdgCr = WWDG->CR;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( b_WdgActive )
+  {
+    u32_WdgAcc += k_WWDG_CLK_MHZ;
+    if ( u32_WdgAcc >= ( k_WWDG_DIV << ( ( WWDG->CFR & WWDG_CFR_WDGTB ) >> 7u ) ) )
+    {
+      u32_WdgAcc -= k_WWDG_DIV << ( ( WWDG->CFR & WWDG_CFR_WDGTB ) >> 7u );
+      WWDG->CR = ( WWDG->CR & ~(UINT32)WWDG_CR_T ) | ( ( WWDG->CR & WWDG_CR_T ) - 1u );
+      u32_WdgCr = WWDG->CR;
+      b_reset = ( b_reset || ( ( WWDG->CR & k_WWDG_T6 ) == 0u ) ) ? TRUE : FALSE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( b_reset )
+  {
+    (void)printf( "controller %u: watchdog reset at %u us, last refresh %u us\n",
+                  (unsigned)k_NUM(cfgSYS_GetControllerID()), (unsigned)u32_now,
+                  (unsigned)u32_WdgRefresh );
+    StatPrint( cfgSYS_GetControllerID() );
+    exit( k_EXIT_WWDG );
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    Dma2Clear
+
+  Description:
+    Clears the flags of DMA2 written to the interrupt flag clear register. The global clear bit
+    of a channel (CGIFx) clears all four flags of the channel.
+
+***************************************************************************************************/
+STATIC void Dma2Clear( void )
+{
+  UINT32 u32_clr = DMA2->IFCR;
+  UINT8  u8_ch;
+
+  for ( u8_ch = 0u; u8_ch < 7u; u8_ch++ )
+  {
+    if ( ( u32_clr & ( DMA_IFCR_CGIF1 << ( 4u * u8_ch ) ) ) != 0u )
+    {
+      u32_clr |= 0xFu << ( 4u * u8_ch );
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  DMA2->ISR &= ~u32_clr;
+  DMA2->IFCR = 0u;
+}
+
+/***************************************************************************************************
+  Function:
+    AicMasterStep
+
+  Description:
+    AIC master: telegram k starts at phase + k * period (plus the drift), its bytes follow with
+    the byte time of the AIC baud rate (10 bit per byte). A byte is written by DMA2 channel 3
+    into the receive buffer if the channel is enabled, a byte is left to receive and UART4 is
+    enabled, else it is lost. The flags of the half and the complete transfer are set like the
+    DMA does. The model only depends on the simulated time, so both controllers receive the
+    same telegrams at the same time (except the bit errors of controller 2).
+
+***************************************************************************************************/
+STATIC void AicMasterStep( CONST UINT32 u32_now )
+{
+  UINT8* pau8_buf = (UINT8*)&aicUart_sAicRxDmaBuffer;
+  unsigned long long ull_start;
+  UINT32 u32_due;
+
+  ull_start = (unsigned long long)u32_AicPhaseUs +
+              ( (unsigned long long)u32_AicTgm * u32_AicPeriodUs );
+  ull_start = (unsigned long long)( (long long)ull_start +
+                                    ( ( (long long)ull_start * i32_AicDriftPpm ) / 1000000LL ) );
+  u32_due = (UINT32)ull_start +
+            (UINT32)( ( ( (unsigned long long)u32_AicByte + 1uLL ) * 10000000uLL ) / k_AIC_BAUD );
+
+  if ( (INT32)( u32_now - u32_due ) >= 0 )
+  {
+    if ( u32_AicByte == 0u )
+    {
+      AicMasterTgm( u32_AicTgm );
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    if ( ( ( DMA2_Channel3->CCR & DMA_CCR3_EN ) != 0u ) && ( DMA2_Channel3->CNDTR != 0u ) &&
+         ( ( UART4->CR1 & USART_CR1_UE ) != 0u ) )
+    {
+      pau8_buf[AICMSGDEF_AM_TGM_SIZE - DMA2_Channel3->CNDTR] = au8_AicTgm[u32_AicByte];
+      DMA2_Channel3->CNDTR--;
+      if ( DMA2_Channel3->CNDTR == ( AICMSGDEF_AM_TGM_SIZE - ( AICMSGDEF_AM_TGM_SIZE / 2u ) ) )
+      {
+        DMA2->ISR |= DMA_ISR_HTIF3 | DMA_ISR_GIF3;
+      }
+      else if ( DMA2_Channel3->CNDTR == 0u )
+      {
+        DMA2->ISR |= DMA_ISR_TCIF3 | DMA_ISR_GIF3;
+      }
+      else
+      {
+        /* empty branch */
+      }
+    }
+    else
+    {
+      s_Stat.u32_aicLostCnt++;
+    }
+
+    u32_AicByte++;
+    if ( u32_AicByte == AICMSGDEF_AM_TGM_SIZE )
+    {
+      u32_AicByte = 0u;
+      u32_AicTgm++;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    AicMasterTgm
+
+  Description:
+    Builds telegram u32_tgm of the AIC master as received by this controller: the control/status
+    byte requests the data exchange (CYCLESIMTASKS_AM_STS_RUN) after the startup telegrams, the
+    data is a pattern of the telegram number, the CRC is the AIC CRC16. The bit errors are
+    derived from the telegram and byte number (see Hash()), so they are the same in every run.
+
+***************************************************************************************************/
+STATIC void AicMasterTgm( CONST UINT32 u32_tgm )
+{
+  AICMSGDEF_AM_TELEGRAM_STRUCT s_tgm;
+  UINT8* pau8_tgm = (UINT8*)&s_tgm;
+  UINT32 u32_hash;
+  BOOL b_err = FALSE;
+  UINT32 i;
+
+  (void)memset( &s_tgm, 0, sizeof(s_tgm) );
+  for ( i = 0u; i < AICMSGDEF_AM_TGM_SIZE; i++ )
+  {
+    pau8_tgm[i] = (UINT8)( ( u32_tgm * 7u ) + ( i * 13u ) );
+  }
+  s_tgm.u8CtrlStatus = ( u32_tgm >= u32_AicStartupTgm ) ? CYCLESIMTASKS_AM_STS_RUN : 0u;
+  s_tgm.u16Crc = aicCrc_Crc16( pau8_tgm, (UINT32)( AICMSGDEF_AM_TGM_SIZE -
+                                                   AICMSGDEF_ASM_CRC_SIZE ) );
+
+  for ( i = 0u; i < AICMSGDEF_AM_TGM_SIZE; i++ )
+  {
+    u32_hash = Hash( u32_tgm, i, k_SALT_LINE ^ s_Cfg.u32_seed );
+    if ( ( u32_hash % 1000000u ) < u32_AicLinePpm )
+    {
+      pau8_tgm[i] ^= (UINT8)( 1u << ( ( u32_hash >> 24u ) % 8u ) );
+      b_err = TRUE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    u32_hash = Hash( u32_tgm, i, k_SALT_C2 ^ s_Cfg.u32_seed );
+    if ( ( cfgSYS_GetControllerID() == SAFETY_CONTROLLER_2 ) &&
+         ( ( u32_hash % 1000000u ) < u32_AicC2Ppm ) )
+    {
+      pau8_tgm[i] ^= (UINT8)( 1u << ( ( u32_hash >> 24u ) % 8u ) );
+      b_err = TRUE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+
+  (void)memcpy( au8_AicTgm, pau8_tgm, AICMSGDEF_AM_TGM_SIZE );
+  s_Stat.u32_aicTgmCnt++;
+  s_Stat.u32_aicErrCnt += b_err ? 1u : 0u;
+}
+
+/***************************************************************************************************
+  Function:
+    AsmTxStep
+
+  Description:
+    ASM telegram on DMA2 channel 5: a transfer count written by the firmware
+    (aicUart_TriggerSending()) starts a telegram, the DMA sends its bytes with the byte time of
+    the AIC baud rate. The interval between the telegrams is measured, a telegram restarted
+    before its last byte is counted.
+
+***************************************************************************************************/
+STATIC void AsmTxStep( CONST UINT32 u32_now )
+{
+  UINT32 u32_int;
+
+  if ( DMA2_Channel5->CNDTR != u32_AsmCnd )
+  {
+    if ( u32_AsmCnd != 0u )
+    {
+      s_Stat.u32_asmAbortCnt++;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    if ( s_Stat.u32_asmTxCnt != 0u )
+    {
+      u32_int = u32_now - u32_AsmStart;
+      s_Stat.u32_asmIntMin = ( u32_int < s_Stat.u32_asmIntMin ) ? u32_int : s_Stat.u32_asmIntMin;
+      s_Stat.u32_asmIntMax = ( u32_int > s_Stat.u32_asmIntMax ) ? u32_int : s_Stat.u32_asmIntMax;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    s_Stat.u32_asmTxCnt++;
+    u32_AsmStart = u32_now;
+    u32_AsmCnd = DMA2_Channel5->CNDTR;
+    u32_AsmLen = u32_AsmCnd;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( ( DMA2_Channel5->CCR & DMA_CCR5_EN ) != 0u ) && ( u32_AsmCnd != 0u ) &&
+       ( ( u32_now - u32_AsmStart ) >=
+         (UINT32)( ( ( (unsigned long long)( u32_AsmLen - u32_AsmCnd ) + 1uLL ) * 10000000uLL ) /
+                   k_AIC_BAUD ) ) )
+  {
+    u32_AsmCnd--;
+    DMA2_Channel5->CNDTR = u32_AsmCnd;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    Hash
+
+  Description:
+    Mixes two numbers and a salt into a pseudo random number (used for the bit errors of the
+    AIC telegrams, independent of the order of the calls).
+
+  Return value:
+    UINT32 - pseudo random number
+
+***************************************************************************************************/
+STATIC UINT32 Hash( CONST UINT32 u32_a, CONST UINT32 u32_b, CONST UINT32 u32_salt )
+{
+  UINT32 u32_x = ( u32_a * 0x9E3779B1u ) ^ ( u32_b * 0x85EBCA77u ) ^ u32_salt;
+
+  u32_x ^= u32_x >> 16u;
+  u32_x *= 0x7FEB352Du;
+  u32_x ^= u32_x >> 15u;
+  u32_x *= 0x846CA68Bu;
+  u32_x ^= u32_x >> 16u;
+  return u32_x;
+}
+
+/***************************************************************************************************
+  Function:
+    StatPrint
+
+  Description:
+    Prints the report of the controller: deadline and jitter statistic of the time slices and
+    cycles, budget monitoring of the scheduler, IPC wait time and link statistic, transport,
+    AIC telegrams and task models, all times in usec.
+
+***************************************************************************************************/
+STATIC void StatPrint( CONST CFG_CONTROLLER_ID_ENUM e_id )
+{
+  STATIC CONST UINT8 au8_id[] = { IPCXSYS_IPC_ID_IO, IPCXSYS_IPC_ID_APPCLKCTRL,
+                                  IPCXSYS_IPC_ID_CSS_CTRL_INFO, IPCXSYS_IPC_ID_SAFETGM,
+                                  IPCXSYS_IPC_ID_FRAME };
+  CYCLESIMTASKS_STAT_STRUCT s_tasks;
+  t_SCHAPP_OVERRUN s_overrun;
+  IPCXSYS_WAIT_STAT_STRUCT s_wait;
+  IPCXSYS_LINK_STAT_STRUCT s_link;
+  IPCTHOST_STAT_STRUCT s_host;
+  UINT32 u32_worst = 0u;
+  UINT32 i;
+
+  schAPP_OverrunGet( &s_overrun );
+  ipcxSYS_WaitStatGet( &s_wait );
+  ipctHOST_StatGet( &s_host );
+  cycleSimTASKS_StatGet( &s_tasks );
+
+  for ( i = 1u; i < SCHAPP_TIME_SLICE_CNT; i++ )
+  {
+    u32_worst = ( s_Stat.au32_durMax[i] > s_Stat.au32_durMax[u32_worst] ) ? i : u32_worst;
+  }
+  (void)printf( "controller %u: %u time slices, IRQ latency max %u us, slice %u max %u us "
+                "(slack %d us), cycle min %u us max %u us, lost update events %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_Stat.u32_sliceCnt,
+                (unsigned)s_Stat.u32_latencyMax, (unsigned)u32_worst,
+                (unsigned)s_Stat.au32_durMax[u32_worst],
+                (int)k_SLICE_US - (int)s_Stat.au32_durMax[u32_worst],
+                (unsigned)s_Stat.u32_cycleMin, (unsigned)s_Stat.u32_cycleMax,
+                (unsigned)s_Stat.u32_timLostCnt );
+  (void)printf( "controller %u: slice max [us]", (unsigned)k_NUM(e_id) );
+  for ( i = 0u; i < SCHAPP_TIME_SLICE_CNT; i++ )
+  {
+    (void)printf( " %u", (unsigned)s_Stat.au32_durMax[i] );
+  }
+  (void)printf( "\n" );
+  (void)printf( "controller %u: task budget overruns %u (last slice %u task %u), slice "
+                "overruns %u, watchdog refresh max %u us\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_overrun.u16_taskCnt,
+                (unsigned)s_overrun.u8_lastSlice, (unsigned)s_overrun.u8_lastTask,
+                (unsigned)s_overrun.u16_sliceCnt, (unsigned)s_Stat.u32_wdgGapMax );
+  (void)printf( "controller %u: IPC %u cycles, rx wait %u cycles max %u, sync max %u, "
+                "total mean %u max %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_wait.u32_cycleCnt,
+                (unsigned)s_wait.u32_rxWaitCycleCnt, (unsigned)s_wait.u16_rxMax,
+                (unsigned)s_wait.u16_syncMax, (unsigned)s_wait.u16_totalMean,
+                (unsigned)s_wait.u16_totalMax );
+  for ( i = 0u; i < ( sizeof(au8_id) / sizeof(au8_id[0]) ); i++ )
+  {
+    ipcxSYS_LinkStatGet( au8_id[i], &s_link );
+    (void)printf( "controller %u: ID 0x%02x rx %u crc fail %u recovered %u wait mean %u max %u\n",
+                  (unsigned)k_NUM(e_id), (unsigned)au8_id[i], (unsigned)s_link.u32_rxCnt,
+                  (unsigned)s_link.u16_crcFailCnt, (unsigned)s_link.u16_recoverCnt,
+                  (unsigned)s_link.u16_waitMean, (unsigned)s_link.u16_waitMax );
+  }
+  (void)printf( "controller %u: transport tx %u rx %u dropped %u flipped %u lost %u "
+                "complete %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_host.u32_txCnt, (unsigned)s_host.u32_rxCnt,
+                (unsigned)s_host.u32_dropCnt, (unsigned)s_host.u32_flipCnt,
+                (unsigned)s_host.u32_lostCnt, (unsigned)s_host.u32_completeCnt );
+  (void)printf( "controller %u: AIC master %u telegrams (%u with bit errors), %u bytes lost, "
+                "found %u, crc fail %u, caught up %u, DMA IRQs %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_Stat.u32_aicTgmCnt,
+                (unsigned)s_Stat.u32_aicErrCnt, (unsigned)s_Stat.u32_aicLostCnt,
+                (unsigned)s_tasks.u32_tgmCnt, (unsigned)s_tasks.u32_crcFailCnt,
+                (unsigned)s_tasks.u32_catchUpCnt, (unsigned)s_Stat.u32_dmaIrqCnt );
+  (void)printf( "controller %u: ASM %u telegrams, restarted %u, interval min %u us max %u us, "
+                "AIC state 0x%04x\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_Stat.u32_asmTxCnt,
+                (unsigned)s_Stat.u32_asmAbortCnt,
+                (unsigned)( ( s_Stat.u32_asmTxCnt > 1u ) ? s_Stat.u32_asmIntMin : 0u ),
+                (unsigned)s_Stat.u32_asmIntMax, (unsigned)aicSm_eAicState );
+  (void)printf( "controller %u: background %u cycles, max time slice %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_tasks.u32_bkgdCnt,
+                (unsigned)s_tasks.u8_bkgdMaxSlice );
+  (void)fflush( stdout );
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,1141 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: cycleSimTasks.c
+**     Summary: Task models of the host cycle simulation (see cycleSim.c). The scheduler
+**              (sch_Scheduler-app.c), the IPC (ipcx, ipcs) and the AIC manager (aicMgrRx.c,
+**              aicMgrTx.c, aicUart.c) are built unchanged, this module provides the tasks and
+**              modules they call:
+**                - every task takes its declared execution time (wcet of
+**                  pkgOperation/sch_Scheduler-app_tasks.cfg) scaled by the load, the firmware
+**                  tasks of the scheduler table are wrapped (ld --wrap) for it
+**                - the tasks with an IPC exchange send and receive the IPC telegrams of the
+**                  firmware (IPC ID, length, reserve/commit or frame) and check them like it
+**                - the AIC state machine enters the data exchange when the AIC master
+**                  requests it (CYCLESIMTASKS_AM_STS_RUN), the background task is triggered
+**                  and checked like SAPLbkgd
+**              The IPC exchanges are the ones of gpio.c, TIM.c, SAPLipc.c, spduIn.c,
+**              tm_TemperatureMonitor-srv.c and clkCtrl.c. No RFID tag is read, so the RFID
+**              digest is not exchanged.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: cycleSimTASKS_Init
+**             cycleSimTASKS_BkgdPending
+**             cycleSimTASKS_BkgdDone
+**             cycleSimTASKS_StatGet
+**
+**             (firmware tasks and modules, see the headers of the firmware)
+**             (__wrap_ functions of the wrapped firmware tasks)
+**
+**             WcetGet
+**             Pad
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+#include "rds.h"
+
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+#include "globFail_Errorcodes.h"
+#include "globFail_SafetyHandler.h"
+#include "cfg_Config-sys.h"
+
+#include "timer-def.h"
+#include "timer-hal.h"
+
+/* Module header */
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+
+#include "includeDiDo.h"
+#include "fiParam.h"
+
+#include "aicMsgDef.h"
+#include "aicMsgCfg.h"
+#include "aicMsgBld.h"
+#include "aicMsgProc.h"
+#include "aicMsgErr.h"
+#include "aicMsgCtrlSts.h"
+#include "aicUart.h"
+#include "aicMgrRx.h"
+#include "aicMgrTx.h"
+#include "aicSm.h"
+#include "aicIoRstDi.h"
+#include "aicIoRstDo.h"
+
+#include "spduIn.h"
+#include "spduOutIo.h"
+#include "spduOutTcoo.h"
+#include "spduOutData.h"
+
+#include "stHan_SelftestHandler-srv.h"
+#include "tm_TemperatureMonitor-srv.h"
+#include "clkCtrl.h"
+#include "TIM.h"
+
+#include "CSOScfg.h"
+#include "CSScfg.h"
+#include "CSStypes.h"
+#include "CSSplatform.h"
+#include "CSSapi.h"
+
+#include "SAPLipc.h"
+#include "SAPLbkgdMain.h"
+#include "SAPLnvLow.h"
+#include "SAPLappObj.h"
+
+#ifdef RFID_ACTIVE
+  #include "RFID.h"
+#endif
+
+#include "hostHal.h"
+
+/* Header-file of module */
+#include "cycleSimTasks.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/* AIC state machine (aicSm.c) */
+volatile AICSM_STATE_ENUM aicSm_eAicState = AICSM_AIC_STARTUP;
+TRUE_FALSE_ENUM aicSm_eFirstMsgReceived = eFALSE;
+
+/* AIC messages (aicMsgBld.c, aicMsgProc.c, aicMsgCtrlSts.c) */
+AICMSGDEF_NON_SAFE_MSG_STRUCT aicMsgBld_s_SendMsg;
+AICMSGDEF_NON_SAFE_MSG_STRUCT aicMsgProc_s_RcvdMsg;
+UINT8 aicMsgCtrlSts_u8_AsmCtrlSts = 0u;
+UINT8 aicMsgCtrlSts_u8_AmCtrlSts = 0u;
+
+/* SPDU buffers (spduIn.c, spduOutIo.c) */
+AICMSGDEF_SPDU_TX_STRUCT spduIn_s_Paket;
+AICMSGDEF_SPDU_RX_STRUCT spduOut_s_Paket;
+
+/* DI/DO error handling and parameters (diErrHdl.c, doErrHdl.c, fiParam.c) */
+DIERRHDL_ERR_STRUCT diErrHdl_sDiErrHdl;
+DO_ERR_STRUCT doErrHdl_sDoErrHdl;
+volatile PARAMETER_IPAR_STRUCT fiParam_sIParam;
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* File ID of the host simulation, used by the Safety Handler */
+#define k_FILEID                 47u
+
+/* Maximum number of tasks of the task description and length of a task name */
+#define k_TASK_MAX               96u
+#define k_NAME_LEN               40u
+
+/* Task tables of the task description, index of t_TASK au16_wcet */
+#define k_MODE_STARTUP           0u
+#define k_MODE_RUN               1u
+#define k_MODE_CNT               2u
+
+/* wcet of a task which is not described in a task table */
+#define k_WCET_NONE              0xFFFFu
+
+/* Time of gpio_SamplePorts() in every time slice [us], part of the slice overhead */
+#define k_SAMPLE_PORTS_US        3u
+
+/* Tolerated difference of the clock control time differences of both controllers [us], the
+** time slices of the controllers are synchronized, the difference is their jitter */
+#define k_CLK_DEV_US             ( GLOBDEF_CYCLE_TIME_US / 100u )
+
+/* Soft error variable of the CSS control info, identical on both controllers */
+#define k_SOFT_ERR               0x5Au
+
+/* t_TASK:
+** Task of the task description with its wcet in the task tables [us]
+*/
+typedef struct
+{
+  char   ac_name[k_NAME_LEN];
+  UINT16 au16_wcet[k_MODE_CNT];
+} t_TASK;
+
+/* t_IPC_VAR:
+** CSS control info, see SAPLipc.c
+*/
+typedef struct
+{
+  UINT16 u16_nvCrc;
+  UINT16 u16_pathCnt;
+  UINT8  u8_softErr;
+} t_IPC_VAR;
+
+/* t_SAFETGM_IPC:
+** Subframes of the safety telegram, see spduIn.c
+*/
+typedef struct
+{
+  UINT8 u8_dataTgmCnt;
+  UINT8 au8_dataTgm[AICMSGDEF_CIP_IN_DATA_SIZE / 2u];
+  UINT8 u8_tcooTgmCnt;
+  UINT8 au8_tcooTgm[AICMSGDEF_CIP_IN_DATA2_SIZE / 2u];
+} t_SAFETGM_IPC;
+
+/* Task description */
+STATIC t_TASK as_Task[k_TASK_MAX];
+STATIC UINT8 u8_TaskCnt = 0u;
+STATIC UINT32 u32_LoadPct = 100u;
+
+/* Statistic, see cycleSimTASKS_StatGet() */
+STATIC CYCLESIMTASKS_STAT_STRUCT s_Stat;
+
+/* TRUE while aicMgrRx_DoAicSync() is executed (catch up of a telegram) */
+STATIC BOOL b_InAicSync = FALSE;
+
+/* Control/status byte of the AIC master processed by aicMsgProc_ProcessMsg() */
+STATIC UINT8 u8_AmStsProcessed = 0u;
+
+/* Semaphore of the background task, see SAPL_BkgdTaskTrigger() */
+STATIC BOOL b_BkgdSema = FALSE;
+
+/* AIC sync counters (gpio.c) */
+STATIC UINT8 u8_AicSyncSend = 0u;
+STATIC UINT8 u8_AicSyncRecv = 0u;
+
+/* Timer values (TIM.c): own and remote value of the last cycle, FALSE: first exchange */
+STATIC UINT32 u32_TimLocal = 0u;
+STATIC UINT32 u32_TimLocalPrev = 0u;
+STATIC UINT32 u32_TimRemotePrev = 0u;
+STATIC BOOL b_TimValid = FALSE;
+
+/* Clock control (clkCtrl.c): time of the last measurement and own time difference */
+STATIC UINT32 u32_ClkLast = 0u;
+STATIC UINT32 u32_ClkDiff = 0u;
+STATIC BOOL b_ClkValid = FALSE;
+
+/* CSS control info (SAPLipc.c) and subframe counters (spduIn.c) */
+STATIC t_IPC_VAR s_VarLocal;
+STATIC UINT8 u8_SafeTgmCnt = 0u;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC UINT32 WcetGet( CONST char* pc_task );
+STATIC void Pad( CONST char* pc_task, CONST UINT32 u32_start );
+
+/* Firmware functions wrapped by the linker (-Wl,--wrap=<function>), see tools/host/Makefile */
+void __real_aicMgrRx_CheckForNewTgm( void );
+void __real_aicMgrRx_DoAicSync( void );
+void __real_aicMgrRx_ProcessTgm( void );
+void __real_aicMgrRx_PrepAicSync( void );
+void __real_aicMgrRx_GetOutputData( void );
+void __real_aicMgrTx_BuildAsmTgm( void );
+void __real_aicMgrTx_MergeSendAsmTgm( void );
+void __real_aicMgrTx_ResetIoData( void );
+void __real_aicMgrTx_SampleIoData( void );
+void __real_ipcxSYS_FrameSend( void );
+void __real_ipcxSYS_FrameRecvinclWait( void );
+BOOL __real_aicUart_NewTgmReceived( void );
+void __wrap_aicMgrRx_CheckForNewTgm( void );
+void __wrap_aicMgrRx_DoAicSync( void );
+void __wrap_aicMgrRx_ProcessTgm( void );
+void __wrap_aicMgrRx_PrepAicSync( void );
+void __wrap_aicMgrRx_GetOutputData( void );
+void __wrap_aicMgrTx_BuildAsmTgm( void );
+void __wrap_aicMgrTx_MergeSendAsmTgm( void );
+void __wrap_aicMgrTx_ResetIoData( void );
+void __wrap_aicMgrTx_SampleIoData( void );
+void __wrap_ipcxSYS_FrameSend( void );
+void __wrap_ipcxSYS_FrameRecvinclWait( void );
+BOOL __wrap_aicUart_NewTgmReceived( void );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_Init
+
+  Description:
+    see cycleSimTasks.h
+
+***************************************************************************************************/
+BOOL cycleSimTASKS_Init( CONST char* pc_cfg, CONST UINT32 u32_loadPct )
+{
+  FILE* ps_file;
+  char ac_line[256];
+  char ac_name[k_NAME_LEN];
+  CONST char* pc_wcet;
+  UINT8 u8_mode = k_MODE_STARTUP;
+  UINT8 i;
+  BOOL b_ok = FALSE;
+
+  u32_LoadPct = u32_loadPct;
+  u8_TaskCnt = 0u;
+  (void)memset( &s_Stat, 0, sizeof(s_Stat) );
+
+  ps_file = fopen( pc_cfg, "r" );
+  if ( ps_file != NULL )
+  {
+    b_ok = TRUE;
+    while ( fgets( ac_line, (int)sizeof(ac_line), ps_file ) != NULL )
+    {
+      if ( strncmp( ac_line, "[startup]", 9u ) == 0 )
+      {
+        u8_mode = k_MODE_STARTUP;
+      }
+      else if ( strncmp( ac_line, "[run]", 5u ) == 0 )
+      {
+        u8_mode = k_MODE_RUN;
+      }
+      else if ( sscanf( ac_line, "task %39s", ac_name ) == 1 )
+      {
+        /* the plain option only, "wcet@<cycle>=" is preceded by the name */
+        pc_wcet = strstr( ac_line, " wcet=" );
+        for ( i = 0u; ( i < u8_TaskCnt ) && ( strcmp( as_Task[i].ac_name, ac_name ) != 0 ); i++ )
+        {
+          /* search */
+        }
+        if ( ( i == u8_TaskCnt ) && ( u8_TaskCnt < k_TASK_MAX ) )
+        {
+          (void)strcpy( as_Task[i].ac_name, ac_name );
+          as_Task[i].au16_wcet[k_MODE_STARTUP] = k_WCET_NONE;
+          as_Task[i].au16_wcet[k_MODE_RUN] = k_WCET_NONE;
+          u8_TaskCnt++;
+        }
+        else
+        {
+          /* empty branch */
+        }
+        if ( ( i < u8_TaskCnt ) && ( pc_wcet != NULL ) )
+        {
+          as_Task[i].au16_wcet[u8_mode] = (UINT16)strtoul( pc_wcet + 6, NULL, 10 );
+        }
+        else
+        {
+          /* empty branch */
+        }
+      }
+      else
+      {
+        /* comment, blank line or global option */
+      }
+    }
+    (void)fclose( ps_file );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return b_ok;
+}
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_BkgdPending
+
+  Description:
+    see cycleSimTasks.h
+
+***************************************************************************************************/
+BOOL cycleSimTASKS_BkgdPending( void )
+{
+  return b_BkgdSema;
+}
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_BkgdDone
+
+  Description:
+    see cycleSimTasks.h
+
+***************************************************************************************************/
+void cycleSimTASKS_BkgdDone( void )
+{
+  b_BkgdSema = FALSE;
+  s_Stat.u32_bkgdCnt++;
+}
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_StatGet
+
+  Description:
+    see cycleSimTasks.h
+
+***************************************************************************************************/
+void cycleSimTASKS_StatGet( CYCLESIMTASKS_STAT_STRUCT* ps_stat )
+{
+  *ps_stat = s_Stat;
+}
+
+/***************************************************************************************************
+  Function:
+    (firmware tasks without IPC exchange)
+
+  Description:
+    The tasks take their wcet, the functions called during the initialization and by the
+    wrapped firmware modules return without effect.
+
+***************************************************************************************************/
+void SAPL_NvLowHandler( void )
+{
+  Pad( "SAPL_NvLowHandler", hostHAL_TimeGet() );
+}
+
+void doSafeBoundSS1t_UpdateTimers( void )
+{
+  Pad( "doSafeBoundSS1t_UpdateTimers", hostHAL_TimeGet() );
+}
+
+void doState_ProcessDOsLight( void )
+{
+  Pad( "doState_ProcessDOsLight", hostHAL_TimeGet() );
+}
+
+void gpio_CyclicSignals( void )
+{
+  Pad( "gpio_CyclicSignals", hostHAL_TimeGet() );
+}
+
+void gpio_FilterDiRelValues( void )
+{
+  Pad( "gpio_FilterDiRelValues", hostHAL_TimeGet() );
+}
+
+void gpio_HandleToTestExecution( void )
+{
+  Pad( "gpio_HandleToTestExecution", hostHAL_TimeGet() );
+}
+
+void gpio_ProcessDIs( void )
+{
+  Pad( "gpio_ProcessDIs", hostHAL_TimeGet() );
+}
+
+void gpio_ProcessDOs( void )
+{
+  Pad( "gpio_ProcessDOs", hostHAL_TimeGet() );
+}
+
+void gpio_SwitchOutputsOff( void )
+{
+  Pad( "gpio_SwitchOutputsOff", hostHAL_TimeGet() );
+}
+
+void stHan_DoSelfTests( void )
+{
+  Pad( "stHan_DoSelfTests", hostHAL_TimeGet() );
+}
+
+void gpio_SamplePorts( void )
+{
+  hostHAL_TimeAdvance( k_SAMPLE_PORTS_US );
+}
+
+#ifdef RFID_ACTIVE
+void RFID_ReadTag( void )
+{
+  Pad( "RFID_ReadTag", hostHAL_TimeGet() );
+}
+
+void RFID_Reader_Boot( void )
+{
+  Pad( "RFID_Reader_Boot", hostHAL_TimeGet() );
+}
+
+/* no tag is read, the digest counter does not change and no digest is exchanged */
+void RFID_DigestSend( void )
+{
+  Pad( "RFID_DigestSend", hostHAL_TimeGet() );
+}
+
+void RFID_DigestRecv( void )
+{
+  Pad( "RFID_DigestRecv", hostHAL_TimeGet() );
+}
+
+UINT32 RFID_InfoGet( void )
+{
+  return 0u;
+}
+#endif /* RFID_ACTIVE */
+
+void aicIoRstDi_ChkAutoErrRst( void )
+{
+}
+
+void aicIoRstDo_ChkAutoErrRst( void )
+{
+}
+
+void doLib_PassAllDOs( void )
+{
+}
+
+void spduOutData_Process( void )
+{
+}
+
+void spduOutIo_Sync( void )
+{
+}
+
+void spduOutTcoo_Sync( void )
+{
+}
+
+void aicMsgBld_BuildMsg( void )
+{
+}
+
+void spduIn_BuildTgm( void )
+{
+}
+
+void spduIn_BuildTgmDummy( void )
+{
+}
+
+void spduIn_Init( void )
+{
+  u8_SafeTgmCnt = 0u;
+}
+
+void spduOutData_Reset( void )
+{
+}
+
+void spduOutIo_Init( void )
+{
+}
+
+void spduOutTcoo_Init( void )
+{
+}
+
+void aicMsgProc_Init( void )
+{
+  u8_AmStsProcessed = 0u;
+}
+
+void doSafeBoundSS1t_SetSafeBoundVal( CONST UINT8 u8DoNum, BOOL bSafeBoundVal )
+{
+  (void)u8DoNum;
+  (void)bSafeBoundVal;
+}
+
+UINT8 doSafeBoundSS1t_ReqRampDown( void )
+{
+  return 0u;
+}
+
+GPIO_STATE_ENUM diState_GetDiState( CONST UINT8 u8DiNum )
+{
+  (void)u8DiNum;
+  return eGPIO_LOW;
+}
+
+AICMSGDEF_PS_OUT_DATA_STRUCT spduOutData_Get( void )
+{
+  AICMSGDEF_PS_OUT_DATA_STRUCT s_data;
+
+  (void)memset( &s_data, 0, sizeof(s_data) );
+  return s_data;
+}
+
+/***************************************************************************************************
+  Function:
+    aicMsgProc_ProcessMsg, aicMsgErr_SerialError
+
+  Description:
+    Processing of the received AIC telegram: the control/status byte of the AIC master is taken
+    over for the state machine. A telegram with a CRC error is counted.
+
+***************************************************************************************************/
+void aicMsgProc_ProcessMsg( void )
+{
+  u8_AmStsProcessed = aicMsgCtrlSts_u8_AmCtrlSts;
+}
+
+void aicMsgErr_SerialError( void )
+{
+  s_Stat.u32_crcFailCnt++;
+}
+
+/***************************************************************************************************
+  Function:
+    aicSm_Statemachine
+
+  Description:
+    AIC state machine: AICSM_AIC_STARTUP until the first valid telegram (like aicSm.c), then
+    AICSM_AIC_WAIT_FOR_INIT until the processed telegram requests the data exchange
+    (CYCLESIMTASKS_AM_STS_RUN), then AICSM_AIC_EXEC_PROD_CONS. Both controllers process the
+    same telegram in slice 6 (after the AIC sync), so they change the state in the same cycle.
+
+***************************************************************************************************/
+void aicSm_Statemachine( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  if ( ( aicSm_eAicState == AICSM_AIC_STARTUP ) && ( aicSm_eFirstMsgReceived == eTRUE ) )
+  {
+    aicSm_eAicState = AICSM_AIC_WAIT_FOR_INIT;
+  }
+  else if ( ( aicSm_eAicState == AICSM_AIC_WAIT_FOR_INIT ) &&
+            ( ( u8_AmStsProcessed & CYCLESIMTASKS_AM_STS_RUN ) != 0u ) )
+  {
+    aicSm_eAicState = AICSM_AIC_EXEC_PROD_CONS;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  Pad( "aicSm_Statemachine", u32_start );
+}
+
+/***************************************************************************************************
+  Function:
+    SAPL_BkgdTaskTrigger, SAPL_BkgdTaskCheck, SAPL_AppObjDiagMaxTimeSliceSet
+
+  Description:
+    Background task (SAPLbkgdMain.c): the trigger sets the semaphore which the background
+    resets when its cycle is finished (cycleSimTASKS_BkgdDone()), the check calls the Safety
+    Handler if it is still set. The trigger itself also calls it if the semaphore is set.
+
+***************************************************************************************************/
+void SAPL_BkgdTaskTrigger( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  if ( b_BkgdSema )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_BKGD_DELAY_ERR, GLOBFAIL_ADDINFO_FILE(1u) );
+  }
+  else
+  {
+    b_BkgdSema = TRUE;
+  }
+  Pad( "SAPL_BkgdTaskTrigger", u32_start );
+}
+
+void SAPL_BkgdTaskCheck( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  if ( b_BkgdSema )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_BKGD_DELAY_ERR, GLOBFAIL_ADDINFO_FILE(2u) );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  Pad( "SAPL_BkgdTaskCheck", u32_start );
+}
+
+void SAPL_AppObjDiagMaxTimeSliceSet( UINT8 u8_maxTimeSlice )
+{
+  s_Stat.u8_bkgdMaxSlice = u8_maxTimeSlice;
+}
+
+/***************************************************************************************************
+  Function:
+    gpio_SendIOvaluesViaIPC, gpio_SendAicSyncViaIPC, gpio_GetIOvaluesFromIPC,
+    gpio_GetAicSyncFromIPC, gpio_SetIpcAicSyncTx, gpio_GetIpcAicSyncRx
+
+  Description:
+    IO values with the AIC sync counter, IPC telegram of gpio.c.
+
+***************************************************************************************************/
+void gpio_SendIOvaluesViaIPC( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  INPT_IPC_IO_DATA_UNION u_io;
+
+  (void)memset( &u_io, 0, sizeof(u_io) );
+  u_io.sIoStruct.u8AicSyncCnt = u8_AicSyncSend;
+#ifdef RFID_ACTIVE
+  ipcxSYS_SendBuffer( IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
+                      (CONST UINT8*)&u_io.sIoStruct );
+#else
+  ipcxSYS_SendUINT32( IPCXSYS_IPC_ID_IO, u_io.u32IpcPacket );
+#endif /* RFID_ACTIVE */
+  Pad( "gpio_SendIOvaluesViaIPC", u32_start );
+}
+
+void gpio_SendAicSyncViaIPC( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  INPT_IPC_IO_DATA_UNION u_io;
+
+  (void)memset( &u_io, 0, sizeof(u_io) );
+  u_io.sIoStruct.u8AicSyncCnt = u8_AicSyncSend;
+#ifdef RFID_ACTIVE
+  ipcxSYS_SendBuffer( IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
+                      (CONST UINT8*)&u_io.sIoStruct );
+#else
+  ipcxSYS_SendUINT32( IPCXSYS_IPC_ID_IO, u_io.u32IpcPacket );
+#endif /* RFID_ACTIVE */
+  Pad( "gpio_SendAicSyncViaIPC", u32_start );
+}
+
+void gpio_GetIOvaluesFromIPC( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  INPT_IPC_IO_DATA_UNION u_io;
+
+#ifdef RFID_ACTIVE
+  ipcxSYS_GetBufferinclWait( IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
+                             (UINT8*)&u_io.sIoStruct );
+#else
+  u_io.u32IpcPacket = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_IO );
+#endif /* RFID_ACTIVE */
+  u8_AicSyncRecv = u_io.sIoStruct.u8AicSyncCnt;
+  Pad( "gpio_GetIOvaluesFromIPC", u32_start );
+}
+
+void gpio_GetAicSyncFromIPC( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  INPT_IPC_IO_DATA_UNION u_io;
+
+#ifdef RFID_ACTIVE
+  ipcxSYS_GetBufferinclWait( IPCXSYS_IPC_ID_IO, (UINT8)sizeof(INPT_IPC_IO_DATA_STRUCT),
+                             (UINT8*)&u_io.sIoStruct );
+#else
+  u_io.u32IpcPacket = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_IO );
+#endif /* RFID_ACTIVE */
+  u8_AicSyncRecv = u_io.sIoStruct.u8AicSyncCnt;
+  Pad( "gpio_GetAicSyncFromIPC", u32_start );
+}
+
+void gpio_SetIpcAicSyncTx( UINT8 u8AicSync )
+{
+  u8_AicSyncSend = u8AicSync;
+}
+
+UINT8 gpio_GetIpcAicSyncRx( void )
+{
+  return u8_AicSyncRecv;
+}
+
+/***************************************************************************************************
+  Function:
+    TIM_SendTimerVal, TIM_CheckAndSetTimerVal
+
+  Description:
+    Timer value exchange of TIM.c. The time stamps are in usec, the difference of two cycles
+    shall be within GLOBDEF_CYCLE_TIME_MIN_US..GLOBDEF_CYCLE_TIME_MAX_US on both controllers.
+
+***************************************************************************************************/
+void TIM_SendTimerVal( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  u32_TimLocal = timerHAL_GetSystemTime3();
+  ipcxSYS_SendUINT32( IPCXSYS_IPC_ID_APPCLKCTRL, u32_TimLocal );
+  Pad( "TIM_SendTimerVal", u32_start );
+}
+
+void TIM_CheckAndSetTimerVal( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  UINT32 u32_remote;
+  UINT32 u32_remoteDiff;
+  UINT32 u32_localDiff;
+
+  u32_remote = ipcxSYS_GetUINT32inclWait( IPCXSYS_IPC_ID_APPCLKCTRL );
+  if ( b_TimValid )
+  {
+    u32_remoteDiff = u32_remote - u32_TimRemotePrev;
+    u32_localDiff = u32_TimLocal - u32_TimLocalPrev;
+    if ( ( u32_remoteDiff > GLOBDEF_CYCLE_TIME_MAX_US ) ||
+         ( u32_remoteDiff < GLOBDEF_CYCLE_TIME_MIN_US ) )
+    {
+      GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_APPL_TIMER_DEV_ERR, GLOBFAIL_ADDINFO_FILE(3u) );
+    }
+    else if ( ( u32_localDiff > GLOBDEF_CYCLE_TIME_MAX_US ) ||
+              ( u32_localDiff < GLOBDEF_CYCLE_TIME_MIN_US ) )
+    {
+      GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_APPL_TIMER_DEV_ERR, GLOBFAIL_ADDINFO_FILE(4u) );
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  else
+  {
+    b_TimValid = TRUE;
+  }
+  u32_TimRemotePrev = u32_remote;
+  u32_TimLocalPrev = u32_TimLocal;
+  Pad( "TIM_CheckAndSetTimerVal", u32_start );
+}
+
+/***************************************************************************************************
+  Function:
+    SAPLipc_SetStackVarAndPath, SAPLipc_SendVar, SAPLipc_RecvAndCheckVar
+
+  Description:
+    CSS control info of SAPLipc.c: the program flow counter advances once per cycle on both
+    controllers, a different counter or soft error variable calls the Safety Handler.
+
+***************************************************************************************************/
+void SAPLipc_SetStackVarAndPath( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  s_VarLocal.u16_pathCnt++;
+  s_VarLocal.u8_softErr = k_SOFT_ERR;
+  Pad( "SAPLipc_SetStackVarAndPath", u32_start );
+}
+
+void SAPLipc_SendVar( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  t_IPC_VAR* ps_varTx;
+
+  ps_varTx = (t_IPC_VAR*)ipcxSYS_TxReserve( IPCXSYS_IPC_ID_CSS_CTRL_INFO,
+                                            (UINT8)sizeof(t_IPC_VAR) );
+  *ps_varTx = s_VarLocal;
+  ipcxSYS_TxCommit();
+  Pad( "SAPLipc_SendVar", u32_start );
+}
+
+void SAPLipc_RecvAndCheckVar( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  t_IPC_VAR s_varRx;
+
+  s_varRx = *(CONST t_IPC_VAR*)ipcxSYS_RxViewinclWait( IPCXSYS_IPC_ID_CSS_CTRL_INFO,
+                                                       (UINT8)sizeof(t_IPC_VAR) );
+  if ( s_VarLocal.u16_pathCnt != s_varRx.u16_pathCnt )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_CSS_PFLOW_ERR, GLOBFAIL_ADDINFO_FILE(5u) );
+  }
+  else if ( s_VarLocal.u8_softErr != s_varRx.u8_softErr )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GLOB_FAILCODE_CSS_SOFTVAR_ERR, GLOBFAIL_ADDINFO_FILE(6u) );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  Pad( "SAPLipc_RecvAndCheckVar", u32_start );
+}
+
+/***************************************************************************************************
+  Function:
+    spduIn_SendSafeTgm, spduIn_RecvSafeTgm
+
+  Description:
+    Subframes of the safety telegram, IPC telegram of spduIn.c.
+
+***************************************************************************************************/
+void spduIn_SendSafeTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  t_SAFETGM_IPC* ps_tgmTx;
+
+  ps_tgmTx = (t_SAFETGM_IPC*)ipcxSYS_TxReserve( IPCXSYS_IPC_ID_SAFETGM,
+                                                (UINT8)sizeof(t_SAFETGM_IPC) );
+  u8_SafeTgmCnt++;
+  (void)memset( ps_tgmTx, (int)u8_SafeTgmCnt, sizeof(t_SAFETGM_IPC) );
+  ipcxSYS_TxCommit();
+  Pad( "spduIn_SendSafeTgm", u32_start );
+}
+
+void spduIn_RecvSafeTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  (void)ipcxSYS_RxViewinclWait( IPCXSYS_IPC_ID_SAFETGM, (UINT8)sizeof(t_SAFETGM_IPC) );
+  Pad( "spduIn_RecvSafeTgm", u32_start );
+}
+
+/***************************************************************************************************
+  Function:
+    tmSRV_CheckTemperature, tmSRV_SyncTemperature, clkCtrl_CalcAndSendTimeDiff,
+    clkCtrl_CheckTimerVal
+
+  Description:
+    Records of the IPC frame (tm_TemperatureMonitor-srv.c, clkCtrl.c). The temperature test
+    passes, the clock control compares the time differences between two measurements of both
+    controllers (k_CLK_DEV_US).
+
+***************************************************************************************************/
+void tmSRV_CheckTemperature( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  ipcxSYS_FrameAddUINT32( IPCXSYS_IPC_ID_TEMP_MESS, (UINT32)TMSRV_TEMP_TEST_PASSED );
+  Pad( "tmSRV_CheckTemperature", u32_start );
+}
+
+void tmSRV_SyncTemperature( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  if ( ipcxSYS_FrameGetUINT32( IPCXSYS_IPC_ID_TEMP_MESS ) != (UINT32)TMSRV_TEMP_TEST_PASSED )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GlOB_FAILCODE_TEMPERATURE_ERR, GLOBFAIL_ADDINFO_FILE(7u) );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  Pad( "tmSRV_SyncTemperature", u32_start );
+}
+
+void clkCtrl_CalcAndSendTimeDiff( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  u32_ClkDiff = u32_start - u32_ClkLast;
+  u32_ClkLast = u32_start;
+  ipcxSYS_FrameAddUINT32( IPCXSYS_IPC_ID_CLKCTRL, u32_ClkDiff );
+  Pad( "clkCtrl_CalcAndSendTimeDiff", u32_start );
+}
+
+void clkCtrl_CheckTimerVal( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+  UINT32 u32_rx;
+  UINT32 u32_dev;
+
+  u32_rx = ipcxSYS_FrameGetUINT32( IPCXSYS_IPC_ID_CLKCTRL );
+  u32_dev = ( u32_rx > u32_ClkDiff ) ? ( u32_rx - u32_ClkDiff ) : ( u32_ClkDiff - u32_rx );
+  /* the first difference starts at the power on */
+  if ( b_ClkValid && ( u32_dev > k_CLK_DEV_US ) )
+  {
+    GLOBFAIL_SAFETY_HANDLER( GlOB_FAILCODE_CLK_CTRL, GLOBFAIL_ADDINFO_FILE(8u) );
+  }
+  else
+  {
+    b_ClkValid = TRUE;
+  }
+  Pad( "clkCtrl_CheckTimerVal", u32_start );
+}
+
+/***************************************************************************************************
+  Function:
+    __wrap_<function>
+
+  Description:
+    Wrapped firmware tasks (ld --wrap), the firmware function is executed and padded to its
+    wcet. aicUart_NewTgmReceived() counts the telegrams found, in aicMgrRx_DoAicSync() they are
+    found by the catch up of a telegram which the other controller already has.
+
+***************************************************************************************************/
+void __wrap_aicMgrRx_CheckForNewTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrRx_CheckForNewTgm();
+  Pad( "aicMgrRx_CheckForNewTgm", u32_start );
+}
+
+void __wrap_aicMgrRx_DoAicSync( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  b_InAicSync = TRUE;
+  __real_aicMgrRx_DoAicSync();
+  b_InAicSync = FALSE;
+  Pad( "aicMgrRx_DoAicSync", u32_start );
+}
+
+void __wrap_aicMgrRx_ProcessTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrRx_ProcessTgm();
+  Pad( "aicMgrRx_ProcessTgm", u32_start );
+}
+
+void __wrap_aicMgrRx_PrepAicSync( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrRx_PrepAicSync();
+  Pad( "aicMgrRx_PrepAicSync", u32_start );
+}
+
+void __wrap_aicMgrRx_GetOutputData( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrRx_GetOutputData();
+  Pad( "aicMgrRx_GetOutputData", u32_start );
+}
+
+void __wrap_aicMgrTx_BuildAsmTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrTx_BuildAsmTgm();
+  Pad( "aicMgrTx_BuildAsmTgm", u32_start );
+}
+
+void __wrap_aicMgrTx_MergeSendAsmTgm( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrTx_MergeSendAsmTgm();
+  Pad( "aicMgrTx_MergeSendAsmTgm", u32_start );
+}
+
+void __wrap_aicMgrTx_ResetIoData( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrTx_ResetIoData();
+  Pad( "aicMgrTx_ResetIoData", u32_start );
+}
+
+void __wrap_aicMgrTx_SampleIoData( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_aicMgrTx_SampleIoData();
+  Pad( "aicMgrTx_SampleIoData", u32_start );
+}
+
+void __wrap_ipcxSYS_FrameSend( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_ipcxSYS_FrameSend();
+  Pad( "ipcxSYS_FrameSend", u32_start );
+}
+
+void __wrap_ipcxSYS_FrameRecvinclWait( void )
+{
+  UINT32 u32_start = hostHAL_TimeGet();
+
+  __real_ipcxSYS_FrameRecvinclWait();
+  Pad( "ipcxSYS_FrameRecvinclWait", u32_start );
+}
+
+BOOL __wrap_aicUart_NewTgmReceived( void )
+{
+  BOOL b_new = __real_aicUart_NewTgmReceived();
+
+  if ( b_new )
+  {
+    s_Stat.u32_tgmCnt++;
+    s_Stat.u32_catchUpCnt += b_InAicSync ? 1u : 0u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return b_new;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    WcetGet
+
+  Description:
+    This function returns the wcet of a task in the task table of the current AIC state. A task
+    which is only described in the other task table takes the wcet of that one (e.g. the tasks
+    called by TaskTimerValAndSelfTests() in run mode).
+
+  Return value:
+    UINT32 - wcet [us], 0: task not described
+
+***************************************************************************************************/
+STATIC UINT32 WcetGet( CONST char* pc_task )
+{
+  UINT32 u32_wcet = 0u;
+  UINT8 u8_mode;
+  UINT8 i;
+
+  switch ( aicSm_eAicState )
+  {
+    case AICSM_AIC_EXEC_PROD_ONLY:  /* fall through */
+    case AICSM_AIC_EXEC_CONS_ONLY:  /* fall through */
+    case AICSM_AIC_EXEC_PROD_CONS:  /* fall through */
+    case AICSM_AIC_IDLE:
+    {
+      u8_mode = k_MODE_RUN;
+      break;
+    }
+    default:
+    {
+      u8_mode = k_MODE_STARTUP;
+      break;
+    }
+  }
+
+  for ( i = 0u; i < u8_TaskCnt; i++ )
+  {
+    if ( strcmp( as_Task[i].ac_name, pc_task ) != 0 )
+    {
+      /* empty branch */
+    }
+    else if ( as_Task[i].au16_wcet[u8_mode] != k_WCET_NONE )
+    {
+      u32_wcet = as_Task[i].au16_wcet[u8_mode];
+    }
+    else if ( as_Task[i].au16_wcet[k_MODE_CNT - 1u - u8_mode] != k_WCET_NONE )
+    {
+      u32_wcet = as_Task[i].au16_wcet[k_MODE_CNT - 1u - u8_mode];
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  return u32_wcet;
+}
+
+/***************************************************************************************************
+  Function:
+    Pad
+
+  Description:
+    This function lets the task take its wcet scaled by the load, counted from its start. The
+    time already taken (e.g. waiting for an IPC telegram) is part of it.
+
+***************************************************************************************************/
+STATIC void Pad( CONST char* pc_task, CONST UINT32 u32_start )
+{
+  UINT32 u32_us = ( WcetGet( pc_task ) * u32_LoadPct ) / 100u;
+
+  while ( ( hostHAL_TimeGet() - u32_start ) < u32_us )
+  {
+    /* busy */
+  }
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
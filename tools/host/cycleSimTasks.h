@@ -0,0 +1,170 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: cycleSimTasks.h
+**     Summary: Header of module cycleSimTasks.c, task models of the host cycle simulation (see
+**              cycleSim.c).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: cycleSimTASKS_Init
+**             cycleSimTASKS_BkgdPending
+**             cycleSimTASKS_BkgdDone
+**             cycleSimTASKS_StatGet
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef CYCLESIMTASKS_H
+#define CYCLESIMTASKS_H
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+#include "xtypes.h"
+#include "xdefs.h"
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Control/status byte of the telegrams of the simulated AIC master in the data exchange. It
+** replaces the configuration dialog of aicMsgProc.c/aicSm.c (not built): the model of
+** aicSm_Statemachine() enters AICSM_AIC_EXEC_PROD_CONS when the processed telegram has it. */
+#define CYCLESIMTASKS_AM_STS_RUN       0x80u
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/* Statistic of the task models, see cycleSimTASKS_StatGet() */
+typedef struct
+{
+  UINT32 u32_tgmCnt;        /* AIC telegrams found by aicMgrRx_CheckForNewTgm() */
+  UINT32 u32_crcFailCnt;    /* AIC telegrams with a CRC error (aicMsgErr_SerialError()) */
+  UINT32 u32_catchUpCnt;    /* telegrams found by the catch up of aicMgrRx_DoAicSync() */
+  UINT32 u32_bkgdCnt;       /* finished background cycles */
+  UINT8  u8_bkgdMaxSlice;   /* max. time slice at the end of the background cycle */
+} CYCLESIMTASKS_STAT_STRUCT;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_Init
+
+  Description:
+    This function reads the declared execution times (wcet) of the tasks from the task
+    description of the scheduler (pkgOperation/sch_Scheduler-app_tasks.cfg). Every task model
+    and every padded firmware task takes its wcet scaled by the load, a task which is not
+    described takes no time.
+
+  See also:
+    -
+
+  Parameters:
+    pc_cfg (IN)      - path of the task description
+                       (valid range: <>NULL, not checked)
+    u32_loadPct (IN) - execution time of the tasks in percent of their wcet
+                       (valid range: any, not checked)
+
+  Return value:
+    TRUE             - task description read
+    FALSE            - the task description can not be opened
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+BOOL cycleSimTASKS_Init( CONST char* pc_cfg, CONST UINT32 u32_loadPct );
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_BkgdPending
+
+  Description:
+    This function returns whether the background cycle is triggered (SAPL_BkgdTaskTrigger())
+    and not yet finished.
+
+  See also:
+    cycleSimTASKS_BkgdDone
+
+  Parameters:
+    -
+
+  Return value:
+    TRUE  - background cycle to be executed
+    FALSE - the background waits for the trigger
+
+  Remarks:
+    Context: main
+
+***************************************************************************************************/
+BOOL cycleSimTASKS_BkgdPending( void );
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_BkgdDone
+
+  Description:
+    This function finishes the background cycle like SAPL_BkgdTaskExec(): the semaphore checked
+    by SAPL_BkgdTaskCheck() is reset.
+
+  See also:
+    cycleSimTASKS_BkgdPending
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    Context: main
+
+***************************************************************************************************/
+void cycleSimTASKS_BkgdDone( void );
+
+/***************************************************************************************************
+  Function:
+    cycleSimTASKS_StatGet
+
+  Description:
+    This function returns the statistic of the task models.
+
+  See also:
+    -
+
+  Parameters:
+    ps_stat (OUT) - statistic
+                    (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void cycleSimTASKS_StatGet( CYCLESIMTASKS_STAT_STRUCT* ps_stat );
+
+#endif /* CYCLESIMTASKS_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
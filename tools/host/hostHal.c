@@ -0,0 +1,704 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: hostHal.c
+**     Summary: Host HAL of the host builds (see tools/host/Makefile). Provides the peripherals and
+**              core functions redirected by tools/host/include/stm32f10x.h, the simulated system
+**              time and the functions of the HAL and of the Safety Handler which are called by
+**              the firmware modules of the host builds.
+**              The peripherals are plain memory, the simulation of a host build reads and writes
+**              them like the hardware (e.g. the CNDTR register of a DMA channel).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: hostHAL_TimeGet
+**             hostHAL_TimeSet
+**             hostHAL_TimeAdvance
+**             hostHAL_ControllerSet
+**             hostHAL_IrqEnabled
+**             hostHAL_NvicPriorityGet
+**             hostHAL_TimeRealSet
+**             hostHAL_SyncLinesSet
+**             hostHAL_TimeStepSet
+**             hostHAL_DisableIrq
+**             hostHAL_EnableIrq
+**             hostHAL_Nop
+**             hostHAL_NvicSetPriority
+**             hostHAL_NvicEnableIrq
+**             hostHAL_NvicDisableIrq
+**             timerHAL_GetSystemTime
+**             timerHAL_GetSystemTime3
+**             timerHAL_GetSystemTime4
+**             timerHAL_InitIrq
+**             timerHAL_StartTimerIrq
+**             timerHAL_ClearTimerIrq
+**             timerHAL_ClearTimer1Counter
+**             timerHAL_StartWwdg
+**             TIM_TimeGet_128us
+**             cfgSYS_GetControllerID
+**             gpioHAL_ConfigureInput
+**             gpioHAL_ConfigureOutput
+**             gpioHAL_GetPin
+**             gpioHAL_SetPin
+**             gpioHAL_ClearPin
+**             globFail_SafetyHandler
+**
+**             Step
+**             StepLeave
+**             SyncLineUpdate
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <time.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globDef_GlobalDefinitions.h"
+#include "cfg_Config-sys.h"
+#include "gpio-hal.h"
+#include "timer-def.h"
+#include "timer-hal.h"
+#include "globFail_Errorcodes.h"
+#include "globFail_SafetyHandler.h"
+#include "TIM.h"
+
+/* Header-file of module */
+#include "hostHal.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/* Peripherals, see tools/host/include/stm32f10x.h */
+RCC_TypeDef hostHAL_sRcc;
+CRC_TypeDef hostHAL_sCrc;
+GPIO_TypeDef hostHAL_asGpio[3];
+USART_TypeDef hostHAL_sUsart1;
+USART_TypeDef hostHAL_sUsart3;
+DMA_TypeDef hostHAL_sDma1;
+DMA_Channel_TypeDef hostHAL_asDma1Channel[HOSTHAL_DMA1_CHANNEL_CNT];
+TIM_TypeDef hostHAL_sTim1;
+WWDG_TypeDef hostHAL_sWwdg;
+USART_TypeDef hostHAL_sUart4;
+DMA_TypeDef hostHAL_sDma2;
+DMA_Channel_TypeDef hostHAL_asDma2Channel[HOSTHAL_DMA2_CHANNEL_CNT];
+
+/* Additional info of the Safety Handler (see globFail_SafetyHandler.h) */
+volatile UINT32 globFail_u32_AddInfo;
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Simulated time in usec and __NOP() calls since the last usec */
+STATIC UINT32 u32_Time = 0u;
+STATIC UINT32 u32_NopCnt = 0u;
+
+STATIC CFG_CONTROLLER_ID_ENUM e_ControllerId = SAFETY_CONTROLLER_1;
+
+/* Interrupts disabled by __disable_irq() (PRIMASK), NVIC enable and priority per IRQ */
+STATIC BOOL b_IrqDisabled = FALSE;
+STATIC BOOL ab_IrqEnabled[HOSTHAL_IRQ_CNT];
+STATIC UINT32 au32_IrqPrio[HOSTHAL_IRQ_CNT];
+
+/* Divider of the monotonic clock, 0: simulated time (see hostHAL_TimeRealSet()) */
+STATIC UINT32 u32_RealDiv = 0u;
+
+/* IPC sync lines shared with the process of the other controller */
+STATIC volatile UINT32* pau32_SyncLines = NULL_PNT;
+
+/* Stepped time (see hostHAL_TimeStepSet()): selected, lockstep with the other controller, time
+** hook and the hook is running */
+STATIC BOOL b_Stepped = FALSE;
+STATIC HOSTHAL_LOCKSTEP_STRUCT* ps_Lockstep = NULL_PNT;
+STATIC HOSTHAL_TIME_HOOK pf_TimeHook = NULL_PNT;
+STATIC BOOL b_InHook = FALSE;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC void Step( void );
+STATIC void StepLeave( void );
+STATIC void SyncLineUpdate( CONST GPIO_TypeDef* ps_gpio );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeGet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+UINT32 hostHAL_TimeGet( void )
+{
+  struct timespec s_ts;
+  UINT32 u32_time = u32_Time;
+
+  if ( u32_RealDiv != 0u )
+  {
+    /* the firmware polls the time in its wait loops, the other process or thread shall run
+    ** meanwhile, also on a host with one CPU */
+    (void)sched_yield();
+    (void)clock_gettime( CLOCK_MONOTONIC, &s_ts );
+    u32_time = (UINT32)( ( ( (unsigned long long)s_ts.tv_sec * 1000000uLL ) +
+                           ( (unsigned long long)s_ts.tv_nsec / 1000uLL ) ) / u32_RealDiv );
+  }
+  else if ( b_Stepped && ( !b_InHook ) )
+  {
+    Step();
+    u32_time = u32_Time;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return u32_time;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeSet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_TimeSet( CONST UINT32 u32_time )
+{
+  u32_Time = u32_time;
+  u32_NopCnt = 0u;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeAdvance
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_TimeAdvance( CONST UINT32 u32_us )
+{
+  UINT32 i;
+
+  if ( b_Stepped )
+  {
+    for ( i = 0u; i < u32_us; i++ )
+    {
+      Step();
+    }
+  }
+  else
+  {
+    u32_Time += u32_us;
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_ControllerSet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_ControllerSet( CONST CFG_CONTROLLER_ID_ENUM e_id )
+{
+  e_ControllerId = e_id;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_IrqEnabled
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+BOOL hostHAL_IrqEnabled( CONST INT32 i32_irq )
+{
+  BOOL b_ret = FALSE;
+
+  if ( ( i32_irq >= 0 ) && ( i32_irq < (INT32)HOSTHAL_IRQ_CNT ) )
+  {
+    b_ret = ( ab_IrqEnabled[i32_irq] && ( !b_IrqDisabled ) ) ? TRUE : FALSE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return b_ret;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_NvicPriorityGet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+UINT32 hostHAL_NvicPriorityGet( CONST INT32 i32_irq )
+{
+  UINT32 u32_prio = 0u;
+
+  if ( ( i32_irq >= 0 ) && ( i32_irq < (INT32)HOSTHAL_IRQ_CNT ) )
+  {
+    u32_prio = au32_IrqPrio[i32_irq];
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return u32_prio;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeRealSet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_TimeRealSet( CONST UINT32 u32_div )
+{
+  u32_RealDiv = u32_div;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_SyncLinesSet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_SyncLinesSet( volatile UINT32* pau32_lines )
+{
+  pau32_SyncLines = pau32_lines;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeStepSet
+
+  Description:
+    see hostHal.h
+
+***************************************************************************************************/
+void hostHAL_TimeStepSet( HOSTHAL_LOCKSTEP_STRUCT* ps_lockstep, CONST HOSTHAL_TIME_HOOK pf_hook )
+{
+  b_Stepped = TRUE;
+  ps_Lockstep = ps_lockstep;
+  pf_TimeHook = pf_hook;
+
+  if ( ps_lockstep != NULL_PNT )
+  {
+    /* the other controller shall not wait for a process which has ended */
+    (void)atexit( &StepLeave );
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_DisableIrq, hostHAL_EnableIrq
+
+  Description:
+    __disable_irq() and __enable_irq() of the host builds, the simulation does not call any
+    interrupt handler while the interrupts are disabled.
+
+***************************************************************************************************/
+void hostHAL_DisableIrq( void )
+{
+  b_IrqDisabled = TRUE;
+}
+
+void hostHAL_EnableIrq( void )
+{
+  b_IrqDisabled = FALSE;
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_Nop
+
+  Description:
+    __NOP() of the host builds. The delay loops of the firmware advance the simulated time by
+    one usec every HOSTHAL_NOP_PER_US calls.
+
+***************************************************************************************************/
+void hostHAL_Nop( void )
+{
+  u32_NopCnt++;
+  if ( ( u32_NopCnt >= HOSTHAL_NOP_PER_US ) && b_Stepped )
+  {
+    u32_NopCnt = 0u;
+    Step();
+  }
+  else if ( u32_NopCnt >= HOSTHAL_NOP_PER_US )
+  {
+    u32_NopCnt = 0u;
+    u32_Time++;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    hostHAL_NvicSetPriority, hostHAL_NvicEnableIrq, hostHAL_NvicDisableIrq
+
+  Description:
+    NVIC_SetPriority(), NVIC_EnableIRQ() and NVIC_DisableIRQ() of the host builds. The system
+    exceptions (negative IRQ numbers) are ignored.
+
+***************************************************************************************************/
+void hostHAL_NvicSetPriority( int32_t i32_irq, uint32_t u32_prio )
+{
+  if ( ( i32_irq >= 0 ) && ( i32_irq < (INT32)HOSTHAL_IRQ_CNT ) )
+  {
+    au32_IrqPrio[i32_irq] = u32_prio;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+void hostHAL_NvicEnableIrq( int32_t i32_irq )
+{
+  if ( ( i32_irq >= 0 ) && ( i32_irq < (INT32)HOSTHAL_IRQ_CNT ) )
+  {
+    ab_IrqEnabled[i32_irq] = TRUE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+void hostHAL_NvicDisableIrq( int32_t i32_irq )
+{
+  if ( ( i32_irq >= 0 ) && ( i32_irq < (INT32)HOSTHAL_IRQ_CNT ) )
+  {
+    ab_IrqEnabled[i32_irq] = FALSE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    timerHAL_GetSystemTime, timerHAL_GetSystemTime3, timerHAL_GetSystemTime4
+
+  Description:
+    System time of the host builds, all return the time in usec of hostHAL_TimeGet().
+
+***************************************************************************************************/
+UINT32 timerHAL_GetSystemTime( CONST TIMERDEF_TIMER_ENUM eTimer )
+{
+  (void)eTimer;
+  return hostHAL_TimeGet();
+}
+
+UINT32 timerHAL_GetSystemTime3( void )
+{
+  return hostHAL_TimeGet();
+}
+
+UINT32 timerHAL_GetSystemTime4( void )
+{
+  return hostHAL_TimeGet();
+}
+
+/***************************************************************************************************
+  Function:
+    timerHAL_InitIrq, timerHAL_StartTimerIrq, timerHAL_ClearTimerIrq,
+    timerHAL_ClearTimer1Counter, timerHAL_StartWwdg
+
+  Description:
+    Scheduler timer TIM1 and window watchdog of the host builds. The register accesses are the
+    ones of pkgUtil/timer-hal.c (timer 1 only), the simulation of a host build counts the
+    timer and the watchdog. timer-hal.c itself is not built, its system time is replaced by the
+    simulated time.
+
+***************************************************************************************************/
+void timerHAL_InitIrq( CONST TIMERDEF_TIMER_IRQ_CONFIG_STRUCT* psTimConfig )
+{
+  TIM1->PSC = psTimConfig->u16Prescaler;
+  TIM1->ARR = psTimConfig->u16AutoReloadValue;
+  TIM1->CNT = psTimConfig->u16CounterValue;
+  /* priority 0..15, see TIMERHAL_IRQ_PRIORITY_MASK */
+  NVIC_SetPriority( TIM1_UP_IRQn, ( (UINT32)psTimConfig->u8IrqPriority & 0x0Fu ) );
+  NVIC_EnableIRQ( TIM1_UP_IRQn );
+  TIM1->EGR = (UINT16)TIM_EGR_UG;
+  TIM1->SR = 0u;
+  TIM1->DIER = TIM_DIER_UIE;
+}
+
+void timerHAL_StartTimerIrq( TIMERDEF_TIMER_ENUM eTimer )
+{
+  (void)eTimer;
+  TIM1->CR1 = TIM_CR1_CEN;
+}
+
+void timerHAL_ClearTimerIrq( TIMERDEF_TIMER_ENUM eTimer )
+{
+  (void)eTimer;
+  TIM1->SR = 0u;
+}
+
+void timerHAL_ClearTimer1Counter( void )
+{
+  TIM1->CNT = 5u;
+}
+
+void timerHAL_StartWwdg( void )
+{
+  WWDG->CFR = (UINT32)( WWDG_CFR_W6 + WWDG_CFR_W0 + WWDG_CFR_W1 );
+  WWDG->CR = (UINT32)( WWDG_CR_WDGA + ( WWDG_CR_T6 + WWDG_CR_T0 + WWDG_CR_T1 ) );
+}
+
+/***************************************************************************************************
+  Function:
+    TIM_TimeGet_128us
+
+  Description:
+    Time stamp of the host builds in 128 usec, derived from the simulated time.
+
+***************************************************************************************************/
+UINT32 TIM_TimeGet_128us( void )
+{
+  return ( hostHAL_TimeGet() >> 7 );
+}
+
+/***************************************************************************************************
+  Function:
+    cfgSYS_GetControllerID
+
+  Description:
+    Controller ID of the host builds, see hostHAL_ControllerSet().
+
+***************************************************************************************************/
+CFG_CONTROLLER_ID_ENUM cfgSYS_GetControllerID( void )
+{
+  return e_ControllerId;
+}
+
+/***************************************************************************************************
+  Function:
+    gpioHAL_ConfigureInput, gpioHAL_ConfigureOutput
+
+  Description:
+    The pin configuration has no effect in the host builds.
+
+***************************************************************************************************/
+void gpioHAL_ConfigureInput( GPIO_TypeDef*                sGpio,
+                             CONST GPIO_PIN_ENUM          ePin,
+                             CONST GPIO_INPUT_CONFIG_ENUM eInCfg )
+{
+  (void)sGpio;
+  (void)ePin;
+  (void)eInCfg;
+}
+
+void gpioHAL_ConfigureOutput( GPIO_TypeDef*                 sGpio,
+                              CONST GPIO_PIN_ENUM           ePin,
+                              CONST GPIO_OUTPUT_CONFIG_ENUM eOutCfg,
+                              CONST GPIO_OUTPUT_MODE_ENUM   eOutMode )
+{
+  (void)sGpio;
+  (void)ePin;
+  (void)eOutCfg;
+  (void)eOutMode;
+}
+
+/***************************************************************************************************
+  Function:
+    gpioHAL_GetPin, gpioHAL_SetPin, gpioHAL_ClearPin
+
+  Description:
+    Pins of the host builds: the outputs are kept in the ODR register, the inputs are read from
+    the IDR register. The IPC sync pins of GPIOA are connected to the sync lines if set (see
+    hostHAL_SyncLinesSet()).
+
+***************************************************************************************************/
+GPIO_PINSTATE_ENUM gpioHAL_GetPin( CONST GPIO_TypeDef* sGpio, CONST UINT16 u16PinMask )
+{
+  UINT32 u32_idr = sGpio->IDR;
+
+  if ( ( sGpio == GPIOA ) && ( pau32_SyncLines != NULL_PNT ) )
+  {
+    /* PA11 is driven by PA12 of the other controller */
+    u32_idr &= ~(UINT32)GPIO_PINMASK_11;
+    u32_idr |= ( pau32_SyncLines[( e_ControllerId == SAFETY_CONTROLLER_1 ) ? HOSTHAL_SYNC_LINE_C2
+                                                                           : HOSTHAL_SYNC_LINE_C1]
+                 != 0u ) ? (UINT32)GPIO_PINMASK_11 : 0u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return ( ( u32_idr & u16PinMask ) != 0u ) ? IO_HIGH : IO_LOW;
+}
+
+void gpioHAL_SetPin( GPIO_TypeDef* sGpio, CONST UINT16 u16PinMask )
+{
+  sGpio->ODR |= u16PinMask;
+  SyncLineUpdate( sGpio );
+}
+
+void gpioHAL_ClearPin( GPIO_TypeDef* sGpio, CONST UINT16 u16PinMask )
+{
+  sGpio->ODR &= ~(UINT32)u16PinMask;
+  SyncLineUpdate( sGpio );
+}
+
+/***************************************************************************************************
+  Function:
+    globFail_SafetyHandler
+
+  Description:
+    Safety Handler of the host builds. The safe state terminates the host process with exit
+    code 3, the fail code and the additional info are printed.
+
+***************************************************************************************************/
+UINT8 globFail_SafetyHandler( GLOB_FAILCODE_ENUM eFailCode )
+{
+  (void)fprintf( stderr, "safety handler: fail code 0x%04X, add info 0x%08X, time %u us\n",
+                 (unsigned)eFailCode, (unsigned)globFail_u32_AddInfo, (unsigned)hostHAL_TimeGet() );
+  exit( 3 );
+  return 0u;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    Step
+
+  Description:
+    This function advances the stepped time by one usec. In lockstep it publishes the new time
+    and waits for the other controller: controller 1 until controller 2 has reached the time,
+    controller 2 until controller 1 has passed it. Afterwards the time hook is called.
+
+***************************************************************************************************/
+STATIC void Step( void )
+{
+  UINT32 u32_own;
+  UINT32 u32_other;
+
+  u32_Time++;
+
+  if ( ps_Lockstep != NULL_PNT )
+  {
+    u32_own = ( e_ControllerId == SAFETY_CONTROLLER_1 ) ? HOSTHAL_SYNC_LINE_C1
+                                                        : HOSTHAL_SYNC_LINE_C2;
+    u32_other = ( u32_own == HOSTHAL_SYNC_LINE_C1 ) ? HOSTHAL_SYNC_LINE_C2 : HOSTHAL_SYNC_LINE_C1;
+
+    /* the accesses of the last usec to the shared resources are done */
+    __sync_synchronize();
+    ps_Lockstep->au32_time[u32_own] = u32_Time;
+
+    while ( ( ps_Lockstep->au32_left[u32_other] == 0u ) &&
+            ( ( ( u32_own == HOSTHAL_SYNC_LINE_C1 ) &&
+                ( (INT32)( ps_Lockstep->au32_time[u32_other] - u32_Time ) < 0 ) ) ||
+              ( ( u32_own == HOSTHAL_SYNC_LINE_C2 ) &&
+                ( (INT32)( ps_Lockstep->au32_time[u32_other] - u32_Time ) <= 0 ) ) ) )
+    {
+      (void)sched_yield();
+    }
+    __sync_synchronize();
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( pf_TimeHook != NULL_PNT ) && ( !b_InHook ) )
+  {
+    b_InHook = TRUE;
+    pf_TimeHook( u32_Time );
+    b_InHook = FALSE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    StepLeave
+
+  Description:
+    Exit handler of the lockstep, the other controller no longer waits for this process.
+
+***************************************************************************************************/
+STATIC void StepLeave( void )
+{
+  ps_Lockstep->au32_left[( e_ControllerId == SAFETY_CONTROLLER_1 ) ? HOSTHAL_SYNC_LINE_C1
+                                                                   : HOSTHAL_SYNC_LINE_C2] = 1u;
+}
+
+/***************************************************************************************************
+  Function:
+    SyncLineUpdate
+
+  Description:
+    This function drives the sync line of the own controller with the output PA12.
+
+***************************************************************************************************/
+STATIC void SyncLineUpdate( CONST GPIO_TypeDef* ps_gpio )
+{
+  if ( ( ps_gpio == GPIOA ) && ( pau32_SyncLines != NULL_PNT ) )
+  {
+    pau32_SyncLines[( e_ControllerId == SAFETY_CONTROLLER_1 ) ? HOSTHAL_SYNC_LINE_C1
+                                                              : HOSTHAL_SYNC_LINE_C2] =
+      ( ( ps_gpio->ODR & GPIO_PINMASK_12 ) != 0u ) ? 1u : 0u;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
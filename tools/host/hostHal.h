@@ -0,0 +1,324 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: hostHal.h
+**     Summary: Header of module hostHal.c, host HAL of the host builds (see tools/host/Makefile).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: hostHAL_TimeGet
+**             hostHAL_TimeSet
+**             hostHAL_TimeAdvance
+**             hostHAL_ControllerSet
+**             hostHAL_IrqEnabled
+**             hostHAL_NvicPriorityGet
+**             hostHAL_TimeRealSet
+**             hostHAL_SyncLinesSet
+**             hostHAL_TimeStepSet
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef HOSTHAL_H
+#define HOSTHAL_H
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+#include "cfg_Config-sys.h"
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Number of __NOP() per usec of the simulated time (delay loops of the firmware, 72 MHz) */
+#define HOSTHAL_NOP_PER_US          9u
+
+/* Number of interrupts with a priority in the NVIC model */
+#define HOSTHAL_IRQ_CNT             68u
+
+/* Index of the sync line driven by the controller, see hostHAL_SyncLinesSet() */
+#define HOSTHAL_SYNC_LINE_C1        0u
+#define HOSTHAL_SYNC_LINE_C2        1u
+#define HOSTHAL_SYNC_LINE_CNT       2u
+
+/* Number of processes of the lockstep, see hostHAL_TimeStepSet() */
+#define HOSTHAL_LOCKSTEP_CNT        2u
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/* HOSTHAL_TIME_HOOK:
+** Function called by the stepped time with the new time in usec, see hostHAL_TimeStepSet().
+*/
+typedef void (*HOSTHAL_TIME_HOOK)( CONST UINT32 u32_time );
+
+/* HOSTHAL_LOCKSTEP_STRUCT:
+** Simulated time of the processes of both controllers, in memory shared by both processes.
+** The index is the one of the sync lines (HOSTHAL_SYNC_LINE_C1, HOSTHAL_SYNC_LINE_C2).
+*/
+typedef struct
+{
+  volatile UINT32 au32_time[HOSTHAL_LOCKSTEP_CNT];  /* simulated time of the controller [us] */
+  volatile UINT32 au32_left[HOSTHAL_LOCKSTEP_CNT];  /* <> 0: process of the controller ended */
+} HOSTHAL_LOCKSTEP_STRUCT;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeGet
+
+  Description:
+    This function returns the simulated time in usec. It is the system time 3 of the firmware
+    (see timerHAL_GetSystemTime3()), the simulation advances it. With the stepped time every
+    call advances it by one usec (see hostHAL_TimeStepSet()).
+
+  See also:
+    hostHAL_TimeAdvance
+
+  Parameters:
+    -
+
+  Return value:
+    UINT32 - simulated time in usec
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+UINT32 hostHAL_TimeGet( void );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeSet
+
+  Description:
+    This function sets the simulated time, e.g. to start a simulation near the wrap around of the
+    system time.
+
+  See also:
+    hostHAL_TimeGet
+
+  Parameters:
+    u32_time (IN) - simulated time in usec
+                    (valid range: 0..0xFFFFFFFF, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void hostHAL_TimeSet( CONST UINT32 u32_time );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeAdvance
+
+  Description:
+    This function advances the simulated time.
+
+  See also:
+    hostHAL_TimeGet
+
+  Parameters:
+    u32_us (IN) - time step in usec
+                  (valid range: 0..0xFFFFFFFF, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void hostHAL_TimeAdvance( CONST UINT32 u32_us );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_ControllerSet
+
+  Description:
+    This function sets the controller ID returned by cfgSYS_GetControllerID(), default is
+    SAFETY_CONTROLLER_1.
+
+  See also:
+    -
+
+  Parameters:
+    e_id (IN) - controller ID
+                (valid range: SAFETY_CONTROLLER_1, SAFETY_CONTROLLER_2, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void hostHAL_ControllerSet( CONST CFG_CONTROLLER_ID_ENUM e_id );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_IrqEnabled
+
+  Description:
+    This function returns whether an interrupt handler may be called by the simulation: the
+    interrupt is enabled in the NVIC model and the interrupts are not disabled by
+    __disable_irq().
+
+  See also:
+    hostHAL_NvicPriorityGet
+
+  Parameters:
+    i32_irq (IN) - IRQ number of the device header
+                   (valid range: 0..HOSTHAL_IRQ_CNT-1, checked)
+
+  Return value:
+    TRUE  - interrupt handler may be called
+    FALSE - interrupt is disabled
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+BOOL hostHAL_IrqEnabled( CONST INT32 i32_irq );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_NvicPriorityGet
+
+  Description:
+    This function returns the priority of an interrupt set with NVIC_SetPriority().
+
+  See also:
+    hostHAL_IrqEnabled
+
+  Parameters:
+    i32_irq (IN) - IRQ number of the device header
+                   (valid range: 0..HOSTHAL_IRQ_CNT-1, checked)
+
+  Return value:
+    UINT32 - priority, 0 if the IRQ number is out of range
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+UINT32 hostHAL_NvicPriorityGet( CONST INT32 i32_irq );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeRealSet
+
+  Description:
+    This function selects the time base of the system time: the simulated time (default) or the
+    monotonic clock of the host divided by u32_div. The real time is used by host builds whose
+    processes or threads run concurrently (e.g. the IPC smoke test), the divider stretches the
+    firmware timeouts (e.g. the 80 usec of the IPC sync) to a duration the host scheduler can
+    keep. Every read of the real time yields the CPU, the firmware polls the time in its wait
+    loops.
+
+  See also:
+    hostHAL_TimeGet
+
+  Parameters:
+    u32_div (IN) - 0: simulated time, else divider of the monotonic clock in usec
+                   (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    The real time may be read from any thread.
+
+***************************************************************************************************/
+void hostHAL_TimeRealSet( CONST UINT32 u32_div );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_SyncLinesSet
+
+  Description:
+    This function connects the IPC sync GPIOs (see ipcs_IpcSync-sys.c) of two host processes.
+    The output PA12 of controller 1 drives pau32_lines[HOSTHAL_SYNC_LINE_C1] which is read by
+    the input PA11 of controller 2 and vice versa. The lines shall be in memory shared by both
+    processes (e.g. mmap() before fork()). Without lines the pins read the IDR register.
+
+  See also:
+    hostHAL_ControllerSet
+
+  Parameters:
+    pau32_lines (IN) - HOSTHAL_SYNC_LINE_CNT lines, NULL to disconnect
+                       (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void hostHAL_SyncLinesSet( volatile UINT32* pau32_lines );
+
+/***************************************************************************************************
+  Function:
+    hostHAL_TimeStepSet
+
+  Description:
+    This function selects the stepped time: every read of the system time, every usec of
+    hostHAL_TimeAdvance() and of the __NOP() delay loops advances the simulated time by one usec
+    and calls the time hook. The hook models the peripherals which run with the time (e.g. the
+    counter of a timer), the wait loops of the firmware see them progress.
+    With a lockstep the processes of both controllers advance their time together: controller 1
+    executes a usec when controller 2 has reached it, controller 2 executes it when controller 1
+    has finished it. The order of the accesses to the shared resources (socket, sync lines)
+    and so the result of the simulation do not depend on the host scheduler. The lockstep ends
+    for the other controller when a process ends (exit()).
+
+  See also:
+    hostHAL_TimeGet
+
+  Parameters:
+    ps_lockstep (IN) - lockstep in memory shared by both processes (zero initialized, e.g.
+                       mmap() before fork()), NULL: the process runs alone
+                       (valid range: any, not checked)
+    pf_hook (IN)     - time hook, NULL: no hook
+                       (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    The controller shall be set before (hostHAL_ControllerSet()). The system time read by the
+    time hook does not advance.
+
+***************************************************************************************************/
+void hostHAL_TimeStepSet( HOSTHAL_LOCKSTEP_STRUCT* ps_lockstep, CONST HOSTHAL_TIME_HOOK pf_hook );
+
+#endif /* HOSTHAL_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
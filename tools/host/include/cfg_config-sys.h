@@ -0,0 +1,34 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: cfg_config-sys.h (tools/host/include)
+**     Summary: Some modules (e.g. version.h) include the configuration as cfg_config-sys.h, the
+**              file is pkgUtil/cfg_Config-sys.h. The host file systems are case sensitive, this
+**              header includes the configuration with the name of the file.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: -
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef HOST_CFG_CONFIG_SYS_H
+#define HOST_CFG_CONFIG_SYS_H
+
+#include "cfg_Config-sys.h"
+
+#endif /* HOST_CFG_CONFIG_SYS_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,34 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: globFit_FitTestHandler_Cfg.h (tools/host/include)
+**     Summary: globFit_FitTestHandler.h includes its configuration as globFit_FitTestHandler_Cfg.h,
+**              the file is pkgGlobal/globFit_FitTestHandler_cfg.h. The host file systems are case
+**              sensitive, this header includes the configuration with the name of the file.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: -
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef HOST_GLOBFIT_FITTESTHANDLER_CFG_H
+#define HOST_GLOBFIT_FITTESTHANDLER_CFG_H
+
+#include "globFit_FitTestHandler_cfg.h"
+
+#endif /* HOST_GLOBFIT_FITTESTHANDLER_CFG_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
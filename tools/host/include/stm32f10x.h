@@ -0,0 +1,126 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: stm32f10x.h (tools/host/include)
+**     Summary: Device header of the host builds (see tools/host/Makefile). Includes the device
+**              header of the CMSIS and redirects the peripherals and the core functions used by
+**              the firmware modules of the host builds to the host HAL (hostHal.c).
+**              The include path of this directory must be in front of the CMSIS include path.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: -
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef HOST_STM32F10X_H
+#define HOST_STM32F10X_H
+
+/* The static inline core functions of core_cm3.h contain ARM instructions. They are not emitted
+** as long as they are not called, the calls are redirected below. */
+#include_next "stm32f10x.h"
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Core functions */
+#undef __disable_irq
+#undef __enable_irq
+#undef __NOP
+#define __disable_irq()             hostHAL_DisableIrq()
+#define __enable_irq()              hostHAL_EnableIrq()
+#define __NOP()                     hostHAL_Nop()
+#define NVIC_SetPriority(irq, prio) hostHAL_NvicSetPriority( (int32_t)(irq), (uint32_t)(prio) )
+#define NVIC_EnableIRQ(irq)         hostHAL_NvicEnableIrq( (int32_t)(irq) )
+#define NVIC_DisableIRQ(irq)        hostHAL_NvicDisableIrq( (int32_t)(irq) )
+
+/* Peripherals */
+#undef RCC
+#undef CRC
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#undef USART1
+#undef USART3
+#undef DMA1
+#undef DMA1_Channel2
+#undef DMA1_Channel3
+#undef DMA1_Channel4
+#undef DMA1_Channel5
+#undef TIM1
+#undef WWDG
+#undef UART4
+#undef DMA2
+#undef DMA2_Channel3
+#undef DMA2_Channel5
+#define RCC                         ( &hostHAL_sRcc )
+#define CRC                         ( &hostHAL_sCrc )
+#define GPIOA                       ( &hostHAL_asGpio[0] )
+#define GPIOB                       ( &hostHAL_asGpio[1] )
+#define GPIOC                       ( &hostHAL_asGpio[2] )
+#define USART1                      ( &hostHAL_sUsart1 )
+#define USART3                      ( &hostHAL_sUsart3 )
+#define DMA1                        ( &hostHAL_sDma1 )
+#define DMA1_Channel2               ( &hostHAL_asDma1Channel[1] )
+#define DMA1_Channel3               ( &hostHAL_asDma1Channel[2] )
+#define DMA1_Channel4               ( &hostHAL_asDma1Channel[3] )
+#define DMA1_Channel5               ( &hostHAL_asDma1Channel[4] )
+#define TIM1                        ( &hostHAL_sTim1 )
+#define WWDG                        ( &hostHAL_sWwdg )
+#define UART4                       ( &hostHAL_sUart4 )
+#define DMA2                        ( &hostHAL_sDma2 )
+#define DMA2_Channel3               ( &hostHAL_asDma2Channel[2] )
+#define DMA2_Channel5               ( &hostHAL_asDma2Channel[4] )
+
+/* Number of channels of DMA1 */
+#define HOSTHAL_DMA1_CHANNEL_CNT    7u
+
+/* Number of channels of DMA2 */
+#define HOSTHAL_DMA2_CHANNEL_CNT    5u
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+extern RCC_TypeDef hostHAL_sRcc;
+extern CRC_TypeDef hostHAL_sCrc;
+extern GPIO_TypeDef hostHAL_asGpio[3];
+extern USART_TypeDef hostHAL_sUsart1;
+extern USART_TypeDef hostHAL_sUsart3;
+extern DMA_TypeDef hostHAL_sDma1;
+extern DMA_Channel_TypeDef hostHAL_asDma1Channel[HOSTHAL_DMA1_CHANNEL_CNT];
+extern TIM_TypeDef hostHAL_sTim1;
+extern WWDG_TypeDef hostHAL_sWwdg;
+extern USART_TypeDef hostHAL_sUart4;
+extern DMA_TypeDef hostHAL_sDma2;
+extern DMA_Channel_TypeDef hostHAL_asDma2Channel[HOSTHAL_DMA2_CHANNEL_CNT];
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+extern void hostHAL_DisableIrq( void );
+extern void hostHAL_EnableIrq( void );
+extern void hostHAL_Nop( void );
+extern void hostHAL_NvicSetPriority( int32_t i32_irq, uint32_t u32_prio );
+extern void hostHAL_NvicEnableIrq( int32_t i32_irq );
+extern void hostHAL_NvicDisableIrq( int32_t i32_irq );
+
+#endif /* HOST_STM32F10X_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,443 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: ipcSmoke.c
+**     Summary: Two process smoke test of the IPC with the host transport (see tools/host/Makefile).
+**              Runs pkgCommunication/ipcx_ExchangeData-sys.c, ipcs_IpcSync-sys.c and
+**              ipct_TransportHost-sys.c unchanged in two processes, one per controller:
+**                - the telegrams are exchanged over a SOCK_SEQPACKET socketpair
+**                - the IPC sync GPIOs PA11/PA12 are connected by lines in shared memory
+**                  (see hostHAL_SyncLinesSet())
+**                - the system time is the monotonic clock of the host divided by the time
+**                  divider, so the firmware timeouts (e.g. 80 usec of ipcsSYS_Sync()) are
+**                  stretched to a duration the host scheduler can keep
+**              Every cycle each process exchanges a buffer (ipcxSYS_SendBuffer(),
+**              ipcxSYS_GetBufferinclWait()), an UINT32 (ipcxSYS_ExChangeUINT32Data()), an IPC
+**              frame with two records and a telegram written and read in place
+**              (ipcxSYS_TxReserve(), ipcxSYS_TxCommit(), ipcxSYS_RxViewinclWait()) and checks
+**              the received data against the pattern of the other controller. The statistics of
+**              the IPC and the transport are printed at the end.
+**
+**              Usage: ipcSmoke [-n <cycles>] [-t <time divider>] [-d <delay usec>]
+**                              [-j <jitter usec>] [-D <drop ppm>] [-F <flip ppm>] [-s <seed>]
+**                              [-x]
+**              -d, -j, -D, -F and -s configure the fault injection of the host transport,
+**              -x expects that both controllers end in the Safety Handler (e.g. with -D).
+**              Exit code: 0 both controllers passed (with -x: both ended in the Safety
+**              Handler), 1 failed, 2 usage error.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: main
+**
+**             Controller
+**             Check
+**             Pattern
+**             StatPrint
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+#include "globFail_Errorcodes.h"
+#include "cfg_Config-sys.h"
+
+/* Module header */
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+#include "ipcs_IpcSync-sys.h"
+#include "ipct_TransportHost-sys.h"
+#include "hostHal.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Default number of cycles */
+#define k_CYCLES                 1000u
+
+/* Default time divider: 1 usec of the firmware is 1 msec of the host */
+#define k_TIME_DIV               1000u
+
+/* Time from the startup sync to the first scheduler IRQ in usec */
+#define k_START_US               20u
+
+/* Exit code of the Safety Handler, see globFail_SafetyHandler() in hostHal.c */
+#define k_EXIT_SAFETY            3
+
+/* Number of the controller (1, 2) for the output */
+#define k_NUM(id)                ( ( (id) == SAFETY_CONTROLLER_1 ) ? 1u : 2u )
+
+/* Length of the buffer and of the in place telegram */
+#define k_BUF_LEN                8u
+#define k_VIEW_LEN               IPCXSYS_SIZEOF_MAX_PAYLOAD
+
+/* Test parameters, see main() */
+STATIC UINT32 u32_Cycles = k_CYCLES;
+STATIC UINT32 u32_TimeDiv = k_TIME_DIV;
+STATIC IPCTHOST_CFG_STRUCT s_Cfg = { 0u, 0u, 0u, 0u, 0u, 1u, 0u };
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC int Controller( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST INT32 i32_fd,
+                       volatile UINT32* pau32_lines );
+STATIC BOOL Check( CONST char* pc_what, CONST UINT32 u32_cycle, CONST UINT8* pau8_rx,
+                   CONST UINT8* pau8_exp, CONST UINT8 u8_len );
+STATIC void Pattern( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST UINT32 u32_cycle,
+                     CONST UINT8 u8_salt, UINT8* pau8_buf, CONST UINT8 u8_len );
+STATIC void StatPrint( CONST CFG_CONTROLLER_ID_ENUM e_id );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    main
+
+  Description:
+    Parses the options, connects the two controller processes (socketpair, sync lines) and
+    waits for both of them.
+
+***************************************************************************************************/
+int main( int argc, char* argv[] )
+{
+  INT32 ai32_fd[2];
+  volatile UINT32* pau32_lines;
+  pid_t ai_pid[2];
+  int ai_status[2];
+  BOOL b_expectSafety = FALSE;
+  BOOL b_pass = TRUE;
+  UINT32 i;
+  int i_opt;
+
+  while ( ( i_opt = getopt( argc, argv, "n:t:d:j:D:F:s:x" ) ) != -1 )
+  {
+    switch ( i_opt )
+    {
+      case 'n': u32_Cycles = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 't': u32_TimeDiv = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'd': s_Cfg.u32_delayUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'j': s_Cfg.u32_jitterUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'D': s_Cfg.u32_dropPpm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'F': s_Cfg.u32_flipPpm = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 's': s_Cfg.u32_seed = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'x': b_expectSafety = TRUE; break;
+      default:  return 2;
+    }
+  }
+  if ( ( optind != argc ) || ( u32_TimeDiv == 0u ) )
+  {
+    (void)fprintf( stderr, "usage: ipcSmoke [-n cycles] [-t time_div] [-d delay_us] "
+                           "[-j jitter_us] [-D drop_ppm] [-F flip_ppm] [-s seed] [-x]\n" );
+    return 2;
+  }
+
+  (void)printf( "%u cycles, time divider %u, delay %u us, jitter %u us, drop %u ppm, "
+                "flip %u ppm, seed %u%s\n",
+                (unsigned)u32_Cycles, (unsigned)u32_TimeDiv, (unsigned)s_Cfg.u32_delayUs,
+                (unsigned)s_Cfg.u32_jitterUs, (unsigned)s_Cfg.u32_dropPpm,
+                (unsigned)s_Cfg.u32_flipPpm, (unsigned)s_Cfg.u32_seed,
+                b_expectSafety ? ", Safety Handler expected" : "" );
+  (void)fflush( stdout );
+
+  /* the sync lines and the socket are shared by both processes */
+  pau32_lines = (volatile UINT32*)mmap( NULL, HOSTHAL_SYNC_LINE_CNT * sizeof(UINT32),
+                                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                                        -1, 0 );
+  if ( ( pau32_lines == (volatile UINT32*)MAP_FAILED ) ||
+       ( socketpair( AF_UNIX, SOCK_SEQPACKET, 0, ai32_fd ) != 0 ) )
+  {
+    perror( "ipcSmoke" );
+    return 1;
+  }
+  else
+  {
+    pau32_lines[HOSTHAL_SYNC_LINE_C1] = 0u;
+    pau32_lines[HOSTHAL_SYNC_LINE_C2] = 0u;
+  }
+
+  for ( i = 0u; i < 2u; i++ )
+  {
+    ai_pid[i] = fork();
+    if ( ai_pid[i] == 0 )
+    {
+      /* child: controller 1 uses the first end of the socketpair, controller 2 the second */
+      (void)close( ai32_fd[1u - i] );
+      exit( Controller( ( i == 0u ) ? SAFETY_CONTROLLER_1 : SAFETY_CONTROLLER_2, ai32_fd[i],
+                        pau32_lines ) );
+    }
+    else if ( ai_pid[i] < 0 )
+    {
+      perror( "ipcSmoke" );
+      return 1;
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  (void)close( ai32_fd[0] );
+  (void)close( ai32_fd[1] );
+
+  for ( i = 0u; i < 2u; i++ )
+  {
+    if ( ( waitpid( ai_pid[i], &ai_status[i], 0 ) != ai_pid[i] ) || !WIFEXITED( ai_status[i] ) )
+    {
+      (void)printf( "controller %u: aborted\n", (unsigned)( i + 1u ) );
+      b_pass = FALSE;
+    }
+    else
+    {
+      (void)printf( "controller %u: exit code %d\n", (unsigned)( i + 1u ),
+                    WEXITSTATUS( ai_status[i] ) );
+      b_pass = ( b_pass &&
+                 ( WEXITSTATUS( ai_status[i] ) == ( b_expectSafety ? k_EXIT_SAFETY : 0 ) ) );
+    }
+  }
+
+  (void)printf( "%s\n", b_pass ? "PASS" : "FAIL" );
+  return b_pass ? 0 : 1;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    Controller
+
+  Description:
+    Process of one controller: startup as in main.c (IPC, sync), then the exchanges of the test
+    cycles. The scheduler start is emulated after the startup sync: the controller waits
+    k_START_US, so the other controller sees the high sync line before it is toggled, and
+    calls ipcsSYS_Sync() as the first scheduler IRQ (see sch_Scheduler-app.c). Afterwards the
+    sync of every ipcxSYS_TxCommit() waits for the other controller to restart its reception.
+    The Safety Handler ends the process with k_EXIT_SAFETY.
+
+  Return value:
+    int - exit code of the process, 0: all received data as expected, 1: wrong data
+
+***************************************************************************************************/
+STATIC int Controller( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST INT32 i32_fd,
+                       volatile UINT32* pau32_lines )
+{
+  CFG_CONTROLLER_ID_ENUM e_other;
+  UINT8 au8_tx[IPCXSYS_SIZEOF_MAX_PAYLOAD];
+  UINT8 au8_exp[IPCXSYS_SIZEOF_MAX_PAYLOAD];
+  UINT8 au8_rx[IPCXSYS_SIZEOF_MAX_PAYLOAD];
+  UINT8* pau8_tx;
+  CONST UINT8* pau8_rx;
+  UINT32 u32_rx;
+  UINT32 u32_cycle;
+  UINT32 u32_start;
+  BOOL b_ok = TRUE;
+
+  e_other = ( e_id == SAFETY_CONTROLLER_1 ) ? SAFETY_CONTROLLER_2 : SAFETY_CONTROLLER_1;
+
+  hostHAL_ControllerSet( e_id );
+  hostHAL_TimeRealSet( u32_TimeDiv );
+  hostHAL_SyncLinesSet( pau32_lines );
+  ipctHOST_Setup( i32_fd, &s_Cfg );
+
+  /* startup, see main.c */
+  ipcxSYS_Init();
+  ipcsSYS_Init();
+  ipcsSYS_SyncStartup();
+
+  /* start of the scheduler */
+  u32_start = hostHAL_TimeGet();
+  while ( ( hostHAL_TimeGet() - u32_start ) < k_START_US )
+  {
+    /* wait */
+  }
+  ipcsSYS_Sync();
+
+  for ( u32_cycle = 0u; ( u32_cycle < u32_Cycles ) && b_ok; u32_cycle++ )
+  {
+    /* buffer, copied */
+    Pattern( e_id, u32_cycle, 0x11u, au8_tx, k_BUF_LEN );
+    ipcxSYS_SendBuffer( IPCXSYS_IPC_ID_IO, k_BUF_LEN, au8_tx );
+    ipcxSYS_GetBufferinclWait( IPCXSYS_IPC_ID_IO, k_BUF_LEN, au8_rx );
+    Pattern( e_other, u32_cycle, 0x11u, au8_exp, k_BUF_LEN );
+    b_ok = Check( "buffer", u32_cycle, au8_rx, au8_exp, k_BUF_LEN );
+
+    /* UINT32 */
+    u32_rx = ipcxSYS_ExChangeUINT32Data( ( (UINT32)e_id << 24u ) ^ u32_cycle,
+                                         IPCXSYS_IPC_ID_CLKCTRL );
+    if ( b_ok && ( u32_rx != ( ( (UINT32)e_other << 24u ) ^ u32_cycle ) ) )
+    {
+      (void)printf( "controller %u cycle %u: UINT32 0x%08x\n", (unsigned)k_NUM(e_id),
+                    (unsigned)u32_cycle, (unsigned)u32_rx );
+      b_ok = FALSE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* IPC frame with two records */
+    Pattern( e_id, u32_cycle, 0x22u, au8_tx, 4u );
+    ipcxSYS_FrameAddUINT32( IPCXSYS_IPC_ID_TEMP_MESS, ~u32_cycle ^ (UINT32)e_id );
+    ipcxSYS_FrameAddBuffer( IPCXSYS_IPC_ID_CONFIG, 4u, au8_tx );
+    ipcxSYS_FrameSend();
+    ipcxSYS_FrameRecvinclWait();
+    Pattern( e_other, u32_cycle, 0x22u, au8_exp, 4u );
+    b_ok = ( b_ok &&
+             Check( "frame", u32_cycle,
+                    ipcxSYS_FrameGetBuffer( IPCXSYS_IPC_ID_CONFIG, 4u ), au8_exp, 4u ) );
+    if ( b_ok &&
+         ( ipcxSYS_FrameGetUINT32( IPCXSYS_IPC_ID_TEMP_MESS ) != ( ~u32_cycle ^ (UINT32)e_other ) ) )
+    {
+      (void)printf( "controller %u cycle %u: frame UINT32\n", (unsigned)k_NUM(e_id),
+                    (unsigned)u32_cycle );
+      b_ok = FALSE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+
+    /* in place */
+    pau8_tx = ipcxSYS_TxReserve( IPCXSYS_IPC_ID_SAFETGM, k_VIEW_LEN );
+    Pattern( e_id, u32_cycle, 0x33u, pau8_tx, k_VIEW_LEN );
+    ipcxSYS_TxCommit();
+    pau8_rx = ipcxSYS_RxViewinclWait( IPCXSYS_IPC_ID_SAFETGM, k_VIEW_LEN );
+    Pattern( e_other, u32_cycle, 0x33u, au8_exp, k_VIEW_LEN );
+    b_ok = ( b_ok && Check( "view", u32_cycle, pau8_rx, au8_exp, k_VIEW_LEN ) );
+
+    ipcxSYS_WaitStatCycle();
+  }
+
+  StatPrint( e_id );
+  return b_ok ? 0 : 1;
+}
+
+/***************************************************************************************************
+  Function:
+    Check
+
+  Description:
+    Compares the received data with the expected pattern, a difference is printed.
+
+  Return value:
+    TRUE  - equal
+    FALSE - different
+
+***************************************************************************************************/
+STATIC BOOL Check( CONST char* pc_what, CONST UINT32 u32_cycle, CONST UINT8* pau8_rx,
+                   CONST UINT8* pau8_exp, CONST UINT8 u8_len )
+{
+  BOOL b_equal = ( memcmp( pau8_rx, pau8_exp, u8_len ) == 0 ) ? TRUE : FALSE;
+
+  if ( !b_equal )
+  {
+    (void)printf( "controller %u cycle %u: %s differs\n", (unsigned)k_NUM(cfgSYS_GetControllerID()),
+                  (unsigned)u32_cycle, pc_what );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return b_equal;
+}
+
+/***************************************************************************************************
+  Function:
+    Pattern
+
+  Description:
+    Builds the test pattern of a controller for a cycle, the salt distinguishes the exchanges.
+
+***************************************************************************************************/
+STATIC void Pattern( CONST CFG_CONTROLLER_ID_ENUM e_id, CONST UINT32 u32_cycle,
+                     CONST UINT8 u8_salt, UINT8* pau8_buf, CONST UINT8 u8_len )
+{
+  UINT8 i;
+
+  for ( i = 0u; i < u8_len; i++ )
+  {
+    pau8_buf[i] = (UINT8)( ( u32_cycle * 7u ) + ( (UINT32)i * 13u ) + u8_salt + (UINT32)e_id );
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    StatPrint
+
+  Description:
+    Prints the wait time and link statistic of the IPC and the statistic of the host transport,
+    all times in usec of the firmware (host time / time divider).
+
+***************************************************************************************************/
+STATIC void StatPrint( CONST CFG_CONTROLLER_ID_ENUM e_id )
+{
+  STATIC CONST UINT8 au8_id[] = { IPCXSYS_IPC_ID_IO, IPCXSYS_IPC_ID_CLKCTRL, IPCXSYS_IPC_ID_FRAME,
+                                  IPCXSYS_IPC_ID_SAFETGM };
+  IPCXSYS_WAIT_STAT_STRUCT s_wait;
+  IPCXSYS_LINK_STAT_STRUCT s_link;
+  IPCTHOST_STAT_STRUCT s_host;
+  UINT32 i;
+
+  ipcxSYS_WaitStatGet( &s_wait );
+  ipctHOST_StatGet( &s_host );
+
+  (void)printf( "controller %u: %u cycles, rx wait %u cycles max %u, sync max %u, "
+                "total mean %u max %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_wait.u32_cycleCnt,
+                (unsigned)s_wait.u32_rxWaitCycleCnt, (unsigned)s_wait.u16_rxMax,
+                (unsigned)s_wait.u16_syncMax, (unsigned)s_wait.u16_totalMean,
+                (unsigned)s_wait.u16_totalMax );
+  for ( i = 0u; i < ( sizeof(au8_id) / sizeof(au8_id[0]) ); i++ )
+  {
+    ipcxSYS_LinkStatGet( au8_id[i], &s_link );
+    (void)printf( "controller %u: ID 0x%02x rx %u crc fail %u recovered %u wait mean %u max %u\n",
+                  (unsigned)k_NUM(e_id), (unsigned)au8_id[i], (unsigned)s_link.u32_rxCnt,
+                  (unsigned)s_link.u16_crcFailCnt, (unsigned)s_link.u16_recoverCnt,
+                  (unsigned)s_link.u16_waitMean, (unsigned)s_link.u16_waitMax );
+  }
+  (void)printf( "controller %u: transport tx %u rx %u dropped %u flipped %u lost %u "
+                "complete %u\n",
+                (unsigned)k_NUM(e_id), (unsigned)s_host.u32_txCnt, (unsigned)s_host.u32_rxCnt,
+                (unsigned)s_host.u32_dropCnt, (unsigned)s_host.u32_flipCnt,
+                (unsigned)s_host.u32_lostCnt, (unsigned)s_host.u32_completeCnt );
+  (void)fflush( stdout );
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
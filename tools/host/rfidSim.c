@@ -0,0 +1,1166 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: rfidSim.c
+**     Summary: Host RFID simulator and latency benchmark (see tools/host/Makefile). Runs
+**              pkgRFID/RFIDmain.c of controller 1 unchanged against
+**                - the simulated USART3 and DMA1 channel 2/3: the bytes of the Tx DMA buffer
+**                  are sent to the reader model with the baud rate of USART3->BRR, the bytes of
+**                  the reader are written into the Rx DMA ring (CNDTR counts down, circular)
+**                  and the IDLE line interrupt calls USART3_IRQHandler()
+**                - the simulated system time (timerHAL_GetSystemTime3(), 1 usec resolution)
+**                - the reader and tag model of rfidSimReader.c
+**                - the scheduler cycle: RFID_ReadTag() in its time slice, the IO telegram every
+**                  4th slice and the digest exchange in its slices
+**                - a model of controller 2: it confirms a digest if the counter matches the IO
+**                  telegram and the S2L ID is the one of the last arrived tag, the verdict is
+**                  returned with the IO telegram (see RFID_DigestAckSet())
+**              The scenario script (see tools/host/scenarios/) describes the tag and reader
+**              events, the benchmark reports the time to the first valid ID per tag arrival,
+**              the time to the withdrawal per tag removal, the cycles per state of the state
+**              machine, the failure count behaviour and the latency histograms.
+**              The tuning constants of RFID.h/RFIDcrc.h are set with RFID_DEFS of the Makefile.
+**
+**              Scenario script, one event per line, '#' starts a comment:
+**                set <param>=<usec>          reader timing before the start: ve_us, br_us,
+**                                            sf_us, sr_us, sr_word_us, boot_us
+**                <ms> power_on               reader (re)start, power on notification
+**                <ms> tag_arrive uid=<16 hex digits> s2l=<8 hex digits>
+**                <ms> tag_remove
+**                <ms> corrupt_chck [n=<cnt>] next n responses with wrong checksum
+**                <ms> timeout [n=<cnt>]      next n commands without response
+**                <ms> wrong_seq rec=<0..7> seq=<value> [crc=keep]
+**                                            sequence number of a record, the CRCs are
+**                                            recalculated unless crc=keep
+**                <ms> digest_reject [n=<cnt>] controller 2 rejects the next n digests
+**                <ms> expect_id              controller 1 publishes the S2L ID of the tag
+**                <ms> expect_no_id           controller 1 publishes no S2L ID
+**                <ms> expect_fail_safe       the state machine is in RFID_FAIL_SAFE
+**                <ms> expect_failures n=<cnt> failure count of the state machine
+**                <ms> expect_valid_within ms=<ms>
+**                                            the last tag arrival was published in time
+**                <ms> end                    end of the simulation
+**
+**              Usage: rfidSim [-c <cycle usec>] [-s <slices>] [-r <RFID_ReadTag slice>]
+**                             [-d <RFID_DigestSend slice>] [-t <start time usec>] [-q]
+**                             <scenario>
+**              Exit code: 0 all expectations met, 1 expectation failed or a wrong S2L ID was
+**              published, 2 usage/scenario error, 3 safety handler (hostHal.c).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: main
+**             ipcxSYS_SendBuffer
+**             ipcxSYS_GetBufferinclWait
+**
+**             BaudGet
+**             BenchCheck
+**             BenchReport
+**             EventRun
+**             HexParse
+**             KeyGet
+**             LineStep
+**             ScenarioLoad
+**             SliceRun
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Host header */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Project header */
+#include "stm32f10x.h"
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globPreChk.h"
+#include "globDef_GlobalDefinitions.h"
+#include "globFail_Errorcodes.h"
+
+/* Module header */
+#include "ipcx_ExchangeData-sys_def.h"
+#include "ipcx_ExchangeData-sys.h"
+#include "RFID.h"
+#include "hostHal.h"
+#include "rfidSimReader.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/* State of RFIDmain.c (not part of RFID.h) */
+extern t_RFID_TAG_READ_STATE e_rfidAccessState;
+extern t_RFID_FAILURE e_rfidLastFailure;
+extern UINT8 u8_rfidFailureCount;
+extern UINT32 au32_rfidStateCycles[];
+extern UINT8 au8_rfidDmaBufferTx[];
+extern UINT8 au8_rfidDmaBufferRx[];
+extern void USART3_IRQHandler( void );
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Scheduler defaults (4 ms cycle, see pkgOperation/sch_Scheduler-app_tbl.h) */
+#define k_CYCLE_US               4000u
+#define k_SLICE_CNT              40u
+#define k_SLICE_READ_TAG         18u
+#define k_SLICE_DIGEST           26u
+#define k_IO_PERIOD              4u
+
+/* Reader timing defaults in usec, see RFIDSIMREADER_CFG_STRUCT */
+#define k_READER_VE_US           3000u
+#define k_READER_BR_US           1000u
+#define k_READER_SF_US           6000u
+#define k_READER_SR_US           4000u
+#define k_READER_SR_WORD_US      250u
+#define k_READER_BOOT_US         50000u
+
+/* Size of the Rx DMA ring (RFID_RX_RING_SIZE of RFIDmain.c) */
+#define k_RX_RING_SIZE           256u
+
+/* Verdict of controller 2: digest counter and confirmation (RFID_DIGEST_ACK_OK of RFIDmain.c) */
+#define k_DIGEST_CNT_SHIFT       2u
+#define k_DIGEST_CNT_MASK        0x3Fu
+#define k_DIGEST_ACK_OK          0x80u
+
+/* Offsets in the digest (t_RFID_DIGEST of RFIDmain.c) */
+#define k_DIGEST_LEN             16u
+#define k_DIGEST_IDX_S2L         0u
+#define k_DIGEST_IDX_CTRL        15u
+
+#define k_EVENT_MAX              256u
+#define k_LINE_MAX               256u
+#define k_TAG_MAX                64u
+
+typedef enum
+{
+  EVT_POWER_ON,
+  EVT_TAG_ARRIVE,
+  EVT_TAG_REMOVE,
+  EVT_CORRUPT_CHCK,
+  EVT_TIMEOUT,
+  EVT_WRONG_SEQ,
+  EVT_DIGEST_REJECT,
+  EVT_EXPECT_ID,
+  EVT_EXPECT_NO_ID,
+  EVT_EXPECT_FAIL_SAFE,
+  EVT_EXPECT_FAILURES,
+  EVT_EXPECT_VALID_WITHIN,
+  EVT_END
+} EVT_ENUM;
+
+typedef struct
+{
+  UINT32 u32_time;                 /* usec after the start */
+  EVT_ENUM e_evt;
+  UINT8 au8_uid[RFID_UID_LEN];
+  UINT8 au8_s2l[RFID_S2L_ID_LEN];
+  UINT32 u32_arg1;
+  UINT32 u32_arg2;
+  UINT32 u32_line;
+} EVENT_STRUCT;
+
+/* Measurement per tag arrival */
+typedef struct
+{
+  UINT32 u32_info;                 /* expected S2L ID (format of RFID_InfoGet()) */
+  UINT32 u32_arrive;               /* arrival time */
+  UINT32 u32_valid;                /* first publication after the arrival (0: none) */
+  UINT32 u32_remove;               /* removal time (0: not removed) */
+  UINT32 u32_withdraw;             /* first cycle without publication after the removal */
+  UINT32 u32_dropStart;            /* start of the current interruption (0: none) */
+  UINT32 u32_dropCnt;              /* interruptions of the publication while present */
+  UINT32 u32_dropMax;              /* longest interruption */
+  BOOL b_valid;
+  BOOL b_withdrawn;
+} TAG_STRUCT;
+
+STATIC CONST char* CONST apc_StateName[] =
+{
+  "TX_BOOT_FIRMWARE", "RX_BOOT_FIRMWARE", "TX_SET_BAUD", "RX_SET_BAUD", "TX_READ_UID",
+  "RX_READ_UID", "TX_READ_REC_EVEN", "RX_READ_REC_EVEN", "CHECK_REC_EVEN", "TX_READ_REC_ODD",
+  "RX_READ_REC_ODD", "CHECK_REC_ODD", "TX_READ_FULL_MEM", "RX_READ_FULL_MEM", "CHECK_FULL_MEM",
+  "TX_READ_REC_SPOT", "RX_READ_REC_SPOT", "CHECK_REC_SPOT", "CHECK_TAG_RECORDS", "STATE_SUCCESS",
+  "RFID_FAIL_SAFE"
+};
+
+STATIC CONST char* CONST apc_FailName[] =
+{
+  "NONE", "BOOT_READER", "BOOT_READER_TIMEOUT", "UID_TIMEOUT", "UID_VERIFY", "INVALID_SEQ_NUM",
+  "EVEN_REC_TIMEOUT", "EVEN_REC_VERIFY", "EVEN_REC_SEQ_NUM_ERROR", "EVEN_REC_CRC_ERROR",
+  "ODD_REC_TIMEOUT", "ODD_REC_VERIFY", "ODD_REC_SEQ_NUM_ERROR", "ODD_REC_CRC_ERROR",
+  "FULL_MEM_TIMEOUT", "FULL_MEM_VERIFY", "FULL_MEM_SEQ_NUM_ERROR", "FULL_MEM_CRC_ERROR",
+  "FULL_MEM_MCRC_ERROR", "SPOT_REC_VERIFY", "SPOT_REC_SEQ_NUM_ERROR", "SPOT_REC_CRC_ERROR",
+  "S2L_ID_VERIFY", "DIGEST_VERIFY", "UNKNOWN"
+};
+
+STATIC CONST char* CONST apc_HistName[] =
+{
+  "UID", "REC_EVEN", "REC_ODD", "FULL_VERIFY", "TAG_REMOVAL"
+};
+
+/*lint -e(948) */
+IXX_TASSERT( ( ( sizeof( apc_StateName ) / sizeof( apc_StateName[0] ) ) ==
+               ( (UINT32)RFID_FAIL_SAFE + 1u ) ), rfidsim_chk1 )
+/*lint -esym(751, IXX_DUMMY_rfidsim_chk1) not referenced - just for checks */
+/*lint -e(948) */
+IXX_TASSERT( ( ( sizeof( apc_FailName ) / sizeof( apc_FailName[0] ) ) == RFID_FAIL_CNT ),
+             rfidsim_chk2 )
+/*lint -esym(751, IXX_DUMMY_rfidsim_chk2) not referenced - just for checks */
+/*lint -e(948) */
+IXX_TASSERT( ( ( sizeof( apc_HistName ) / sizeof( apc_HistName[0] ) ) == RFID_HIST_CNT ),
+             rfidsim_chk3 )
+/*lint -esym(751, IXX_DUMMY_rfidsim_chk3) not referenced - just for checks */
+
+/* Options */
+STATIC UINT32 u32_CycleUs = k_CYCLE_US;
+STATIC UINT32 u32_SliceCnt = k_SLICE_CNT;
+STATIC UINT32 u32_SliceReadTag = k_SLICE_READ_TAG;
+STATIC UINT32 u32_SliceDigest = k_SLICE_DIGEST;
+STATIC UINT32 u32_StartTime = 0u;
+STATIC BOOL b_Quiet = FALSE;
+
+/* Scenario */
+STATIC RFIDSIMREADER_CFG_STRUCT s_ReaderCfg =
+{
+  k_READER_VE_US, k_READER_BR_US, k_READER_SF_US, k_READER_SR_US, k_READER_SR_WORD_US,
+  k_READER_BOOT_US
+};
+STATIC EVENT_STRUCT as_Event[k_EVENT_MAX];
+STATIC UINT32 u32_EventCnt = 0u;
+STATIC UINT32 u32_EventNext = 0u;
+STATIC BOOL b_End = FALSE;
+
+/* Serial line: Tx DMA transfer (length, expected CNDTR, end of the current byte), Rx IDLE */
+STATIC BOOL b_TxActive = FALSE;
+STATIC UINT32 u32_TxLen = 0u;
+STATIC UINT32 u32_TxCnt = 0u;
+STATIC UINT32 u32_TxByteEnd = 0u;
+STATIC BOOL b_RxIdlePending = FALSE;
+STATIC UINT32 u32_RxLast = 0u;
+
+/* Model of controller 2: received IO telegram, digest and verdict */
+STATIC UINT8 u8_C2DigestCnt = 0u;
+STATIC UINT8 u8_C2Ack = 0u;
+STATIC UINT8 u8_C2AckTx = 0u;
+STATIC UINT8 au8_C2Digest[k_DIGEST_LEN];
+STATIC BOOL b_C2DigestRx = FALSE;
+STATIC UINT32 u32_C2RejectCnt = 0u;
+STATIC UINT8 au8_C2S2l[RFID_S2L_ID_LEN];
+STATIC UINT32 u32_C2Confirmed = 0u;
+STATIC UINT32 u32_C2Rejected = 0u;
+
+/* Benchmark */
+STATIC TAG_STRUCT as_Tag[k_TAG_MAX];
+STATIC UINT32 u32_TagCnt = 0u;
+STATIC BOOL b_TagPresent = FALSE;
+STATIC UINT32 u32_Published = 0u;
+STATIC UINT32 u32_WrongIdCnt = 0u;
+STATIC UINT32 u32_ExpectFailCnt = 0u;
+STATIC UINT8 u8_FailCntLast = 0u;
+STATIC t_RFID_TAG_READ_STATE e_StateLast = TX_BOOT_FIRMWARE;
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC UINT32 BaudGet( void );
+STATIC void BenchCheck( CONST UINT32 u32_now );
+STATIC void BenchReport( CONST UINT32 u32_now );
+STATIC void EventRun( CONST EVENT_STRUCT* ps_evt, CONST UINT32 u32_now );
+STATIC BOOL HexParse( CONST char* pc_hex, UINT8* pau8_out, CONST UINT32 u32_len );
+STATIC CONST char* KeyGet( CONST char* pc_args, CONST char* pc_key );
+STATIC void LineStep( CONST UINT32 u32_now );
+STATIC BOOL ScenarioLoad( CONST char* pc_file );
+STATIC void SliceRun( CONST UINT32 u32_slice );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    main
+
+  Description:
+    Parses the options, loads the scenario and runs the simulation in steps of 1 usec up to
+    the "end" event.
+
+***************************************************************************************************/
+int main( int argc, char* argv[] )
+{
+  UINT32 u32_sliceUs;
+  UINT32 u32_now;
+  UINT32 u32_slice = 0u;
+  int i_opt;
+
+  while ( ( i_opt = getopt( argc, argv, "c:s:r:d:t:q" ) ) != -1 )
+  {
+    switch ( i_opt )
+    {
+      case 'c': u32_CycleUs = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 's': u32_SliceCnt = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'r': u32_SliceReadTag = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'd': u32_SliceDigest = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 't': u32_StartTime = (UINT32)strtoul( optarg, NULL, 0 ); break;
+      case 'q': b_Quiet = TRUE; break;
+      default:  return 2;
+    }
+  }
+  if ( ( optind != ( argc - 1 ) ) || ( u32_SliceCnt == 0u ) ||
+       ( ( u32_CycleUs % u32_SliceCnt ) != 0u ) || ( u32_SliceReadTag >= u32_SliceCnt ) ||
+       ( ( u32_SliceDigest + 1u ) >= u32_SliceCnt ) )
+  {
+    (void)fprintf( stderr, "usage: rfidSim [-c cycle_us] [-s slices] [-r slice] [-d slice] "
+                           "[-t start_us] [-q] scenario\n" );
+    return 2;
+  }
+  if ( !ScenarioLoad( argv[optind] ) )
+  {
+    return 2;
+  }
+  u32_sliceUs = u32_CycleUs / u32_SliceCnt;
+
+  (void)printf( "scenario %s, cycle %u us, %u slices, RFID_ReadTag slice %u, digest slice %u/%u\n",
+                argv[optind], (unsigned)u32_CycleUs, (unsigned)u32_SliceCnt,
+                (unsigned)u32_SliceReadTag, (unsigned)u32_SliceDigest,
+                (unsigned)( u32_SliceDigest + 1u ) );
+
+  hostHAL_TimeSet( u32_StartTime );
+  hostHAL_ControllerSet( SAFETY_CONTROLLER_1 );
+  rfidSimREADER_Init( &s_ReaderCfg );
+  /* startup, see main.c */
+  RFID_Init();
+
+  while ( !b_End )
+  {
+    u32_now = hostHAL_TimeGet() - u32_StartTime;
+
+    while ( ( u32_EventNext < u32_EventCnt ) && ( as_Event[u32_EventNext].u32_time <= u32_now ) )
+    {
+      EventRun( &as_Event[u32_EventNext], u32_now );
+      u32_EventNext++;
+    }
+
+    LineStep( u32_now );
+
+    if ( ( u32_now % u32_sliceUs ) == 0u )
+    {
+      SliceRun( u32_slice );
+      u32_slice = ( u32_slice + 1u ) % u32_SliceCnt;
+      if ( u32_slice == 0u )
+      {
+        BenchCheck( u32_now );
+      }
+      else
+      {
+        /* empty branch */
+      }
+    }
+    else
+    {
+      /* empty branch */
+    }
+    hostHAL_TimeAdvance( 1u );
+  }
+
+  BenchReport( hostHAL_TimeGet() - u32_StartTime );
+  return ( ( u32_WrongIdCnt != 0u ) || ( u32_ExpectFailCnt != 0u ) ) ? 1 : 0;
+}
+
+/***************************************************************************************************
+  Function:
+    ipcxSYS_SendBuffer, ipcxSYS_GetBufferinclWait
+
+  Description:
+    IPC of the simulator, only the digest exchange with controller 2 is modeled
+    (RFID_DigestSend(), RFID_DigestRecv()). Controller 2 sends an empty digest.
+
+***************************************************************************************************/
+void ipcxSYS_SendBuffer( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, CONST UINT8* pau8_buffer )
+{
+  if ( ( u8_ipcId == IPCXSYS_IPC_ID_RFID_DIGEST ) && ( u8_dataLen == k_DIGEST_LEN ) )
+  {
+    (void)memcpy( au8_C2Digest, pau8_buffer, k_DIGEST_LEN );
+    b_C2DigestRx = TRUE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+void ipcxSYS_GetBufferinclWait( CONST UINT8 u8_ipcId, CONST UINT8 u8_dataLen, UINT8* pau8_buffer )
+{
+  UINT8 u8_cnt;
+
+  (void)memset( pau8_buffer, 0, u8_dataLen );
+
+  if ( ( u8_ipcId == IPCXSYS_IPC_ID_RFID_DIGEST ) && b_C2DigestRx )
+  {
+    /* controller 2 checks the digest (see RFID_DigestRecv()) */
+    b_C2DigestRx = FALSE;
+    u8_cnt = (UINT8)( au8_C2Digest[k_DIGEST_IDX_CTRL] >> k_DIGEST_CNT_SHIFT );
+    u8_C2Ack = (UINT8)( u8_C2DigestCnt & k_DIGEST_CNT_MASK );
+    if ( ( u8_cnt == ( u8_C2DigestCnt & k_DIGEST_CNT_MASK ) ) && ( u32_C2RejectCnt == 0u ) &&
+         ( memcmp( &au8_C2Digest[k_DIGEST_IDX_S2L], au8_C2S2l, RFID_S2L_ID_LEN ) == 0 ) )
+    {
+      u8_C2Ack |= k_DIGEST_ACK_OK;
+      u32_C2Confirmed++;
+    }
+    else
+    {
+      u32_C2RejectCnt = ( u32_C2RejectCnt != 0u ) ? ( u32_C2RejectCnt - 1u ) : 0u;
+      u32_C2Rejected++;
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    BaudGet
+
+  Description:
+    This function returns the baud rate of USART3 (PCLK1 = system clock / 2, see
+    RFID_USART_BRR() of RFIDmain.c).
+
+***************************************************************************************************/
+STATIC UINT32 BaudGet( void )
+{
+  UINT32 u32_brr = USART3->BRR;
+
+  return ( u32_brr != 0u ) ? ( (UINT32)GLOBDEF_SYSTEM_CLOCK / ( 2u * u32_brr ) ) : 0u;
+}
+
+/***************************************************************************************************
+  Function:
+    BenchCheck
+
+  Description:
+    This function evaluates the published S2L ID at the end of each scheduler cycle: time to
+    the first valid ID, interruptions of the publication while the tag is present, time to the
+    withdrawal, wrong IDs, failure count and state changes.
+
+***************************************************************************************************/
+STATIC void BenchCheck( CONST UINT32 u32_now )
+{
+  UINT32 u32_info = RFID_InfoGet();
+  TAG_STRUCT* ps_tag = ( u32_TagCnt != 0u ) ? &as_Tag[u32_TagCnt - 1u] : NULL_PNT;
+  UINT32 u32_drop;
+
+  u32_Published = u32_info;
+
+  if ( u32_info != 0u )
+  {
+    /* after a removal the ID remains published until the reader reports no tag (withdrawal
+    ** time), but it must not be published again */
+    if ( ( ps_tag == NULL_PNT ) || ( u32_info != ps_tag->u32_info ) || ps_tag->b_withdrawn )
+    {
+      u32_WrongIdCnt++;
+      (void)printf( "%10.3f ms  ERROR: S2L ID 0x%08X published, tag %s\n", u32_now / 1000.0,
+                    (unsigned)u32_info, b_TagPresent ? "differs" : "not present" );
+    }
+    else if ( ps_tag->u32_dropStart != 0u )
+    {
+      /* published again after a failure */
+      u32_drop = u32_now - ps_tag->u32_dropStart;
+      ps_tag->u32_dropStart = 0u;
+      ps_tag->u32_dropMax = ( u32_drop > ps_tag->u32_dropMax ) ? u32_drop : ps_tag->u32_dropMax;
+      if ( !b_Quiet )
+      {
+        (void)printf( "%10.3f ms  S2L ID 0x%08X published again after %.3f ms\n",
+                      u32_now / 1000.0, (unsigned)u32_info, u32_drop / 1000.0 );
+      }
+    }
+    else if ( !ps_tag->b_valid )
+    {
+      ps_tag->b_valid = TRUE;
+      ps_tag->u32_valid = u32_now;
+      if ( !b_Quiet )
+      {
+        (void)printf( "%10.3f ms  S2L ID 0x%08X published, %.3f ms after the arrival\n",
+                      u32_now / 1000.0, (unsigned)u32_info,
+                      ( u32_now - ps_tag->u32_arrive ) / 1000.0 );
+      }
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  else if ( ( ps_tag != NULL_PNT ) && ( ps_tag->u32_remove != 0u ) && !ps_tag->b_withdrawn )
+  {
+    ps_tag->b_withdrawn = TRUE;
+    ps_tag->u32_withdraw = u32_now;
+    if ( !b_Quiet )
+    {
+      (void)printf( "%10.3f ms  S2L ID withdrawn, %.3f ms after the removal\n", u32_now / 1000.0,
+                    ( u32_now - ps_tag->u32_remove ) / 1000.0 );
+    }
+  }
+  else if ( ( ps_tag != NULL_PNT ) && b_TagPresent && ps_tag->b_valid &&
+            ( ps_tag->u32_dropStart == 0u ) )
+  {
+    /* publication interrupted while the tag is present */
+    ps_tag->u32_dropStart = u32_now;
+    ps_tag->u32_dropCnt++;
+    if ( !b_Quiet )
+    {
+      (void)printf( "%10.3f ms  S2L ID withdrawn while the tag is present\n", u32_now / 1000.0 );
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( u8_rfidFailureCount != u8_FailCntLast )
+  {
+    u8_FailCntLast = u8_rfidFailureCount;
+    (void)printf( "%10.3f ms  failure count %u, last failure %s\n", u32_now / 1000.0,
+                  (unsigned)u8_rfidFailureCount,
+                  ( (UINT32)e_rfidLastFailure < RFID_FAIL_CNT ) ? apc_FailName[e_rfidLastFailure]
+                                                                 : "?" );
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( e_rfidAccessState == RFID_FAIL_SAFE ) && ( e_StateLast != RFID_FAIL_SAFE ) )
+  {
+    (void)printf( "%10.3f ms  state machine in RFID_FAIL_SAFE\n", u32_now / 1000.0 );
+  }
+  else
+  {
+    /* empty branch */
+  }
+  e_StateLast = e_rfidAccessState;
+}
+
+/***************************************************************************************************
+  Function:
+    BenchReport
+
+  Description:
+    This function prints the benchmark report.
+
+***************************************************************************************************/
+STATIC void BenchReport( CONST UINT32 u32_now )
+{
+  UINT16 au16_bucket[RFID_HIST_BUCKET_CNT];
+  UINT16 au16_fail[RFID_FAIL_CNT];
+  UINT32 u32_cycles = 0u;
+  UINT32 i;
+  UINT32 j;
+
+  (void)printf( "\n== benchmark after %.3f ms\n", u32_now / 1000.0 );
+  (void)printf( "time to first valid ID / to withdrawal per tag:\n" );
+  for ( i = 0u; i < u32_TagCnt; i++ )
+  {
+    (void)printf( "  tag %u S2L ID 0x%08X arrival %.3f ms: ", (unsigned)i,
+                  (unsigned)as_Tag[i].u32_info, as_Tag[i].u32_arrive / 1000.0 );
+    if ( as_Tag[i].b_valid )
+    {
+      (void)printf( "valid after %.3f ms", ( as_Tag[i].u32_valid - as_Tag[i].u32_arrive ) / 1000.0 );
+    }
+    else
+    {
+      (void)printf( "never valid" );
+    }
+    if ( as_Tag[i].u32_dropCnt != 0u )
+    {
+      (void)printf( ", %u interruptions (longest %.3f ms)", (unsigned)as_Tag[i].u32_dropCnt,
+                    as_Tag[i].u32_dropMax / 1000.0 );
+    }
+    else
+    {
+      /* empty branch */
+    }
+    if ( as_Tag[i].b_withdrawn )
+    {
+      (void)printf( ", withdrawn %.3f ms after the removal",
+                    ( as_Tag[i].u32_withdraw - as_Tag[i].u32_remove ) / 1000.0 );
+    }
+    else
+    {
+      /* empty branch */
+    }
+    (void)printf( "\n" );
+  }
+
+  for ( i = 0u; i <= (UINT32)RFID_FAIL_SAFE; i++ )
+  {
+    u32_cycles += au32_rfidStateCycles[i];
+  }
+  (void)printf( "RFID_ReadTag() cycles per state (%u cycles):\n", (unsigned)u32_cycles );
+  for ( i = 0u; i <= (UINT32)RFID_FAIL_SAFE; i++ )
+  {
+    if ( au32_rfidStateCycles[i] != 0u )
+    {
+      (void)printf( "  %-18s %8u  %5.1f%%\n", apc_StateName[i], (unsigned)au32_rfidStateCycles[i],
+                    ( 100.0 * au32_rfidStateCycles[i] ) / u32_cycles );
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+
+  (void)printf( "failure count %u, last failure %s, final state %s\n",
+                (unsigned)u8_rfidFailureCount, apc_FailName[e_rfidLastFailure],
+                apc_StateName[e_rfidAccessState] );
+  (void)RFID_DiagFailCntGet( 0u, au16_fail, (UINT8)RFID_FAIL_CNT );
+  for ( i = 0u; i < RFID_FAIL_CNT; i++ )
+  {
+    if ( au16_fail[i] != 0u )
+    {
+      (void)printf( "  %-22s %5u\n", apc_FailName[i], (unsigned)au16_fail[i] );
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+
+  (void)printf( "latency histograms (bucket n: < 2^n ms, last: >= 256 ms):\n" );
+  for ( i = 0u; i < RFID_HIST_CNT; i++ )
+  {
+    RFID_DiagHistGet( (t_RFID_HIST)i, au16_bucket );
+    (void)printf( "  %-11s", apc_HistName[i] );
+    for ( j = 0u; j < RFID_HIST_BUCKET_CNT; j++ )
+    {
+      (void)printf( " %5u", (unsigned)au16_bucket[j] );
+    }
+    (void)printf( "\n" );
+  }
+
+  (void)printf( "reader: %u commands since power on, baud %u; controller 2: %u digests confirmed, "
+                "%u rejected\n", (unsigned)rfidSimREADER_CmdCntGet(),
+                (unsigned)rfidSimREADER_BaudGet(), (unsigned)u32_C2Confirmed,
+                (unsigned)u32_C2Rejected );
+  (void)printf( "result: %s (%u wrong IDs, %u failed expectations)\n",
+                ( ( u32_WrongIdCnt == 0u ) && ( u32_ExpectFailCnt == 0u ) ) ? "PASS" : "FAIL",
+                (unsigned)u32_WrongIdCnt, (unsigned)u32_ExpectFailCnt );
+}
+
+/***************************************************************************************************
+  Function:
+    EventRun
+
+  Description:
+    This function executes an event of the scenario.
+
+***************************************************************************************************/
+STATIC void EventRun( CONST EVENT_STRUCT* ps_evt, CONST UINT32 u32_now )
+{
+  TAG_STRUCT* ps_tag = ( u32_TagCnt != 0u ) ? &as_Tag[u32_TagCnt - 1u] : NULL_PNT;
+  BOOL b_ok = TRUE;
+  UINT32 i;
+
+  switch ( ps_evt->e_evt )
+  {
+    case EVT_POWER_ON:
+      rfidSimREADER_PowerOn( hostHAL_TimeGet() );
+      break;
+    case EVT_TAG_ARRIVE:
+      rfidSimREADER_TagArrive( ps_evt->au8_uid, ps_evt->au8_s2l );
+      (void)memcpy( au8_C2S2l, ps_evt->au8_s2l, RFID_S2L_ID_LEN );
+      if ( u32_TagCnt < k_TAG_MAX )
+      {
+        ps_tag = &as_Tag[u32_TagCnt];
+        u32_TagCnt++;
+        (void)memset( ps_tag, 0, sizeof( *ps_tag ) );
+        ps_tag->u32_arrive = u32_now;
+        for ( i = 0u; i < RFID_S2L_ID_LEN; i++ )
+        {
+          /* same byte order as RFID_CheckTagRecordFields() */
+          ps_tag->u32_info |= (UINT32)ps_evt->au8_s2l[i] << ( 8u * i );
+        }
+      }
+      else
+      {
+        /* empty branch */
+      }
+      b_TagPresent = TRUE;
+      break;
+    case EVT_TAG_REMOVE:
+      rfidSimREADER_TagRemove();
+      if ( ps_tag != NULL_PNT )
+      {
+        ps_tag->u32_remove = u32_now;
+        /* not published at the removal (e.g. after a failure): withdrawal time 0 */
+        ps_tag->b_withdrawn = ( u32_Published == 0u ) ? TRUE : FALSE;
+        ps_tag->u32_withdraw = u32_now;
+      }
+      else
+      {
+        /* empty branch */
+      }
+      b_TagPresent = FALSE;
+      break;
+    case EVT_CORRUPT_CHCK:
+      rfidSimREADER_FaultSet( RFIDSIMREADER_FAULT_CHCK, ps_evt->u32_arg1 );
+      break;
+    case EVT_TIMEOUT:
+      rfidSimREADER_FaultSet( RFIDSIMREADER_FAULT_TIMEOUT, ps_evt->u32_arg1 );
+      break;
+    case EVT_WRONG_SEQ:
+      rfidSimREADER_TagSeqSet( (UINT8)ps_evt->u32_arg1, (UINT8)ps_evt->u32_arg2,
+                               ( ps_evt->au8_uid[0] == 0u ) ? TRUE : FALSE );
+      break;
+    case EVT_DIGEST_REJECT:
+      u32_C2RejectCnt = ps_evt->u32_arg1;
+      break;
+    case EVT_EXPECT_ID:
+      b_ok = ( ( ps_tag != NULL_PNT ) && ( u32_Published == ps_tag->u32_info ) ) ? TRUE : FALSE;
+      break;
+    case EVT_EXPECT_NO_ID:
+      b_ok = ( u32_Published == 0u ) ? TRUE : FALSE;
+      break;
+    case EVT_EXPECT_FAIL_SAFE:
+      b_ok = ( e_rfidAccessState == RFID_FAIL_SAFE ) ? TRUE : FALSE;
+      break;
+    case EVT_EXPECT_FAILURES:
+      b_ok = ( (UINT32)u8_rfidFailureCount == ps_evt->u32_arg1 ) ? TRUE : FALSE;
+      break;
+    case EVT_EXPECT_VALID_WITHIN:
+      b_ok = ( ( ps_tag != NULL_PNT ) && ps_tag->b_valid &&
+               ( ( ps_tag->u32_valid - ps_tag->u32_arrive ) <= ps_evt->u32_arg1 ) ) ? TRUE : FALSE;
+      break;
+    case EVT_END:
+    default:
+      b_End = TRUE;
+      break;
+  }
+
+  if ( !b_ok )
+  {
+    u32_ExpectFailCnt++;
+    (void)printf( "%10.3f ms  EXPECTATION FAILED (scenario line %u)\n", u32_now / 1000.0,
+                  (unsigned)ps_evt->u32_line );
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    HexParse
+
+  Description:
+    This function converts a string of hex digits into bytes (MSB first).
+
+***************************************************************************************************/
+STATIC BOOL HexParse( CONST char* pc_hex, UINT8* pau8_out, CONST UINT32 u32_len )
+{
+  char ac_byte[3] = { 0, 0, 0 };
+  char* pc_end;
+  BOOL b_ok = ( pc_hex != NULL ) ? TRUE : FALSE;
+  UINT32 i;
+
+  for ( i = 0u; b_ok && ( i < u32_len ); i++ )
+  {
+    ac_byte[0] = pc_hex[2u * i];
+    ac_byte[1] = ( ac_byte[0] != '\0' ) ? pc_hex[( 2u * i ) + 1u] : '\0';
+    pau8_out[i] = (UINT8)strtoul( ac_byte, &pc_end, 16 );
+    b_ok = ( ( ac_byte[1] != '\0' ) && ( *pc_end == '\0' ) ) ? TRUE : FALSE;
+  }
+  return b_ok;
+}
+
+/***************************************************************************************************
+  Function:
+    KeyGet
+
+  Description:
+    This function returns the value of "key=value" in the arguments of an event, NULL if the
+    key is not found.
+
+***************************************************************************************************/
+STATIC CONST char* KeyGet( CONST char* pc_args, CONST char* pc_key )
+{
+  CONST char* pc_pos = pc_args;
+  CONST char* pc_val = NULL;
+  size_t t_len = strlen( pc_key );
+
+  while ( ( pc_val == NULL ) && ( ( pc_pos = strstr( pc_pos, pc_key ) ) != NULL ) )
+  {
+    if ( ( ( pc_pos == pc_args ) || ( pc_pos[-1] == ' ' ) ) && ( pc_pos[t_len] == '=' ) )
+    {
+      pc_val = &pc_pos[t_len + 1u];
+    }
+    else
+    {
+      pc_pos++;
+    }
+  }
+  return pc_val;
+}
+
+/***************************************************************************************************
+  Function:
+    LineStep
+
+  Description:
+    This function simulates one usec of the serial line between USART3 and the reader:
+      - Tx DMA channel 2: a transfer is started by enabling the channel with a new CNDTR, the
+        bytes are sent with the baud rate of USART3 and CNDTR counts down
+      - Rx DMA channel 3: the bytes of the reader are written at RING_SIZE - CNDTR, CNDTR is
+        reloaded in circular mode. A byte with another baud rate is lost (framing error).
+      - IDLE line: one byte time after the last received byte USART_SR_IDLE is set and
+        USART3_IRQHandler() is called as soon as the interrupt is enabled
+
+***************************************************************************************************/
+STATIC void LineStep( CONST UINT32 u32_now )
+{
+  DMA_Channel_TypeDef* ps_tx = DMA1_Channel2;
+  DMA_Channel_TypeDef* ps_rx = DMA1_Channel3;
+  UINT32 u32_baud = BaudGet();
+  UINT32 u32_readerBaud;
+  UINT32 u32_diff;
+  UINT8 u8_byte;
+
+  if ( ( u32_baud != 0u ) && ( ( USART3->CR1 & USART_CR1_UE ) != 0u ) )
+  {
+    /* transmission */
+    if ( ( ( ps_tx->CCR & DMA_CCR1_EN ) != 0u ) && ( ps_tx->CNDTR != 0u ) )
+    {
+      if ( !b_TxActive || ( ps_tx->CNDTR != u32_TxCnt ) )
+      {
+        /* new transfer, RFID_FrameTxTrigger() */
+        b_TxActive = TRUE;
+        u32_TxLen = ps_tx->CNDTR;
+        u32_TxCnt = ps_tx->CNDTR;
+        u32_TxByteEnd = u32_now + RFIDSIMREADER_BYTE_US( u32_baud );
+      }
+      else if ( u32_now >= u32_TxByteEnd )
+      {
+        u8_byte = au8_rfidDmaBufferTx[u32_TxLen - u32_TxCnt];
+        u32_TxCnt--;
+        ps_tx->CNDTR = u32_TxCnt;
+        rfidSimREADER_RxByte( hostHAL_TimeGet(), u8_byte, u32_baud );
+        u32_TxByteEnd = u32_now + RFIDSIMREADER_BYTE_US( u32_baud );
+        b_TxActive = ( u32_TxCnt != 0u ) ? TRUE : FALSE;
+      }
+      else
+      {
+        /* empty branch, byte in progress */
+      }
+    }
+    else
+    {
+      b_TxActive = FALSE;
+    }
+
+    /* reception */
+    while ( rfidSimREADER_TxByte( hostHAL_TimeGet(), &u8_byte, &u32_readerBaud ) )
+    {
+      u32_diff = ( u32_baud > u32_readerBaud ) ? ( u32_baud - u32_readerBaud )
+                                               : ( u32_readerBaud - u32_baud );
+      if ( ( ( u32_diff * 1000u ) <= ( u32_readerBaud * 30u ) ) &&
+           ( ( ps_rx->CCR & DMA_CCR1_EN ) != 0u ) && ( ps_rx->CNDTR != 0u ) )
+      {
+        au8_rfidDmaBufferRx[k_RX_RING_SIZE - ps_rx->CNDTR] = u8_byte;
+        ps_rx->CNDTR = ( ps_rx->CNDTR > 1u ) ? ( ps_rx->CNDTR - 1u ) : k_RX_RING_SIZE;
+      }
+      else
+      {
+        /* empty branch, framing error */
+      }
+      b_RxIdlePending = TRUE;
+      u32_RxLast = u32_now;
+    }
+  }
+  else
+  {
+    /* empty branch, USART disabled (e.g. baud rate change) */
+  }
+
+  if ( b_RxIdlePending && ( u32_baud != 0u ) &&
+       ( ( u32_now - u32_RxLast ) >= RFIDSIMREADER_BYTE_US( u32_baud ) ) )
+  {
+    b_RxIdlePending = FALSE;
+    USART3->SR |= USART_SR_IDLE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( ( USART3->SR & USART_SR_IDLE ) != 0u ) && ( ( USART3->CR1 & USART_CR1_IDLEIE ) != 0u ) &&
+       hostHAL_IrqEnabled( (INT32)USART3_IRQn ) )
+  {
+    USART3_IRQHandler();
+    /* cleared by reading SR and DR */
+    USART3->SR &= ~USART_SR_IDLE;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    ScenarioLoad
+
+  Description:
+    This function reads the scenario script. The events must be sorted by time.
+
+***************************************************************************************************/
+STATIC BOOL ScenarioLoad( CONST char* pc_file )
+{
+  static CONST struct
+  {
+    CONST char* pc_name;
+    EVT_ENUM e_evt;
+  } as_name[] =
+  {
+    { "power_on", EVT_POWER_ON }, { "tag_arrive", EVT_TAG_ARRIVE },
+    { "tag_remove", EVT_TAG_REMOVE }, { "corrupt_chck", EVT_CORRUPT_CHCK },
+    { "timeout", EVT_TIMEOUT }, { "wrong_seq", EVT_WRONG_SEQ },
+    { "digest_reject", EVT_DIGEST_REJECT }, { "expect_id", EVT_EXPECT_ID },
+    { "expect_no_id", EVT_EXPECT_NO_ID }, { "expect_fail_safe", EVT_EXPECT_FAIL_SAFE },
+    { "expect_failures", EVT_EXPECT_FAILURES },
+    { "expect_valid_within", EVT_EXPECT_VALID_WITHIN }, { "end", EVT_END }
+  };
+  static CONST struct
+  {
+    CONST char* pc_name;
+    UINT32* pu32_val;
+  } as_param[] =
+  {
+    { "ve_us", &s_ReaderCfg.u32_veUs }, { "br_us", &s_ReaderCfg.u32_brUs },
+    { "sf_us", &s_ReaderCfg.u32_sfUs }, { "sr_us", &s_ReaderCfg.u32_srUs },
+    { "sr_word_us", &s_ReaderCfg.u32_srWordUs }, { "boot_us", &s_ReaderCfg.u32_bootUs }
+  };
+  char ac_line[k_LINE_MAX];
+  char ac_evt[32];
+  char* pc_args;
+  CONST char* pc_val;
+  EVENT_STRUCT* ps_evt;
+  FILE* ps_file = fopen( pc_file, "r" );
+  BOOL b_ok = ( ps_file != NULL ) ? TRUE : FALSE;
+  UINT32 u32_line = 0u;
+  double d_ms;
+  int i_pos;
+  UINT32 i;
+
+  while ( b_ok && ( fgets( ac_line, (int)sizeof( ac_line ), ps_file ) != NULL ) )
+  {
+    u32_line++;
+    pc_args = strchr( ac_line, '#' );
+    if ( pc_args != NULL )
+    {
+      *pc_args = '\0';
+    }
+    else
+    {
+      /* empty branch */
+    }
+    ac_line[strcspn( ac_line, "\r\n" )] = '\0';
+
+    if ( sscanf( ac_line, " set %31[a-z_]=%n", ac_evt, &i_pos ) == 1 )
+    {
+      b_ok = FALSE;
+      for ( i = 0u; i < ( sizeof( as_param ) / sizeof( as_param[0] ) ); i++ )
+      {
+        if ( strcmp( ac_evt, as_param[i].pc_name ) == 0 )
+        {
+          *as_param[i].pu32_val = (UINT32)strtoul( &ac_line[i_pos], NULL, 0 );
+          b_ok = TRUE;
+        }
+        else
+        {
+          /* empty branch */
+        }
+      }
+    }
+    else if ( sscanf( ac_line, " %lf %31s %n", &d_ms, ac_evt, &i_pos ) >= 2 )
+    {
+      b_ok = ( u32_EventCnt < k_EVENT_MAX ) ? TRUE : FALSE;
+      ps_evt = &as_Event[u32_EventCnt];
+      (void)memset( ps_evt, 0, sizeof( *ps_evt ) );
+      ps_evt->u32_time = (UINT32)( ( d_ms * 1000.0 ) + 0.5 );
+      ps_evt->u32_line = u32_line;
+      ps_evt->u32_arg1 = 1u;
+      pc_args = &ac_line[i_pos];
+      if ( b_ok && ( u32_EventCnt != 0u ) && ( ps_evt->u32_time < as_Event[u32_EventCnt - 1u].u32_time ) )
+      {
+        b_ok = FALSE;
+      }
+      else
+      {
+        b_ok = FALSE;
+        for ( i = 0u; i < ( sizeof( as_name ) / sizeof( as_name[0] ) ); i++ )
+        {
+          if ( strcmp( ac_evt, as_name[i].pc_name ) == 0 )
+          {
+            ps_evt->e_evt = as_name[i].e_evt;
+            b_ok = TRUE;
+          }
+          else
+          {
+            /* empty branch */
+          }
+        }
+      }
+
+      if ( b_ok && ( ps_evt->e_evt == EVT_TAG_ARRIVE ) )
+      {
+        b_ok = ( HexParse( KeyGet( pc_args, "uid" ), ps_evt->au8_uid, RFID_UID_LEN ) &&
+                 HexParse( KeyGet( pc_args, "s2l" ), ps_evt->au8_s2l, RFID_S2L_ID_LEN ) )
+               ? TRUE : FALSE;
+      }
+      else if ( b_ok && ( ps_evt->e_evt == EVT_WRONG_SEQ ) )
+      {
+        pc_val = KeyGet( pc_args, "crc" );
+        /* au8_uid[0] marks crc=keep */
+        ps_evt->au8_uid[0] = ( ( pc_val != NULL ) && ( strncmp( pc_val, "keep", 4u ) == 0 ) ) ? 1u : 0u;
+        b_ok = ( ( KeyGet( pc_args, "rec" ) != NULL ) && ( KeyGet( pc_args, "seq" ) != NULL ) )
+               ? TRUE : FALSE;
+        if ( b_ok )
+        {
+          ps_evt->u32_arg1 = (UINT32)strtoul( KeyGet( pc_args, "rec" ), NULL, 0 );
+          ps_evt->u32_arg2 = (UINT32)strtoul( KeyGet( pc_args, "seq" ), NULL, 0 );
+        }
+        else
+        {
+          /* empty branch */
+        }
+      }
+      else if ( b_ok && ( ps_evt->e_evt == EVT_EXPECT_VALID_WITHIN ) )
+      {
+        pc_val = KeyGet( pc_args, "ms" );
+        b_ok = ( pc_val != NULL ) ? TRUE : FALSE;
+        ps_evt->u32_arg1 = b_ok ? (UINT32)( ( strtod( pc_val, NULL ) * 1000.0 ) + 0.5 ) : 0u;
+      }
+      else if ( b_ok && ( KeyGet( pc_args, "n" ) != NULL ) )
+      {
+        ps_evt->u32_arg1 = (UINT32)strtoul( KeyGet( pc_args, "n" ), NULL, 0 );
+      }
+      else
+      {
+        /* empty branch */
+      }
+      u32_EventCnt++;
+    }
+    else
+    {
+      /* empty line or comment, anything else is an error */
+      b_ok = ( strspn( ac_line, " \t" ) == strlen( ac_line ) ) ? TRUE : FALSE;
+    }
+  }
+
+  if ( ps_file == NULL )
+  {
+    (void)fprintf( stderr, "%s: cannot open\n", pc_file );
+  }
+  else
+  {
+    if ( !b_ok )
+    {
+      (void)fprintf( stderr, "%s:%u: invalid line\n", pc_file, (unsigned)u32_line );
+    }
+    else if ( ( u32_EventCnt == 0u ) || ( as_Event[u32_EventCnt - 1u].e_evt != EVT_END ) )
+    {
+      (void)fprintf( stderr, "%s: no end event\n", pc_file );
+      b_ok = FALSE;
+    }
+    else
+    {
+      /* empty branch */
+    }
+    (void)fclose( ps_file );
+  }
+  return b_ok;
+}
+
+/***************************************************************************************************
+  Function:
+    SliceRun
+
+  Description:
+    This function runs the RFID tasks of a time slice: RFID_ReadTag() in its slice, the IO
+    telegram (gpio_SendIOvaluesViaIPC() every 4th slice, received by gpio_GetIOvaluesFromIPC()
+    in the next slice) and the digest exchange. The startup calls RFID_Reader_Boot() in the
+    same slice, RFID_ReadTag() continues the boot sequence, so RFID_ReadTag() is called from the
+    start.
+
+***************************************************************************************************/
+STATIC void SliceRun( CONST UINT32 u32_slice )
+{
+  static UINT8 u8_cnt = 0u;
+
+  if ( u32_slice == u32_SliceReadTag )
+  {
+    RFID_ReadTag();
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( ( u32_slice % k_IO_PERIOD ) == 0u )
+  {
+    /* IO telegram sent by both controllers: digest counter of controller 1, verdict of
+    ** controller 2 */
+    u8_cnt = RFID_DigestCntGet();
+    u8_C2AckTx = u8_C2Ack;
+  }
+  else if ( ( u32_slice % k_IO_PERIOD ) == 1u )
+  {
+    /* IO telegram received by both controllers */
+    u8_C2DigestCnt = u8_cnt;
+    RFID_DigestAckSet( u8_C2AckTx );
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  if ( u32_slice == u32_SliceDigest )
+  {
+    RFID_DigestSend();
+  }
+  else if ( u32_slice == ( u32_SliceDigest + 1u ) )
+  {
+    RFID_DigestRecv();
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,727 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: rfidSimReader.c
+**     Summary: Model of the RFID reader and the tag of the host RFID simulator (see rfidSim.c).
+**              The reader receives the commands of RFIDmain.c byte by byte, answers them after
+**              a configurable processing time and sends the response byte by byte with its
+**              baud rate (see RFID Reader Manual tdoct3728d_ger.pdf):
+**                VE  Reader Version
+**                BR  Change Baud Rate, the reader switches after the response
+**                SF  Single Read Fix Code, UID of the tag or "no tag"
+**                SR  Single Read Words, words of the tag memory or "no tag"
+**              A command with a wrong checksum or an unknown command is answered with a syntax
+**              error. The tag memory is built like the firmware expects it, the R_CRC and the
+**              memory CRC are calculated bit by bit independently of RFIDcrc.c.
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: rfidSimREADER_Init
+**             rfidSimREADER_PowerOn
+**             rfidSimREADER_TagArrive
+**             rfidSimREADER_TagRemove
+**             rfidSimREADER_TagSeqSet
+**             rfidSimREADER_FaultSet
+**             rfidSimREADER_RxByte
+**             rfidSimREADER_TxByte
+**             rfidSimREADER_BaudGet
+**             rfidSimREADER_CmdCntGet
+**
+**             BaudMatch
+**             CmdLen
+**             CmdProcess
+**             Crc32
+**             HexGet
+**             ResBuild
+**             TagRecordBuild
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+
+/* Project header */
+#include "xtypes.h"
+#include "xdefs.h"
+
+#include "globDef_GlobalDefinitions.h"
+
+/* Module header */
+#include "RFID.h"
+#include "RFIDcrc.h"
+
+/* Header-file of module */
+#include "rfidSimReader.h"
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    static constants, types, macros, variables
+***************************************************************************************************/
+
+/* Baud rate after the power on and rate codes of the Change Baud Rate command */
+#define k_BOOT_BAUD              38400u
+#define k_BAUD_CODE_38400        0x33u
+#define k_BAUD_CODE_115200       0x35u
+
+/* Tolerance of the baud rates of controller and reader in 1/1000 */
+#define k_BAUD_TOL               30u
+
+/* Maximum length of a command and of a response */
+#define k_CMD_MAX                16u
+#define k_RES_MAX                ( 3u + RFID_MEM_TOTAL_LEN )
+
+/* Command lengths (incl. CHCK and ETX) */
+#define k_CMD_VE_LEN             4u
+#define k_CMD_BR_LEN             5u
+#define k_CMD_SF_LEN             4u
+#define k_CMD_SR_LEN             10u
+
+/* Length of the version string of the VE response (70 byte response) */
+#define k_VERSION_LEN            67u
+
+/* Bytes per word of the tag memory */
+#define k_WORD_LEN               4u
+
+STATIC RFIDSIMREADER_CFG_STRUCT s_Cfg;
+STATIC BOOL b_Powered = FALSE;
+STATIC UINT32 u32_Baud = k_BOOT_BAUD;
+STATIC UINT32 u32_CmdCnt = 0u;
+
+/* Command received so far */
+STATIC UINT8 au8_Cmd[k_CMD_MAX];
+STATIC UINT8 u8_CmdLen = 0u;
+
+/* Response: bytes, number of bytes already sent, start time of the first byte, baud rate, baud
+** rate after the response (0: unchanged) */
+STATIC UINT8 au8_Res[k_RES_MAX];
+STATIC UINT16 u16_ResLen = 0u;
+STATIC UINT16 u16_ResPos = 0u;
+STATIC UINT32 u32_ResStart = 0u;
+STATIC UINT32 u32_ResBaud = k_BOOT_BAUD;
+STATIC UINT32 u32_ResBaudNext = 0u;
+
+/* Tag */
+STATIC BOOL b_TagPresent = FALSE;
+STATIC UINT8 au8_TagUid[RFID_UID_LEN];
+STATIC UINT8 au8_TagMem[RFID_MEM_TOTAL_LEN];
+
+/* Remaining number of responses affected by the faults */
+STATIC UINT32 au32_Fault[RFIDSIMREADER_FAULT_CNT];
+
+/* Version string of the VE response */
+STATIC CONST char ac_Version[] = "T100 RFID HOST SIMULATION READER V1.00";
+
+/***************************************************************************************************
+**    static function-prototypes
+***************************************************************************************************/
+STATIC BOOL BaudMatch( CONST UINT32 u32_baud );
+STATIC UINT8 CmdLen( void );
+STATIC void CmdProcess( CONST UINT32 u32_time );
+STATIC UINT32 Crc32( CONST UINT8* pau8_data, CONST UINT8 u8_len );
+STATIC UINT32 HexGet( CONST UINT8* pau8_hex, CONST UINT8 u8_digits, BOOL* pb_ok );
+STATIC void ResBuild( CONST UINT8 u8_status, CONST UINT8* pau8_data, CONST UINT16 u16_len,
+                      CONST UINT32 u32_start );
+STATIC void TagRecordBuild( CONST UINT8 u8_rec, CONST UINT8 u8_seq );
+
+/***************************************************************************************************
+**    global functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_Init
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_Init( CONST RFIDSIMREADER_CFG_STRUCT* ps_cfg )
+{
+  UINT8 i;
+
+  s_Cfg = *ps_cfg;
+  b_Powered = FALSE;
+  b_TagPresent = FALSE;
+  u32_Baud = k_BOOT_BAUD;
+  u8_CmdLen = 0u;
+  u16_ResLen = 0u;
+  u16_ResPos = 0u;
+  u32_ResBaudNext = 0u;
+  u32_CmdCnt = 0u;
+  for ( i = 0u; i < (UINT8)RFIDSIMREADER_FAULT_CNT; i++ )
+  {
+    au32_Fault[i] = 0u;
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_PowerOn
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_PowerOn( CONST UINT32 u32_time )
+{
+  b_Powered = TRUE;
+  u32_Baud = k_BOOT_BAUD;
+  u8_CmdLen = 0u;
+  u32_CmdCnt = 0u;
+  u32_ResBaudNext = 0u;
+  /* power on notification, status without data */
+  ResBuild( RFID_PWR_ON_NOTIFICATION, NULL_PNT, 0u, u32_time + s_Cfg.u32_bootUs );
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagArrive
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_TagArrive( CONST UINT8* pau8_uid, CONST UINT8* pau8_s2l )
+{
+  UINT32 u32_crc;
+  UINT8 u8_rec;
+  UINT8 i;
+
+  for ( i = 0u; i < RFID_UID_LEN; i++ )
+  {
+    au8_TagUid[i] = pau8_uid[i];
+  }
+
+  for ( u8_rec = 0u; u8_rec < RFID_REC_COUNT; u8_rec++ )
+  {
+    for ( i = 0u; i < RFID_S2L_ID_LEN; i++ )
+    {
+      /* even records: S2L ID, odd records: complement of the S2L ID */
+      au8_TagMem[( u8_rec * RFID_REC_TOTAL_LEN ) + RFID_REC_IDX_S2L_ID + i] =
+        ( ( u8_rec & 1u ) == 0u ) ? pau8_s2l[i] : (UINT8)( ~pau8_s2l[i] );
+    }
+    TagRecordBuild( u8_rec, u8_rec );
+  }
+
+  u32_crc = Crc32( au8_TagMem, (UINT8)( RFID_REC_COUNT * RFID_REC_TOTAL_LEN ) );
+  for ( i = 0u; i < RFID_MEM_CRC_LEN; i++ )
+  {
+    au8_TagMem[( RFID_REC_COUNT * RFID_REC_TOTAL_LEN ) + i] = (UINT8)( u32_crc >> ( 24u - ( 8u * i ) ) );
+  }
+  b_TagPresent = TRUE;
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagRemove
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_TagRemove( void )
+{
+  b_TagPresent = FALSE;
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagSeqSet
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_TagSeqSet( CONST UINT8 u8_rec, CONST UINT8 u8_seq, CONST BOOL b_crcFix )
+{
+  UINT32 u32_crc;
+  UINT8 i;
+
+  if ( u8_rec < RFID_REC_COUNT )
+  {
+    if ( b_crcFix )
+    {
+      TagRecordBuild( u8_rec, u8_seq );
+      u32_crc = Crc32( au8_TagMem, (UINT8)( RFID_REC_COUNT * RFID_REC_TOTAL_LEN ) );
+      for ( i = 0u; i < RFID_MEM_CRC_LEN; i++ )
+      {
+        au8_TagMem[( RFID_REC_COUNT * RFID_REC_TOTAL_LEN ) + i] =
+          (UINT8)( u32_crc >> ( 24u - ( 8u * i ) ) );
+      }
+    }
+    else
+    {
+      au8_TagMem[( u8_rec * RFID_REC_TOTAL_LEN ) + RFID_REC_IDX_SEQ] = u8_seq;
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_FaultSet
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_FaultSet( CONST RFIDSIMREADER_FAULT_ENUM e_fault, CONST UINT32 u32_cnt )
+{
+  if ( e_fault < RFIDSIMREADER_FAULT_CNT )
+  {
+    au32_Fault[e_fault] = u32_cnt;
+  }
+  else
+  {
+    /* empty branch */
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_RxByte
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+void rfidSimREADER_RxByte( CONST UINT32 u32_time, CONST UINT8 u8_byte, CONST UINT32 u32_baud )
+{
+  UINT8 u8_len;
+
+  if ( !b_Powered )
+  {
+    /* empty branch, the reader boots */
+  }
+  else if ( !BaudMatch( u32_baud ) )
+  {
+    /* framing error, the command is lost */
+    u8_CmdLen = 0u;
+  }
+  else
+  {
+    au8_Cmd[u8_CmdLen] = u8_byte;
+    u8_CmdLen++;
+    u8_len = CmdLen();
+
+    if ( ( u8_CmdLen == u8_len ) ||
+         ( ( u8_len == 0u ) && ( ( u8_byte == RFID_ETX ) || ( u8_CmdLen == k_CMD_MAX ) ) ) )
+    {
+      u32_CmdCnt++;
+      CmdProcess( u32_time );
+      u8_CmdLen = 0u;
+    }
+    else
+    {
+      /* empty branch, command not complete */
+    }
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TxByte
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+BOOL rfidSimREADER_TxByte( CONST UINT32 u32_time, UINT8* pu8_byte, UINT32* pu32_baud )
+{
+  BOOL b_sent = FALSE;
+  UINT32 u32_end;
+
+  if ( u16_ResPos < u16_ResLen )
+  {
+    u32_end = u32_ResStart + ( ( (UINT32)u16_ResPos + 1u ) * RFIDSIMREADER_BYTE_US( u32_ResBaud ) );
+    if ( (INT32)( u32_time - u32_end ) >= 0 )
+    {
+      *pu8_byte = au8_Res[u16_ResPos];
+      *pu32_baud = u32_ResBaud;
+      u16_ResPos++;
+      b_sent = TRUE;
+
+      if ( ( u16_ResPos == u16_ResLen ) && ( u32_ResBaudNext != 0u ) )
+      {
+        /* Change Baud Rate: the response is sent with the old baud rate */
+        u32_Baud = u32_ResBaudNext;
+        u32_ResBaudNext = 0u;
+      }
+      else
+      {
+        /* empty branch */
+      }
+    }
+    else
+    {
+      /* empty branch */
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return b_sent;
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_BaudGet
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+UINT32 rfidSimREADER_BaudGet( void )
+{
+  return u32_Baud;
+}
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_CmdCntGet
+
+  Description:
+    see rfidSimReader.h
+
+***************************************************************************************************/
+UINT32 rfidSimREADER_CmdCntGet( void )
+{
+  return u32_CmdCnt;
+}
+
+/***************************************************************************************************
+**    static functions
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    BaudMatch
+
+  Description:
+    This function checks whether the baud rate of the controller matches the one of the reader
+    (tolerance k_BAUD_TOL).
+
+  Parameters:
+    u32_baud (IN) - baud rate of the controller
+
+  Return value:
+    TRUE  - baud rates match
+    FALSE - framing error
+
+***************************************************************************************************/
+STATIC BOOL BaudMatch( CONST UINT32 u32_baud )
+{
+  UINT32 u32_diff = ( u32_baud > u32_Baud ) ? ( u32_baud - u32_Baud ) : ( u32_Baud - u32_baud );
+
+  return ( ( u32_diff * 1000u ) <= ( u32_Baud * k_BAUD_TOL ) ) ? TRUE : FALSE;
+}
+
+/***************************************************************************************************
+  Function:
+    CmdLen
+
+  Description:
+    This function returns the length of the command received so far, identified by its first
+    two bytes.
+
+  Return value:
+    UINT8 - length incl. CHCK and ETX, 0 if not known (yet)
+
+***************************************************************************************************/
+STATIC UINT8 CmdLen( void )
+{
+  UINT8 u8_len = 0u;
+
+  if ( u8_CmdLen >= 2u )
+  {
+    if ( ( au8_Cmd[0] == (UINT8)'V' ) && ( au8_Cmd[1] == (UINT8)'E' ) )
+    {
+      u8_len = k_CMD_VE_LEN;
+    }
+    else if ( ( au8_Cmd[0] == (UINT8)'B' ) && ( au8_Cmd[1] == (UINT8)'R' ) )
+    {
+      u8_len = k_CMD_BR_LEN;
+    }
+    else if ( ( au8_Cmd[0] == (UINT8)'S' ) && ( au8_Cmd[1] == (UINT8)'F' ) )
+    {
+      u8_len = k_CMD_SF_LEN;
+    }
+    else if ( ( au8_Cmd[0] == (UINT8)'S' ) && ( au8_Cmd[1] == (UINT8)'R' ) )
+    {
+      u8_len = k_CMD_SR_LEN;
+    }
+    else
+    {
+      /* empty branch, unknown command */
+    }
+  }
+  else
+  {
+    /* empty branch */
+  }
+  return u8_len;
+}
+
+/***************************************************************************************************
+  Function:
+    CmdProcess
+
+  Description:
+    This function processes the received command and builds the response.
+
+  Parameters:
+    u32_time (IN) - time of the ETX of the command
+
+***************************************************************************************************/
+STATIC void CmdProcess( CONST UINT32 u32_time )
+{
+  UINT8 au8_data[k_VERSION_LEN];
+  UINT8 u8_chk = 0u;
+  UINT32 u32_addr;
+  UINT32 u32_cnt;
+  BOOL b_ok = TRUE;
+  UINT8 i;
+
+  for ( i = 0u; i < ( u8_CmdLen - 2u ); i++ )
+  {
+    u8_chk = (UINT8)( u8_chk + au8_Cmd[i] );
+  }
+
+  if ( au32_Fault[RFIDSIMREADER_FAULT_TIMEOUT] != 0u )
+  {
+    /* no response */
+    au32_Fault[RFIDSIMREADER_FAULT_TIMEOUT]--;
+  }
+  else if ( ( CmdLen() == 0u ) || ( au8_Cmd[u8_CmdLen - 1u] != RFID_ETX ) ||
+            ( au8_Cmd[u8_CmdLen - 2u] != u8_chk ) )
+  {
+    ResBuild( RFID_CMD_SYNTAX_ERROR, NULL_PNT, 0u, u32_time + s_Cfg.u32_veUs );
+  }
+  else if ( au8_Cmd[0] == (UINT8)'V' )
+  {
+    for ( i = 0u; i < k_VERSION_LEN; i++ )
+    {
+      au8_data[i] = ( i < ( sizeof( ac_Version ) - 1u ) ) ? (UINT8)ac_Version[i] : (UINT8)' ';
+    }
+    ResBuild( RFID_CMD_OK, au8_data, k_VERSION_LEN, u32_time + s_Cfg.u32_veUs );
+  }
+  else if ( au8_Cmd[0] == (UINT8)'B' )
+  {
+    if ( ( au8_Cmd[2] == k_BAUD_CODE_38400 ) || ( au8_Cmd[2] == k_BAUD_CODE_115200 ) )
+    {
+      ResBuild( RFID_CMD_OK, NULL_PNT, 0u, u32_time + s_Cfg.u32_brUs );
+      u32_ResBaudNext = ( au8_Cmd[2] == k_BAUD_CODE_115200 ) ? 115200u : 38400u;
+    }
+    else
+    {
+      ResBuild( RFID_CMD_SYNTAX_ERROR, NULL_PNT, 0u, u32_time + s_Cfg.u32_brUs );
+    }
+  }
+  else if ( !b_TagPresent )
+  {
+    ResBuild( RFID_NO_TAG, NULL_PNT, 0u, u32_time + s_Cfg.u32_sfUs );
+  }
+  else if ( au8_Cmd[1] == (UINT8)'F' )
+  {
+    ResBuild( RFID_CMD_OK, au8_TagUid, RFID_UID_LEN, u32_time + s_Cfg.u32_sfUs );
+  }
+  else
+  {
+    /* Single Read Words: 4 hex digits word address, 2 hex digits number of words */
+    u32_addr = HexGet( &au8_Cmd[2], 4u, &b_ok );
+    u32_cnt = HexGet( &au8_Cmd[6], 2u, &b_ok );
+    if ( b_ok && ( u32_cnt != 0u ) &&
+         ( ( ( u32_addr + u32_cnt ) * k_WORD_LEN ) <= RFID_MEM_TOTAL_LEN ) )
+    {
+      ResBuild( RFID_CMD_OK, &au8_TagMem[u32_addr * k_WORD_LEN], (UINT16)( u32_cnt * k_WORD_LEN ),
+                u32_time + s_Cfg.u32_srUs + ( u32_cnt * s_Cfg.u32_srWordUs ) );
+    }
+    else
+    {
+      ResBuild( RFID_CMD_SYNTAX_ERROR, NULL_PNT, 0u, u32_time + s_Cfg.u32_srUs );
+    }
+  }
+}
+
+/***************************************************************************************************
+  Function:
+    Crc32
+
+  Description:
+    This function calculates the record CRC bit by bit (parameters see RFIDcrc.h).
+
+  Parameters:
+    pau8_data (IN) - data
+    u8_len    (IN) - number of bytes
+
+  Return value:
+    UINT32 - CRC
+
+***************************************************************************************************/
+STATIC UINT32 Crc32( CONST UINT8* pau8_data, CONST UINT8 u8_len )
+{
+  UINT32 u32_crc = RFID_CRC_SEED;
+  UINT8 i;
+  UINT8 u8_bit;
+
+  for ( i = 0u; i < u8_len; i++ )
+  {
+    u32_crc ^= (UINT32)pau8_data[i] << 24;
+    for ( u8_bit = 0u; u8_bit < 8u; u8_bit++ )
+    {
+      u32_crc = ( ( u32_crc & 0x80000000u ) != 0u ) ? ( ( u32_crc << 1 ) ^ RFID_CRC_POLY )
+                                                     : ( u32_crc << 1 );
+    }
+  }
+  return u32_crc ^ RFID_CRC_XOROUT;
+}
+
+/***************************************************************************************************
+  Function:
+    HexGet
+
+  Description:
+    This function converts ASCII hex digits (upper case) of a command.
+
+  Parameters:
+    pau8_hex (IN)  - hex digits
+    u8_digits (IN) - number of hex digits
+    pb_ok    (OUT) - set to FALSE if a digit is invalid
+
+  Return value:
+    UINT32 - value
+
+***************************************************************************************************/
+STATIC UINT32 HexGet( CONST UINT8* pau8_hex, CONST UINT8 u8_digits, BOOL* pb_ok )
+{
+  UINT32 u32_val = 0u;
+  UINT8 i;
+
+  for ( i = 0u; i < u8_digits; i++ )
+  {
+    u32_val <<= 4;
+    if ( ( pau8_hex[i] >= (UINT8)'0' ) && ( pau8_hex[i] <= (UINT8)'9' ) )
+    {
+      u32_val |= (UINT32)pau8_hex[i] - (UINT32)'0';
+    }
+    else if ( ( pau8_hex[i] >= (UINT8)'A' ) && ( pau8_hex[i] <= (UINT8)'F' ) )
+    {
+      u32_val |= (UINT32)pau8_hex[i] - (UINT32)'A' + 10u;
+    }
+    else
+    {
+      *pb_ok = FALSE;
+    }
+  }
+  return u32_val;
+}
+
+/***************************************************************************************************
+  Function:
+    ResBuild
+
+  Description:
+    This function builds a response frame: status, data, CHCK (sum of status and data), ETX.
+    The checksum fault is applied here. A response in progress is replaced.
+
+  Parameters:
+    u8_status (IN) - status byte
+    pau8_data (IN) - data (NULL_PNT if u16_len is 0)
+    u16_len   (IN) - number of data bytes
+    u32_start (IN) - start time of the first byte
+
+***************************************************************************************************/
+STATIC void ResBuild( CONST UINT8 u8_status, CONST UINT8* pau8_data, CONST UINT16 u16_len,
+                      CONST UINT32 u32_start )
+{
+  UINT8 u8_chk = u8_status;
+  UINT16 i;
+
+  au8_Res[0] = u8_status;
+  for ( i = 0u; i < u16_len; i++ )
+  {
+    au8_Res[1u + i] = pau8_data[i];
+    u8_chk = (UINT8)( u8_chk + pau8_data[i] );
+  }
+
+  if ( au32_Fault[RFIDSIMREADER_FAULT_CHCK] != 0u )
+  {
+    au32_Fault[RFIDSIMREADER_FAULT_CHCK]--;
+    u8_chk = (UINT8)( u8_chk + 1u );
+  }
+  else
+  {
+    /* empty branch */
+  }
+
+  au8_Res[1u + u16_len] = u8_chk;
+  au8_Res[2u + u16_len] = RFID_ETX;
+  u16_ResLen = (UINT16)( u16_len + 3u );
+  u16_ResPos = 0u;
+  u32_ResStart = u32_start;
+  u32_ResBaud = u32_Baud;
+  u32_ResBaudNext = 0u;
+}
+
+/***************************************************************************************************
+  Function:
+    TagRecordBuild
+
+  Description:
+    This function writes the sequence number, the reserved bytes and the R_CRC of a record. The
+    S2L ID of the record must be written before. The R_CRC covers UID, sequence number, reserved
+    bytes and S2L ID and is stored MSB first.
+
+  Parameters:
+    u8_rec (IN) - record
+    u8_seq (IN) - sequence number
+
+***************************************************************************************************/
+STATIC void TagRecordBuild( CONST UINT8 u8_rec, CONST UINT8 u8_seq )
+{
+  UINT8 au8_crcIn[RFID_UID_LEN + RFID_REC_IDX_R_CRC];
+  UINT8* pau8_rec = &au8_TagMem[u8_rec * RFID_REC_TOTAL_LEN];
+  UINT32 u32_crc;
+  UINT8 i;
+
+  pau8_rec[RFID_REC_IDX_SEQ] = u8_seq;
+  pau8_rec[RFID_REC_IDX_RES0] = 0u;
+  pau8_rec[RFID_REC_IDX_RES1] = 0u;
+  pau8_rec[RFID_REC_IDX_RES2] = 0u;
+
+  for ( i = 0u; i < RFID_UID_LEN; i++ )
+  {
+    au8_crcIn[i] = au8_TagUid[i];
+  }
+  for ( i = 0u; i < RFID_REC_IDX_R_CRC; i++ )
+  {
+    au8_crcIn[RFID_UID_LEN + i] = pau8_rec[i];
+  }
+  u32_crc = Crc32( au8_crcIn, (UINT8)sizeof( au8_crcIn ) );
+  for ( i = 0u; i < RFID_RECORD_CRC_LEN; i++ )
+  {
+    pau8_rec[RFID_REC_IDX_R_CRC + i] = (UINT8)( u32_crc >> ( 24u - ( 8u * i ) ) );
+  }
+}
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
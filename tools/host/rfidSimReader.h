@@ -0,0 +1,342 @@
+/***************************************************************************************************
+**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+****************************************************************************************************
+**
+**        File: rfidSimReader.h
+**     Summary: Header of module rfidSimReader.c, model of the RFID reader and the tag of the host
+**              RFID simulator (see rfidSim.c).
+**   $Revision: $
+**       $Date: $
+**      Author: K. Angele
+** Responsible: (optional)
+**
+****************************************************************************************************
+****************************************************************************************************
+**
+**  Functions: rfidSimREADER_Init
+**             rfidSimREADER_PowerOn
+**             rfidSimREADER_TagArrive
+**             rfidSimREADER_TagRemove
+**             rfidSimREADER_TagSeqSet
+**             rfidSimREADER_FaultSet
+**             rfidSimREADER_RxByte
+**             rfidSimREADER_TxByte
+**             rfidSimREADER_BaudGet
+**             rfidSimREADER_CmdCntGet
+**
+**    History:
+**
+****************************************************************************************************
+**    Template Version 5
+***************************************************************************************************/
+
+#ifndef RFIDSIMREADER_H
+#define RFIDSIMREADER_H
+
+/***************************************************************************************************
+**    include-files
+***************************************************************************************************/
+#include "xtypes.h"
+#include "xdefs.h"
+
+/***************************************************************************************************
+**    constants and macros
+***************************************************************************************************/
+
+/* Bits per byte on the UART (8N1) */
+#define RFIDSIMREADER_BITS_PER_BYTE    10u
+
+/* Transfer time of one byte in usec (rounded up) */
+#define RFIDSIMREADER_BYTE_US(baud) \
+  ( ( ( RFIDSIMREADER_BITS_PER_BYTE * 1000000u ) + (baud) - 1u ) / (baud) )
+
+/***************************************************************************************************
+**    data types
+***************************************************************************************************/
+
+/*
+** Timing of the reader in usec, from the ETX of the command to the start of the response.
+** The values are model parameters, calibrate them with bench measurements.
+*/
+typedef struct
+{
+  UINT32 u32_veUs;       /* Reader Version */
+  UINT32 u32_brUs;       /* Change Baud Rate */
+  UINT32 u32_sfUs;       /* Single Read Fix Code (inventory of the tag) */
+  UINT32 u32_srUs;       /* Single Read Words, base time */
+  UINT32 u32_srWordUs;   /* Single Read Words, additional time per word */
+  UINT32 u32_bootUs;     /* Power on until the power on notification */
+} RFIDSIMREADER_CFG_STRUCT;
+
+/* Injectable faults, see rfidSimREADER_FaultSet() */
+typedef enum
+{
+  RFIDSIMREADER_FAULT_CHCK,     /* the next n responses have a wrong checksum */
+  RFIDSIMREADER_FAULT_TIMEOUT,  /* the next n commands are not answered */
+  RFIDSIMREADER_FAULT_CNT
+} RFIDSIMREADER_FAULT_ENUM;
+
+/***************************************************************************************************
+**    global variables
+***************************************************************************************************/
+
+/***************************************************************************************************
+**    function prototypes
+***************************************************************************************************/
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_Init
+
+  Description:
+    This function initializes the reader model with the given timing. The reader is powered
+    off and no tag is present.
+
+  See also:
+    rfidSimREADER_PowerOn
+
+  Parameters:
+    ps_cfg (IN) - timing of the reader
+                  (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_Init( CONST RFIDSIMREADER_CFG_STRUCT* ps_cfg );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_PowerOn
+
+  Description:
+    This function (re)starts the reader: the baud rate is reset to 38400 baud, a command or a
+    response in progress is lost and the power on notification is sent after the boot time.
+
+  See also:
+    -
+
+  Parameters:
+    u32_time (IN) - current time in usec
+                    (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_PowerOn( CONST UINT32 u32_time );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagArrive
+
+  Description:
+    This function puts a tag in front of the reader. The memory of the tag is built as the
+    firmware expects it: 8 records (sequence number, 3 reserved bytes, S2L ID of the even
+    records or its complement in the odd records, R_CRC) and the memory CRC.
+
+  See also:
+    rfidSimREADER_TagRemove, rfidSimREADER_TagSeqSet
+
+  Parameters:
+    pau8_uid (IN) - UID of the tag, 8 bytes
+                    (valid range: <>NULL, not checked)
+    pau8_s2l (IN) - S2L ID of the tag, 4 bytes
+                    (valid range: <>NULL, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_TagArrive( CONST UINT8* pau8_uid, CONST UINT8* pau8_s2l );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagRemove
+
+  Description:
+    This function removes the tag, the reader answers "no tag".
+
+  See also:
+    rfidSimREADER_TagArrive
+
+  Parameters:
+    -
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_TagRemove( void );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TagSeqSet
+
+  Description:
+    This function overwrites the sequence number of a record of the present tag.
+
+  See also:
+    rfidSimREADER_TagArrive
+
+  Parameters:
+    u8_rec   (IN) - record
+                    (valid range: 0..7, checked)
+    u8_seq   (IN) - sequence number written to the record
+                    (valid range: any, not checked)
+    b_crcFix (IN) - TRUE: R_CRC and memory CRC are recalculated, FALSE: the CRCs are kept
+                    (valid range: TRUE, FALSE, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_TagSeqSet( CONST UINT8 u8_rec, CONST UINT8 u8_seq, CONST BOOL b_crcFix );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_FaultSet
+
+  Description:
+    This function injects a fault into the next responses of the reader.
+
+  See also:
+    RFIDSIMREADER_FAULT_ENUM
+
+  Parameters:
+    e_fault (IN) - fault
+                   (valid range: RFIDSIMREADER_FAULT_ENUM, checked)
+    u32_cnt (IN) - number of affected responses
+                   (valid range: any, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_FaultSet( CONST RFIDSIMREADER_FAULT_ENUM e_fault, CONST UINT32 u32_cnt );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_RxByte
+
+  Description:
+    This function passes a byte sent by the controller to the reader. A byte with another baud
+    rate than the one of the reader is lost (framing error) and discards the command received
+    so far.
+
+  See also:
+    rfidSimREADER_TxByte
+
+  Parameters:
+    u32_time (IN) - time of the stop bit in usec
+                    (valid range: any, not checked)
+    u8_byte  (IN) - received byte
+                    (valid range: any, not checked)
+    u32_baud (IN) - baud rate of the controller
+                    (valid range: >0, not checked)
+
+  Return value:
+    -
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+void rfidSimREADER_RxByte( CONST UINT32 u32_time, CONST UINT8 u8_byte, CONST UINT32 u32_baud );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_TxByte
+
+  Description:
+    This function returns the next byte sent by the reader if its stop bit is sent up to the
+    given time.
+
+  See also:
+    rfidSimREADER_RxByte
+
+  Parameters:
+    u32_time  (IN)  - current time in usec
+                      (valid range: any, not checked)
+    pu8_byte  (OUT) - sent byte
+                      (valid range: <>NULL, not checked)
+    pu32_baud (OUT) - baud rate of the reader
+                      (valid range: <>NULL, not checked)
+
+  Return value:
+    TRUE  - a byte was sent
+    FALSE - no byte was sent
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+BOOL rfidSimREADER_TxByte( CONST UINT32 u32_time, UINT8* pu8_byte, UINT32* pu32_baud );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_BaudGet
+
+  Description:
+    This function returns the current baud rate of the reader.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    UINT32 - baud rate
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+UINT32 rfidSimREADER_BaudGet( void );
+
+/***************************************************************************************************
+  Function:
+    rfidSimREADER_CmdCntGet
+
+  Description:
+    This function returns the number of commands received completely since the last power on.
+
+  See also:
+    -
+
+  Parameters:
+    -
+
+  Return value:
+    UINT32 - number of commands
+
+  Remarks:
+    -
+
+***************************************************************************************************/
+UINT32 rfidSimREADER_CmdCntGet( void );
+
+#endif /* RFIDSIMREADER_H */
+
+/***************************************************************************************************
+**    end of file
+***************************************************************************************************/
@@ -0,0 +1,593 @@
+#!/usr/bin/env python3
+###################################################################################################
+##    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+###################################################################################################
+##
+##        File: sch_SliceGen.py
+##     Summary: Host tool which assigns the tasks of the scheduler to the time slices and generates
+##              the task tables of sch_Scheduler-app.c (sch_Scheduler-app_tbl.h) for every
+##              supported cycle time.
+##      Author: K. Angele
+##
+###################################################################################################
+##
+##  Usage:
+##    python3 tools/sch_SliceGen.py [--cycle <us>] [--measured <file>] [--check] [--keep]
+##                                  [pkgOperation/sch_Scheduler-app_tasks.cfg]
+##
+##    --cycle     only check and report the tables of this cycle time of the scheduler in
+##                microseconds (GLOBDEF_CYCLE_TIME_US, 2000, 4000 or 8000), the header file is not
+##                written. Default: the tables of all cycle times are generated.
+##    --measured  file with measured execution times, one line "<startup|run> <task> <cycles>",
+##                e.g. the longest task execution times read from the scheduler profiler
+##                (SCH_PROFILER_ACTIVE). The optimizer uses the maximum of the declared and the
+##                measured execution time, the task tables keep the declared budgets.
+##    --check     only check and report, the header file is not written
+##    --keep      no optimization, every task is placed into its preferred slice
+##
+##  The number of time slices depends on the cycle time (SCHAPP_TIME_SLICE_CNT of
+##  sch_Scheduler-app.h): as many time slices as possible, each at least 100us long, max. 40
+##  (2ms: 20 x 100us, 4ms: 40 x 100us, 8ms: 40 x 200us). The budget of a time slice is the slice
+##  time minus the "slice_overhead" of the task description. The header contains the tables of all
+##  cycle times, selected by GLOBDEF_CYCLE_TIME_US.
+##
+##  The assignment minimizes the worst-case load of the time slices first and then the sum of
+##  the squared loads (the load is spread over the slices). If there are several solutions the
+##  preferred slices of the task description are kept.
+##
+###################################################################################################
+
+import argparse
+import math
+import os
+import re
+import sys
+
+SLICE_MAX = 40                  # SCHAPP_TIME_SLICE_MAX, width of the slice mask
+SLICE_MIN_US = 100              # SCHAPP_TIME_SLICE_MIN_US
+CYCLES_US = (2000, 4000, 8000)
+DEF_CYCLE_US = 4000
+CPU_HZ = 72000000
+PERIODS = (4, 5, 20, 40)
+IPC_MAX_PAYLOAD = 16
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+DEF_CFG = os.path.join(ROOT, 'pkgOperation', 'sch_Scheduler-app_tasks.cfg')
+DEF_OUT = os.path.join(ROOT, 'pkgOperation', 'sch_Scheduler-app_tbl.h')
+
+MODES = (('startup', 'as_StartupTasks', 'Tasks executed in startup mode.'),
+         ('run', 'as_RunModeTasks', 'Tasks executed in run mode (data exchange mode).'))
+
+
+class CfgError(Exception):
+    pass
+
+
+def slice_cnt(cycle):
+    """Number of time slices of the cycle time (see SCHAPP_TIME_SLICE_CNT)."""
+    return min(cycle // SLICE_MIN_US, SLICE_MAX)
+
+
+class Task(object):
+    def __init__(self, name, line, period):
+        self.name = name
+        self.line = line
+        self.wcet = None        # declared budget [us]
+        self.load = None        # execution time used by the optimizer [us]
+        self.period = period
+        self.domain = None      # allowed start slices, first one preferred
+        self.at = None          # fixed slices
+        self.after = None       # (task, offset)
+        self.ipc = False
+        self.ipc_bytes = IPC_MAX_PAYLOAD  # IPC payload (only used by the timing model)
+        self.cond = None
+        self.comment = []       # table comment lines
+        self.blank = False      # blank line in front of the table entry
+        self.root = None        # root task of the group
+        self.offset = 0         # offset to the root task
+
+
+def parse_list(text, line):
+    values = []
+    for part in text.split(','):
+        m = re.match(r'^(\d+)(?:-(\d+))?$', part.strip())
+        if not m:
+            raise CfgError('line %d: invalid slice list "%s"' % (line, text))
+        first = int(m.group(1))
+        last = int(m.group(2)) if m.group(2) else first
+        for v in range(first, last + 1):
+            if v not in values:
+                values.append(v)
+    return values
+
+
+def parse_options(words, cycle, line):
+    """Options of a task line, "<option>@<cycle>=<value>" replaces the option for this cycle."""
+    opts = {}
+    overrides = {}
+    for opt in words:
+        key, _, val = opt.partition('=')
+        key, at, cyc = key.partition('@')
+        if at:
+            if not cyc.isdigit() or int(cyc) not in CYCLES_US:
+                raise CfgError('line %d: invalid cycle time in "%s"' % (line, opt))
+            if int(cyc) == cycle:
+                overrides[key] = val
+        elif key in opts:
+            raise CfgError('line %d: option "%s" twice' % (line, key))
+        else:
+            opts[key] = val
+    opts.update(overrides)
+    return opts
+
+
+def parse_cfg(path, cycle=DEF_CYCLE_US):
+    """Task description for the cycle time 'cycle'. Returns the slice overhead, the tasks per mode
+    and the tasks per mode whose condition is not supported in this cycle time ("cond")."""
+    n = slice_cnt(cycle)
+    overhead = None
+    modes = {}
+    excluded = {}
+    tasks = None
+    skipped = None
+    cond_cycles = {}
+    comment = []
+    blank = False
+    with open(path) as f:
+        for no, raw in enumerate(f, 1):
+            text = raw.strip()
+            if text.startswith('#'):
+                continue
+            if not text:
+                blank = tasks is not None and len(tasks) > 0
+                continue
+            if text.startswith('//'):
+                comment.append(text[2:].strip())
+                continue
+            m = re.match(r'^\[(\w+)\]$', text)
+            if m:
+                if m.group(1) not in [mode[0] for mode in MODES]:
+                    raise CfgError('line %d: unknown mode "%s"' % (no, m.group(1)))
+                tasks = modes.setdefault(m.group(1), [])
+                skipped = excluded.setdefault(m.group(1), [])
+                comment, blank = [], False
+                continue
+            m = re.match(r'^slice_overhead=(\d+)$', text)
+            if m:
+                overhead = int(m.group(1))
+                continue
+            m = re.match(r'^cond\s+(\w+)\s+cycles=([\d,]+)$', text)
+            if m:
+                cycles = [int(v) for v in m.group(2).split(',') if v]
+                if not cycles or any(c not in CYCLES_US for c in cycles) or tasks is not None:
+                    raise CfgError('line %d: "cond" needs cycle times of %s in front of the '
+                                   'tasks' % (no, CYCLES_US))
+                cond_cycles[m.group(1)] = cycles
+                continue
+            words = text.split()
+            if words[0] != 'task' or len(words) < 2 or tasks is None:
+                raise CfgError('line %d: syntax error' % no)
+            t = Task(words[1], no, n)
+            t.comment, t.blank = comment, blank
+            comment, blank = [], False
+            opts = parse_options(words[2:], cycle, no)
+            for key, val in opts.items():
+                if key == 'wcet':
+                    t.wcet = int(val)
+                elif key == 'period':
+                    t.period = int(val)
+                    if t.period not in PERIODS or n % t.period:
+                        raise CfgError('line %d: period must be one of %s and divide %d slices' %
+                                       (no, PERIODS, n))
+                elif key == 'slices':
+                    # slices of a longer cycle are dropped
+                    t.domain = [v for v in parse_list(val, no) if v < n]
+                    if not t.domain:
+                        raise CfgError('line %d: no slice < %d, use "slices@%d="' %
+                                       (no, n, cycle))
+                elif key == 'at':
+                    t.at = parse_list(val, no)
+                elif key == 'after':
+                    m = re.match(r'^(\w+)\+(\d+)$', val)
+                    if not m:
+                        raise CfgError('line %d: invalid "after=%s"' % (no, val))
+                    t.after = (m.group(1), int(m.group(2)))
+                elif key == 'ipc':
+                    t.ipc = True
+                    if val:
+                        t.ipc_bytes = int(val)
+                        if not 0 < t.ipc_bytes <= IPC_MAX_PAYLOAD:
+                            raise CfgError('line %d: invalid IPC payload length' % no)
+                elif key == 'cond':
+                    t.cond = val
+                else:
+                    raise CfgError('line %d: unknown option "%s"' % (no, key))
+            if t.wcet is None:
+                raise CfgError('line %d: wcet missing' % no)
+            if sum(x is not None for x in (t.domain, t.at, t.after)) > 1:
+                raise CfgError('line %d: only one of slices, at, after allowed' % no)
+            if t.after is not None and 'period' in opts:
+                raise CfgError('line %d: "after" and "period" not allowed together' % no)
+            if t.at is not None and (t.period != n or len(t.at) > 3 or max(t.at) >= n):
+                raise CfgError('line %d: "at" needs max. 3 slices < %d, use "at@%d="' %
+                               (no, n, cycle))
+            if t.domain is not None and max(t.domain) >= t.period:
+                raise CfgError('line %d: slice out of period' % no)
+            if cycle not in cond_cycles.get(t.cond, CYCLES_US):
+                # the table of this cycle time rejects the condition
+                skipped.append(t)
+                continue
+            t.load = t.wcet
+            tasks.append(t)
+    if overhead is None:
+        raise CfgError('slice_overhead missing')
+    for name, _, _ in MODES:
+        if name not in modes:
+            raise CfgError('mode [%s] missing' % name)
+        link_groups(modes[name])
+    return overhead, modes, excluded
+
+
+def link_groups(tasks):
+    by_name = dict((t.name, t) for t in tasks)
+    if len(by_name) != len(tasks):
+        raise CfgError('task listed twice in one mode')
+    for t in tasks:
+        seen = set()
+        cur, ofs = t, 0
+        while cur.after is not None:
+            if cur.name in seen:
+                raise CfgError('line %d: cyclic "after"' % t.line)
+            seen.add(cur.name)
+            if cur.after[0] not in by_name:
+                raise CfgError('line %d: unknown task "%s"' % (cur.line, cur.after[0]))
+            ofs += cur.after[1]
+            cur = by_name[cur.after[0]]
+        if cur is not t:
+            if cur.at is not None:
+                raise CfgError('line %d: "after" a task with fixed slices' % t.line)
+            # the task runs with the period of its group
+            t.period = cur.period
+        t.root, t.offset = cur, ofs
+
+
+def read_measured(path, modes):
+    with open(path) as f:
+        for no, raw in enumerate(f, 1):
+            words = raw.split('#')[0].split()
+            if not words:
+                continue
+            if len(words) != 3 or words[0] not in modes:
+                raise CfgError('%s line %d: syntax error' % (path, no))
+            us = int(math.ceil(int(words[2]) * 1000000.0 / CPU_HZ))
+            for t in modes[words[0]]:
+                if t.name == words[1]:
+                    t.load = max(t.wcet, us)
+                    break
+            else:
+                raise CfgError('%s line %d: unknown task "%s"' % (path, no, words[1]))
+
+
+class Mode(object):
+    """Slice assignment of the task groups of one task table."""
+
+    def __init__(self, tasks, n=SLICE_MAX):
+        self.tasks = tasks
+        self.n = n              # number of time slices
+        self.groups = []        # (root, members, domain)
+        for root in [t for t in tasks if t.root is t]:
+            members = [t for t in tasks if t.root is root]
+            if root.at is not None:
+                domain = [None]
+            else:
+                domain = root.domain if root.domain is not None else list(range(root.period))
+                domain = [s for s in domain if self.fits(members, s)]
+                if not domain:
+                    raise CfgError('line %d: no valid slice for "%s"' % (root.line, root.name))
+            self.groups.append((root, members, domain))
+
+    def slices(self, t, start):
+        """Time slices of task t if its group starts in slice 'start'."""
+        if t.at is not None:
+            return list(t.at)
+        phase = start + t.offset
+        if t.period != self.n:
+            phase %= t.period
+        return list(range(phase, self.n, t.period))
+
+    def fits(self, members, start):
+        return all(m.period != self.n or start + m.offset < self.n for m in members)
+
+    def place(self, load, ipc, members, start, sign):
+        for m in members:
+            for s in self.slices(m, start):
+                load[s] += sign * m.load
+                if m.ipc:
+                    ipc[s] += sign
+
+    def evaluate(self, assign):
+        load = [0] * self.n
+        ipc = [0] * self.n
+        for (_, members, _), start in zip(self.groups, assign):
+            self.place(load, ipc, members, start, 1)
+        return load, ipc
+
+    def cost(self, assign):
+        load, ipc = self.evaluate(assign)
+        moved = sum(start != domain[0] for (_, _, domain), start in zip(self.groups, assign))
+        return (max(ipc) > 1, max(load), sum(x * x for x in load), moved)
+
+    def solve_max(self):
+        """Branch and bound: assignment with the minimum worst-case slice load."""
+        order = sorted(range(len(self.groups)),
+                       key=lambda i: (len(self.groups[i][2]),
+                                      -sum(m.load * len(self.slices(m, self.groups[i][2][0]))
+                                           for m in self.groups[i][1])))
+        load = [0] * self.n
+        ipc = [0] * self.n
+        assign = [None] * len(self.groups)
+        best = [None, None]
+        fixed = [0] * self.n
+        for i in order:
+            if len(self.groups[i][2]) == 1:
+                self.place(fixed, [0] * self.n, self.groups[i][1], self.groups[i][2][0], 1)
+        lower = max(fixed)
+
+        def dfs(k):
+            if best[0] is not None and best[0] <= lower:
+                return
+            if k == len(order):
+                peak = max(load)
+                if best[0] is None or peak < best[0]:
+                    best[0], best[1] = peak, list(assign)
+                return
+            i = order[k]
+            _, members, domain = self.groups[i]
+            for start in domain:
+                self.place(load, ipc, members, start, 1)
+                if max(ipc) <= 1 and (best[0] is None or max(load) < best[0]):
+                    assign[i] = start
+                    dfs(k + 1)
+                self.place(load, ipc, members, start, -1)
+            assign[i] = None
+
+        dfs(0)
+        if best[1] is None:
+            raise CfgError('no assignment without IPC conflict found')
+        return best[1]
+
+    def solve(self, keep):
+        assign = [domain[0] for _, _, domain in self.groups]
+        if keep:
+            if self.cost(assign)[0]:
+                raise CfgError('IPC conflict in the preferred slices')
+            return assign
+        assign = self.solve_max()
+        peak = self.cost(assign)[1]
+        # local search: spread the load without exceeding the worst-case load
+        improved = True
+        while improved:
+            improved = False
+            best = self.cost(assign)
+            for i, (_, _, domain) in enumerate(self.groups):
+                for start in domain:
+                    trial = assign[:i] + [start] + assign[i + 1:]
+                    c = self.cost(trial)
+                    if not c[0] and c[1] <= peak and c[2:] < best[2:]:
+                        assign, best, improved = trial, c, True
+        return assign
+
+
+def mask_macro(t, slices):
+    if t.period == 4:
+        return 'SCH_EVERY_4TH(%du)' % slices[0]
+    if t.period == 5:
+        return 'SCH_EVERY_5TH(%du)' % slices[0]
+    names = {1: 'SCH_SLICE', 2: 'SCH_SLICES2', 3: 'SCH_SLICES3'}
+    if len(slices) not in names:
+        raise CfgError('line %d: no slice mask macro for %d slices' % (t.line, len(slices)))
+    return '%s(%s)' % (names[len(slices)], ', '.join('%du' % s for s in slices))
+
+
+def emit_table(mode, assign, var, title):
+    start = {}
+    for (root, members, _), s in zip(mode.groups, assign):
+        for m in members:
+            start[m.name] = s
+    out = ['/* %s:' % var,
+           '** %s Declared budgets in microseconds.' % title,
+           '*/',
+           'STATIC CONST t_SCH_TASK %s[] =' % var,
+           '{']
+    body = []
+    cond = None
+    for t in mode.tasks:
+        if cond is not None and (t.cond != cond or t.blank):
+            body.append('#endif /* %s */' % cond)
+            cond = None
+        if t.blank:
+            body.append('')
+        if t.cond is not None and t.cond != cond:
+            body.append('#ifdef %s' % t.cond)
+            cond = t.cond
+        for i, c in enumerate(t.comment):
+            body.append('  %s %s' % ('/*' if i == 0 else '**', c))
+        if t.comment:
+            body[-1] += ' */'
+        mask = mask_macro(t, mode.slices(t, start[t.name]))
+        body.append('  { %-32s%-28sSCH_US(%du)%s },' %
+                    (t.name + ',', mask + ',', t.wcet, ' ' if t.wcet < 10 else ''))
+    if cond is not None:
+        body.append('#endif /* %s */' % cond)
+    # no comma after the last entry of the table
+    idx = max(i for i, l in enumerate(body) if l.startswith('  {'))
+    body[idx] = body[idx][:-1]
+    out.extend(body)
+    out.append('};')
+    return out
+
+
+def emit_load(name, load, ipc):
+    out = ['** %s mode, declared load per time slice [us] (* = IPC telegram):' % name]
+    for row in range(0, len(load), 10):
+        out.append('**  ' + ' '.join('%2d:%3d%s' % (s, load[s], '*' if ipc[s] else ' ')
+                                     for s in range(row, min(row + 10, len(load)))).rstrip())
+    out.append('**  worst case: %d us (slice %d)' % (max(load), load.index(max(load))))
+    return out
+
+
+def emit_cycles(cycles):
+    return ' or '.join('%dus' % c for c in cycles)
+
+
+def emit_title(v):
+    return ['** T-cyc %dus: %d time slices of %dus, budget %dus' % (c, v['n'], c // v['n'], b)
+            for c, b in zip(v['cycles'], v['budgets'])]
+
+
+def emit_max_load(n, results):
+    out = ['/* Number of time slices of the task tables, checked against the number of time',
+           '** slices of the scheduler by sch_Scheduler-app.c */',
+           '#define %-32s%du' % ('SCH_TBL_SLICE_CNT', n),
+           '',
+           '/* Worst-case declared load of a time slice [us], checked against the budget of the',
+           '** time slice by sch_Scheduler-app.c */']
+    for name, load, _ in results:
+        out.append('#define %-32s%du' % ('SCH_TBL_' + name.upper() + '_MAX_LOAD_US', max(load)))
+    out.append('')
+    return out
+
+
+def emit_excluded(cycles, excluded):
+    out = []
+    conds = []
+    for name, _, _ in MODES:
+        for t in excluded[name]:
+            if t.cond not in conds:
+                conds.append(t.cond)
+    for cond in conds:
+        out.extend(['#ifdef %s' % cond,
+                    '  #error "%s not supported with T-cyc %s, see %s"' %
+                    (cond, emit_cycles(cycles), os.path.basename(DEF_CFG)),
+                    '#endif /* %s */' % cond,
+                    ''])
+    return out
+
+
+def emit_header(variants, cfg_name):
+    out = [
+        '/' + '*' * 99,
+        '**    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved',
+        '*' * 100,
+        '**',
+        '**        File: sch_Scheduler-app_tbl.h',
+        '**     Summary: Task tables of the scheduler, only included by sch_Scheduler-app.c.',
+        '**              GENERATED FILE, DO NOT EDIT! Generated by tools/sch_SliceGen.py from',
+        '**              %s.' % cfg_name,
+        '**              The tables are selected by the cycle time GLOBDEF_CYCLE_TIME_US.',
+        '**   $Revision: $',
+        '**       $Date: $',
+        '**      Author: K. Angele',
+        '** Responsible: (optional)',
+        '**',
+        '*' * 100,
+        '*' * 100,
+        '**']
+    for v in variants:
+        out.extend(emit_title(v))
+        out.append('**')
+        for name, load, ipc in v['results']:
+            out.extend(emit_load(name, load, ipc))
+            out.append('**')
+    out.extend([
+        '*' * 100,
+        '**    Template Version 5',
+        '*' * 99 + '/',
+        '',
+        '#ifndef SCH_SCHEDULER_APP_TBL_H',
+        '#define SCH_SCHEDULER_APP_TBL_H',
+        ''])
+    for i, v in enumerate(variants):
+        cond = ' || '.join('(GLOBDEF_CYCLE_TIME_US == %du)' % c for c in v['cycles'])
+        if len(v['cycles']) > 1:
+            cond = '(%s)' % cond
+        out.append('%s %s' % ('#if' if i == 0 else '#elif', cond))
+        out.append('')
+        out.extend(emit_excluded(v['cycles'], v['excluded']))
+        out.extend(emit_max_load(v['n'], v['results']))
+        out.extend(v['body'])
+    out.extend(['#else',
+                '  #error "No task tables for GLOBDEF_CYCLE_TIME_US, run tools/sch_SliceGen.py"',
+                '#endif /* GLOBDEF_CYCLE_TIME_US */',
+                '',
+                '#endif /* SCH_SCHEDULER_APP_TBL_H */'])
+    return out
+
+
+def generate(args, cycle):
+    """Task tables of one cycle time."""
+    overhead, modes, excluded = parse_cfg(args.cfg, cycle)
+    n = slice_cnt(cycle)
+    budget = cycle // n - overhead
+    if args.measured:
+        read_measured(args.measured, modes)
+    body = []
+    results = []
+    for name, var, title in MODES:
+        mode = Mode(modes[name], n)
+        assign = mode.solve(args.keep)
+        load, ipc = mode.evaluate(assign)
+        if max(load) > budget:
+            raise CfgError('T-cyc %dus, %s mode: slice %d exceeds the budget of %d us (%d us)' %
+                           (cycle, name, load.index(max(load)), budget, max(load)))
+        results.append((name, load, ipc))
+        body.extend(emit_table(mode, assign, var, title))
+        body.append('')
+    return {'cycles': [cycle], 'budgets': [budget], 'n': n, 'results': results, 'body': body,
+            'excluded': excluded}
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Assign the scheduler tasks to the time slices.')
+    ap.add_argument('cfg', nargs='?', default=DEF_CFG)
+    ap.add_argument('-o', '--out', default=DEF_OUT)
+    ap.add_argument('--cycle', type=int, choices=CYCLES_US)
+    ap.add_argument('--measured')
+    ap.add_argument('--check', action='store_true')
+    ap.add_argument('--keep', action='store_true')
+    args = ap.parse_args()
+
+    variants = []
+    try:
+        for cycle in ((args.cycle,) if args.cycle else CYCLES_US):
+            v = generate(args, cycle)
+            budget = v['budgets'][0]
+            # cycle times with the same tables share them (only the budget differs)
+            for w in variants:
+                if (w['body'], w['results'], w['n']) == (v['body'], v['results'], v['n']) and \
+                        [t.name for m in w['excluded'].values() for t in m] == \
+                        [t.name for m in v['excluded'].values() for t in m]:
+                    w['cycles'].append(cycle)
+                    w['budgets'].append(budget)
+                    break
+            else:
+                variants.append(v)
+    except (CfgError, IOError, ValueError) as e:
+        sys.stderr.write('sch_SliceGen: %s\n' % e)
+        return 1
+
+    for v in variants:
+        print('\n'.join(line[3:] for line in emit_title(v)))
+        for name, load, ipc in v['results']:
+            print('\n'.join(line[3:] for line in emit_load(name, load, ipc)))
+
+    if not args.check and not args.cycle:
+        text = emit_header(variants, os.path.basename(args.cfg))
+        with open(args.out, 'w') as f:
+            f.write('\n'.join(text) + '\n')
+        print('written: %s' % args.out)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
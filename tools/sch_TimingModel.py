@@ -0,0 +1,404 @@
+#!/usr/bin/env python3
+###################################################################################################
+##    Copyright (C) 2024 HMS Technology Center Ravensburg GmbH, all rights reserved
+###################################################################################################
+##
+##        File: sch_TimingModel.py
+##     Summary: Static timing model of the scheduler cycle of both safety controllers. The time
+##              slices, the IPC exchange, the GPIO sync, the AIC master telegrams and the
+##              background task are modeled on the task description of the scheduler
+##              (pkgOperation/sch_Scheduler-app_tasks.cfg, see tools/sch_SliceGen.py).
+##      Author: K. Angele
+##
+###################################################################################################
+##
+##  Usage:
+##    python3 tools/sch_TimingModel.py [options] [pkgOperation/sch_Scheduler-app_tasks.cfg]
+##    python3 tools/sch_TimingModel.py --help
+##
+##  Scope:
+##    No firmware code is executed. A task is only its declared execution time (wcet of the task
+##    description or the measured time of --measured), the IPC link, the sync, the AIC master and
+##    the background task are only the timing parameters below. The model shows the effect of the
+##    slice assignment and of these parameters on the cycle, e.g. the IPC wait times and the
+##    slack of the time slices. Its results are as good as the declared execution times, they do
+##    not replace the measurement on the target (scheduler profiler, SCH_PROFILER_ACTIVE). The
+##    IPC protocol itself is tested on the host transport by tools/host (ipcSmoke).
+##
+##  Model of one time slice (both controllers, lockstep):
+##    - TIM1 update IRQ 67 timer ticks (72 ticks reload - 5 ticks preset, 100us time slice) after
+##      the counter was cleared, own clock drift per controller, random IRQ entry latency
+##    - ipcsSYS_Sync(): both controllers wait for the sync edge of the other one, the later one
+##      defines the clear time of the timer counter of both (timeout IPCSSYS_IPCSYNC_TIMEOUT)
+##    - tasks of the slice in table order, execution time wcet (default) or uniformly distributed
+##      between bcet * wcet and wcet (--exec uniform), wcet or the measured execution time
+##    - IPC: a telegram (payload length of "ipc=<bytes>") is sent at the end of the sending task
+##      and received by the task "after" it. The receiver waits for the telegram (timeout
+##      IPCXSYS_WAITTIMEOUT). A task with "ipc" but without partner exchanges data within its
+##      slice (timeout IPCXSYS_TIMEOUT). Bit errors cause a CRC error.
+##    - the background task runs in the time between the time slices, it is triggered by
+##      SAPL_BkgdTaskTrigger and must be finished at SAPL_BkgdTaskCheck
+##    - the AIC master sends a telegram every AIC cycle with its own clock drift, the
+##      controllers count it in aicMgrRx_CheckForNewTgm and process it in aicMgrRx_ProcessTgm,
+##      the response is sent by the ASM telegram task
+##
+##  The model is deterministic for a given seed. Modeled values are parameters (see
+##  --help), the defaults are the values of the firmware or typical measured values.
+##
+###################################################################################################
+
+import argparse
+import bisect
+import csv
+import math
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import sch_SliceGen as gen                                  # noqa: E402
+
+CTRL_CNT = 2
+CTRL_NAMES = ('CFG_CONTROLLER_ID_1', 'CFG_CONTROLLER_ID_2')
+
+# firmware constants (ns)
+TIM_TICK_NS = 100000.0 / 72.0                   # TIM1 tick, 72 ticks per 100us
+TIM_PRESET_TICKS = 5                            # timerHAL_ClearTimer1Counter()
+SYNC_TIMEOUT_NS = 80 * 1000                     # IPCSSYS_IPCSYNC_TIMEOUT
+IPC_BAUD = 4000000                              # SERIALHAL_4000000_BAUD
+AIC_BAUD = 1020000                              # SERIALHAL_1020000_BAUD
+
+# tasks with a special meaning for the model
+TASK_SYNC_RX = 'aicMgrRx_CheckForNewTgm'
+TASK_AIC_RX = 'aicMgrRx_ProcessTgm'
+TASKS_AIC_TX = ('aicMgrTx_MergeSendAsmTgm', 'TaskStartupSendAsmTgm')
+TASK_BKGD_TRIGGER = 'SAPL_BkgdTaskTrigger'
+TASK_BKGD_CHECK = 'SAPL_BkgdTaskCheck'
+
+
+class Stat(object):
+    def __init__(self):
+        self.values = []
+
+    def add(self, v):
+        self.values.append(v)
+
+    def text(self, scale=1000.0, unit='us'):
+        if not self.values:
+            return 'n/a'
+        v = [x / scale for x in self.values]
+        mean = sum(v) / len(v)
+        dev = math.sqrt(sum((x - mean) ** 2 for x in v) / len(v))
+        return ('min %9.2f  mean %9.2f  max %9.2f  stddev %7.2f  p-p %7.2f %s' %
+                (min(v), mean, max(v), dev, max(v) - min(v), unit))
+
+
+class Controller(object):
+    def __init__(self, idx, ppm, phase_ns):
+        self.idx = idx
+        self.scale = 1.0 + ppm * 1e-6           # clock drift
+        self.clear = phase_ns                   # time of the last timer counter clear
+        self.busy = 0.0                         # end of the last time slice (ISR)
+        self.bkgd_left = 0.0                    # remaining background task time
+        self.bkgd_done = None                   # slice in which the background task finished
+        self.tgm_cnt = 0                        # AIC telegrams counted
+        self.tgm_time = None                    # completion time of the last counted telegram
+        self.tgm_processed = 0
+        self.rx = {}                            # IPC telegrams in flight: task -> (time, crc ok)
+
+
+class Sim(object):
+    def __init__(self, args, tasks):
+        self.a = args
+        self.rng = random.Random(args.seed)
+        self.tasks = tasks
+        self.n = gen.slice_cnt(args.cycle)      # number of time slices
+        mode = gen.Mode(tasks, self.n)
+        assign = mode.solve(args.keep)
+        self.slices = {}
+        for (_, members, _), start in zip(mode.groups, assign):
+            for m in members:
+                self.slices[m.name] = set(mode.slices(m, start))
+        # IPC roles: sender -> receiver, exchange tasks
+        self.ipc_rx_of = {}
+        receivers = set()
+        for t in tasks:
+            if t.ipc and t.after is not None:
+                sender = [s for s in tasks if s.name == t.after[0]][0]
+                if sender.ipc:
+                    self.ipc_rx_of[sender.name] = t.name
+                    receivers.add(t.name)
+        self.ipc_exchange = set(t.name for t in tasks if t.ipc and t.name not in receivers and
+                                t.name not in self.ipc_rx_of)
+        self.receivers = receivers
+        # cycle time (GLOBDEF_CYCLE_TIME_US): TIM1 reload and scheduler timeout (+/-10%)
+        self.reload_ticks = args.cycle * 72 // (self.n * 100)
+        self.timeout_min = args.cycle * 900.0
+        self.timeout_max = args.cycle * 1100.0
+        self.ctrl = [Controller(0, args.ppm1, 0.0),
+                     Controller(1, args.ppm2, args.phase * 1000.0)]
+        # AIC master
+        self.aic_period = (args.aic_cycle or args.cycle) * 1000.0 * (1.0 + args.ppm_aic * 1e-6)
+        self.aic_dur = args.aic_bytes * 10 * 1e9 / AIC_BAUD
+        self.aic_next = args.aic_phase * 1000.0 + self.aic_dur
+        self.aic_done = []                      # completion times of the AIC telegrams (sorted)
+        # statistics
+        self.errors = {}
+        self.cycle_len = Stat()
+        self.sync_wait = Stat()
+        self.ipc_wait = Stat()
+        self.slice_len = [Stat() for _ in range(self.n)]
+        self.isr_lat = Stat()
+        self.aic_rx_lat = Stat()
+        self.aic_rsp_lat = Stat()
+        self.bkgd_slice = [0] * (self.n + 1)
+        self.overruns = 0
+
+    def error(self, cycle, text):
+        self.errors.setdefault(text, []).append(cycle)
+
+    def exec_ns(self, t):
+        if self.a.exec == 'wcet':
+            us = t.load
+        else:
+            us = self.rng.uniform(self.a.bcet * t.load, t.load)
+        return us * 1000.0
+
+    def aic_update(self, until):
+        while self.aic_next <= until:
+            self.aic_done.append(self.aic_next)
+            self.aic_next += self.aic_period
+
+    def count_tgm(self, c, now):
+        self.aic_update(now)
+        cnt = bisect.bisect_right(self.aic_done, now)
+        if cnt > c.tgm_cnt:
+            c.tgm_cnt = cnt
+            c.tgm_time = self.aic_done[cnt - 1]
+
+    def run_background(self, c, start, end, slice_idx):
+        if c.bkgd_left > 0.0 and end > start:
+            used = min(c.bkgd_left, end - start)
+            c.bkgd_left -= used
+            if c.bkgd_left <= 0.0:
+                # finished after the previous time slice
+                c.bkgd_done = (slice_idx + self.n - 1) % self.n
+
+    def slice(self, cycle, k, trace):
+        a = self.a
+        ctrl = self.ctrl
+        # TIM1 update IRQ and ISR entry, the IRQ is pending if the last slice was too long
+        arrive = []
+        for c in ctrl:
+            irq = c.clear + (self.reload_ticks - TIM_PRESET_TICKS) * TIM_TICK_NS * c.scale
+            lat = self.rng.uniform(0.0, a.isr_jitter * 1000.0)
+            if c.busy > irq:
+                self.overruns += 1
+                irq = c.busy
+            self.isr_lat.add(lat)
+            self.run_background(c, c.busy, irq + lat, k)
+            arrive.append(irq + lat + a.isr_entry * 1000.0)
+        # GPIO sync, the later controller releases both
+        release = max(arrive) + a.sync_lat * 1000.0
+        for c, t in zip(ctrl, arrive):
+            wait = release - t
+            self.sync_wait.add(wait)
+            if wait > SYNC_TIMEOUT_NS:
+                self.error(cycle, 'GLOB_FAILCODE_IPCS_SYNC_TIMEOUT')
+            c.clear = release
+        if k == 0:
+            trace['start'] = release
+        now = [release + a.sample_ports * 1000.0] * CTRL_CNT
+        ipc_wait_max = 0.0
+        # tasks of the slice in table order, both controllers in lockstep
+        for t in self.tasks:
+            if k not in self.slices[t.name]:
+                continue
+            start = list(now)
+            dur = [self.exec_ns(t) for _ in ctrl]
+            wait = [0.0] * CTRL_CNT
+            for i, c in enumerate(ctrl):
+                other = ctrl[1 - i]
+                if t.name in self.receivers or t.name in self.ipc_exchange:
+                    if t.name in self.ipc_exchange:
+                        # exchange: telegram of the other controller sent at its task start
+                        arrival, ok = start[1 - i] + self.ipc_ns(t), self.crc_ok(t)
+                        timeout = a.ipc_xchg_timeout
+                    else:
+                        arrival, ok = c.rx.pop(t.name, (None, True))
+                        timeout = a.ipc_timeout
+                    if arrival is None:
+                        # no telegram before the first send of the other controller
+                        if cycle > 0:
+                            self.error(cycle, 'IPC telegram missing (%s)' % t.name)
+                    else:
+                        wait[i] = max(0.0, arrival - start[i])
+                        if wait[i] >= timeout * 1000.0:
+                            self.error(cycle, 'GlOB_FAILCODE_IPCX_TIMEOUT (%s)' % t.name)
+                        if not ok:
+                            self.error(cycle, 'IPC CRC error (%s)' % t.name)
+                    self.ipc_wait.add(wait[i])
+                    ipc_wait_max = max(ipc_wait_max, wait[i])
+                if t.name == TASK_SYNC_RX:
+                    self.count_tgm(c, start[i])
+                if t.name == TASK_AIC_RX and c.tgm_cnt > c.tgm_processed:
+                    c.tgm_processed = c.tgm_cnt
+                    if i == 0:
+                        self.aic_rx_lat.add(start[i] - c.tgm_time)
+                        trace['aic_rx'] = (start[i] - c.tgm_time) / 1000.0
+                        trace['tgm'] = c.tgm_time
+                if t.name == TASK_BKGD_TRIGGER:
+                    c.bkgd_left = self.bkgd_ns()
+                    c.bkgd_done = None
+                if t.name == TASK_BKGD_CHECK:
+                    if c.bkgd_left > 0.0:
+                        self.error(cycle, 'background task not finished')
+                        trace['bkgd%d' % (i + 1)] = -1
+                    else:
+                        self.bkgd_slice[c.bkgd_done if c.bkgd_done is not None
+                                        else self.n] += 1
+                        trace['bkgd%d' % (i + 1)] = c.bkgd_done
+                now[i] = start[i] + wait[i] + dur[i]
+                if t.name in TASKS_AIC_TX and i == 0 and trace.get('tgm') is not None:
+                    rsp = now[i] - trace['tgm']
+                    self.aic_rsp_lat.add(rsp)
+                    trace['aic_rsp'] = rsp / 1000.0
+                    if 0.0 < a.aic_deadline * 1000.0 < rsp:
+                        self.error(cycle, 'AIC response deadline missed')
+                if t.name in self.ipc_rx_of:
+                    # telegram to the receiver task of the other controller
+                    other.rx[self.ipc_rx_of[t.name]] = (now[i] + self.ipc_ns(t), self.crc_ok(t))
+        for i, c in enumerate(ctrl):
+            c.busy = now[i] + a.isr_exit * 1000.0
+            self.slice_len[k].add(c.busy - c.clear)
+            trace['slice_max'] = max(trace.get('slice_max', 0.0), (c.busy - c.clear) / 1000.0)
+        trace['ipc_wait'] = max(trace.get('ipc_wait', 0.0), ipc_wait_max / 1000.0)
+
+    @staticmethod
+    def ipc_bits(t):
+        # ID, payload, CRC8, 10 bits per byte
+        return (1 + t.ipc_bytes + 1) * 10
+
+    def ipc_ns(self, t):
+        return self.ipc_bits(t) * 1e9 / IPC_BAUD + self.a.ipc_lat * 1000.0
+
+    def crc_ok(self, t):
+        if self.a.ber <= 0.0:
+            return True
+        return self.rng.random() >= 1.0 - (1.0 - self.a.ber) ** self.ipc_bits(t)
+
+    def bkgd_ns(self):
+        j = self.a.bkgd_jitter
+        return self.a.bkgd * 1000.0 * self.rng.uniform(1.0 - j, 1.0)
+
+    def run(self, out):
+        writer = None
+        if out is not None:
+            writer = csv.writer(out)
+            writer.writerow(['cycle', 'start_us', 'cycle_us', 'slice_max_us', 'ipc_wait_us',
+                             'aic_rx_latency_us', 'aic_rsp_latency_us', 'bkgd_done_slice_1',
+                             'bkgd_done_slice_2', 'errors'])
+        last = None
+        for cycle in range(self.a.cycles):
+            trace = {}
+            err_before = sum(len(v) for v in self.errors.values())
+            for k in range(self.n):
+                self.slice(cycle, k, trace)
+            period = None
+            if last is not None:
+                period = trace['start'] - last
+                self.cycle_len.add(period)
+                if not self.timeout_min <= period <= self.timeout_max:
+                    self.error(cycle, 'scheduler cycle out of range (CheckSchedulerTimeout)')
+            last = trace['start']
+            if writer is not None:
+                writer.writerow([cycle, '%.3f' % (trace['start'] / 1000.0),
+                                 '' if period is None else '%.3f' % (period / 1000.0),
+                                 '%.3f' % trace['slice_max'], '%.3f' % trace['ipc_wait'],
+                                 '%.3f' % trace['aic_rx'] if 'aic_rx' in trace else '',
+                                 '%.3f' % trace['aic_rsp'] if 'aic_rsp' in trace else '',
+                                 trace.get('bkgd1', ''), trace.get('bkgd2', ''),
+                                 sum(len(v) for v in self.errors.values()) - err_before])
+
+    def report(self):
+        a = self.a
+        print('timing model: %s mode, T-cyc %dus, %d cycles, seed %d, exec %s' %
+              (a.mode, a.cycle, a.cycles, a.seed, a.exec))
+        print('  cycle time          %s' % self.cycle_len.text())
+        print('  ISR entry latency   %s' % self.isr_lat.text())
+        print('  sync wait           %s' % self.sync_wait.text())
+        print('  IPC receive wait    %s' % self.ipc_wait.text())
+        print('  AIC RX latency      %s' % self.aic_rx_lat.text())
+        print('  AIC response        %s' % self.aic_rsp_lat.text())
+        print('  slice overruns      %d' % self.overruns)
+        worst = max(range(self.n), key=lambda k: max(self.slice_len[k].values))
+        print('  longest slice       %d: %s' % (worst, self.slice_len[worst].text()))
+        done = ['%d:%d' % (k, n) for k, n in enumerate(self.bkgd_slice[:self.n]) if n]
+        print('  background done in  %s' % (' '.join(done) if done else 'n/a'))
+        if not self.errors:
+            print('  deadline misses     none (modeled)')
+        for text in sorted(self.errors):
+            cycles = self.errors[text]
+            print('  ERROR %-40s %5d x (first in cycle %d)' % (text, len(cycles), cycles[0]))
+        return 1 if self.errors else 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Timing model of the scheduler cycle of both '
+                                             'safety controllers (%s, %s), no firmware code is '
+                                             'executed.' % CTRL_NAMES)
+    ap.add_argument('cfg', nargs='?', default=gen.DEF_CFG)
+    ap.add_argument('--mode', choices=('run', 'startup'), default='run')
+    ap.add_argument('--cycle', type=int, choices=gen.CYCLES_US, default=gen.DEF_CYCLE_US,
+                    help='cycle time GLOBDEF_CYCLE_TIME_US [us]')
+    ap.add_argument('--keep', action='store_true', help='preferred slices, no optimization')
+    ap.add_argument('--measured', help='measured execution times (see sch_SliceGen.py)')
+    ap.add_argument('--cycles', type=int, default=1000)
+    ap.add_argument('--seed', type=int, default=1)
+    ap.add_argument('--trace', help='per cycle trace (CSV)')
+    ap.add_argument('--exec', choices=('wcet', 'uniform'), default='wcet')
+    ap.add_argument('--bcet', type=float, default=0.5, help='best/worst case exec time ratio')
+    ap.add_argument('--ppm1', type=float, default=30.0, help='clock drift controller 1 [ppm]')
+    ap.add_argument('--ppm2', type=float, default=-30.0, help='clock drift controller 2 [ppm]')
+    ap.add_argument('--phase', type=float, default=2.0, help='start offset controller 2 [us]')
+    ap.add_argument('--isr-entry', type=float, default=5.5, help='ISR prologue to sync [us]')
+    ap.add_argument('--isr-jitter', type=float, default=2.0, help='max IRQ entry latency [us]')
+    ap.add_argument('--isr-exit', type=float, default=1.0, help='ISR epilogue [us]')
+    ap.add_argument('--sync-lat', type=float, default=0.5, help='GPIO sync latency [us]')
+    ap.add_argument('--sample-ports', type=float, default=3.0, help='gpio_SamplePorts [us]')
+    ap.add_argument('--ipc-lat', type=float, default=2.0, help='IPC DMA/link latency [us]')
+    ap.add_argument('--ipc-timeout', type=float, default=30.0,
+                    help='IPCXSYS_WAITTIMEOUT [us] (50 with RFID_ACTIVE)')
+    ap.add_argument('--ipc-xchg-timeout', type=float, default=100.0,
+                    help='IPCXSYS_TIMEOUT of an exchange [us]')
+    ap.add_argument('--ber', type=float, default=0.0, help='IPC bit error rate')
+    ap.add_argument('--bkgd', type=float, default=1500.0, help='background task time [us]')
+    ap.add_argument('--bkgd-jitter', type=float, default=0.2, help='background time variation')
+    ap.add_argument('--aic-cycle', type=float, default=0.0,
+                    help='AIC master cycle [us], 0: cycle time')
+    ap.add_argument('--ppm-aic', type=float, default=100.0, help='clock drift AIC master [ppm]')
+    ap.add_argument('--aic-phase', type=float, default=0.0, help='first AIC telegram [us]')
+    ap.add_argument('--aic-bytes', type=int, default=40, help='AIC telegram length [bytes]')
+    ap.add_argument('--aic-deadline', type=float, default=0.0,
+                    help='max. time AIC telegram -> ASM response [us], 0: not checked')
+    args = ap.parse_args()
+
+    try:
+        _, modes, _ = gen.parse_cfg(args.cfg, args.cycle)
+        if args.measured:
+            gen.read_measured(args.measured, modes)
+        sim = Sim(args, modes[args.mode])
+    except (gen.CfgError, IOError, ValueError) as e:
+        sys.stderr.write('sch_TimingModel: %s\n' % e)
+        return 2
+
+    if args.trace:
+        with open(args.trace, 'w') as f:
+            sim.run(f)
+    else:
+        sim.run(None)
+    return sim.report()
+
+
+if __name__ == '__main__':
+    sys.exit(main())